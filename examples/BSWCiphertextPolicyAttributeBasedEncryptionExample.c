@@ -56,7 +56,9 @@ int main() {
       malloc(
           sizeof(bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary));
 
-  if (CRYPTID_SUCCESS != cryptid_abe_bsw_setup(publicKey, masterKey, LOWEST)) {
+  if (CRYPTID_SUCCESS !=
+      cryptid_abe_bsw_setupForPairingGroup(publicKey, masterKey, LOWEST,
+                                           pairingGroup_BLS12_381)) {
     printf("Setup failed\n");
     return -1;
   }
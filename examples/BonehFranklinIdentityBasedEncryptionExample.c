@@ -17,8 +17,9 @@ int main() {
   BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary *masterSecret =
       malloc(sizeof(BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary));
 
-  if (CRYPTID_SUCCESS !=
-      cryptid_ibe_bonehFranklin_setup(masterSecret, publicParameters, LOWEST)) {
+  if (CRYPTID_SUCCESS != cryptid_ibe_bonehFranklin_setupForPairingGroup(
+                             masterSecret, publicParameters, LOWEST,
+                             pairingGroup_BLS12_381)) {
     printf("Setup failed\n");
     return -1;
   }
@@ -32,7 +33,8 @@ int main() {
     return -1;
   }
 
-  AffinePointAsBinary *privateKey = malloc(sizeof(AffinePointAsBinary));
+  PairingGroupElementAsBinary *privateKey =
+      malloc(sizeof(PairingGroupElementAsBinary));
   if (CRYPTID_SUCCESS !=
       cryptid_ibe_bonehFranklin_extract(privateKey, identity, strlen(identity),
                                         *masterSecret, *publicParameters)) {
@@ -53,7 +55,7 @@ int main() {
   free(plaintext);
   bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_destroy(*ciphertext);
   free(ciphertext);
-  affineAsBinary_destroy(*privateKey);
+  pairingGroupElementAsBinary_destroy(*privateKey);
   free(privateKey);
   free(masterSecret->masterSecret);
   free(masterSecret);
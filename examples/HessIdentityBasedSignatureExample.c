@@ -16,13 +16,15 @@ int main() {
   HessIdentityBasedSignatureMasterSecretAsBinary *masterSecret =
       malloc(sizeof(HessIdentityBasedSignatureMasterSecretAsBinary));
 
-  if (CRYPTID_SUCCESS !=
-      cryptid_ibs_hess_setup(masterSecret, publicParameters, LOWEST)) {
+  if (CRYPTID_SUCCESS != cryptid_ibs_hess_setupForPairingGroup(
+                             masterSecret, publicParameters, LOWEST,
+                             pairingGroup_BLS12_381)) {
     printf("Setup failed\n");
     return -1;
   }
 
-  AffinePointAsBinary *privateKey = malloc(sizeof(AffinePointAsBinary));
+  PairingGroupElementAsBinary *privateKey =
+      malloc(sizeof(PairingGroupElementAsBinary));
   if (CRYPTID_SUCCESS !=
       cryptid_ibs_hess_extract(privateKey, identity, strlen(identity),
                                *masterSecret, *publicParameters)) {
@@ -50,7 +52,7 @@ int main() {
 
   hessIdentityBasedSignatureSignatureAsBinary_destroy(*signature);
   free(signature);
-  affineAsBinary_destroy(*privateKey);
+  pairingGroupElementAsBinary_destroy(*privateKey);
   free(privateKey);
   free(masterSecret->masterSecret);
   free(masterSecret);
@@ -0,0 +1,126 @@
+//How to build: ./task.sh build && gcc examples/TatePairingBatchBenchmark.c build/libcryptid.a -I/mnt/c/Users/vecsi/Documents/CryptID/cryptid-native/include -D__CRYPTID_GMP -std=c99 -Wall -Wextra -Werror -lgmp -lm
+//Usage: ./a.out [number of pairings] [highest security level (0-4)]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "elliptic/TatePairing.h"
+#include "util/PrimalityTest.h"
+#include "util/Random.h"
+#include "util/SecurityLevel.h"
+
+// Same as in the Boneh-Franklin setup.
+static const unsigned int Q_LENGTH_MAPPING[] = {160, 224, 256, 384, 512};
+static const unsigned int P_LENGTH_MAPPING[] = {512, 1024, 1536, 3840, 7680};
+static const char *LEVEL_NAMES[] = {"LOWEST", "LOW", "MEDIUM", "HIGH",
+                                    "HIGHEST"};
+
+static double millisecondsSince(const clock_t start) {
+  return 1000.0 * (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char **argv) {
+  const size_t count = argc > 1 ? (size_t)atoi(argv[1]) : 64;
+  const int highestLevel = argc > 2 ? atoi(argv[2]) : (int)MEDIUM;
+
+  if (count == 0 || highestLevel < (int)LOWEST ||
+      highestLevel > (int)HIGHEST) {
+    printf("Invalid arguments\n");
+    return -1;
+  }
+
+  printf("%-8s %8s %16s %16s\n", "level", "count", "sequential (ms)",
+         "batch (ms)");
+
+  for (int level = (int)LOWEST; level <= highestLevel; ++level) {
+    // A curve like the one of the Boneh-Franklin setup.
+    mpz_t q, r, p, zero, one, cofactor, scalar;
+    mpz_inits(q, r, p, cofactor, scalar, NULL);
+    mpz_init_set_ui(zero, 0);
+    mpz_init_set_ui(one, 1);
+
+    if (random_solinasPrime(q, Q_LENGTH_MAPPING[level], 100)) {
+      printf("Solinas prime generation failed\n");
+      return -1;
+    }
+
+    const unsigned int lengthOfR =
+        P_LENGTH_MAPPING[level] - Q_LENGTH_MAPPING[level] - 3;
+    do {
+      random_mpzOfLength(r, lengthOfR);
+      mpz_mul_ui(p, r, 12);
+      mpz_mul(p, p, q);
+      mpz_sub_ui(p, p, 1);
+    } while (!primalityTest_isProbablePrime(p));
+
+    EllipticCurve ec;
+    ellipticCurve_init(&ec, zero, one, p);
+    mpz_mul_ui(cofactor, r, 12);
+
+    EllipticCurveContext context;
+    if (ellipticCurveContext_init(&context, ec, q)) {
+      printf("Context initialization failed\n");
+      return -1;
+    }
+
+    AffinePoint generator;
+    do {
+      AffinePoint point;
+      if (random_affinePoint(&point, ec, 100) ||
+          affine_wNAFMultiply(&generator, point, cofactor, &context)) {
+        printf("Point generation failed\n");
+        return -1;
+      }
+      affine_destroy(point);
+    } while (affine_isInfinity(generator));
+
+    AffinePoint *ps = malloc(count * sizeof(AffinePoint));
+    AffinePoint *bs = malloc(count * sizeof(AffinePoint));
+    Complex *results = malloc(count * sizeof(Complex));
+    for (size_t i = 0; i < count; ++i) {
+      random_mpzInRange(scalar, q);
+      affine_wNAFMultiply(&ps[i], generator, scalar, &context);
+      random_mpzInRange(scalar, q);
+      affine_wNAFMultiply(&bs[i], generator, scalar, &context);
+    }
+
+    clock_t start = clock();
+    for (size_t i = 0; i < count; ++i) {
+      if (tate_performPairing(&results[i], ps[i], bs[i], &context)) {
+        printf("Pairing failed\n");
+        return -1;
+      }
+    }
+    const double sequential = millisecondsSince(start);
+
+    for (size_t i = 0; i < count; ++i) {
+      complex_destroy(results[i]);
+    }
+
+    start = clock();
+    if (tate_performPairingBatch(results, ps, bs, count, &context)) {
+      printf("Batch pairing failed\n");
+      return -1;
+    }
+    const double batch = millisecondsSince(start);
+
+    printf("%-8s %8zu %16.2f %16.2f\n", LEVEL_NAMES[level], count, sequential,
+           batch);
+
+    for (size_t i = 0; i < count; ++i) {
+      complex_destroy(results[i]);
+      affine_destroy(ps[i]);
+      affine_destroy(bs[i]);
+    }
+    free(ps);
+    free(bs);
+    free(results);
+    affine_destroy(generator);
+    ellipticCurveContext_destroy(context);
+    ellipticCurve_destroy(ec);
+    mpz_clears(q, r, p, zero, one, cofactor, scalar, NULL);
+  }
+
+  return 0;
+}
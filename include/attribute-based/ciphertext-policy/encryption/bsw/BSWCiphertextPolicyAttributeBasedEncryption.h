@@ -3,7 +3,6 @@
 #include "gmp.h"
 
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary.h"
-#include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionDefines.h"
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionEncryptedMessage.h"
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary.h"
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionMasterKey.h"
@@ -11,7 +10,7 @@
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionPolynom.h"
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary.h"
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionUtils.h"
-#include "elliptic/AffinePoint.h"
+#include "pairing/PairingGroupType.h"
 #include "util/Random.h"
 #include "util/SecurityLevel.h"
 #include "util/Status.h"
@@ -23,6 +22,18 @@ CryptidStatus cryptid_abe_bsw_setup(
         *masterkeyAsBinary,
     const SecurityLevel securityLevel);
 
+// Same as cryptid_abe_bsw_setup, on the selected pairing group. The d and dJ
+// components of the secret keys and the hashed attributes are elements of G1,
+// while h, c, the cY values of the access tree and the dJa components of the
+// secret keys are elements of G2. pairingGroup_BLS12_381 supports the security
+// levels up to MEDIUM.
+CryptidStatus cryptid_abe_bsw_setupForPairingGroup(
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary
+        *publickeyAsBinary,
+    bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary
+        *masterkeyAsBinary,
+    const SecurityLevel securityLevel, const PairingGroupType pairingGroupType);
+
 CryptidStatus cryptid_abe_bsw_encrypt(
     bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary
         *encryptedAsBinary,
@@ -2,7 +2,7 @@
 #define __CRYPTID_BSW_CIPHERTEXT_POLICY_ATTRIBUTE_BASED_ENCRYPTION_ACCESS_TREE_H
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionPolynom.h"
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionUtils.h"
-#include "elliptic/AffinePoint.h"
+#include "pairing/PairingGroupElement.h"
 #include "util/Utils.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -15,8 +15,8 @@ typedef struct bswCiphertextPolicyAttributeBasedEncryptionAccessTree {
   int numChildren;
   char *attribute;
   size_t attributeLength;
-  AffinePoint cY;
-  AffinePoint cYa;
+  PairingGroupElement cY;  // in G2
+  PairingGroupElement cYa; // in G1
 } bswCiphertextPolicyAttributeBasedEncryptionAccessTree;
 
 bswCiphertextPolicyAttributeBasedEncryptionAccessTree *
@@ -4,8 +4,8 @@
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionAccessTree.h"
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionPolynom.h"
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionUtils.h"
-#include "elliptic/AffinePoint.h"
-#include "elliptic/AffinePointAsBinary.h"
+#include "pairing/PairingGroup.h"
+#include "pairing/PairingGroupElementAsBinary.h"
 #include "util/Utils.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -19,8 +19,8 @@ typedef struct bswCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary {
   void *attribute;
   int numChildren;
   size_t attributeLength;
-  AffinePointAsBinary cY;
-  AffinePointAsBinary cYa;
+  PairingGroupElementAsBinary cY;
+  PairingGroupElementAsBinary cYa;
 } bswCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary;
 
 bswCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary *
@@ -32,14 +32,20 @@ void bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary
         *accessTreeAsBinary);
 
-void bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionAccessTree(
+// Reads the tree with the computed values in group. Returns
+// CRYPTID_ILLEGAL_CIPHERTEXT_ERROR if a computed value is invalid, in which
+// case everything but accessTree itself is freed.
+CryptidStatus
+bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionAccessTree(
     bswCiphertextPolicyAttributeBasedEncryptionAccessTree *accessTree,
     const bswCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary
-        *accessTreeAsBinary);
+        *accessTreeAsBinary,
+    const PairingGroup *group);
 
 void bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionAccessTree(
     bswCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary
         *accessTreeAsBinary,
-    const bswCiphertextPolicyAttributeBasedEncryptionAccessTree *accessTree);
+    const bswCiphertextPolicyAttributeBasedEncryptionAccessTree *accessTree,
+    const PairingGroup *group);
 
 #endif
\ No newline at end of file
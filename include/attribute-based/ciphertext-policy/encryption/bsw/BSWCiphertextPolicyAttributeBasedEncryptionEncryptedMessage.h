@@ -1,24 +1,20 @@
-
 #ifndef __CRYPTID_BSW_CIPHERTEXT_POLICY_ATTRIBUTE_BASED_ENCRYPTION_ENCRYPTEDMESSAGE_ABE_H
 #define __CRYPTID_BSW_CIPHERTEXT_POLICY_ATTRIBUTE_BASED_ENCRYPTION_ENCRYPTEDMESSAGE_ABE_H
 
+#include <stddef.h>
+
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionAccessTree.h"
-#include "complex/Complex.h"
-#include "elliptic/AffinePoint.h"
+#include "pairing/PairingGroupElement.h"
 #include "gmp.h"
 
-typedef struct bswCiphertextPolicyAttributeBasedEncryptionCtildeSet {
-  Complex cTilde;
-  struct bswCiphertextPolicyAttributeBasedEncryptionCtildeSet *cTildeSet;
-  CtildeSetState last;
-} bswCiphertextPolicyAttributeBasedEncryptionCtildeSet;
-
 typedef struct bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage {
   bswCiphertextPolicyAttributeBasedEncryptionAccessTree *tree;
-  bswCiphertextPolicyAttributeBasedEncryptionCtildeSet *cTildeSet;
-  AffinePoint c;
+  unsigned char *cTilde; // the message masked by a hash of eggalpha^s
+  size_t cTildeLength;
+  PairingGroupElement c; // h^s, in G2
 } bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage;
 
+// Frees the message, but not its tree, which should be destroyed separately.
 void bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage *encrypted);
 
@@ -1,49 +1,40 @@
-
 #ifndef __CRYPTID_BSW_CIPHERTEXT_POLICY_ATTRIBUTE_BASED_ENCRYPTION_ENCRYPTEDMESSAGE_AS_BINARY_ABE_H
 #define __CRYPTID_BSW_CIPHERTEXT_POLICY_ATTRIBUTE_BASED_ENCRYPTION_ENCRYPTEDMESSAGE_AS_BINARY_ABE_H
 
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary.h"
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionEncryptedMessage.h"
-#include "complex/ComplexAsBinary.h"
-
-typedef struct bswCiphertextPolicyAttributeBasedEncryptionCtildeSetAsBinary {
-  ComplexAsBinary cTilde;
-  struct bswCiphertextPolicyAttributeBasedEncryptionCtildeSetAsBinary
-      *cTildeSet;
-  CtildeSetState last;
-} bswCiphertextPolicyAttributeBasedEncryptionCtildeSetAsBinary;
+#include "pairing/PairingGroup.h"
+#include "pairing/PairingGroupElementAsBinary.h"
+#include "util/Status.h"
 
 typedef struct
     bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary {
   bswCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary *tree;
-  bswCiphertextPolicyAttributeBasedEncryptionCtildeSetAsBinary *cTildeSet;
-  AffinePointAsBinary c;
+  void *cTilde;
+  size_t cTildeLength;
+  PairingGroupElementAsBinary c;
 } bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary;
 
 void bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary
         *encrypted);
 
-void bswCiphertextPolicyAttributeBasedEncryptionCtildeSetAsBinary_toBswCiphertextPolicyAttributeBasedEncryptionCtildeSet(
-    bswCiphertextPolicyAttributeBasedEncryptionCtildeSet *ctildeSet,
-    const bswCiphertextPolicyAttributeBasedEncryptionCtildeSetAsBinary
-        *ctildeSetAsBinary);
-
-void bswCiphertextPolicyAttributeBasedEncryptionCtildeSetAsBinary_fromBswCiphertextPolicyAttributeBasedEncryptionCtildeSet(
-    bswCiphertextPolicyAttributeBasedEncryptionCtildeSetAsBinary
-        *ctildeSetAsBinary,
-    const bswCiphertextPolicyAttributeBasedEncryptionCtildeSet *ctildeSet);
-
-void bswChiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionEncryptedMessage(
+// Reads the message with the tree and c in group. Returns
+// CRYPTID_ILLEGAL_CIPHERTEXT_ERROR if one of them is invalid. On
+// CRYPTID_SUCCESS, the tree and the message should be destroyed by the caller.
+CryptidStatus
+bswChiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionEncryptedMessage(
     bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage
         *encryptedMessage,
     const bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary
-        *encryptedMessageAsBinary);
+        *encryptedMessageAsBinary,
+    const PairingGroup *group);
 
 void bswChiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionEncryptedMessage(
     bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary
         *encryptedMessageAsBinary,
     const bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage
-        *encryptedMessage);
+        *encryptedMessage,
+    const PairingGroup *group);
 
 #endif
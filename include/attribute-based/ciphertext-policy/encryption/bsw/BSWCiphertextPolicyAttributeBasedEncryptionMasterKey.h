@@ -3,17 +3,14 @@
 
 #include "gmp.h"
 
-#include "elliptic/AffinePoint.h"
-#include "elliptic/EllipticCurve.h"
-#include "elliptic/TatePairing.h"
-#include "util/HashFunction.h"
+#include "pairing/PairingGroupElement.h"
 
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionPublicKey.h"
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionSecretKey.h"
 
 typedef struct bswCiphertextPolicyAttributeBasedEncryptionMasterKey {
   mpz_t beta;
-  AffinePoint g_alpha;
+  PairingGroupElement g_alpha; // g1^alpha
   bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey;
 } bswCiphertextPolicyAttributeBasedEncryptionMasterKey;
 
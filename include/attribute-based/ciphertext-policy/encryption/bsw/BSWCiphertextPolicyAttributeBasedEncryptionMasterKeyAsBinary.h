@@ -3,20 +3,26 @@
 
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionMasterKey.h"
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary.h"
-#include "elliptic/AffinePointAsBinary.h"
+#include "pairing/PairingGroupElementAsBinary.h"
+#include "util/Status.h"
 #include <stdio.h>
 
 typedef struct bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary {
   void *beta;
   size_t betaLength;
-  AffinePointAsBinary g_alpha;
+  PairingGroupElementAsBinary g_alpha;
   bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary *publickey;
 } bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary;
 
 void bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary *masterkey);
 
-void bswChiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionMasterKey(
+// Reads the public key of the master key, and g_alpha in its group. Returns
+// the error of the public key, or CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR if
+// g_alpha is invalid. On CRYPTID_SUCCESS, the public key and the master key
+// should be destroyed by the caller.
+CryptidStatus
+bswChiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionMasterKey(
     bswCiphertextPolicyAttributeBasedEncryptionMasterKey *masterKey,
     const bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary
         *masterKeyAsBinary);
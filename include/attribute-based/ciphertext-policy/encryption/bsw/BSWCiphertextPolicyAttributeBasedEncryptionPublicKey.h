@@ -3,22 +3,30 @@
 
 #include "gmp.h"
 
-#include "elliptic/AffinePoint.h"
 #include "elliptic/EllipticCurve.h"
-#include "elliptic/TatePairing.h"
+#include "pairing/PairingGroup.h"
 #include "util/HashFunction.h"
 
 typedef struct bswCiphertextPolicyAttributeBasedEncryptionPublicKey {
-  EllipticCurve ellipticCurve; // G0
-  AffinePoint g;               // generator of cyclic group
-  AffinePoint h;               // g^(beta)
-  AffinePoint f;               // g^(1/beta)
-  Complex eggalpha;            // e(g, g)^alpha
-  HashFunction hashFunction;
+  PairingGroupType pairingGroupType;
+  EllipticCurve ellipticCurve; // holds G1, see pairingGroup_describe
   mpz_t q;
+  PairingGroupElement g1;       // generator of G1
+  PairingGroupElement g2;       // generator of G2
+  PairingGroupElement h;        // g2^(beta)
+  PairingGroupElement f;        // g1^(1/beta)
+  PairingGroupElement eggalpha; // e(g1, g2)^alpha
+  HashFunction hashFunction;
+  PairingGroup group; // acquired for the key, released by destroy
 } bswCiphertextPolicyAttributeBasedEncryptionPublicKey;
 
 void bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey);
 
+// Builds the fixed-base table of g2, so that the subsequent multiplications of
+// g2 are cheaper. Only pays off for operations that multiply g2 for every leaf
+// of an access tree or every attribute of a key.
+CryptidStatus bswCiphertextPolicyAttributeBasedEncryptionPublicKey_prepare(
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey);
+
 #endif
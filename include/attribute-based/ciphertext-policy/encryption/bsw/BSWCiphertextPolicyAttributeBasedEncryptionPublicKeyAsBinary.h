@@ -2,17 +2,19 @@
 #define __CRYPTID_BSW_CIPHERTEXT_POLICY_ATTRIBUTE_BASED_ENCRYPTION_PUBLICKEY_AS_BINARY_ABE_H
 
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionPublicKey.h"
-#include "complex/ComplexAsBinary.h"
-#include "elliptic/AffinePointAsBinary.h"
 #include "elliptic/EllipticCurveAsBinary.h"
+#include "pairing/PairingGroupElementAsBinary.h"
+#include "util/Status.h"
 #include <stdlib.h>
 
 typedef struct bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary {
-  EllipticCurveAsBinary ellipticCurve; // G0
-  AffinePointAsBinary g;               // generator of cyclic group
-  AffinePointAsBinary h;               // g^(beta)
-  AffinePointAsBinary f;               // g^(1/beta)
-  ComplexAsBinary eggalpha;            // e(g, g)^alpha
+  PairingGroupType pairingGroupType;
+  EllipticCurveAsBinary ellipticCurve;  // holds G1
+  PairingGroupElementAsBinary g1;       // generator of G1
+  PairingGroupElementAsBinary g2;       // generator of G2
+  PairingGroupElementAsBinary h;        // g2^(beta)
+  PairingGroupElementAsBinary f;        // g1^(1/beta)
+  PairingGroupElementAsBinary eggalpha; // e(g1, g2)^alpha
   HashFunction hashFunction;
   void *q;
   size_t qLength;
@@ -21,7 +23,12 @@ typedef struct bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary {
 void bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary *publicKey);
 
-void bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
+// Acquires the pairing group the key records, validating its curve and order,
+// and reads the elements of the key in it. Returns
+// CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR if an element is invalid. On
+// CRYPTID_SUCCESS, the key should be destroyed by the caller.
+CryptidStatus
+bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
     bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publicKey,
     const bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary
         *publicKeyAsBinary);
@@ -1,14 +1,13 @@
 #ifndef __CRYPTID_BSW_CIPHERTEXT_POLICY_ATTRIBUTE_BASED_ENCRYPTION_SECRETKEY_ABE_H
 #define __CRYPTID_BSW_CIPHERTEXT_POLICY_ATTRIBUTE_BASED_ENCRYPTION_SECRETKEY_ABE_H
-#include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionDefines.h"
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionPublicKey.h"
-#include "elliptic/AffinePoint.h"
+#include "pairing/PairingGroupElement.h"
 #include "gmp.h"
 
 typedef struct bswCiphertextPolicyAttributeBasedEncryptionSecretKey {
-  AffinePoint d;
-  AffinePoint *dJ;
-  AffinePoint *dJa;
+  PairingGroupElement d;    // in G1
+  PairingGroupElement *dJ;  // in G1
+  PairingGroupElement *dJa; // in G2
   char **attributes;
   int numAttributes;
   bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey;
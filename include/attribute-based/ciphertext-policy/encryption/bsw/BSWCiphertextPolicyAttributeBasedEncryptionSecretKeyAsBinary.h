@@ -2,13 +2,14 @@
 #define __CRYPTID_BSW_CIPHERTEXT_POLICY_ATTRIBUTE_BASED_ENCRYPTION_SECRETKEY_AS_BINARY_ABE_H
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary.h"
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryptionSecretKey.h"
-#include "elliptic/AffinePointAsBinary.h"
+#include "pairing/PairingGroupElementAsBinary.h"
+#include "util/Status.h"
 #include <string.h>
 
 typedef struct bswCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary {
-  AffinePointAsBinary d;
-  AffinePointAsBinary *dJ;
-  AffinePointAsBinary *dJa;
+  PairingGroupElementAsBinary d;
+  PairingGroupElementAsBinary *dJ;
+  PairingGroupElementAsBinary *dJa;
   void **attributes;
   int *attributeLengths;
   int numAttributes;
@@ -18,7 +19,12 @@ typedef struct bswCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary {
 void bswCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary *secretkey);
 
-void bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionSecretKey(
+// Reads the public key of the secret key, and the components in its group.
+// Returns the error of the public key, or CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR
+// if a component is invalid. On CRYPTID_SUCCESS, the public key and the
+// secret key should be destroyed by the caller.
+CryptidStatus
+bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionSecretKey(
     bswCiphertextPolicyAttributeBasedEncryptionSecretKey *secretKey,
     const bswCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary
         *secretKeyAsBinary);
@@ -0,0 +1,336 @@
+#ifndef __CRYPTID_BLS12381_H
+#define __CRYPTID_BLS12381_H
+
+#include <stddef.h>
+
+#include "gmp.h"
+
+#include "bls12-381/Bls12381Context.h"
+#include "bls12-381/Fp12Element.h"
+#include "bls12-381/TwistAffinePoint.h"
+#include "elliptic/FieldAffinePoint.h"
+#include "util/HashFunction.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * The length of the uncompressed binary representation of a \f$G_1\f$
+ * element.
+ */
+#define BLS12381_G1_BINARY_LENGTH 96
+
+/**
+ * ## Description
+ *
+ * The length of the uncompressed binary representation of a \f$G_2\f$
+ * element.
+ */
+#define BLS12381_G2_BINARY_LENGTH 192
+
+/**
+ * ## Description
+ *
+ * The length of the binary representation of a \f$G_T\f$ element.
+ */
+#define BLS12381_GT_BINARY_LENGTH 576
+
+/**
+ * ## Description
+ *
+ * Checks whether a point is an element of \f$G_1\f$, that is, it lies on
+ * \f$E\f$ and its order divides \f$r\f$.
+ *
+ * ## Parameters
+ *
+ *   * point
+ *     * The point to check.
+ *   * context
+ *     * The BLS12-381 context.
+ *
+ * ## Return Value
+ *
+ * 1 if the point is an element of \f$G_1\f$, 0 otherwise.
+ */
+int bls12381_g1IsValid(const FieldAffinePoint *point,
+                       const Bls12381Context *context);
+
+/**
+ * ## Description
+ *
+ * Checks whether a point is an element of \f$G_2\f$, that is, it lies on
+ * \f$E^{\prime}\f$ and its order divides \f$r\f$.
+ *
+ * ## Parameters
+ *
+ *   * point
+ *     * The point to check.
+ *   * context
+ *     * The BLS12-381 context.
+ *
+ * ## Return Value
+ *
+ * 1 if the point is an element of \f$G_2\f$, 0 otherwise.
+ */
+int bls12381_g2IsValid(const TwistAffinePoint *point,
+                       const Bls12381Context *context);
+
+/**
+ * ## Description
+ *
+ * Checks whether an element of \f$F_{p^{12}}\f$ is an element of \f$G_T\f$,
+ * that is, it lies in the cyclotomic subgroup and its order divides \f$r\f$.
+ *
+ * ## Parameters
+ *
+ *   * element
+ *     * The element to check.
+ *   * context
+ *     * The BLS12-381 context.
+ *
+ * ## Return Value
+ *
+ * 1 if the element is an element of \f$G_T\f$, 0 otherwise.
+ */
+int bls12381_gtIsValid(const Fp12Element *element,
+                       const Bls12381Context *context);
+
+/**
+ * ## Description
+ *
+ * Multiplies a point of \f$E(F_p)\f$ by a scalar, accumulating in Jacobian
+ * coordinates.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The result of the multiplication.
+ *   * point
+ *     * The point to multiply.
+ *   * scalar
+ *     * The scalar, which may be negative.
+ *   * context
+ *     * The BLS12-381 context.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus bls12381_g1Multiply(FieldAffinePoint *result,
+                                  const FieldAffinePoint *point,
+                                  const mpz_t scalar,
+                                  const Bls12381Context *context);
+
+/**
+ * ## Description
+ *
+ * Computes the optimal ate pairing \f$e(P, Q)\f$ of BLS12-381: the Miller
+ * function \f$f_{|x|, Q}(P)\f$, conjugated as \f$x\f$ is negative, raised to
+ * \f$\frac{p^{12} - 1}{r}\f$. The pairing of the point at infinity with
+ * anything is one.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The value of the pairing.
+ *   * p
+ *     * An element of \f$G_1\f$.
+ *   * q
+ *     * An element of \f$G_2\f$.
+ *   * context
+ *     * The BLS12-381 context.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus bls12381_performPairing(Fp12Element *result,
+                                      const FieldAffinePoint *p,
+                                      const TwistAffinePoint *q,
+                                      const Bls12381Context *context);
+
+/**
+ * ## Description
+ *
+ * Raises an element of \f$G_T\f$ to a power with a windowed NAF. As
+ * \f$G_T\f$ lies in the cyclotomic subgroup, negative exponents take the
+ * conjugate of the base. The result may alias the base.
+ *
+ * ## Parameters
+ *
+ *   * power
+ *     * The result of the exponentiation.
+ *   * base
+ *     * An element of \f$G_T\f$.
+ *   * exponent
+ *     * The exponent, which may be negative.
+ *   * context
+ *     * The BLS12-381 context.
+ */
+void bls12381_gtPow(Fp12Element *power, const Fp12Element *base,
+                    const mpz_t exponent, const Bls12381Context *context);
+
+/**
+ * ## Description
+ *
+ * Hashes a message to an element of \f$G_1\f$ by try-and-increment: the
+ * first candidate \f$x = \mathrm{HashToRange}(m || c, p)\f$ with a one octet
+ * counter \f$c\f$ for which \f$x^3 + 4\f$ is a square gives a point, whose
+ * cofactor is then cleared.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The resulting element of \f$G_1\f$.
+ *   * message
+ *     * The message to hash.
+ *   * messageLength
+ *     * The length of the message.
+ *   * hashFunction
+ *     * The hash function to use.
+ *   * context
+ *     * The BLS12-381 context.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right,
+ * CRYPTID_ATTEMPT_LIMIT_REACHED_ERROR if none of the counters gave a point.
+ */
+CryptidStatus bls12381_hashToG1(FieldAffinePoint *result,
+                                const unsigned char *const message,
+                                const size_t messageLength,
+                                const HashFunction hashFunction,
+                                const Bls12381Context *context);
+
+/**
+ * ## Description
+ *
+ * Writes the uncompressed binary representation of a \f$G_1\f$ element: the
+ * big-endian \f$x\f$ and \f$y\f$ coordinates of 48 octets each. The point at
+ * infinity is all zeros but for the infinity flag 0x40 in the first octet.
+ *
+ * ## Parameters
+ *
+ *   * output
+ *     * Buffer of BLS12381_G1_BINARY_LENGTH octets.
+ *   * point
+ *     * The point to write.
+ *   * context
+ *     * The BLS12-381 context.
+ */
+void bls12381_g1ToBinary(unsigned char *output, const FieldAffinePoint *point,
+                         const Bls12381Context *context);
+
+/**
+ * ## Description
+ *
+ * Reads the representation written by {@code bls12381_g1ToBinary}, checking
+ * that it encodes an element of \f$G_1\f$.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The point read.
+ *   * input
+ *     * Buffer of BLS12381_G1_BINARY_LENGTH octets.
+ *   * context
+ *     * The BLS12-381 context.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right,
+ * CRYPTID_ILLEGAL_POINT_ENCODING_ERROR if the input is not a valid encoding.
+ */
+CryptidStatus bls12381_g1FromBinary(FieldAffinePoint *result,
+                                    const unsigned char *const input,
+                                    const Bls12381Context *context);
+
+/**
+ * ## Description
+ *
+ * Writes the uncompressed binary representation of a \f$G_2\f$ element: the
+ * imaginary and real parts of \f$x\f$, then those of \f$y\f$, as big-endian
+ * integers of 48 octets each. The point at infinity is encoded like in
+ * {@code bls12381_g1ToBinary}.
+ *
+ * ## Parameters
+ *
+ *   * output
+ *     * Buffer of BLS12381_G2_BINARY_LENGTH octets.
+ *   * point
+ *     * The point to write.
+ *   * context
+ *     * The BLS12-381 context.
+ */
+void bls12381_g2ToBinary(unsigned char *output, const TwistAffinePoint *point,
+                         const Bls12381Context *context);
+
+/**
+ * ## Description
+ *
+ * Reads the representation written by {@code bls12381_g2ToBinary}, checking
+ * that it encodes an element of \f$G_2\f$.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The point read.
+ *   * input
+ *     * Buffer of BLS12381_G2_BINARY_LENGTH octets.
+ *   * context
+ *     * The BLS12-381 context.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right,
+ * CRYPTID_ILLEGAL_POINT_ENCODING_ERROR if the input is not a valid encoding.
+ */
+CryptidStatus bls12381_g2FromBinary(TwistAffinePoint *result,
+                                    const unsigned char *const input,
+                                    const Bls12381Context *context);
+
+/**
+ * ## Description
+ *
+ * Writes the binary representation of a \f$G_T\f$ element: the coefficients
+ * of \f$F_{p^{12}}\f$ from \f$c_0\f$ to \f$c_1\f$, each of \f$F_{p^6}\f$
+ * from \f$c_0\f$ to \f$c_2\f$, and each of \f$F_{p^2}\f$ encoded like the
+ * coordinates in {@code bls12381_g2ToBinary}.
+ *
+ * ## Parameters
+ *
+ *   * output
+ *     * Buffer of BLS12381_GT_BINARY_LENGTH octets.
+ *   * element
+ *     * The element to write.
+ *   * context
+ *     * The BLS12-381 context.
+ */
+void bls12381_gtToBinary(unsigned char *output, const Fp12Element *element,
+                         const Bls12381Context *context);
+
+/**
+ * ## Description
+ *
+ * Reads the representation written by {@code bls12381_gtToBinary}, checking
+ * that it encodes an element of \f$G_T\f$.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The element read.
+ *   * input
+ *     * Buffer of BLS12381_GT_BINARY_LENGTH octets.
+ *   * context
+ *     * The BLS12-381 context.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right,
+ * CRYPTID_ILLEGAL_POINT_ENCODING_ERROR if the input is not a valid encoding.
+ */
+CryptidStatus bls12381_gtFromBinary(Fp12Element *result,
+                                    const unsigned char *const input,
+                                    const Bls12381Context *context);
+
+#endif
@@ -0,0 +1,174 @@
+#ifndef __CRYPTID_BLS12381CONTEXT_H
+#define __CRYPTID_BLS12381CONTEXT_H
+
+#include <stddef.h>
+
+#include "gmp.h"
+
+#include "bls12-381/TwistAffinePoint.h"
+#include "complex/ComplexFieldElement.h"
+#include "elliptic/FieldAffinePoint.h"
+#include "field/FieldElement.h"
+#include "field/MontgomeryContext.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * The parameters of the BLS12-381 curve and the constants derived from them.
+ * The curve \f$E : y^2 = x^3 + 4\f$ over \f$F_p\f$ holds \f$G_1\f$, its sextic
+ * twist \f$E^{\prime} : y^2 = x^3 + 4(1 + i)\f$ over \f$F_{p^2}\f$ holds
+ * \f$G_2\f$, and \f$G_T\f$ is the subgroup of order \f$r\f$ in
+ * \f$F_{p^{12}}^{*}\f$.
+ */
+typedef struct Bls12381Context {
+  /**
+   * ## Description
+   *
+   * The curve parameter \f$x = -\mathrm{0xd201000000010000}\f$.
+   */
+  mpz_t x;
+
+  /**
+   * ## Description
+   *
+   * The order \f$p = \frac{(x - 1)^2 (x^4 - x^2 + 1)}{3} + x\f$ of the base
+   * field.
+   */
+  mpz_t fieldOrder;
+
+  /**
+   * ## Description
+   *
+   * The prime order \f$r = x^4 - x^2 + 1\f$ of \f$G_1\f$, \f$G_2\f$ and
+   * \f$G_T\f$.
+   */
+  mpz_t groupOrder;
+
+  /**
+   * ## Description
+   *
+   * The cofactor \f$\frac{(x - 1)^2}{3}\f$ of \f$G_1\f$ in \f$E(F_p)\f$.
+   */
+  mpz_t g1Cofactor;
+
+  /**
+   * ## Description
+   *
+   * The exponent \f$\frac{p + 1}{4}\f$ taking square roots in \f$F_p\f$.
+   */
+  mpz_t squareRootExponent;
+
+  /**
+   * ## Description
+   *
+   * Montgomery arithmetic constants of the base field.
+   */
+  MontgomeryContext montgomeryContext;
+
+  /**
+   * ## Description
+   *
+   * The storage the field elements of the constants below are views into.
+   */
+  mp_limb_t *limbs;
+
+  /**
+   * ## Description
+   *
+   * The coefficient \f$a = 0\f$ of both curves, for the generic point
+   * formulas.
+   */
+  FieldElement *curveA;
+
+  /**
+   * ## Description
+   *
+   * The coefficient \f$b = 4\f$ of \f$E\f$.
+   */
+  FieldElement *curveB;
+
+  /**
+   * ## Description
+   *
+   * The coefficient \f$4(1 + i)\f$ of \f$E^{\prime}\f$.
+   */
+  ComplexFieldElement twistB;
+
+  /**
+   * ## Description
+   *
+   * The coefficients of the Frobenius map of \f$F_{p^{12}}\f$, see
+   * {@code fp12Element_frobeniusCoefficients}.
+   */
+  ComplexFieldElement frobeniusCoefficients[6];
+
+  /**
+   * ## Description
+   *
+   * The standard generator of \f$G_1\f$.
+   */
+  FieldAffinePoint g1Generator;
+
+  /**
+   * ## Description
+   *
+   * The standard generator of \f$G_2\f$.
+   */
+  TwistAffinePoint g2Generator;
+
+  /**
+   * ## Description
+   *
+   * The windowed NAF of the hard part \f$\frac{p^4 - p^2 + 1}{r}\f$ of the
+   * final exponentiation, least significant digit first.
+   */
+  signed char *hardPartDigits;
+
+  /**
+   * ## Description
+   *
+   * The number of digits in {@code hardPartDigits}.
+   */
+  size_t hardPartDigitCount;
+
+  /**
+   * ## Description
+   *
+   * The window size {@code hardPartDigits} were recoded with.
+   */
+  int hardPartWindowSize;
+} Bls12381Context;
+
+/**
+ * ## Description
+ *
+ * Initializes a new Bls12381Context, deriving the field and group orders from
+ * the curve parameter and checking the generators.
+ *
+ * ## Parameters
+ *
+ *   * contextOutput
+ *     * The Bls12381Context to be initialized. On CRYPTID_SUCCESS, this
+ * should be destroyed by the caller.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus bls12381Context_init(Bls12381Context *contextOutput);
+
+/**
+ * ## Description
+ *
+ * Frees a Bls12381Context. After calling this function on a Bls12381Context
+ * instance, that instance should not be used anymore.
+ *
+ * ## Parameters
+ *
+ *   * context
+ *     * The Bls12381Context to be destroyed.
+ */
+void bls12381Context_destroy(Bls12381Context context);
+
+#endif
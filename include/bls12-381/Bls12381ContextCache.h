@@ -0,0 +1,50 @@
+#ifndef __CRYPTID_BLS12381CONTEXTCACHE_H
+#define __CRYPTID_BLS12381CONTEXTCACHE_H
+
+#include "bls12-381/Bls12381Context.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * Returns the shared Bls12381Context, initializing it only if it is not in the
+ * cache yet. This way the operations taking serialized public parameters on
+ * BLS12-381 derive its constants once, not on every call. Safe to call from
+ * multiple threads.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the context. On CRYPTID_SUCCESS, this should be
+ * released by the caller with {@code bls12381ContextCache_release}, and must
+ * not be destroyed.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus bls12381ContextCache_acquire(const Bls12381Context **result);
+
+/**
+ * ## Description
+ *
+ * Releases a context acquired with {@code bls12381ContextCache_acquire}. The
+ * context is destroyed once it is released by every caller and is no longer in
+ * the cache. Safe to call from multiple threads.
+ *
+ * ## Parameters
+ *
+ *   * context
+ *     * The context to release.
+ */
+void bls12381ContextCache_release(const Bls12381Context *context);
+
+/**
+ * ## Description
+ *
+ * Removes the context from the cache. If it is still acquired, it remains
+ * usable until it is released. Safe to call from multiple threads.
+ */
+void bls12381ContextCache_flush(void);
+
+#endif
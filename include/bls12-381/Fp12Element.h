@@ -0,0 +1,301 @@
+#ifndef __CRYPTID_FP12ELEMENT_H
+#define __CRYPTID_FP12ELEMENT_H
+
+#include <stddef.h>
+
+#include "gmp.h"
+
+#include "complex/ComplexFieldElement.h"
+#include "field/MontgomeryContext.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * The largest window size of {@code fp12Element_powDigits}, which keeps a
+ * table of \f$2^{w - 2}\f$ odd powers on the stack.
+ */
+#define FP12ELEMENT_MAX_WINDOW_SIZE 4
+
+/**
+ * ## Description
+ *
+ * Element \f$c_0 + c_1 v + c_2 v^2\f$ of
+ * \f$F_{p^6} = F_{p^2}[v] / (v^3 - \xi)\f$ with \f$\xi = 1 + i\f$, where
+ * \f$F_{p^2}\f$ is represented by ComplexFieldElement. Views
+ * {@code 6 * limbCount} limbs owned by the caller, see
+ * {@code fp6Element_view}. Does not need to be initialized or destroyed.
+ */
+typedef struct Fp6Element {
+  /**
+   * ## Description
+   *
+   * The coefficients of \f$1\f$, \f$v\f$ and \f$v^2\f$.
+   */
+  ComplexFieldElement c0, c1, c2;
+} Fp6Element;
+
+/**
+ * ## Description
+ *
+ * Element \f$c_0 + c_1 w\f$ of \f$F_{p^{12}} = F_{p^6}[w] / (w^2 - v)\f$, the
+ * target field of the BLS12-381 pairing. Views {@code 12 * limbCount} limbs
+ * owned by the caller, see {@code fp12Element_view}. Does not need to be
+ * initialized or destroyed.
+ */
+typedef struct Fp12Element {
+  /**
+   * ## Description
+   *
+   * The coefficients of \f$1\f$ and \f$w\f$.
+   */
+  Fp6Element c0, c1;
+} Fp12Element;
+
+/**
+ * ## Description
+ *
+ * Creates an Fp6Element over caller-owned storage.
+ *
+ * ## Parameters
+ *
+ *   * limbs
+ *     * Storage for {@code 6 * limbCount} limbs, \f$c_0\f$, \f$c_1\f$ then
+ * \f$c_2\f$.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ *
+ * ## Return Value
+ *
+ * The element viewing {@code limbs}.
+ */
+Fp6Element fp6Element_view(mp_limb_t *limbs,
+                           const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Creates an Fp12Element over caller-owned storage.
+ *
+ * ## Parameters
+ *
+ *   * limbs
+ *     * Storage for {@code 12 * limbCount} limbs, \f$c_0\f$ then \f$c_1\f$.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ *
+ * ## Return Value
+ *
+ * The element viewing {@code limbs}.
+ */
+Fp12Element fp12Element_view(mp_limb_t *limbs,
+                             const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Copies an Fp12Element.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The destination.
+ *   * operand
+ *     * The source.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ */
+void fp12Element_copy(Fp12Element *result, const Fp12Element *operand,
+                      const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Sets an Fp12Element to one.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The element to set.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ */
+void fp12Element_setOne(Fp12Element *result,
+                        const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Compares two Fp12Elements.
+ *
+ * ## Parameters
+ *
+ *   * element1
+ *     * An element.
+ *   * element2
+ *     * An element.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ *
+ * ## Return Value
+ *
+ * 1 if the elements are equal, 0 otherwise.
+ */
+int fp12Element_isEquals(const Fp12Element *element1,
+                         const Fp12Element *element2,
+                         const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Multiplies two Fp12Elements. The result may alias any of the operands.
+ *
+ * ## Parameters
+ *
+ *   * product
+ *     * The result of the multiplication.
+ *   * multiplier
+ *     * An element.
+ *   * multiplicand
+ *     * An element.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ */
+void fp12Element_mul(Fp12Element *product, const Fp12Element *multiplier,
+                     const Fp12Element *multiplicand,
+                     const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Squares an Fp12Element. The result may alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * square
+ *     * The result of the squaring.
+ *   * operand
+ *     * The element to square.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ */
+void fp12Element_square(Fp12Element *square, const Fp12Element *operand,
+                        const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Computes the conjugate \f$c_0 - c_1 w\f$ of an Fp12Element, which is its
+ * image under \f$f \mapsto f^{p^6}\f$. For the elements of the cyclotomic
+ * subgroup, like the values of the pairing, it is the inverse. The result may
+ * alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The conjugate.
+ *   * operand
+ *     * The element to conjugate.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ */
+void fp12Element_conjugate(Fp12Element *result, const Fp12Element *operand,
+                           const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Computes the multiplicative inverse of an Fp12Element. The result may alias
+ * the operand.
+ *
+ * ## Parameters
+ *
+ *   * inverse
+ *     * The multiplicative inverse.
+ *   * operand
+ *     * The element to invert.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_HAS_NO_MUL_INV_ERROR if
+ * the operand is zero.
+ */
+CryptidStatus fp12Element_invert(Fp12Element *inverse,
+                                 const Fp12Element *operand,
+                                 const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Computes the coefficients \f$\gamma_k = \xi^{k \frac{p - 1}{6}}\f$ of the
+ * Frobenius map for \f$k = 0, \ldots, 5\f$.
+ *
+ * ## Parameters
+ *
+ *   * coefficients
+ *     * The six resulting coefficients.
+ *   * fieldOrder
+ *     * The order \f$p \equiv 1 \pmod 6\f$ of the base field.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ */
+void fp12Element_frobeniusCoefficients(
+    ComplexFieldElement *coefficients, const mpz_t fieldOrder,
+    const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Computes the image \f$f^p\f$ of an Fp12Element under the Frobenius map.
+ * Writing \f$f = \sum_{k} a_k w^k\f$ with \f$a_k \in F_{p^2}\f$ and
+ * \f$w^6 = \xi\f$, the image is \f$\sum_{k} \bar{a}_k \gamma_k w^k\f$. The
+ * result may alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The image of the element.
+ *   * operand
+ *     * The element to map.
+ *   * coefficients
+ *     * The coefficients computed by
+ * {@code fp12Element_frobeniusCoefficients}.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ */
+void fp12Element_frobenius(Fp12Element *result, const Fp12Element *operand,
+                           const ComplexFieldElement *coefficients,
+                           const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Raises an element of the cyclotomic subgroup to a power given by its
+ * windowed NAF digits, see {@code windowedNaf_recode}. The negative digits
+ * use the conjugates of the precomputed powers. The result may alias the
+ * base.
+ *
+ * ## Parameters
+ *
+ *   * power
+ *     * The result of the exponentiation.
+ *   * base
+ *     * An element of the cyclotomic subgroup.
+ *   * digits
+ *     * The digits of the exponent, least significant first.
+ *   * digitCount
+ *     * The number of digits.
+ *   * windowSize
+ *     * The window size the digits were recoded with, at most
+ * FP12ELEMENT_MAX_WINDOW_SIZE.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ */
+void fp12Element_powDigits(Fp12Element *power, const Fp12Element *base,
+                           const signed char *digits, const size_t digitCount,
+                           const int windowSize,
+                           const MontgomeryContext *montgomeryContext);
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef __CRYPTID_TWISTAFFINEPOINT_H
+#define __CRYPTID_TWISTAFFINEPOINT_H
+
+#include "gmp.h"
+
+#include "complex/ComplexFieldElement.h"
+#include "field/MontgomeryContext.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * Affine point of a curve \f$y^2 = x^3 + b\f$ over \f$F_{p^2}\f$, like the
+ * sextic twist of BLS12-381 holding \f$G_2\f$, with ComplexFieldElement
+ * coordinates. Views {@code 4 * limbCount} limbs owned by the caller, see
+ * {@code twistAffine_view}. Does not need to be initialized or destroyed.
+ */
+typedef struct TwistAffinePoint {
+  /**
+   * ## Description
+   *
+   * The \f$x\f$ coordinate.
+   */
+  ComplexFieldElement x;
+
+  /**
+   * ## Description
+   *
+   * The \f$y\f$ coordinate.
+   */
+  ComplexFieldElement y;
+
+  /**
+   * ## Description
+   *
+   * Nonzero if the point is the point at infinity, in which case the
+   * coordinates are meaningless.
+   */
+  int isInfinity;
+} TwistAffinePoint;
+
+/**
+ * ## Description
+ *
+ * Creates a TwistAffinePoint over caller-owned storage. The point is the point
+ * at infinity until its coordinates are set.
+ *
+ * ## Parameters
+ *
+ *   * limbs
+ *     * Storage for {@code 4 * limbCount} limbs, \f$x\f$ then \f$y\f$.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ *
+ * ## Return Value
+ *
+ * The point viewing {@code limbs}.
+ */
+TwistAffinePoint twistAffine_view(mp_limb_t *limbs,
+                                  const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Copies a TwistAffinePoint.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The destination.
+ *   * point
+ *     * The source.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ */
+void twistAffine_copy(TwistAffinePoint *result, const TwistAffinePoint *point,
+                      const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Checks whether two TwistAffinePoints are equal.
+ *
+ * ## Parameters
+ *
+ *   * point1
+ *     * A point.
+ *   * point2
+ *     * A point.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ *
+ * ## Return Value
+ *
+ * 1 if the points are equal, 0 otherwise.
+ */
+int twistAffine_isEquals(const TwistAffinePoint *point1,
+                         const TwistAffinePoint *point2,
+                         const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Checks whether a point satisfies the curve equation \f$y^2 = x^3 + b\f$.
+ *
+ * ## Parameters
+ *
+ *   * point
+ *     * The point to check.
+ *   * curveB
+ *     * The \f$b\f$ coefficient of the curve.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ *
+ * ## Return Value
+ *
+ * 1 if the point is on the curve, 0 otherwise.
+ */
+int twistAffine_isOnCurve(const TwistAffinePoint *point,
+                          const ComplexFieldElement *curveB,
+                          const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Computes the additive inverse of a TwistAffinePoint. The result may alias
+ * the operand.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The negated point.
+ *   * point
+ *     * The point to negate.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ */
+void twistAffine_negate(TwistAffinePoint *result, const TwistAffinePoint *point,
+                        const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Doubles a TwistAffinePoint. The result may alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The result of the operation.
+ *   * slope
+ *     * The slope of the tangent at the point, set unless the result is the
+ * point at infinity. May be NULL.
+ *   * point
+ *     * The point to double.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus twistAffine_double(TwistAffinePoint *result,
+                                 ComplexFieldElement *slope,
+                                 const TwistAffinePoint *point,
+                                 const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Adds two TwistAffinePoints. The result may alias any of the operands.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The result of the addition.
+ *   * slope
+ *     * The slope of the line through the points, set unless the result is
+ * the point at infinity or one of the operands is. May be NULL.
+ *   * point1
+ *     * A point.
+ *   * point2
+ *     * A point.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus twistAffine_add(TwistAffinePoint *result,
+                              ComplexFieldElement *slope,
+                              const TwistAffinePoint *point1,
+                              const TwistAffinePoint *point2,
+                              const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Multiplies a TwistAffinePoint by a scalar with the double-and-add method.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The result of the multiplication.
+ *   * point
+ *     * The point to multiply.
+ *   * scalar
+ *     * The scalar, which may be negative.
+ *   * montgomeryContext
+ *     * The context of the base field.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus twistAffine_multiply(TwistAffinePoint *result,
+                                   const TwistAffinePoint *point,
+                                   const mpz_t scalar,
+                                   const MontgomeryContext *montgomeryContext);
+
+#endif
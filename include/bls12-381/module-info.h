@@ -0,0 +1,3 @@
+#ifndef __CRYPTID_BLS12_381_MODULE
+#define __CRYPTID_BLS12_381_MODULE
+#endif
\ No newline at end of file
@@ -177,6 +177,26 @@ void complex_destroyMany(const size_t argumentCount, ...);
 void complex_modAdd(Complex *sum, const Complex augend, const Complex addend,
                     const mpz_t modulus);
 
+/**
+ * ## Description
+ *
+ * Same as {@code complex_modAdd}, writing into an already initialized Complex.
+ * The sum may alias any of the operands.
+ *
+ * ## Parameters
+ *
+ *   * sum
+ *     * The result of the addition. Must be initialized.
+ *   * augend
+ *     * The complex number to which the addend is added.
+ *   * addend
+ *     * The complex number that is added to the augend.
+ *   * modulus
+ *     * The modulus.
+ */
+void complex_modAddInto(Complex *sum, const Complex *augend,
+                        const Complex *addend, const mpz_t modulus);
+
 /**
  * ## Description
  *
@@ -233,6 +253,62 @@ void complex_modAddInteger(Complex *sum, const Complex augend,
 void complex_modMul(Complex *product, const Complex multiplier,
                     const Complex multiplicand, const mpz_t modulus);
 
+/**
+ * ## Description
+ *
+ * Same as {@code complex_modMul}, writing into an already initialized Complex.
+ * The product may alias any of the operands.
+ *
+ * ## Parameters
+ *
+ *   * product
+ *     * The result of the multiplication. Must be initialized.
+ *   * multiplier
+ *     * The complex number to multiply with.
+ *   * multiplicand
+ *     * The complex number to be multiplied by the multiplier.
+ *   * modulus
+ *     * The modulus.
+ */
+void complex_modMulInto(Complex *product, const Complex *multiplier,
+                        const Complex *multiplicand, const mpz_t modulus);
+
+/**
+ * ## Description
+ *
+ * Squares a Complex value with respect to the specified modulus. Cheaper than
+ * multiplying the value by itself.
+ *
+ * ## Parameters
+ *
+ *   * square
+ *     * The result of the squaring.
+ *   * operand
+ *     * The complex number to square.
+ *   * modulus
+ *     * The modulus.
+ */
+void complex_modSquare(Complex *square, const Complex operand,
+                       const mpz_t modulus);
+
+/**
+ * ## Description
+ *
+ * Same as {@code complex_modSquare}, writing into an already initialized
+ * Complex. The square may alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * square
+ *     * The result of the squaring. Must be initialized.
+ *   * operand
+ *     * The complex number to square.
+ *   * modulus
+ *     * The modulus.
+ */
+void complex_modSquareInto(Complex *square, const Complex *operand,
+                           const mpz_t modulus);
+
 /**
  * ## Description
  *
@@ -252,6 +328,26 @@ void complex_modMul(Complex *product, const Complex multiplier,
 void complex_modPow(Complex *power, const Complex base, const mpz_t exponent,
                     const mpz_t modulus);
 
+/**
+ * ## Description
+ *
+ * Same as {@code complex_modPow}, writing into an already initialized Complex.
+ * The power may alias the base.
+ *
+ * ## Parameters
+ *
+ *   * power
+ *     * The result of the exponentiation. Must be initialized.
+ *   * base
+ *     * The base of the exponentiation.
+ *   * exponent
+ *     * The exponent of the exponentiation.
+ *   * modulus
+ *     * The modulus.
+ */
+void complex_modPowInto(Complex *power, const Complex *base,
+                        const mpz_t exponent, const mpz_t modulus);
+
 /**
  * ## Description
  *
@@ -271,6 +367,27 @@ void complex_modPow(Complex *power, const Complex base, const mpz_t exponent,
 void complex_modMulInteger(Complex *product, const mpz_t multiplier,
                            const Complex multiplicand, const mpz_t modulus);
 
+/**
+ * ## Description
+ *
+ * Same as {@code complex_modMulInteger}, writing into an already initialized
+ * Complex. The product may alias the multiplicand.
+ *
+ * ## Parameters
+ *
+ *   * product
+ *     * The result of the multiplication. Must be initialized.
+ *   * multiplier
+ *     * The integer number to multiply with.
+ *   * multiplicand
+ *     * The complex number to be multiplied by the multiplier.
+ *   * modulus
+ *     * The modulus.
+ */
+void complex_modMulIntegerInto(Complex *product, const mpz_t multiplier,
+                               const Complex *multiplicand,
+                               const mpz_t modulus);
+
 /**
  * ## Description
  *
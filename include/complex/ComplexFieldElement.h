@@ -0,0 +1,319 @@
+#ifndef __CRYPTID_COMPLEXFIELDELEMENT_H
+#define __CRYPTID_COMPLEXFIELDELEMENT_H
+
+#include "gmp.h"
+
+#include "complex/Complex.h"
+#include "field/FieldElement.h"
+#include "field/MontgomeryContext.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * Fixed-width element of \f$F_p^2\f$ with Montgomery form real and imaginary
+ * parts. It is a view of {@code 2 * limbCount} limbs owned by the caller, set
+ * up with {@code complexFieldElement_view}, and does not need to be
+ * initialized or destroyed. Assigning a ComplexFieldElement copies the view,
+ * not the value, see {@code complexFieldElement_copy}.
+ */
+typedef struct ComplexFieldElement {
+  /**
+   * ## Description
+   *
+   * The real part.
+   */
+  FieldElement *real;
+
+  /**
+   * ## Description
+   *
+   * The imaginary part.
+   */
+  FieldElement *imaginary;
+} ComplexFieldElement;
+
+/**
+ * ## Description
+ *
+ * Views storage as a ComplexFieldElement, the real part followed by the
+ * imaginary part.
+ *
+ * ## Parameters
+ *
+ *   * limbs
+ *     * The storage of {@code 2 * limbCount} limbs.
+ *   * montgomeryContext
+ *     * The context of the field.
+ *
+ * ## Return Value
+ *
+ * The element viewing the storage.
+ */
+ComplexFieldElement
+complexFieldElement_view(mp_limb_t *limbs,
+                         const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Converts a Complex into a ComplexFieldElement.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The resulting element.
+ *   * complex
+ *     * The Complex to convert.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void complexFieldElement_fromComplex(
+    ComplexFieldElement *result, const Complex complex,
+    const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Converts a ComplexFieldElement into a Complex with canonical parts.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the resulting Complex. Should be destroyed by the
+ * caller.
+ *   * element
+ *     * The element to convert.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void complexFieldElement_toComplex(Complex *result,
+                                   const ComplexFieldElement *element,
+                                   const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Sets a ComplexFieldElement to one.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The element to set.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void complexFieldElement_setOne(ComplexFieldElement *result,
+                                const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Copies a ComplexFieldElement.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The destination.
+ *   * element
+ *     * The source.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void complexFieldElement_copy(ComplexFieldElement *result,
+                              const ComplexFieldElement *element,
+                              const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Adds two ComplexFieldElements. The result may alias any of the operands.
+ *
+ * ## Parameters
+ *
+ *   * sum
+ *     * The result of the addition.
+ *   * augend
+ *     * The element to which the addend is added.
+ *   * addend
+ *     * The element that is added to the augend.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void complexFieldElement_add(ComplexFieldElement *sum,
+                             const ComplexFieldElement *augend,
+                             const ComplexFieldElement *addend,
+                             const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Adds an element of \f$F_p\f$ to a ComplexFieldElement. The result may alias
+ * the augend.
+ *
+ * ## Parameters
+ *
+ *   * sum
+ *     * The result of the addition.
+ *   * augend
+ *     * The element to which the addend is added.
+ *   * addend
+ *     * The element of \f$F_p\f$ that is added to the real part of the augend.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void complexFieldElement_addFieldElement(
+    ComplexFieldElement *sum, const ComplexFieldElement *augend,
+    const FieldElement *addend, const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Subtracts two ComplexFieldElements. The result may alias any of the
+ * operands.
+ *
+ * ## Parameters
+ *
+ *   * difference
+ *     * The result of the subtraction.
+ *   * minuend
+ *     * The element from which the subtrahend is subtracted.
+ *   * subtrahend
+ *     * The element that is subtracted from the minuend.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void complexFieldElement_sub(ComplexFieldElement *difference,
+                             const ComplexFieldElement *minuend,
+                             const ComplexFieldElement *subtrahend,
+                             const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Multiplies two ComplexFieldElements. The result may alias any of the
+ * operands.
+ *
+ * ## Parameters
+ *
+ *   * product
+ *     * The result of the multiplication.
+ *   * multiplier
+ *     * The element to multiply with.
+ *   * multiplicand
+ *     * The element to be multiplied by the multiplier.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void complexFieldElement_mul(ComplexFieldElement *product,
+                             const ComplexFieldElement *multiplier,
+                             const ComplexFieldElement *multiplicand,
+                             const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Squares a ComplexFieldElement. The result may alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * square
+ *     * The result of the squaring.
+ *   * operand
+ *     * The element to square.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void complexFieldElement_square(ComplexFieldElement *square,
+                                const ComplexFieldElement *operand,
+                                const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Multiplies a ComplexFieldElement by an element of \f$F_p\f$. The result may
+ * alias the multiplicand.
+ *
+ * ## Parameters
+ *
+ *   * product
+ *     * The result of the multiplication.
+ *   * multiplier
+ *     * The element of \f$F_p\f$ to multiply with.
+ *   * multiplicand
+ *     * The element to be multiplied by the multiplier.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void complexFieldElement_mulFieldElement(
+    ComplexFieldElement *product, const FieldElement *multiplier,
+    const ComplexFieldElement *multiplicand,
+    const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Raises a ComplexFieldElement to the specified power. The result may alias
+ * the base.
+ *
+ * ## Parameters
+ *
+ *   * power
+ *     * The result of the exponentiation.
+ *   * base
+ *     * The base of the exponentiation.
+ *   * exponent
+ *     * A non-negative integer exponent.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void complexFieldElement_pow(ComplexFieldElement *power,
+                             const ComplexFieldElement *base,
+                             const mpz_t exponent,
+                             const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Computes the conjugate \f$a - bi\f$ of a ComplexFieldElement, which is
+ * its image under the Frobenius map. The result may alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The conjugate.
+ *   * operand
+ *     * The element to conjugate.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void complexFieldElement_conjugate(ComplexFieldElement *result,
+                                   const ComplexFieldElement *operand,
+                                   const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Computes the multiplicative inverse of a ComplexFieldElement. The result may
+ * alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * inverse
+ *     * The multiplicative inverse.
+ *   * operand
+ *     * The element to invert.
+ *   * montgomeryContext
+ *     * The context of the field.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_HAS_NO_MUL_INV_ERROR if
+ * the operand is not invertible.
+ */
+CryptidStatus
+complexFieldElement_invert(ComplexFieldElement *inverse,
+                           const ComplexFieldElement *operand,
+                           const MontgomeryContext *montgomeryContext);
+
+#endif
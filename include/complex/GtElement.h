@@ -0,0 +1,214 @@
+#ifndef __CRYPTID_GTELEMENT_H
+#define __CRYPTID_GTELEMENT_H
+
+#include <stddef.h>
+
+#include "gmp.h"
+
+#include "complex/Complex.h"
+#include "complex/ComplexFieldElement.h"
+#include "field/MontgomeryContext.h"
+
+/**
+ * ## Description
+ *
+ * The largest window size of the exponentiations, which keep a table of
+ * \f$2^{w - 2}\f$ odd powers on the stack.
+ */
+#define GTELEMENT_MAX_WINDOW_SIZE 5
+
+/**
+ * ## Description
+ *
+ * Element of the target group of the Tate pairing, that is, of the subgroup
+ * of order \f$p + 1\f$ of \f$F_p^2\f$, whose elements have norm
+ * \f$a^2 + b^2 = 1\f$. In this subgroup, the inverse of an element is its
+ * conjugate, and squaring takes two field squarings. Views
+ * {@code 2 * limbCount} limbs owned by the caller, see {@code gtElement_view}.
+ * Does not need to be initialized or destroyed.
+ */
+typedef struct GtElement {
+  /**
+   * ## Description
+   *
+   * The element of \f$F_p^2\f$.
+   */
+  ComplexFieldElement value;
+} GtElement;
+
+/**
+ * ## Description
+ *
+ * Creates a GtElement over caller-owned storage.
+ *
+ * ## Parameters
+ *
+ *   * limbs
+ *     * Storage for {@code 2 * limbCount} limbs.
+ *   * montgomeryContext
+ *     * The context of the field.
+ *
+ * ## Return Value
+ *
+ * The element viewing {@code limbs}.
+ */
+GtElement gtElement_view(mp_limb_t *limbs,
+                         const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Converts a Complex of norm 1, like the result of a pairing, into a
+ * GtElement.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The resulting element.
+ *   * complex
+ *     * The Complex to convert.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void gtElement_fromComplex(GtElement *result, const Complex complex,
+                           const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Converts a GtElement into a Complex with canonical parts.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the resulting Complex. Should be destroyed by the
+ * caller.
+ *   * element
+ *     * The element to convert.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void gtElement_toComplex(Complex *result, const GtElement *element,
+                         const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Multiplies two GtElements. The result may alias any of the operands.
+ *
+ * ## Parameters
+ *
+ *   * product
+ *     * The result of the multiplication.
+ *   * multiplier
+ *     * The multiplier.
+ *   * multiplicand
+ *     * The multiplicand.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void gtElement_mul(GtElement *product, const GtElement *multiplier,
+                   const GtElement *multiplicand,
+                   const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Squares a GtElement with the cyclotomic squaring formulas. The result may
+ * alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * square
+ *     * The result of the squaring.
+ *   * operand
+ *     * The element to square.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void gtElement_square(GtElement *square, const GtElement *operand,
+                      const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Computes the inverse of a GtElement, which is its conjugate. The result may
+ * alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * inverse
+ *     * The inverse.
+ *   * operand
+ *     * The element to invert.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void gtElement_inverse(GtElement *inverse, const GtElement *operand,
+                       const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Returns the window size of the exponentiations for the specified exponent.
+ *
+ * ## Parameters
+ *
+ *   * exponent
+ *     * The exponent.
+ *
+ * ## Return Value
+ *
+ * A window size between 2 and {@code GTELEMENT_MAX_WINDOW_SIZE}.
+ */
+int gtElement_windowSize(const mpz_t exponent);
+
+/**
+ * ## Description
+ *
+ * Raises a GtElement to the power given by its width-\f$w\f$ NAF digits. As
+ * the inverse of an element is its conjugate, negative digits cost the same
+ * as positive ones. The result may alias the base.
+ *
+ * ## Parameters
+ *
+ *   * power
+ *     * The result of the exponentiation.
+ *   * base
+ *     * The base of the exponentiation.
+ *   * digits
+ *     * The width-\f$w\f$ NAF of the exponent, least significant first, as
+ * computed by {@code windowedNaf_recode}.
+ *   * digitCount
+ *     * The number of digits.
+ *   * windowSize
+ *     * The width \f$w\f$, at most {@code GTELEMENT_MAX_WINDOW_SIZE}.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void gtElement_powDigits(GtElement *power, const GtElement *base,
+                         const signed char *digits, const size_t digitCount,
+                         const int windowSize,
+                         const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Raises a GtElement to the specified power. The result may alias the base.
+ *
+ * ## Parameters
+ *
+ *   * power
+ *     * The result of the exponentiation.
+ *   * base
+ *     * The base of the exponentiation.
+ *   * exponent
+ *     * An integer exponent, which may be negative.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void gtElement_pow(GtElement *power, const GtElement *base,
+                   const mpz_t exponent,
+                   const MontgomeryContext *montgomeryContext);
+
+#endif
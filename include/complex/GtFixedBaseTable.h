@@ -0,0 +1,144 @@
+#ifndef __CRYPTID_GTFIXEDBASETABLE_H
+#define __CRYPTID_GTFIXEDBASETABLE_H
+
+#include "gmp.h"
+
+#include "complex/Complex.h"
+#include "complex/GtElement.h"
+#include "field/MontgomeryContext.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * The window size of the fixed-base tables built for pairing values. A table
+ * holds \f$2^w - 1\f$ elements, and an exponentiation by an exponent of
+ * \f$t\f$ bits needs \f$\lceil t / w \rceil\f$ squarings and multiplications.
+ * Can be overridden at compile time to trade memory for speed.
+ */
+#ifndef GT_FIXED_BASE_DEFAULT_WINDOW_SIZE
+#define GT_FIXED_BASE_DEFAULT_WINDOW_SIZE 4
+#endif
+
+/**
+ * ## Description
+ *
+ * The largest supported window size.
+ */
+#define GT_FIXED_BASE_MAX_WINDOW_SIZE 8
+
+/**
+ * ## Description
+ *
+ * Precomputed comb table of a fixed pairing value of known order, used to
+ * speed up repeated exponentiations of the same value.
+ */
+typedef struct GtFixedBaseTable {
+  /**
+   * ## Description
+   *
+   * The order of the base. Exponents are reduced modulo this value.
+   */
+  mpz_t order;
+
+  /**
+   * ## Description
+   *
+   * The window size \f$w\f$, that is the number of teeth of the comb.
+   */
+  int windowSize;
+
+  /**
+   * ## Description
+   *
+   * The distance \f$d\f$ between the teeth of the comb in bits.
+   */
+  int spacing;
+
+  /**
+   * ## Description
+   *
+   * The table itself. The \f$j\f$th entry is
+   * \f$\prod_{i} g^{j_i 2^{id}}\f$ for \f$j = 1, \ldots, 2^w - 1\f$, stored at
+   * index \f$j - 1\f$.
+   */
+  GtElement *elements;
+
+  /**
+   * ## Description
+   *
+   * The storage of {@code elements}, {@code 2 * limbCount} limbs each.
+   */
+  mp_limb_t *elementLimbs;
+
+  /**
+   * ## Description
+   *
+   * The context of the field.
+   */
+  MontgomeryContext montgomeryContext;
+} GtFixedBaseTable;
+
+/**
+ * ## Description
+ *
+ * Builds a fixed-base comb table for the specified pairing value.
+ *
+ * ## Parameters
+ *
+ *   * tableOutput
+ *     * The table to be initialized. On CRYPTID_SUCCESS, this should be
+ * destroyed by the caller.
+ *   * base
+ *     * The fixed base, an element of norm 1.
+ *   * order
+ *     * The order of the base.
+ *   * windowSize
+ *     * The window size, clamped between 1 and
+ * {@code GT_FIXED_BASE_MAX_WINDOW_SIZE}.
+ *   * fieldOrder
+ *     * The order of the field.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus gtFixedBaseTable_init(GtFixedBaseTable *tableOutput,
+                                    const Complex base, const mpz_t order,
+                                    const int windowSize,
+                                    const mpz_t fieldOrder);
+
+/**
+ * ## Description
+ *
+ * Frees a GtFixedBaseTable. After calling this function on a GtFixedBaseTable
+ * instance, that instance should not be used anymore.
+ *
+ * ## Parameters
+ *
+ *   * table
+ *     * The GtFixedBaseTable to be destroyed.
+ */
+void gtFixedBaseTable_destroy(GtFixedBaseTable table);
+
+/**
+ * ## Description
+ *
+ * Raises the base of a fixed-base table to the specified power.
+ * Implementation note: Uses the fixed-base comb method, see Algorithm 3.44 in
+ * [Guide-to-ECC].
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the result of the exponentiation. Should be
+ * destroyed by the caller.
+ *   * table
+ *     * The table of the base.
+ *   * exponent
+ *     * The exponent, which may be negative.
+ */
+void gtElement_fixedBasePow(Complex *result, const GtFixedBaseTable *table,
+                            const mpz_t exponent);
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef __CRYPTID_AFFINEFIXEDBASETABLE_H
+#define __CRYPTID_AFFINEFIXEDBASETABLE_H
+
+#include "gmp.h"
+
+#include "elliptic/AffinePoint.h"
+#include "elliptic/EllipticCurve.h"
+#include "elliptic/FieldAffinePoint.h"
+#include "field/FieldElement.h"
+#include "field/MontgomeryContext.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * The window size of the fixed-base tables built by the protocols. A table
+ * holds \f$2^w - 1\f$ points, and a multiplication by a scalar of \f$t\f$ bits
+ * needs \f$\lceil t / w \rceil\f$ doublings and additions. Can be overridden at
+ * compile time to trade memory for speed.
+ */
+#ifndef AFFINE_FIXED_BASE_DEFAULT_WINDOW_SIZE
+#define AFFINE_FIXED_BASE_DEFAULT_WINDOW_SIZE 4
+#endif
+
+/**
+ * ## Description
+ *
+ * The largest supported window size.
+ */
+#define AFFINE_FIXED_BASE_MAX_WINDOW_SIZE 8
+
+/**
+ * ## Description
+ *
+ * Precomputed comb table of a fixed base point of known order, used to speed
+ * up repeated multiplications of the same point.
+ */
+typedef struct AffineFixedBaseTable {
+  /**
+   * ## Description
+   *
+   * The order of the base point. Scalars are reduced modulo this value.
+   */
+  mpz_t order;
+
+  /**
+   * ## Description
+   *
+   * The window size \f$w\f$, that is the number of teeth of the comb.
+   */
+  int windowSize;
+
+  /**
+   * ## Description
+   *
+   * The distance \f$d\f$ between the teeth of the comb in bits.
+   */
+  int spacing;
+
+  /**
+   * ## Description
+   *
+   * The table itself. The \f$j\f$th entry is
+   * \f$\sum_{i} j_i 2^{id} P\f$ for \f$j = 1, \ldots, 2^w - 1\f$, stored at
+   * index \f$j - 1\f$.
+   */
+  FieldAffinePoint *points;
+
+  /**
+   * ## Description
+   *
+   * The Montgomery form \f$a\f$ coefficient of the curve.
+   */
+  FieldElement *curveA;
+
+  /**
+   * ## Description
+   *
+   * The storage {@code curveA} and the coordinates of {@code points} are views
+   * into.
+   */
+  mp_limb_t *limbs;
+
+  /**
+   * ## Description
+   *
+   * The context of the field of the curve.
+   */
+  MontgomeryContext montgomeryContext;
+} AffineFixedBaseTable;
+
+/**
+ * ## Description
+ *
+ * Builds a fixed-base comb table for the specified point. Implementation of the
+ * precomputation step of Algorithm 3.44 in [Guide-to-ECC].
+ *
+ * ## Parameters
+ *
+ *   * tableOutput
+ *     * The table to be initialized. On CRYPTID_SUCCESS, this should be
+ * destroyed by the caller.
+ *   * basePoint
+ *     * The fixed base point.
+ *   * order
+ *     * The order of the base point.
+ *   * windowSize
+ *     * The window size, clamped between 1 and
+ * {@code AFFINE_FIXED_BASE_MAX_WINDOW_SIZE}.
+ *   * ellipticCurve
+ *     * The elliptic curve to operate over.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus affineFixedBaseTable_init(AffineFixedBaseTable *tableOutput,
+                                        const AffinePoint basePoint,
+                                        const mpz_t order, const int windowSize,
+                                        const EllipticCurve ellipticCurve);
+
+/**
+ * ## Description
+ *
+ * Frees an AffineFixedBaseTable. After calling this function on an
+ * AffineFixedBaseTable instance, that instance should not be used anymore.
+ *
+ * ## Parameters
+ *
+ *   * table
+ *     * The AffineFixedBaseTable to be destroyed.
+ */
+void affineFixedBaseTable_destroy(AffineFixedBaseTable table);
+
+/**
+ * ## Description
+ *
+ * Multiplies the base point of a fixed-base table with a scalar.
+ * Implementation note: Uses the fixed-base comb method, see Algorithm 3.44 in
+ * [Guide-to-ECC].
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The result of the multiplication. On CRYPTID_SUCCESS, this should be
+ * destroyed by the caller.
+ *   * table
+ *     * The table of the base point.
+ *   * s
+ *     * The scalar to multiply with.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus affine_fixedBaseMultiply(AffinePoint *result,
+                                       const AffineFixedBaseTable *table,
+                                       const mpz_t s);
+
+#endif
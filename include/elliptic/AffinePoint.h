@@ -4,9 +4,26 @@
 #include "gmp.h"
 
 #include "elliptic/EllipticCurve.h"
+#include "elliptic/EllipticCurveContext.h"
 #include "util/Status.h"
 #include "util/Validation.h"
 
+/**
+ * ## Description
+ *
+ * The largest number of terms for which {@code affine_multiScalarMultiply}
+ * uses interleaving instead of the bucket method.
+ */
+#define AFFINE_MULTI_SCALAR_STRAUS_THRESHOLD 32
+
+/**
+ * ## Description
+ *
+ * The largest window size of the bucket method, which needs
+ * \f$2^c - 1\f$ buckets.
+ */
+#define AFFINE_MULTI_SCALAR_MAX_BUCKET_BITS 10
+
 /**
  * ## Description
  *
@@ -26,13 +43,22 @@ typedef struct AffinePoint {
    * The \f$y\f$ coordinate.
    */
   mpz_t y;
+
+  /**
+   * ## Description
+   *
+   * 1 if this is the point at infinity, 0 otherwise. The point at infinity
+   * keeps the \f$(-1, -1)\f$ coordinates as well, so that its binary encoding
+   * does not change.
+   */
+  int isInfinity;
 } AffinePoint;
 
 /**
  * ## Description
  *
  * Initializes a new AffinePoint with the specified arbitrary precision
- * coordinates.
+ * coordinates. The \f$(-1, -1)\f$ coordinates yield the point at infinity.
  *
  * ## Parameters
  *
@@ -48,7 +74,8 @@ void affine_init(AffinePoint *affinePointOutput, const mpz_t x, const mpz_t y);
 /**
  * ## Description
  *
- * Initializes a new AffinePoint with the specified long values.
+ * Initializes a new AffinePoint with the specified long values. The
+ * \f$(-1, -1)\f$ coordinates yield the point at infinity.
  *
  * ## Parameters
  *
@@ -121,6 +148,24 @@ int affine_isEquals(const AffinePoint affinePoint1,
  */
 int affine_isInfinity(const AffinePoint affinePoint);
 
+/**
+ * ## Description
+ *
+ * Negates the specified AffinePoint, that is, computes \f$(x, -y)\f$. The
+ * negative of the point at infinity is itself.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The negated point. Should be destroyed by the caller.
+ *   * affinePoint
+ *     * The point to negate.
+ *   * ellipticCurve
+ *     * The elliptic curve to operate over.
+ */
+void affine_negate(AffinePoint *result, const AffinePoint affinePoint,
+                   const EllipticCurve ellipticCurve);
+
 /**
  * ## Description
  *
@@ -143,6 +188,29 @@ int affine_isInfinity(const AffinePoint affinePoint);
 CryptidStatus affine_double(AffinePoint *result, const AffinePoint affinePoint,
                             const EllipticCurve ellipticCurve);
 
+/**
+ * ## Description
+ *
+ * Same as {@code affine_double}, writing into an already initialized
+ * AffinePoint. The result may alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The result of the operation. Must be initialized.
+ *   * affinePoint
+ *     * The point to double.
+ *   * ellipticCurve
+ *     * The elliptic curve to operate over.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise
+ */
+CryptidStatus affine_doubleInto(AffinePoint *result,
+                                const AffinePoint *affinePoint,
+                                const EllipticCurve ellipticCurve);
+
 /**
  * ## Description
  *
@@ -169,6 +237,32 @@ CryptidStatus affine_add(AffinePoint *result, const AffinePoint affinePoint1,
                          const AffinePoint affinePoint2,
                          const EllipticCurve ellipticCurve);
 
+/**
+ * ## Description
+ *
+ * Same as {@code affine_add}, writing into an already initialized
+ * AffinePoint. The result may alias any of the operands.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The result of the addition. Must be initialized.
+ *   * affinePoint1
+ *     * An AffinePoint.
+ *   * affinePoint2
+ *     * An AffinePoint.
+ *   * ellipticCurve
+ *     * The curve to operate over.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus affine_addInto(AffinePoint *result,
+                             const AffinePoint *affinePoint1,
+                             const AffinePoint *affinePoint2,
+                             const EllipticCurve ellipticCurve);
+
 /**
  * ## Description
  *
@@ -184,8 +278,8 @@ CryptidStatus affine_add(AffinePoint *result, const AffinePoint affinePoint1,
  *     * The point to multiply.
  *   * s
  *     * The scalar to multiply with.
- *   * ellipticCurve
- *     * The elliptic curve to operate over.
+ *   * curveContext
+ *     * The context of the elliptic curve to operate over.
  *
  * ## Return Value
  *
@@ -193,7 +287,38 @@ CryptidStatus affine_add(AffinePoint *result, const AffinePoint affinePoint1,
  */
 CryptidStatus affine_wNAFMultiply(AffinePoint *result,
                                   const AffinePoint affinePoint, const mpz_t s,
-                                  const EllipticCurve ellipticCurve);
+                                  const EllipticCurveContext *curveContext);
+
+/**
+ * ## Description
+ *
+ * Computes the sum \f$\sum_{i} s_i P_i\f$ with a single shared doubling chain.
+ * Implementation note: Uses interleaved width-\f$w\f$ NAFs (Straus-Shamir)
+ * for at most {@code AFFINE_MULTI_SCALAR_STRAUS_THRESHOLD} terms, and the
+ * bucket method of Pippenger for more. Terms with a non-positive scalar do not
+ * contribute to the sum.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The sum. On CRYPTID_SUCCESS, this should be destroyed by the caller.
+ *   * points
+ *     * The points to multiply.
+ *   * scalars
+ *     * The scalars to multiply with, one for every point.
+ *   * count
+ *     * The number of terms.
+ *   * curveContext
+ *     * The context of the elliptic curve to operate over.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus
+affine_multiScalarMultiply(AffinePoint *result, const AffinePoint *points,
+                           const mpz_srcptr *scalars, const size_t count,
+                           const EllipticCurveContext *curveContext);
 
 /**
  * ## Description
@@ -26,12 +26,21 @@ typedef struct ComplexAffinePoint {
    * The y coordinate.
    */
   Complex y;
+
+  /**
+   * ## Description
+   *
+   * 1 if this is the point at infinity, 0 otherwise. The point at infinity
+   * keeps the \f$(-1, -1)\f$ coordinates as well.
+   */
+  int isInfinity;
 } ComplexAffinePoint;
 
 /**
  * ## Description
  *
- * Initializes a new ComplexAffinePoint with the specified coordinates.
+ * Initializes a new ComplexAffinePoint with the specified coordinates. The
+ * \f$(-1, -1)\f$ coordinates yield the point at infinity.
  *
  * ## Parameters
  *
@@ -49,7 +58,7 @@ void complexAffine_init(ComplexAffinePoint *complexAffinePointOutput,
  * ## Description
  *
  * Initializes a new ComplexAffinePoint initialized with the specified long
- * values.
+ * values. The \f$(-1, -1)\f$ coordinates yield the point at infinity.
  *
  * ## Parameters
  *
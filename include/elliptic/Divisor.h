@@ -2,11 +2,68 @@
 #define __CRYPTID_DIVISOR_H
 
 #include "complex/Complex.h"
+#include "complex/ComplexFieldElement.h"
 #include "elliptic/AffinePoint.h"
 #include "elliptic/ComplexAffinePoint.h"
 #include "elliptic/EllipticCurve.h"
+#include "elliptic/EllipticCurveContext.h"
+#include "elliptic/FieldAffinePoint.h"
+#include "elliptic/JacobianPoint.h"
+#include "field/FieldElement.h"
+#include "field/MontgomeryContext.h"
 #include "util/Status.h"
 
+/**
+ * ## Description
+ *
+ * Montgomery form coefficients of the line \f$ax + by + c = 0\f$. The
+ * constant function 1 is represented by \f$a = b = 0\f$ and \f$c = 1\f$.
+ * Views {@code 3 * limbCount} limbs owned by the caller, see
+ * {@code divisor_viewLine}. Does not need to be initialized or destroyed.
+ */
+typedef struct DivisorLine {
+  /**
+   * ## Description
+   *
+   * The coefficient of \f$x\f$.
+   */
+  FieldElement *a;
+
+  /**
+   * ## Description
+   *
+   * The coefficient of \f$y\f$.
+   */
+  FieldElement *b;
+
+  /**
+   * ## Description
+   *
+   * The constant term.
+   */
+  FieldElement *c;
+} DivisorLine;
+
+/**
+ * ## Description
+ *
+ * Creates a DivisorLine over caller-owned storage.
+ *
+ * ## Parameters
+ *
+ *   * limbs
+ *     * Storage for {@code 3 * limbCount} limbs, \f$a\f$, \f$b\f$ then
+ * \f$c\f$.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ *
+ * ## Return Value
+ *
+ * The line viewing {@code limbs}.
+ */
+DivisorLine divisor_viewLine(mp_limb_t *limbs,
+                             const MontgomeryContext *montgomeryContext);
+
 /**
  * ## Description
  *
@@ -21,12 +78,12 @@
  *     * A point in \f$E(F_p)\f$.
  *   * b
  *     * A point \f$E(F_p^2)\f$.
- *   * ec
- *     * The elliptic curve to operate on.
+ *   * context
+ *     * The context of the elliptic curve to operate on.
  */
 void divisor_evaluateVertical(Complex *result, const AffinePoint a,
                               const ComplexAffinePoint b,
-                              const EllipticCurve ec);
+                              const EllipticCurveContext *context);
 
 /**
  * ## Description
@@ -43,8 +100,8 @@ void divisor_evaluateVertical(Complex *result, const AffinePoint a,
  *     * A point in \f$E(F_p)\f$.
  *   * b
  *     * A point \f$E(F_p^2)\f$.
- *   * ec
- *     * The elliptic curve to operate on.
+ *   * context
+ *     * The context of the elliptic curve to operate on.
  *
  * ## Return Value
  *
@@ -52,7 +109,7 @@ void divisor_evaluateVertical(Complex *result, const AffinePoint a,
  */
 CryptidStatus divisor_evaluateTangent(Complex *result, const AffinePoint a,
                                       const ComplexAffinePoint b,
-                                      const EllipticCurve ec);
+                                      const EllipticCurveContext *context);
 
 /**
  * ## Description
@@ -71,8 +128,8 @@ CryptidStatus divisor_evaluateTangent(Complex *result, const AffinePoint a,
  *     * A point in \f$E(F_p)\f$.
  *   * b
  *     * A point in \f$E(F_p^2)\f$.
- *   * ec
- *     * The elliptic curve to operate on.
+ *   * context
+ *     * The context of the elliptic curve to operate on.
  *
  * ## Return Value
  *
@@ -81,6 +138,244 @@ CryptidStatus divisor_evaluateTangent(Complex *result, const AffinePoint a,
 CryptidStatus divisor_evaluateLine(Complex *result, const AffinePoint a,
                                    const AffinePoint aprime,
                                    const ComplexAffinePoint b,
-                                   const EllipticCurve ec);
+                                   const EllipticCurveContext *context);
+
+/**
+ * ## Description
+ *
+ * Same as {@code divisor_evaluateVertical}, operating on fixed-width Montgomery
+ * form coordinates.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The resulting element of \f$F_p^2\f$. Must not alias bX.
+ *   * a
+ *     * A point in \f$E(F_p)\f$.
+ *   * bX
+ *     * The \f$x\f$ coordinate of a finite point in \f$E(F_p^2)\f$.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void divisor_montgomeryEvaluateVertical(
+    ComplexFieldElement *result, const FieldAffinePoint *a,
+    const ComplexFieldElement *bX, const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Same as {@code divisor_evaluateTangent}, operating on fixed-width Montgomery
+ * form coordinates.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The resulting element of \f$F_p^2\f$. Must not alias bX or bY.
+ *   * a
+ *     * A point in \f$E(F_p)\f$.
+ *   * bX
+ *     * The \f$x\f$ coordinate of a finite point in \f$E(F_p^2)\f$.
+ *   * bY
+ *     * The \f$y\f$ coordinate of a finite point in \f$E(F_p^2)\f$.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void divisor_montgomeryEvaluateTangent(
+    ComplexFieldElement *result, const FieldAffinePoint *a,
+    const ComplexFieldElement *bX, const ComplexFieldElement *bY,
+    const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Same as {@code divisor_evaluateLine}, operating on fixed-width Montgomery
+ * form coordinates.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The resulting element of \f$F_p^2\f$. Must not alias bX or bY.
+ *   * a
+ *     * A point in \f$E(F_p)\f$.
+ *   * aprime
+ *     * A point in \f$E(F_p)\f$.
+ *   * bX
+ *     * The \f$x\f$ coordinate of a finite point in \f$E(F_p^2)\f$.
+ *   * bY
+ *     * The \f$y\f$ coordinate of a finite point in \f$E(F_p^2)\f$.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void divisor_montgomeryEvaluateLine(
+    ComplexFieldElement *result, const FieldAffinePoint *a,
+    const FieldAffinePoint *aprime, const ComplexFieldElement *bX,
+    const ComplexFieldElement *bY, const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Computes the coefficients of the tangent at a point, which
+ * {@code divisor_montgomeryEvaluateTangent} evaluates. As the coefficients do
+ * not depend on the point of evaluation, they can be reused.
+ *
+ * ## Parameters
+ *
+ *   * line
+ *     * The resulting coefficients.
+ *   * a
+ *     * A point in \f$E(F_p)\f$.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void divisor_montgomeryTangentLine(DivisorLine *line, const FieldAffinePoint *a,
+                                   const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Computes the coefficients of the line through two points, which
+ * {@code divisor_montgomeryEvaluateLine} evaluates. As the coefficients do not
+ * depend on the point of evaluation, they can be reused.
+ *
+ * ## Parameters
+ *
+ *   * line
+ *     * The resulting coefficients.
+ *   * a
+ *     * A point in \f$E(F_p)\f$.
+ *   * aprime
+ *     * A point in \f$E(F_p)\f$.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void divisor_montgomeryChordLine(DivisorLine *line, const FieldAffinePoint *a,
+                                 const FieldAffinePoint *aprime,
+                                 const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Evaluates a line at a point, that is, computes \f$a x_B + b y_B + c\f$.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The resulting element of \f$F_p^2\f$. Must not alias bX or bY.
+ *   * line
+ *     * The coefficients of the line.
+ *   * bX
+ *     * The \f$x\f$ coordinate of a finite point in \f$E(F_p^2)\f$.
+ *   * bY
+ *     * The \f$y\f$ coordinate of a finite point in \f$E(F_p^2)\f$.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void divisor_montgomeryEvaluateDivisorLine(
+    ComplexFieldElement *result, const DivisorLine *line,
+    const ComplexFieldElement *bX, const ComplexFieldElement *bY,
+    const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Multiplies by a line evaluated at a point whose \f$y\f$ coordinate is in
+ * \f$F_p\f$, like the image of a point of \f$E(F_p)\f$ under the distortion
+ * map. The line value \f$(a x_B + b y_B + c)\f$ then has the imaginary part
+ * \f$a \Im(x_B)\f$ only, so it takes three multiplications in \f$F_p\f$
+ * instead of four, and none in \f$F_p^2\f$.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The element of \f$F_p^2\f$ to multiply. Must not alias bX.
+ *   * line
+ *     * The coefficients of the line.
+ *   * bX
+ *     * The \f$x\f$ coordinate of a finite point in \f$E(F_p^2)\f$.
+ *   * bY
+ *     * The \f$y\f$ coordinate of the point, which is in \f$F_p\f$.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void divisor_montgomeryMulDivisorLine(
+    ComplexFieldElement *result, const DivisorLine *line,
+    const ComplexFieldElement *bX, const FieldElement *bY,
+    const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Doubles a JacobianPoint and computes the tangent at it in the same pass,
+ * reusing the intermediate values of the doubling. The coefficients of the
+ * tangent are scaled by an element of \f$F_p\f$ to avoid inversions.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The doubled point. May alias a.
+ *   * line
+ *     * The coefficients of the tangent at a, scaled by an element of
+ * \f$F_p\f$.
+ *   * a
+ *     * A point in \f$E(F_p)\f$.
+ *   * curveA
+ *     * The Montgomery form \f$a\f$ coefficient of the curve.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void divisor_jacobianDoubleAndTangent(
+    JacobianPoint *result, DivisorLine *line, const JacobianPoint *a,
+    const FieldElement *curveA, const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Adds an affine point to a JacobianPoint and computes the line through them
+ * in the same pass, reusing the intermediate values of the addition. The
+ * coefficients of the line are scaled by an element of \f$F_p\f$ to avoid
+ * inversions.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The sum of the points. May alias a.
+ *   * line
+ *     * The coefficients of the line through a and aprime, scaled by an
+ * element of \f$F_p\f$.
+ *   * a
+ *     * A point in \f$E(F_p)\f$.
+ *   * aprime
+ *     * A point in \f$E(F_p)\f$.
+ *   * curveA
+ *     * The Montgomery form \f$a\f$ coefficient of the curve.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void divisor_jacobianAddAndChord(JacobianPoint *result, DivisorLine *line,
+                                 const JacobianPoint *a,
+                                 const FieldAffinePoint *aprime,
+                                 const FieldElement *curveA,
+                                 const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Same as {@code divisor_montgomeryEvaluateVertical} for a JacobianPoint,
+ * scaled by the element \f$Z^2\f$ of \f$F_p\f$.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The resulting element of \f$F_p^2\f$. Must not alias bX.
+ *   * a
+ *     * A point in \f$E(F_p)\f$.
+ *   * bX
+ *     * The \f$x\f$ coordinate of a finite point in \f$E(F_p^2)\f$.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void divisor_jacobianEvaluateVertical(
+    ComplexFieldElement *result, const JacobianPoint *a,
+    const ComplexFieldElement *bX, const MontgomeryContext *montgomeryContext);
 
 #endif
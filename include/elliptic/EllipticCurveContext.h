@@ -0,0 +1,189 @@
+#ifndef __CRYPTID_ELLIPTICCURVECONTEXT_H
+#define __CRYPTID_ELLIPTICCURVECONTEXT_H
+
+#include "gmp.h"
+
+#include "complex/ComplexFieldElement.h"
+#include "elliptic/EllipticCurve.h"
+#include "field/FieldElement.h"
+#include "field/MontgomeryContext.h"
+#include "util/Status.h"
+#include "util/ValidationMemo.h"
+
+/**
+ * ## Description
+ *
+ * Constants derived from the public parameters of a Type-1 curve, computed
+ * once when the parameters are loaded instead of on every pairing, hash or
+ * divisor evaluation.
+ */
+typedef struct EllipticCurveContext {
+  /**
+   * ## Description
+   *
+   * The elliptic curve itself.
+   */
+  EllipticCurve ellipticCurve;
+
+  /**
+   * ## Description
+   *
+   * The order \f$q\f$ of the subgroup.
+   */
+  mpz_t subgroupOrder;
+
+  /**
+   * ## Description
+   *
+   * The NAF of the subgroup order, least significant digit first, driving the
+   * Miller loop of the Tate pairing. The subgroup orders of the Solinas form
+   * \f$2^a \pm 2^b \pm 1\f$ have at most three nonzero digits.
+   */
+  signed char *subgroupOrderDigits;
+
+  /**
+   * ## Description
+   *
+   * The number of digits in {@code subgroupOrderDigits}.
+   */
+  size_t subgroupOrderDigitCount;
+
+  /**
+   * ## Description
+   *
+   * The exponent \f$\frac{2 \cdot p - 1}{3}\f$ taking cube roots in
+   * {@code hashToPoint}.
+   */
+  mpz_t cubeRootExponent;
+
+  /**
+   * ## Description
+   *
+   * The cofactor \f$\frac{p + 1}{q}\f$.
+   */
+  mpz_t cofactor;
+
+  /**
+   * ## Description
+   *
+   * The width-\f$w\f$ NAF of the cofactor, least significant digit first,
+   * used by the final exponentiation of the Tate pairing.
+   */
+  signed char *cofactorDigits;
+
+  /**
+   * ## Description
+   *
+   * The number of digits in {@code cofactorDigits}.
+   */
+  size_t cofactorDigitCount;
+
+  /**
+   * ## Description
+   *
+   * The width \f$w\f$ of {@code cofactorDigits}.
+   */
+  int cofactorWindowSize;
+
+  /**
+   * ## Description
+   *
+   * The value \f$-3 \mod p\f$, used by the tangent lines.
+   */
+  mpz_t minusThree;
+
+  /**
+   * ## Description
+   *
+   * The Montgomery form \f$a\f$ coefficient of the curve.
+   */
+  FieldElement *curveA;
+
+  /**
+   * ## Description
+   *
+   * The Montgomery form \f$\xi = \frac{p - 1}{2}(1 + 3^{\frac{p + 1}{4}}i)\f$
+   * of the distortion map.
+   */
+  ComplexFieldElement xi;
+
+  /**
+   * ## Description
+   *
+   * The storage {@code curveA} and {@code xi} are views into.
+   */
+  mp_limb_t *limbs;
+
+  /**
+   * ## Description
+   *
+   * The context of the field of the curve.
+   */
+  MontgomeryContext montgomeryContext;
+
+  /**
+   * ## Description
+   *
+   * Digest of the curve and the subgroup order, identifying them in the
+   * caches of the library.
+   */
+  unsigned char fingerprint[VALIDATION_MEMO_KEY_LENGTH];
+} EllipticCurveContext;
+
+/**
+ * ## Description
+ *
+ * Initializes a new EllipticCurveContext, computing the derived constants of
+ * the curve. The embedding degree of the Type-1 curves is always 2.
+ *
+ * ## Parameters
+ *
+ *   * contextOutput
+ *     * The EllipticCurveContext to be initialized. On CRYPTID_SUCCESS, this
+ * should be destroyed by the caller.
+ *   * ellipticCurve
+ *     * The elliptic curve.
+ *   * subgroupOrder
+ *     * The order of the subgroup.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus ellipticCurveContext_init(EllipticCurveContext *contextOutput,
+                                        const EllipticCurve ellipticCurve,
+                                        const mpz_t subgroupOrder);
+
+/**
+ * ## Description
+ *
+ * Computes the fingerprint an EllipticCurveContext of the curve and the
+ * subgroup order would have, without deriving the constants.
+ *
+ * ## Parameters
+ *
+ *   * fingerprint
+ *     * Out parameter holding {@code VALIDATION_MEMO_KEY_LENGTH} octets.
+ *   * ellipticCurve
+ *     * The elliptic curve.
+ *   * subgroupOrder
+ *     * The order of the subgroup.
+ */
+void ellipticCurveContext_computeFingerprint(unsigned char *fingerprint,
+                                             const EllipticCurve ellipticCurve,
+                                             const mpz_t subgroupOrder);
+
+/**
+ * ## Description
+ *
+ * Frees an EllipticCurveContext. After calling this function on an
+ * EllipticCurveContext instance, that instance should not be used anymore.
+ *
+ * ## Parameters
+ *
+ *   * context
+ *     * The EllipticCurveContext to be destroyed.
+ */
+void ellipticCurveContext_destroy(EllipticCurveContext context);
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef __CRYPTID_ELLIPTICCURVECONTEXTCACHE_H
+#define __CRYPTID_ELLIPTICCURVECONTEXTCACHE_H
+
+#include "gmp.h"
+
+#include "elliptic/EllipticCurve.h"
+#include "elliptic/EllipticCurveContext.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * The number of contexts the cache holds. Once full, the oldest context is
+ * evicted. Must be at least 1. Can be overridden at compile time.
+ */
+#ifndef ELLIPTIC_CURVE_CONTEXT_CACHE_CAPACITY
+#define ELLIPTIC_CURVE_CONTEXT_CACHE_CAPACITY 4
+#endif
+
+/**
+ * ## Description
+ *
+ * Looks up the EllipticCurveContext of a curve and a subgroup order by their
+ * fingerprint, and initializes it only if it is not in the cache yet. This way
+ * the operations taking serialized public parameters derive the constants of
+ * the curve once, not on every call. Safe to call from multiple threads.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the context. On CRYPTID_SUCCESS, this should be
+ * released by the caller with {@code ellipticCurveContextCache_release}, and
+ * must not be destroyed.
+ *   * ellipticCurve
+ *     * The elliptic curve.
+ *   * subgroupOrder
+ *     * The order of the subgroup.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus
+ellipticCurveContextCache_acquire(const EllipticCurveContext **result,
+                                  const EllipticCurve ellipticCurve,
+                                  const mpz_t subgroupOrder);
+
+/**
+ * ## Description
+ *
+ * Releases a context acquired with {@code ellipticCurveContextCache_acquire}.
+ * The context is destroyed once it is released by every caller and is no
+ * longer in the cache. Safe to call from multiple threads.
+ *
+ * ## Parameters
+ *
+ *   * context
+ *     * The context to release.
+ */
+void ellipticCurveContextCache_release(const EllipticCurveContext *context);
+
+/**
+ * ## Description
+ *
+ * Removes every context from the cache. The contexts still acquired remain
+ * usable until they are released. Safe to call from multiple threads.
+ */
+void ellipticCurveContextCache_flush(void);
+
+#endif
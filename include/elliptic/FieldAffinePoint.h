@@ -0,0 +1,210 @@
+#ifndef __CRYPTID_FIELDAFFINEPOINT_H
+#define __CRYPTID_FIELDAFFINEPOINT_H
+
+#include "elliptic/AffinePoint.h"
+#include "field/FieldElement.h"
+#include "field/MontgomeryContext.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * Affine point with fixed-width Montgomery form coordinates. Views
+ * {@code 2 * limbCount} limbs owned by the caller, see
+ * {@code fieldAffine_view}. Does not need to be initialized or destroyed.
+ * Assigning a FieldAffinePoint copies the view, not the coordinates.
+ */
+typedef struct FieldAffinePoint {
+  /**
+   * ## Description
+   *
+   * The \f$x\f$ coordinate.
+   */
+  FieldElement *x;
+
+  /**
+   * ## Description
+   *
+   * The \f$y\f$ coordinate.
+   */
+  FieldElement *y;
+
+  /**
+   * ## Description
+   *
+   * Nonzero if the point is the point at infinity, in which case the
+   * coordinates are meaningless.
+   */
+  int isInfinity;
+} FieldAffinePoint;
+
+/**
+ * ## Description
+ *
+ * Creates a FieldAffinePoint over caller-owned storage. The point is the point
+ * at infinity until its coordinates are set.
+ *
+ * ## Parameters
+ *
+ *   * limbs
+ *     * Storage for {@code 2 * limbCount} limbs, \f$x\f$ then \f$y\f$.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ *
+ * ## Return Value
+ *
+ * The point viewing {@code limbs}.
+ */
+FieldAffinePoint fieldAffine_view(mp_limb_t *limbs,
+                                  const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Converts an AffinePoint into a FieldAffinePoint.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The resulting point.
+ *   * affinePoint
+ *     * The point to convert.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void fieldAffine_fromAffinePoint(FieldAffinePoint *result,
+                                 const AffinePoint affinePoint,
+                                 const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Converts a FieldAffinePoint into an AffinePoint with canonical coordinates.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the resulting point. Should be destroyed by the
+ * caller.
+ *   * point
+ *     * The point to convert.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void fieldAffine_toAffinePoint(AffinePoint *result,
+                               const FieldAffinePoint *point,
+                               const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Copies a FieldAffinePoint.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The destination.
+ *   * point
+ *     * The source.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void fieldAffine_copy(FieldAffinePoint *result, const FieldAffinePoint *point,
+                      const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Checks whether two FieldAffinePoints are equal.
+ *
+ * ## Parameters
+ *
+ *   * point1
+ *     * A point.
+ *   * point2
+ *     * A point.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ *
+ * ## Return Value
+ *
+ * 1 if the points are equal, 0 otherwise.
+ */
+int fieldAffine_isEquals(const FieldAffinePoint *point1,
+                         const FieldAffinePoint *point2,
+                         const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Computes the additive inverse of a FieldAffinePoint. The result may alias
+ * the operand.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The negated point.
+ *   * point
+ *     * The point to negate.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void fieldAffine_negate(FieldAffinePoint *result, const FieldAffinePoint *point,
+                        const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Same as {@code affine_double}, operating on a FieldAffinePoint. The result
+ * may alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The result of the operation.
+ *   * point
+ *     * The point to double.
+ *   * curveA
+ *     * The Montgomery form \f$a\f$ coefficient of the curve.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus fieldAffine_double(FieldAffinePoint *result,
+                                 const FieldAffinePoint *point,
+                                 const FieldElement *curveA,
+                                 const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Same as {@code affine_add}, operating on FieldAffinePoints. The result may
+ * alias any of the operands.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The result of the addition.
+ *   * point1
+ *     * A FieldAffinePoint.
+ *   * point2
+ *     * A FieldAffinePoint.
+ *   * curveA
+ *     * The Montgomery form \f$a\f$ coefficient of the curve.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus fieldAffine_add(FieldAffinePoint *result,
+                              const FieldAffinePoint *point1,
+                              const FieldAffinePoint *point2,
+                              const FieldElement *curveA,
+                              const MontgomeryContext *montgomeryContext);
+
+#endif
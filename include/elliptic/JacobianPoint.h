@@ -0,0 +1,255 @@
+#ifndef __CRYPTID_JACOBIANPOINT_H
+#define __CRYPTID_JACOBIANPOINT_H
+
+#include <stddef.h>
+
+#include "elliptic/FieldAffinePoint.h"
+#include "field/FieldElement.h"
+#include "field/MontgomeryContext.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * Point in Jacobian projective coordinates with fixed-width Montgomery form
+ * coordinates. The triple \f$(X, Y, Z)\f$ represents the affine point
+ * \f$(X/Z^2, Y/Z^3)\f$, while \f$Z = 0\f$ represents the point at infinity.
+ * Addition and doubling do not need field inversions. Views
+ * {@code 3 * limbCount} limbs owned by the caller, see {@code jacobian_view}.
+ * Assigning a JacobianPoint copies the view, not the coordinates.
+ */
+typedef struct JacobianPoint {
+  /**
+   * ## Description
+   *
+   * The \f$X\f$ coordinate.
+   */
+  FieldElement *x;
+
+  /**
+   * ## Description
+   *
+   * The \f$Y\f$ coordinate.
+   */
+  FieldElement *y;
+
+  /**
+   * ## Description
+   *
+   * The \f$Z\f$ coordinate.
+   */
+  FieldElement *z;
+} JacobianPoint;
+
+/**
+ * ## Description
+ *
+ * Creates a JacobianPoint over caller-owned storage.
+ *
+ * ## Parameters
+ *
+ *   * limbs
+ *     * Storage for {@code 3 * limbCount} limbs, \f$X\f$, \f$Y\f$ then
+ * \f$Z\f$.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ *
+ * ## Return Value
+ *
+ * The point viewing {@code limbs}.
+ */
+JacobianPoint jacobian_view(mp_limb_t *limbs,
+                            const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Copies the coordinates of a JacobianPoint.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The destination.
+ *   * point
+ *     * The source.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void jacobian_copy(JacobianPoint *result, const JacobianPoint *point,
+                   const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Sets a JacobianPoint to the point at infinity.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The point to set.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void jacobian_setInfinity(JacobianPoint *result,
+                          const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Checks whether a JacobianPoint is the point at infinity.
+ *
+ * ## Parameters
+ *
+ *   * point
+ *     * The point to check.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ *
+ * ## Return Value
+ *
+ * 1 if the point is the point at infinity, 0 otherwise.
+ */
+int jacobian_isInfinity(const JacobianPoint *point,
+                        const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Converts a FieldAffinePoint into Jacobian coordinates by setting
+ * \f$Z = 1\f$.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The resulting point.
+ *   * point
+ *     * The point to convert.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void jacobian_fromFieldAffinePoint(JacobianPoint *result,
+                                   const FieldAffinePoint *point,
+                                   const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Converts a JacobianPoint back to affine coordinates, at the cost of a single
+ * field inversion.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The resulting point.
+ *   * point
+ *     * The point to convert.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus
+jacobian_toFieldAffinePoint(FieldAffinePoint *result,
+                            const JacobianPoint *point,
+                            const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Converts multiple JacobianPoints back to affine coordinates at the cost of a
+ * single field inversion, using Montgomery's simultaneous inversion trick.
+ *
+ * ## Parameters
+ *
+ *   * results
+ *     * The resulting points, at least count long.
+ *   * points
+ *     * The points to convert.
+ *   * count
+ *     * The number of points.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus
+jacobian_toFieldAffinePoints(FieldAffinePoint *results,
+                             const JacobianPoint *points, const size_t count,
+                             const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Doubles a JacobianPoint. Curves with \f$a = 0\f$, like the Type-1 curves,
+ * take a faster path. The result may alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The result of the operation.
+ *   * point
+ *     * The point to double.
+ *   * curveA
+ *     * The Montgomery form \f$a\f$ coefficient of the curve.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void jacobian_double(JacobianPoint *result, const JacobianPoint *point,
+                     const FieldElement *curveA,
+                     const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Adds an affine point to a JacobianPoint (mixed addition). The result may
+ * alias the Jacobian operand.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The result of the addition.
+ *   * point1
+ *     * A JacobianPoint.
+ *   * point2
+ *     * A FieldAffinePoint.
+ *   * curveA
+ *     * The Montgomery form \f$a\f$ coefficient of the curve, used if the
+ * addition turns out to be a doubling.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void jacobian_addMixed(JacobianPoint *result, const JacobianPoint *point1,
+                       const FieldAffinePoint *point2,
+                       const FieldElement *curveA,
+                       const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Adds two JacobianPoints. Mixed addition is cheaper, and should be preferred
+ * if one of the operands is available in affine coordinates. The result may
+ * alias any of the operands.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The result of the addition.
+ *   * point1
+ *     * A JacobianPoint.
+ *   * point2
+ *     * A JacobianPoint.
+ *   * curveA
+ *     * The Montgomery form \f$a\f$ coefficient of the curve, used if the
+ * addition turns out to be a doubling.
+ *   * montgomeryContext
+ *     * The context of the field of the curve.
+ */
+void jacobian_add(JacobianPoint *result, const JacobianPoint *point1,
+                  const JacobianPoint *point2, const FieldElement *curveA,
+                  const MontgomeryContext *montgomeryContext);
+
+#endif
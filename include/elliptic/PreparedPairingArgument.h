@@ -0,0 +1,149 @@
+#ifndef __CRYPTID_PREPAREDPAIRINGARGUMENT_H
+#define __CRYPTID_PREPAREDPAIRINGARGUMENT_H
+
+#include <stddef.h>
+
+#include "gmp.h"
+
+#include "elliptic/AffinePoint.h"
+#include "elliptic/Divisor.h"
+#include "elliptic/EllipticCurveContext.h"
+#include "field/FieldElement.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * The first argument of the Tate pairing, prepared for repeated pairings. The
+ * point arithmetic of Miller's algorithm only depends on this argument, so
+ * the lines of every step can be computed once. A step is a doubling, or an
+ * addition after the doubling for every nonzero digit in the NAF of the
+ * subgroup order.
+ */
+typedef struct PreparedPairingArgument {
+  /**
+   * ## Description
+   *
+   * The number of steps.
+   */
+  size_t stepCount;
+
+  /**
+   * ## Description
+   *
+   * The number of limbs of a coefficient.
+   */
+  size_t limbCount;
+
+  /**
+   * ## Description
+   *
+   * The \f$a\f$, \f$b\f$ and \f$c\f$ coefficients of the line, and the
+   * \f$x\f$ coordinate of the vertical line of every step, each taking
+   * {@code limbCount} limbs.
+   */
+  mp_limb_t *coefficients;
+
+  /**
+   * ## Description
+   *
+   * 1 if the step has a vertical line, 0 if the vertical line would go
+   * through the point at infinity.
+   */
+  unsigned char *hasVertical;
+
+  /**
+   * ## Description
+   *
+   * The \f$x\f$ coordinate of the point, taking {@code limbCount} limbs, for
+   * the vertical line of the negative digits. NULL if the point is the point
+   * at infinity.
+   */
+  mp_limb_t *pointX;
+} PreparedPairingArgument;
+
+/**
+ * ## Description
+ *
+ * Prepares a point to be the first argument of
+ * {@code tate_performPreparedPairing}.
+ *
+ * ## Parameters
+ *
+ *   * argumentOutput
+ *     * The PreparedPairingArgument to be initialized. On CRYPTID_SUCCESS,
+ * this should be destroyed by the caller.
+ *   * p
+ *     * A point of \f$E[r]\f$.
+ *   * context
+ *     * The context of the elliptic curve. The same context must be used for
+ * the pairings.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus
+preparedPairingArgument_init(PreparedPairingArgument *argumentOutput,
+                             const AffinePoint p,
+                             const EllipticCurveContext *context);
+
+/**
+ * ## Description
+ *
+ * Frees a PreparedPairingArgument. After calling this function on a
+ * PreparedPairingArgument instance, that instance should not be used anymore.
+ *
+ * ## Parameters
+ *
+ *   * argument
+ *     * The PreparedPairingArgument to be destroyed.
+ */
+void preparedPairingArgument_destroy(PreparedPairingArgument argument);
+
+/**
+ * ## Description
+ *
+ * Loads the lines of a step.
+ *
+ * ## Parameters
+ *
+ *   * line
+ *     * The line of the step.
+ *   * verticalX
+ *     * The \f$x\f$ coordinate of the vertical line of the step. Only set if
+ * the step has a vertical line.
+ *   * argument
+ *     * The prepared argument.
+ *   * step
+ *     * The index of the step.
+ *
+ * ## Return Value
+ *
+ * 1 if the step has a vertical line, 0 otherwise.
+ */
+int preparedPairingArgument_loadStep(DivisorLine *line, FieldElement *verticalX,
+                                     const PreparedPairingArgument *argument,
+                                     const size_t step);
+
+/**
+ * ## Description
+ *
+ * Loads the \f$x\f$ coordinate of the point.
+ *
+ * ## Parameters
+ *
+ *   * x
+ *     * The \f$x\f$ coordinate. Only set if the point is not the point at
+ * infinity.
+ *   * argument
+ *     * The prepared argument.
+ *
+ * ## Return Value
+ *
+ * 1 if the point is not the point at infinity, 0 otherwise.
+ */
+int preparedPairingArgument_loadPointX(FieldElement *x,
+                                       const PreparedPairingArgument *argument);
+
+#endif
@@ -7,6 +7,8 @@
 #include "elliptic/AffinePoint.h"
 #include "elliptic/ComplexAffinePoint.h"
 #include "elliptic/EllipticCurve.h"
+#include "elliptic/EllipticCurveContext.h"
+#include "elliptic/PreparedPairingArgument.h"
 #include "util/Status.h"
 
 /**
@@ -23,12 +25,9 @@
  *     * A point of \f$E[r]\f$.
  *   * b
  *     * A point of \f$E[r]\f$.
- *   * embeddingDegree
- *     * The embedding degree of the curve.
- *   * subgroupOrder
- *     * The order of the subgroup.
- *   * ellipticCurve
- *     * The elliptic curve to operate on.
+ *   * context
+ *     * The context of the elliptic curve to operate on, holding the order of
+ * the subgroup and the embedding degree.
  *
  * ## Return Value
  *
@@ -36,8 +35,97 @@
  */
 CryptidStatus tate_performPairing(Complex *result, const AffinePoint p,
                                   const AffinePoint b,
-                                  const int embeddingDegree,
-                                  const mpz_t subgroupOrder,
-                                  const EllipticCurve ellipticCurve);
+                                  const EllipticCurveContext *context);
+
+/**
+ * ## Description
+ *
+ * Computes the product \f$\prod_{i} e(p_i, b_i)\f$ of Tate pairings. The
+ * Miller loops share the squarings of the accumulator, and the product has a
+ * single final exponentiation.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the resulting Complex value. On CRYPTID_SUCCESS, this
+ * should be destroyed by the caller.
+ *   * ps
+ *     * The first arguments, points of \f$E[r]\f$.
+ *   * bs
+ *     * The second arguments, points of \f$E[r]\f$, one for every first
+ * argument.
+ *   * count
+ *     * The number of pairs.
+ *   * context
+ *     * The context of the elliptic curve to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus tate_performMultiPairing(Complex *result, const AffinePoint *ps,
+                                       const AffinePoint *bs,
+                                       const size_t count,
+                                       const EllipticCurveContext *context);
+
+/**
+ * ## Description
+ *
+ * Computes the Tate pairings \f$e(p_i, b_i)\f$ of independent pairs. The
+ * final exponentiations share a single inversion in \f$F_p\f$ through
+ * Montgomery's trick.
+ *
+ * ## Parameters
+ *
+ *   * results
+ *     * Out parameter to the resulting Complex values, one for every pair. On
+ * CRYPTID_SUCCESS, each of these should be destroyed by the caller.
+ *   * ps
+ *     * The first arguments, points of \f$E[r]\f$.
+ *   * bs
+ *     * The second arguments, points of \f$E[r]\f$, one for every first
+ * argument.
+ *   * count
+ *     * The number of pairs.
+ *   * context
+ *     * The context of the elliptic curve to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus tate_performPairingBatch(Complex *results, const AffinePoint *ps,
+                                       const AffinePoint *bs,
+                                       const size_t count,
+                                       const EllipticCurveContext *context);
+
+/**
+ * ## Description
+ *
+ * Same as {@code tate_performPairing}, with a prepared first argument. Only
+ * the lines are evaluated at the second argument, so the loop does no point
+ * arithmetic and no inversions. As the pairing is symmetric, a fixed second
+ * argument can be prepared as well by swapping the arguments.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the resulting Complex value. On CRYPTID_SUCCESS, this
+ * should be destroyed by the caller.
+ *   * p
+ *     * The prepared first argument.
+ *   * b
+ *     * A point of \f$E[r]\f$.
+ *   * context
+ *     * The context the first argument has been prepared with.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus tate_performPreparedPairing(Complex *result,
+                                          const PreparedPairingArgument *p,
+                                          const AffinePoint b,
+                                          const EllipticCurveContext *context);
 
 #endif
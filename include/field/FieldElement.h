@@ -0,0 +1,304 @@
+#ifndef __CRYPTID_FIELDELEMENT_H
+#define __CRYPTID_FIELDELEMENT_H
+
+#include <limits.h>
+
+#include "gmp.h"
+
+#include "field/MontgomeryContext.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * The bit length of the widest field supported by FieldElement, which is the
+ * field size of the highest SecurityLevel. It bounds the stack usage of the
+ * temporaries.
+ */
+#define FIELDELEMENT_MAX_BITS 7680
+
+/**
+ * ## Description
+ *
+ * The number of limbs of the widest supported field.
+ */
+#define FIELDELEMENT_MAX_LIMBS                                                 \
+  (FIELDELEMENT_MAX_BITS / (sizeof(mp_limb_t) * CHAR_BIT))
+
+/**
+ * ## Description
+ *
+ * Fixed-width element of \f$F_p\f$ in Montgomery form. A
+ * {@code FieldElement *} points to the first of the {@code limbCount} limbs of
+ * the MontgomeryContext, least significant first, and the element is always
+ * fully reduced. The storage is sized from the context, so at the lower
+ * security levels the elements are a fraction of the size of the widest field.
+ * Storage is declared in limbs, temporaries being variable length arrays on
+ * the stack, like
+ *
+ * {@code mp_limb_t t[montgomeryContext->limbCount];}
+ *
+ * and do not need to be initialized or destroyed.
+ */
+typedef mp_limb_t FieldElement;
+
+/**
+ * ## Description
+ *
+ * Checks whether the field of the context fits into a FieldElement.
+ *
+ * ## Parameters
+ *
+ *   * montgomeryContext
+ *     * The context of the field.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if the field is supported,
+ * CRYPTID_FIELD_SIZE_NOT_SUPPORTED_ERROR otherwise.
+ */
+CryptidStatus
+fieldElement_checkSupported(const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Converts an arbitrary integer into a Montgomery form FieldElement.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The resulting element.
+ *   * value
+ *     * The integer to convert. Does not need to be reduced.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void fieldElement_fromMpz(FieldElement *result, const mpz_t value,
+                          const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Converts a FieldElement into its canonical integer representative.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the canonical value. Must be initialized.
+ *   * element
+ *     * The element to convert.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void fieldElement_toMpz(mpz_t result, const FieldElement *element,
+                        const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Sets a FieldElement to zero.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The element to set.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void fieldElement_setZero(FieldElement *result,
+                          const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Sets a FieldElement to one.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The element to set.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void fieldElement_setOne(FieldElement *result,
+                         const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Copies a FieldElement.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * The destination.
+ *   * element
+ *     * The source.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void fieldElement_copy(FieldElement *result, const FieldElement *element,
+                       const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Checks whether a FieldElement is zero.
+ *
+ * ## Parameters
+ *
+ *   * element
+ *     * The element to check.
+ *   * montgomeryContext
+ *     * The context of the field.
+ *
+ * ## Return Value
+ *
+ * 1 if the element is zero, 0 otherwise.
+ */
+int fieldElement_isZero(const FieldElement *element,
+                        const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Checks whether two FieldElements are equal.
+ *
+ * ## Parameters
+ *
+ *   * element1
+ *     * A FieldElement.
+ *   * element2
+ *     * A FieldElement.
+ *   * montgomeryContext
+ *     * The context of the field.
+ *
+ * ## Return Value
+ *
+ * 1 if the elements are equal, 0 otherwise.
+ */
+int fieldElement_isEquals(const FieldElement *element1,
+                          const FieldElement *element2,
+                          const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Adds two FieldElements. The result may alias any of the operands.
+ *
+ * ## Parameters
+ *
+ *   * sum
+ *     * The result of the addition.
+ *   * augend
+ *     * The element to which the addend is added.
+ *   * addend
+ *     * The element that is added to the augend.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void fieldElement_add(FieldElement *sum, const FieldElement *augend,
+                      const FieldElement *addend,
+                      const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Subtracts two FieldElements. The result may alias any of the operands.
+ *
+ * ## Parameters
+ *
+ *   * difference
+ *     * The result of the subtraction.
+ *   * minuend
+ *     * The element from which the subtrahend is subtracted.
+ *   * subtrahend
+ *     * The element that is subtracted from the minuend.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void fieldElement_sub(FieldElement *difference, const FieldElement *minuend,
+                      const FieldElement *subtrahend,
+                      const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Computes the additive inverse of a FieldElement. The result may alias the
+ * operand.
+ *
+ * ## Parameters
+ *
+ *   * negation
+ *     * The additive inverse.
+ *   * operand
+ *     * The element to negate.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void fieldElement_negate(FieldElement *negation, const FieldElement *operand,
+                         const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Multiplies two FieldElements. The result may alias any of the operands.
+ *
+ * ## Parameters
+ *
+ *   * product
+ *     * The result of the multiplication.
+ *   * multiplier
+ *     * The element to multiply with.
+ *   * multiplicand
+ *     * The element to be multiplied by the multiplier.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void fieldElement_mul(FieldElement *product, const FieldElement *multiplier,
+                      const FieldElement *multiplicand,
+                      const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Squares a FieldElement. The result may alias the operand.
+ *
+ * ## Parameters
+ *
+ *   * square
+ *     * The result of the squaring.
+ *   * operand
+ *     * The element to square.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void fieldElement_square(FieldElement *square, const FieldElement *operand,
+                         const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Computes the multiplicative inverse of a FieldElement. The result may alias
+ * the operand.
+ *
+ * ## Parameters
+ *
+ *   * inverse
+ *     * The multiplicative inverse.
+ *   * operand
+ *     * The element to invert.
+ *   * montgomeryContext
+ *     * The context of the field.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_HAS_NO_MUL_INV_ERROR if
+ * the operand is not invertible.
+ */
+CryptidStatus fieldElement_invert(FieldElement *inverse,
+                                  const FieldElement *operand,
+                                  const MontgomeryContext *montgomeryContext);
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef __CRYPTID_MONTGOMERY_CONTEXT_H
+#define __CRYPTID_MONTGOMERY_CONTEXT_H
+
+#include <stddef.h>
+
+#include "gmp.h"
+
+/**
+ * ## Description
+ *
+ * Precomputed constants for Montgomery arithmetic over \f$F_p\f$. With
+ * \f$R = 2^{wn}\f$, where \f$w\f$ is the bit size of a limb and \f$n\f$ is the
+ * number of limbs in \f$p\f$, an element \f$a\f$ is represented by
+ * \f$aR \mod p\f$, which lets multiplications reduce without trial division.
+ */
+typedef struct MontgomeryContext {
+  /**
+   * ## Description
+   *
+   * The odd modulus \f$p\f$.
+   */
+  mpz_t modulus;
+
+  /**
+   * ## Description
+   *
+   * The number of limbs in the modulus.
+   */
+  size_t limbCount;
+
+  /**
+   * ## Description
+   *
+   * \f$-p^{-1} \mod 2^w\f$.
+   */
+  mp_limb_t modulusInverse;
+
+  /**
+   * ## Description
+   *
+   * \f$R \mod p\f$, the Montgomery form of one.
+   */
+  mpz_t r;
+
+  /**
+   * ## Description
+   *
+   * \f$R^2 \mod p\f$, used to convert into the Montgomery domain.
+   */
+  mpz_t rSquared;
+
+  /**
+   * ## Description
+   *
+   * \f$R^3 \mod p\f$, used to fix up inverses computed by GMP.
+   */
+  mpz_t rCubed;
+} MontgomeryContext;
+
+/**
+ * ## Description
+ *
+ * Initializes a new MontgomeryContext for the specified modulus.
+ *
+ * ## Parameters
+ *
+ *   * montgomeryContextOutput
+ *     * The MontgomeryContext to be initialized.
+ *   * modulus
+ *     * An odd modulus.
+ */
+void montgomeryContext_init(MontgomeryContext *montgomeryContextOutput,
+                            const mpz_t modulus);
+
+/**
+ * ## Description
+ *
+ * Frees a MontgomeryContext.
+ *
+ * ## Parameters
+ *
+ *   * montgomeryContext
+ *     * The MontgomeryContext to be destroyed.
+ */
+void montgomeryContext_destroy(MontgomeryContext montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Montgomery reduction of a double-width value.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the \f$n\f$ limbs of \f$TR^{-1} \mod p\f$. Must not
+ * overlap with t.
+ *   * t
+ *     * The \f$2n\f$ limbs of \f$T < pR\f$. Used as scratch space.
+ *   * montgomeryContext
+ *     * The context of the field.
+ */
+void montgomery_reduce(mp_limb_t *result, mp_limb_t *t,
+                       const MontgomeryContext *montgomeryContext);
+
+#endif
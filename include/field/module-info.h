@@ -0,0 +1,3 @@
+#ifndef __CRYPTID_PRIME_FIELD_ARITHMETICS_MODULE
+#define __CRYPTID_PRIME_FIELD_ARITHMETICS_MODULE
+#endif
@@ -5,19 +5,24 @@
 
 #include "gmp.h"
 
-#include "elliptic/AffinePoint.h"
 #include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertextAsBinary.h"
 #include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary.h"
+#include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPreparedIdentity.h"
+#include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPreparedPrivateKey.h"
+#include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPreparedPublicParameters.h"
 #include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary.h"
+#include "pairing/PairingGroupElementAsBinary.h"
+#include "pairing/PairingGroupType.h"
 #include "util/SecurityLevel.h"
 #include "util/Status.h"
 
 /**
  * ## Description
  *
- * Establishes a master secret and public parameters for a given security level.
- * The master secret (as its name suggests) should be kept secret, while the
- * public parameters can be distributed among the clients.
+ * Establishes a master secret and public parameters for a given security level
+ * on a pairingGroup_TYPE_1 group. The master secret (as its name suggests)
+ * should be kept secret, while the public parameters can be distributed among
+ * the clients.
  *
  * ## Parameters
  *
@@ -46,6 +51,47 @@ CryptidStatus cryptid_ibe_bonehFranklin_setup(
         *publicParametersAsBinary,
     const SecurityLevel securityLevel);
 
+/**
+ * ## Description
+ *
+ * Same as {@code cryptid_ibe_bonehFranklin_setup}, on the selected pairing
+ * group. The identities and the private keys are elements of \f$G_1\f$, while
+ * \f$P\f$, \f$P_{pub}\f$ and the first part of the ciphertexts are elements
+ * of \f$G_2\f$. pairingGroup_BLS12_381 supports the security levels up to
+ * MEDIUM.
+ *
+ * ## Parameters
+ *
+ *   * masterSecretAsBinary
+ *     * Out parameter which will hold the master secret. If the return value is
+ * CRYPTID_SUCCESS, then it will point to a
+ * [BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary.h#BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * publicParametersAsBinary
+ *     * Pointer in which the public parameters will be stored. If the return
+ * value is CRYPTID_SUCCESS, then it will point to correctly filled
+ * [BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary.h#BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary)
+ * instance.
+ *   * securityLevel
+ *     * The desired security level.
+ *   * pairingGroupType
+ *     * The pairing group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right,
+ * CRYPTID_SECURITY_LEVEL_NOT_SUPPORTED_ERROR if the group does not reach the
+ * security level.
+ */
+CryptidStatus cryptid_ibe_bonehFranklin_setupForPairingGroup(
+    BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary
+        *masterSecretAsBinary,
+    BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
+        *publicParametersAsBinary,
+    const SecurityLevel securityLevel,
+    const PairingGroupType pairingGroupType);
+
 /**
  * ## Description
  *
@@ -55,8 +101,8 @@ CryptidStatus cryptid_ibe_bonehFranklin_setup(
  *
  *   * result
  *     * Out parameter holding the private key in binary format. If the return
- * value is CRYPTID_SUCCESS, then it will point to an
- * [AffinePointAsBinary](codebase://elliptic/AffinePointAsBinary.h#AffinePointAsBinary)
+ * value is CRYPTID_SUCCESS, then it will point to a
+ * [PairingGroupElementAsBinary](codebase://pairing/PairingGroupElementAsBinary.h#PairingGroupElementAsBinary)
  * instance, that must be destroyed by the caller. Initialization is done by
  * this function.
  *   * identity
@@ -73,7 +119,7 @@ CryptidStatus cryptid_ibe_bonehFranklin_setup(
  * CRYPTID_SUCCESS if everything went right.
  */
 CryptidStatus cryptid_ibe_bonehFranklin_extract(
-    AffinePointAsBinary *result, const char *const identity,
+    PairingGroupElementAsBinary *result, const char *const identity,
     const size_t identityLength,
     const BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary
         masterSecretAsBinary,
@@ -141,10 +187,244 @@ CryptidStatus cryptid_ibe_bonehFranklin_decrypt(
     char **result,
     const BonehFranklinIdentityBasedEncryptionCiphertextAsBinary
         ciphertextAsBinary,
-    const AffinePointAsBinary privateKeyAsBinary,
+    const PairingGroupElementAsBinary privateKeyAsBinary,
+    const BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
+        publicParametersAsBinary);
+
+/**
+ * ## Description
+ *
+ * Imports and validates the public parameters once, and precomputes the values
+ * the prepared variants of extraction, encryption and decryption reuse: the
+ * constants of the curve, a fixed-base table of \f$P\f$ and the Miller lines of
+ * \f$P_{pub}\f$. Worth it when the same public parameters serve many
+ * operations.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter holding the prepared public parameters. If the return
+ * value is CRYPTID_SUCCESS, then it will point to a
+ * [BonehFranklinIdentityBasedEncryptionPreparedPublicParameters](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPreparedPublicParameters.h#BonehFranklinIdentityBasedEncryptionPreparedPublicParameters)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * publicParametersAsBinary
+ *     * The BF-IBE public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibe_bonehFranklin_prepare(
+    BonehFranklinIdentityBasedEncryptionPreparedPublicParameters *result,
     const BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
         publicParametersAsBinary);
 
+/**
+ * ## Description
+ *
+ * Imports and validates a private key once, and precomputes the Miller lines
+ * of the key for the pairing of decryption.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter holding the prepared private key. If the return value is
+ * CRYPTID_SUCCESS, then it will point to a
+ * [BonehFranklinIdentityBasedEncryptionPreparedPrivateKey](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPreparedPrivateKey.h#BonehFranklinIdentityBasedEncryptionPreparedPrivateKey)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * privateKeyAsBinary
+ *     * The private key to prepare.
+ *   * preparedPublicParameters
+ *     * The prepared BF-IBE public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibe_bonehFranklin_preparePrivateKey(
+    BonehFranklinIdentityBasedEncryptionPreparedPrivateKey *result,
+    const PairingGroupElementAsBinary privateKeyAsBinary,
+    const BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        *preparedPublicParameters);
+
+/**
+ * ## Description
+ *
+ * Hashes a recipient identity and computes its pairing value
+ * \f$\mathrm{Pairing}(Q_{id}, P_{pub})\f$ once, together with a fixed-base
+ * table of it. Worth it when many messages are encrypted to the same
+ * recipient, as encryption to a prepared identity skips both hashing the
+ * identity and the pairing.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter holding the prepared identity. If the return value is
+ * CRYPTID_SUCCESS, then it will point to a
+ * [BonehFranklinIdentityBasedEncryptionPreparedIdentity](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPreparedIdentity.h#BonehFranklinIdentityBasedEncryptionPreparedIdentity)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * identity
+ *     * The identity string to prepare.
+ *   * identityLength
+ *     * The length of the identity string.
+ *   * preparedPublicParameters
+ *     * The prepared BF-IBE public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibe_bonehFranklin_prepareIdentity(
+    BonehFranklinIdentityBasedEncryptionPreparedIdentity *result,
+    const char *const identity, const size_t identityLength,
+    const BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        *preparedPublicParameters);
+
+/**
+ * ## Description
+ *
+ * Same as {@code cryptid_ibe_bonehFranklin_extract}, with prepared public
+ * parameters.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter holding the private key in binary format. If the return
+ * value is CRYPTID_SUCCESS, then it will point to a
+ * [PairingGroupElementAsBinary](codebase://pairing/PairingGroupElementAsBinary.h#PairingGroupElementAsBinary)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * identity
+ *     * The identity string we're extracting the private key for.
+ *   * identityLength
+ *     * The length of the identity string.
+ *   * masterSecretAsBinary
+ *     * The master secret corresponding to the public parameters.
+ *   * preparedPublicParameters
+ *     * The prepared BF-IBE public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibe_bonehFranklin_extractPrepared(
+    PairingGroupElementAsBinary *result, const char *const identity,
+    const size_t identityLength,
+    const BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary
+        masterSecretAsBinary,
+    const BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        *preparedPublicParameters);
+
+/**
+ * ## Description
+ *
+ * Same as {@code cryptid_ibe_bonehFranklin_encrypt}, with prepared public
+ * parameters. \f$U = [l]P\f$ is computed from the fixed-base table and the
+ * pairing reuses the Miller lines of \f$P_{pub}\f$.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter storing the ciphertext. If the return value is
+ * CRYPTID_SUCCESS, then it will point to a
+ * [BonehFranklinIdentityBasedEncryptionCiphertextAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertextAsBinary.h#BonehFranklinIdentityBasedEncryptionCiphertextAsBinary)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * message
+ *     * The string to encrypt.
+ *   * messageLength
+ *     * The length of the message string.
+ *   * identity
+ *     * The identity string to encrypt with.
+ *   * identityLength
+ *     * The length of the identity string.
+ *   * preparedPublicParameters
+ *     * The prepared BF-IBE public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibe_bonehFranklin_encryptPrepared(
+    BonehFranklinIdentityBasedEncryptionCiphertextAsBinary *result,
+    const char *const message, const size_t messageLength,
+    const char *const identity, const size_t identityLength,
+    const BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        *preparedPublicParameters);
+
+/**
+ * ## Description
+ *
+ * Same as {@code cryptid_ibe_bonehFranklin_encryptPrepared}, with a prepared
+ * recipient identity. No pairing is computed, \f$\mathrm{theta}^l\f$ is
+ * computed from the fixed-base table of the identity.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter storing the ciphertext. If the return value is
+ * CRYPTID_SUCCESS, then it will point to a
+ * [BonehFranklinIdentityBasedEncryptionCiphertextAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertextAsBinary.h#BonehFranklinIdentityBasedEncryptionCiphertextAsBinary)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * message
+ *     * The string to encrypt.
+ *   * messageLength
+ *     * The length of the message string.
+ *   * preparedIdentity
+ *     * The recipient identity, prepared against
+ * {@code preparedPublicParameters}.
+ *   * preparedPublicParameters
+ *     * The prepared BF-IBE public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibe_bonehFranklin_encryptToPreparedIdentity(
+    BonehFranklinIdentityBasedEncryptionCiphertextAsBinary *result,
+    const char *const message, const size_t messageLength,
+    const BonehFranklinIdentityBasedEncryptionPreparedIdentity
+        *preparedIdentity,
+    const BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        *preparedPublicParameters);
+
+/**
+ * ## Description
+ *
+ * Same as {@code cryptid_ibe_bonehFranklin_decrypt}, with a prepared private
+ * key and prepared public parameters.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter holding the message in plaintext. If the return value is
+ * CRYPTID_SUCCESS, then it will point to a zero-terminated string, that must be
+ * destroyed by the caller. Initialization is done by this function.
+ *   * ciphertextAsBinary
+ *     * The ciphertext to decrypt.
+ *   * preparedPrivateKey
+ *     * The prepared private key to decrypt with, prepared against
+ * {@code preparedPublicParameters}.
+ *   * preparedPublicParameters
+ *     * The prepared BF-IBE public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibe_bonehFranklin_decryptPrepared(
+    char **result,
+    const BonehFranklinIdentityBasedEncryptionCiphertextAsBinary
+        ciphertextAsBinary,
+    const BonehFranklinIdentityBasedEncryptionPreparedPrivateKey
+        *preparedPrivateKey,
+    const BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        *preparedPublicParameters);
+
 #endif
 
 #endif
\ No newline at end of file
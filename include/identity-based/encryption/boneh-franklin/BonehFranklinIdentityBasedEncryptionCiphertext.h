@@ -3,7 +3,7 @@
 
 #include <stddef.h>
 
-#include "elliptic/AffinePoint.h"
+#include "pairing/PairingGroupElement.h"
 #include "util/Validation.h"
 
 /**
@@ -17,9 +17,9 @@ typedef struct BonehFranklinIdentityBasedEncryptionCiphertext {
   /**
    * ## Description
    *
-   * A point in \f$E(F_p)\f$ representing a part of the cipher.
+   * An element of \f$G_2\f$ representing a part of the cipher.
    */
-  AffinePoint cipherU;
+  PairingGroupElement cipherU;
 
   /**
    * ## Description
@@ -61,7 +61,9 @@ typedef struct BonehFranklinIdentityBasedEncryptionCiphertext {
  * [cipherV](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertext.h#BonehFranklinIdentityBasedEncryptionCiphertext.cipherV)
  * and
  * [cipherW](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertext.h#BonehFranklinIdentityBasedEncryptionCiphertext.cipherW)
- * will be copied.
+ * will be copied, while
+ * [cipherU](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertext.h#BonehFranklinIdentityBasedEncryptionCiphertext.cipherU)
+ * is taken over.
  *
  * ## Parameters
  *
@@ -70,7 +72,7 @@ typedef struct BonehFranklinIdentityBasedEncryptionCiphertext {
  * [BonehFranklinIdentityBasedEncryptionCiphertext](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertext.h#BonehFranklinIdentityBasedEncryptionCiphertext)
  * to be initialized.
  *   * cipherU
- *     * A point in \f$E(F_p)\f$ representing a part of the signature.
+ *     * An element of \f$G_2\f$ representing a part of the cipher.
  *   * cipherV
  *     * A binary string representing a part of the cipher.
  *   * cipherVLength
@@ -84,7 +86,7 @@ typedef struct BonehFranklinIdentityBasedEncryptionCiphertext {
  */
 void bonehFranklinIdentityBasedEncryptionCiphertext_init(
     BonehFranklinIdentityBasedEncryptionCiphertext *ciphertextOutput,
-    const AffinePoint cipherU, const unsigned char *const cipherV,
+    const PairingGroupElement cipherU, const unsigned char *const cipherV,
     const int cipherVLength, const unsigned char *const cipherW,
     const int cipherWLength);
 
@@ -107,7 +109,9 @@ void bonehFranklinIdentityBasedEncryptionCiphertext_destroy(
 /**
  * ## Description
  *
- * Validates that the specified ciphertext is correct.
+ * Validates that the specified ciphertext is correct. The first part of the
+ * cipher is checked by {@code pairingGroup_fromBinary}, when the ciphertext is
+ * read.
  *
  * ## Parameters
  *
@@ -115,15 +119,12 @@ void bonehFranklinIdentityBasedEncryptionCiphertext_destroy(
  *     * The
  * [BonehFranklinIdentityBasedEncryptionCiphertext](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertext.h#BonehFranklinIdentityBasedEncryptionCiphertext)
  * to check.
- *   * ellipticCurve
- *     * The elliptic curve, we are operating over.
  *
  * ## Return Value
  *
  * CRYPTID_VALIDATION_SUCCESS if the ciphertext is valid.
  */
 CryptidValidationResult bonehFranklinIdentityBasedEncryptionCiphertext_isValid(
-    const BonehFranklinIdentityBasedEncryptionCiphertext ciphertext,
-    const EllipticCurve ellipticCurve);
+    const BonehFranklinIdentityBasedEncryptionCiphertext ciphertext);
 
 #endif
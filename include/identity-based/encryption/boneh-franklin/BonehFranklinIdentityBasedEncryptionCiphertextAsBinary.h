@@ -3,8 +3,9 @@
 
 #include <stddef.h>
 
-#include "elliptic/AffinePointAsBinary.h"
 #include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertext.h"
+#include "pairing/PairingGroupElementAsBinary.h"
+#include "util/Status.h"
 
 /**
  * ## Description
@@ -15,10 +16,10 @@ typedef struct BonehFranklinIdentityBasedEncryptionCiphertextAsBinary {
   /**
    * ## Description
    *
-   * A binary representation of a point in \f$E(F_p)\f$ representing a part of
-   * the cipher.
+   * A binary representation of an element of \f$G_2\f$ representing a part
+   * of the cipher.
    */
-  AffinePointAsBinary cipherU;
+  PairingGroupElementAsBinary cipherU;
 
   /**
    * ## Description
@@ -69,8 +70,8 @@ typedef struct BonehFranklinIdentityBasedEncryptionCiphertextAsBinary {
  * [BonehFranklinIdentityBasedEncryptionCiphertextAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertextAsBinary.h#BonehFranklinIdentityBasedEncryptionCiphertextAsBinary)
  * to be initialized.
  *   * cipherU
- *     * An
- * [AffinePointAsBinary](codebase://elliptic/AffinePointAsBinary.h#AffinePointAsBinary)
+ *     * A
+ * [PairingGroupElementAsBinary](codebase://pairing/PairingGroupElementAsBinary.h#PairingGroupElementAsBinary)
  * representing a part of the cipher.
  *   * cipherV
  *     * A binary string representing a part of the cipher.
@@ -86,7 +87,7 @@ typedef struct BonehFranklinIdentityBasedEncryptionCiphertextAsBinary {
 void bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_init(
     BonehFranklinIdentityBasedEncryptionCiphertextAsBinary
         *ciphertextAsBinaryOutput,
-    const AffinePointAsBinary cipherU, const void *const cipherV,
+    const PairingGroupElementAsBinary cipherU, const void *const cipherV,
     const size_t cipherVLength, const void *const cipherW,
     const size_t cipherWLength);
 
@@ -113,7 +114,8 @@ void bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_destroy(
  * Converts a
  * [BonehFranklinIdentityBasedEncryptionCiphertextAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertextAsBinary.h#BonehFranklinIdentityBasedEncryptionCiphertextAsBinary)
  * to
- * [BonehFranklinIdentityBasedEncryptionCiphertext](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertext.h#BonehFranklinIdentityBasedEncryptionCiphertext).
+ * [BonehFranklinIdentityBasedEncryptionCiphertext](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertext.h#BonehFranklinIdentityBasedEncryptionCiphertext),
+ * reading the first part of the cipher as an element of \f$G_2\f$.
  *
  * ## Parameters
  *
@@ -122,16 +124,25 @@ void bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_destroy(
  * [BonehFranklinIdentityBasedEncryptionCiphertext](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertext.h#BonehFranklinIdentityBasedEncryptionCiphertext)
  * to be initialized based on a
  * [BonehFranklinIdentityBasedEncryptionCiphertextAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertextAsBinary.h#BonehFranklinIdentityBasedEncryptionCiphertextAsBinary).
+ * On CRYPTID_SUCCESS, this should be destroyed by the caller.
  *   * ciphertextAsBinary
  *     * The
  * [BonehFranklinIdentityBasedEncryptionCiphertextAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertextAsBinary.h#BonehFranklinIdentityBasedEncryptionCiphertextAsBinary),
  * which needs to be converted to
  * [BonehFranklinIdentityBasedEncryptionCiphertext](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertext.h#BonehFranklinIdentityBasedEncryptionCiphertext).
+ *   * group
+ *     * The pairing group of the public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_ILLEGAL_CIPHERTEXT_ERROR
+ * if the first part of the cipher is not a valid element of \f$G_2\f$.
  */
-void bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_toBonehFranklinIdentityBasedEncryptionCiphertext(
+CryptidStatus bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_toBonehFranklinIdentityBasedEncryptionCiphertext(
     BonehFranklinIdentityBasedEncryptionCiphertext *ciphertextOutput,
     const BonehFranklinIdentityBasedEncryptionCiphertextAsBinary
-        ciphertextAsBinary);
+        ciphertextAsBinary,
+    const PairingGroup *group);
 
 /**
  * ## Description
@@ -153,10 +164,13 @@ void bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_toBonehFranklinIdent
  * [BonehFranklinIdentityBasedEncryptionCiphertext](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertext.h#BonehFranklinIdentityBasedEncryptionCiphertext),
  * which needs to be converted to
  * [BonehFranklinIdentityBasedEncryptionCiphertextAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionCiphertextAsBinary.h#BonehFranklinIdentityBasedEncryptionCiphertextAsBinary).
+ *   * group
+ *     * The pairing group of the public parameters.
  */
 void bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_fromBonehFranklinIdentityBasedEncryptionCiphertext(
     BonehFranklinIdentityBasedEncryptionCiphertextAsBinary
         *ciphertextAsBinaryOutput,
-    const BonehFranklinIdentityBasedEncryptionCiphertext ciphertext);
+    const BonehFranklinIdentityBasedEncryptionCiphertext ciphertext,
+    const PairingGroup *group);
 
 #endif
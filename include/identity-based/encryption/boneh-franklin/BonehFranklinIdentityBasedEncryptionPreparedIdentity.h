@@ -0,0 +1,39 @@
+#ifndef __CRYPTID_BONEH_FRANKLIN_IDENTITY_BASED_ENCRYPTION_PREPARED_IDENTITY_H
+#define __CRYPTID_BONEH_FRANKLIN_IDENTITY_BASED_ENCRYPTION_PREPARED_IDENTITY_H
+
+#include "pairing/PairingGroupElement.h"
+
+/**
+ * ## Description
+ *
+ * BF-IBE recipient identity with its pairing value computed once. Created by
+ * {@code cryptid_ibe_bonehFranklin_prepareIdentity} and accepted by
+ * {@code cryptid_ibe_bonehFranklin_encryptToPreparedIdentity}, which then
+ * needs no pairing at all. It is only read by encryption, so it can be shared
+ * between threads.
+ */
+typedef struct BonehFranklinIdentityBasedEncryptionPreparedIdentity {
+  /**
+   * ## Description
+   *
+   * \f$\mathrm{theta} = \mathrm{Pairing}(P_{pub}, Q_{id})\f$ with its
+   * fixed-base table, computing \f$\mathrm{theta}^l\f$ on encryption.
+   */
+  PairingGroupElement theta;
+} BonehFranklinIdentityBasedEncryptionPreparedIdentity;
+
+/**
+ * ## Description
+ *
+ * Frees a
+ * [BonehFranklinIdentityBasedEncryptionPreparedIdentity](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPreparedIdentity.h#BonehFranklinIdentityBasedEncryptionPreparedIdentity).
+ *
+ * ## Parameters
+ *
+ *   * preparedIdentity
+ *     * The prepared identity to be destroyed.
+ */
+void bonehFranklinIdentityBasedEncryptionPreparedIdentity_destroy(
+    BonehFranklinIdentityBasedEncryptionPreparedIdentity preparedIdentity);
+
+#endif
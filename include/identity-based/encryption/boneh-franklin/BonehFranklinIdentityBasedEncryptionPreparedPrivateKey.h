@@ -0,0 +1,37 @@
+#ifndef __CRYPTID_BONEH_FRANKLIN_IDENTITY_BASED_ENCRYPTION_PREPARED_PRIVATE_KEY_H
+#define __CRYPTID_BONEH_FRANKLIN_IDENTITY_BASED_ENCRYPTION_PREPARED_PRIVATE_KEY_H
+
+#include "pairing/PairingGroupElement.h"
+
+/**
+ * ## Description
+ *
+ * BF-IBE private key imported and validated once. Created by
+ * {@code cryptid_ibe_bonehFranklin_preparePrivateKey} and accepted by
+ * {@code cryptid_ibe_bonehFranklin_decryptPrepared}.
+ */
+typedef struct BonehFranklinIdentityBasedEncryptionPreparedPrivateKey {
+  /**
+   * ## Description
+   *
+   * The validated private key \f$S_{id}\f$, prepared as a pairing argument,
+   * computing \f$\mathrm{Pairing}(U, S_{id})\f$ on decryption.
+   */
+  PairingGroupElement privateKey;
+} BonehFranklinIdentityBasedEncryptionPreparedPrivateKey;
+
+/**
+ * ## Description
+ *
+ * Frees a
+ * [BonehFranklinIdentityBasedEncryptionPreparedPrivateKey](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPreparedPrivateKey.h#BonehFranklinIdentityBasedEncryptionPreparedPrivateKey).
+ *
+ * ## Parameters
+ *
+ *   * preparedPrivateKey
+ *     * The prepared private key to be destroyed.
+ */
+void bonehFranklinIdentityBasedEncryptionPreparedPrivateKey_destroy(
+    BonehFranklinIdentityBasedEncryptionPreparedPrivateKey preparedPrivateKey);
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef __CRYPTID_BONEH_FRANKLIN_IDENTITY_BASED_ENCRYPTION_PREPARED_PUBLICPARAMETERS_H
+#define __CRYPTID_BONEH_FRANKLIN_IDENTITY_BASED_ENCRYPTION_PREPARED_PUBLICPARAMETERS_H
+
+#include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h"
+#include "pairing/PairingGroup.h"
+
+/**
+ * ## Description
+ *
+ * BF-IBE public parameters imported and validated once, together with the
+ * constants every operation derives from them. Created by
+ * {@code cryptid_ibe_bonehFranklin_prepare} and accepted by the prepared
+ * variants of the operations. It is only read by the operations, so it can be
+ * shared between threads.
+ */
+typedef struct BonehFranklinIdentityBasedEncryptionPreparedPublicParameters {
+  /**
+   * ## Description
+   *
+   * The validated public parameters. \f$P\f$ holds its fixed-base table,
+   * computing \f$U = [l]P\f$ on encryption and decryption, and \f$P_{pub}\f$
+   * is prepared as a pairing argument, computing
+   * \f$\mathrm{Pairing}(Q_{id}, P_{pub})\f$ on encryption.
+   */
+  BonehFranklinIdentityBasedEncryptionPublicParameters publicParameters;
+
+  /**
+   * ## Description
+   *
+   * The pairing group of the operations, holding the derived constants of the
+   * curve.
+   */
+  PairingGroup group;
+} BonehFranklinIdentityBasedEncryptionPreparedPublicParameters;
+
+/**
+ * ## Description
+ *
+ * Frees a
+ * [BonehFranklinIdentityBasedEncryptionPreparedPublicParameters](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPreparedPublicParameters.h#BonehFranklinIdentityBasedEncryptionPreparedPublicParameters).
+ *
+ * ## Parameters
+ *
+ *   * preparedPublicParameters
+ *     * The prepared public parameters to be destroyed.
+ */
+void bonehFranklinIdentityBasedEncryptionPreparedPublicParameters_destroy(
+    BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        preparedPublicParameters);
+
+#endif
@@ -3,8 +3,8 @@
 
 #include "gmp.h"
 
-#include "elliptic/AffinePoint.h"
 #include "elliptic/EllipticCurve.h"
+#include "pairing/PairingGroup.h"
 #include "util/HashFunction.h"
 #include "util/Validation.h"
 
@@ -13,13 +13,22 @@
  *
  * Struct storing the BF-IBE public parameters. Refer to
  * [BFPublicParameters](https://tools.ietf.org/html/rfc5091#page-55) in
- * [RFC-5091](https://tools.ietf.org/html/rfc5091).
+ * [RFC-5091](https://tools.ietf.org/html/rfc5091). The identities are
+ * hashed to \f$G_1\f$, while the points of the parameters are in \f$G_2\f$.
  */
 typedef struct BonehFranklinIdentityBasedEncryptionPublicParameters {
   /**
    * ## Description
    *
-   * The Type-1 elliptic curve we're operating over. Note, that the p field of
+   * The type of the pairing group the system operates on.
+   */
+  PairingGroupType pairingGroupType;
+
+  /**
+   * ## Description
+   *
+   * The elliptic curve holding \f$G_1\f$, as described by
+   * {@code pairingGroup_describe}. Note, that the p field of
    * [BFPublicParameters](https://tools.ietf.org/html/rfc5091#page-55)
    * corresponds to
    * [fieldOrder](codebase://elliptic/EllipticCurve.h#EllipticCurve.fieldOrder).
@@ -36,23 +45,19 @@ typedef struct BonehFranklinIdentityBasedEncryptionPublicParameters {
   /**
    * ## Description
    *
-   * A generator point of group order
-   * [q](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.q)
-   * on
-   * [ellipticCurve](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.ellipticCurve).
+   * A generator of \f$G_2\f$ of group order
+   * [q](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.q).
    */
-  AffinePoint pointP;
+  PairingGroupElement pointP;
 
   /**
    * ## Description
    *
-   * A point on
-   * [ellipticCurve](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.ellipticCurve)
-   * which is
+   * The element of \f$G_2\f$ which is
    * [pointP](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.pointP)
    * multiplied with the master secret.
    */
-  AffinePoint pointPpublic;
+  PairingGroupElement pointPpublic;
 
   /**
    * ## Description
@@ -67,7 +72,8 @@ typedef struct BonehFranklinIdentityBasedEncryptionPublicParameters {
  *
  * Initializes a new
  * [BonehFranklinIdentityBasedEncryptionPublicParameters](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters)
- * with the specified values.
+ * with the specified values. Note, that the points are taken over, and are
+ * destroyed together with the parameters.
  *
  * ## Parameters
  *
@@ -75,20 +81,18 @@ typedef struct BonehFranklinIdentityBasedEncryptionPublicParameters {
  *     * The
  * [BonehFranklinIdentityBasedEncryptionPublicParameters](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters)
  * to be initialized.
+ *   * pairingGroupType
+ *     * The type of the pairing group, the system operates on.
  *   * ellipticCurve
- *     * The [EllipticCurve](codebase://elliptic/EllipticCurve.h#EllipticCurve),
- * the system operates on.
+ *     * The [EllipticCurve](codebase://elliptic/EllipticCurve.h#EllipticCurve)
+ * holding \f$G_1\f$.
  *   * q
  *     * The field order of the subgroup, the system operates on.
  *   * pointP
- *     * A generator point of group order
- * [q](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.q)
- * on
- * [ellipticCurve](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.ellipticCurve).
+ *     * A generator of \f$G_2\f$ of group order
+ * [q](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.q).
  *   * pointPpublic
- *     * A point on
- * [ellipticCurve](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.ellipticCurve)
- * which is
+ *     * The element of \f$G_2\f$ which is
  * [pointP](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.pointP)
  * multiplied with the master secret.
  *   * hashFunction
@@ -97,8 +101,9 @@ typedef struct BonehFranklinIdentityBasedEncryptionPublicParameters {
 void bonehFranklinIdentityBasedEncryptionPublicParameters_init(
     BonehFranklinIdentityBasedEncryptionPublicParameters
         *publicParametersOutput,
-    const EllipticCurve ellipticCurve, const mpz_t q, const AffinePoint pointP,
-    const AffinePoint pointPpublic, const HashFunction hashFunction);
+    const PairingGroupType pairingGroupType, const EllipticCurve ellipticCurve,
+    const mpz_t q, const PairingGroupElement pointP,
+    const PairingGroupElement pointPpublic, const HashFunction hashFunction);
 
 /**
  * ## Description
@@ -119,7 +124,9 @@ void bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
 /**
  * ## Description
  *
- * Validates that the specified public parameters are correct.
+ * Validates that the specified public parameters are correct. The curve and
+ * the order are checked by {@code pairingGroup_acquire}, and the points by
+ * {@code pairingGroup_fromBinary}, when the parameters are read.
  *
  * ## Parameters
  *
@@ -127,6 +134,8 @@ void bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
  *     * The
  * [BonehFranklinIdentityBasedEncryptionPublicParameters](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters)
  * to check.
+ *   * group
+ *     * The pairing group the parameters were read with.
  *
  * ## Return Value
  *
@@ -135,6 +144,7 @@ void bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
 CryptidValidationResult
 bonehFranklinIdentityBasedEncryptionPublicParameters_isValid(
     const BonehFranklinIdentityBasedEncryptionPublicParameters
-        publicParameters);
+        publicParameters,
+    const PairingGroup *group);
 
 #endif
@@ -1,10 +1,11 @@
 #ifndef __CRYPTID_BONEH_FRANKLIN_IDENTITY_BASED_ENCRYPTION_PUBLICPARAMETERS_AS_BINARY_H
 #define __CRYPTID_BONEH_FRANKLIN_IDENTITY_BASED_ENCRYPTION_PUBLICPARAMETERS_AS_BINARY_H
 
-#include "elliptic/AffinePointAsBinary.h"
 #include "elliptic/EllipticCurveAsBinary.h"
 #include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h"
+#include "pairing/PairingGroupElementAsBinary.h"
 #include "util/HashFunction.h"
+#include "util/Status.h"
 
 /**
  * ## Description
@@ -16,8 +17,14 @@ typedef struct BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary {
   /**
    * ## Description
    *
-   * The Type-1 elliptic curve we're operating over represented by binary
-   * values.
+   * The type of the pairing group the system operates on.
+   */
+  PairingGroupType pairingGroupType;
+
+  /**
+   * ## Description
+   *
+   * The elliptic curve holding \f$G_1\f$ represented by binary values.
    */
   EllipticCurveAsBinary ellipticCurve;
 
@@ -37,21 +44,17 @@ typedef struct BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary {
   size_t qLength;
 
   /**
-   * The binary representation of a generator point of group order
-   * [q](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.q)
-   * on
-   * [ellipticCurve](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.ellipticCurve).
+   * The binary representation of a generator of \f$G_2\f$ of group order
+   * [q](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.q).
    */
-  AffinePointAsBinary pointP;
+  PairingGroupElementAsBinary pointP;
 
   /**
-   * The binary representation of a point on
-   * [ellipticCurve](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.ellipticCurve)
-   * which is
+   * The binary representation of the element of \f$G_2\f$ which is
    * [pointP](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.pointP)
    * multiplied with the master secret.
    */
-  AffinePointAsBinary pointPpublic;
+  PairingGroupElementAsBinary pointPpublic;
 
   /**
    * The hash function, used by the system.
@@ -72,9 +75,11 @@ typedef struct BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary {
  *     * The
  * [BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary.h#BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary)
  * to be initialized.
+ *   * pairingGroupType
+ *     * The type of the pairing group, the system operates on.
  *   * ellipticCurve
- *     * The [EllipticCurve](codebase://elliptic/EllipticCurve.h#EllipticCurve),
- * the system operates on, but in binary representation.
+ *     * The [EllipticCurve](codebase://elliptic/EllipticCurve.h#EllipticCurve)
+ * holding \f$G_1\f$, but in binary representation.
  *   * q
  *     * The binary representation pf the field order of the subgroup, the
  * system operates on.
@@ -82,14 +87,11 @@ typedef struct BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary {
  *     * The length of
  * [q](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary.h#BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary.q).
  *   * pointP
- *     * The binary representation of a generator point of group order
- * [q](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.q)
- * on
- * [ellipticCurve](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.ellipticCurve).
+ *     * The binary representation of a generator of \f$G_2\f$ of group
+ * order
+ * [q](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.q).
  *   * pointPpublic
- *     * The binary representation of a point on
- * [ellipticCurve](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.ellipticCurve)
- * which is
+ *     * The binary representation of the element of \f$G_2\f$ which is
  * [pointP](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters.pointP)
  * multiplied with the master secret.
  *   * hashFunction
@@ -98,9 +100,11 @@ typedef struct BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary {
 void bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_init(
     BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
         *publicParametersAsBinaryOutput,
+    const PairingGroupType pairingGroupType,
     const EllipticCurveAsBinary ellipticCurve, const void *const q,
-    const size_t qLength, const AffinePointAsBinary pointP,
-    const AffinePointAsBinary pointPpublic, const HashFunction hashFunction);
+    const size_t qLength, const PairingGroupElementAsBinary pointP,
+    const PairingGroupElementAsBinary pointPpublic,
+    const HashFunction hashFunction);
 
 /**
  * ## Description
@@ -125,7 +129,9 @@ void bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_destroy(
  * Converts a
  * [BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary.h#BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary)
  * to
- * [BonehFranklinIdentityBasedEncryptionPublicParameters](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters).
+ * [BonehFranklinIdentityBasedEncryptionPublicParameters](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters),
+ * reading the points as elements of \f$G_2\f$ of a group set up by
+ * {@code pairingGroup_acquire} from the curve and the order of the parameters.
  *
  * ## Parameters
  *
@@ -134,17 +140,27 @@ void bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_destroy(
  * [BonehFranklinIdentityBasedEncryptionPublicParameters](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters)
  * to be initialized based on a
  * [BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary.h#BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary).
+ * On CRYPTID_SUCCESS, this should be destroyed by the caller.
  *   * publicParametersAsBinary
  *     * The
  * [BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary.h#BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary),
  * which needs to be converted to
  * [BonehFranklinIdentityBasedEncryptionPublicParameters](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters).
+ *   * group
+ *     * The pairing group of the parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right,
+ * CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR if a point is not a valid element of
+ * \f$G_2\f$.
  */
-void bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_toBonehFranklinIdentityBasedEncryptionPublicParameters(
+CryptidStatus bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_toBonehFranklinIdentityBasedEncryptionPublicParameters(
     BonehFranklinIdentityBasedEncryptionPublicParameters
         *publicParametersOutput,
     const BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
-        publicParametersAsBinary);
+        publicParametersAsBinary,
+    const PairingGroup *group);
 
 /**
  * ## Description
@@ -166,11 +182,14 @@ void bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_toBonehFrankli
  * [BonehFranklinIdentityBasedEncryptionPublicParameters](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h#BonehFranklinIdentityBasedEncryptionPublicParameters),
  * which needs to be converted to
  * [BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary](codebase://identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary.h#BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary).
+ *   * group
+ *     * The pairing group of the parameters.
  */
 void bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_fromBonehFranklinIdentityBasedEncryptionPublicParameters(
     BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
         *publicParametersAsBinaryOutput,
     const BonehFranklinIdentityBasedEncryptionPublicParameters
-        publicParameters);
+        publicParameters,
+    const PairingGroup *group);
 
 #endif
\ No newline at end of file
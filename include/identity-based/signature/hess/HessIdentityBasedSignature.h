@@ -5,10 +5,15 @@
 
 #include "gmp.h"
 
-#include "elliptic/AffinePoint.h"
 #include "identity-based/signature/hess/HessIdentityBasedSignatureMasterSecretAsBinary.h"
+#include "identity-based/signature/hess/HessIdentityBasedSignaturePreparedIdentity.h"
+#include "identity-based/signature/hess/HessIdentityBasedSignaturePreparedPrivateKey.h"
+#include "identity-based/signature/hess/HessIdentityBasedSignaturePreparedPublicParameters.h"
+#include "identity-based/signature/hess/HessIdentityBasedSignaturePreparedSigner.h"
 #include "identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h"
 #include "identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h"
+#include "pairing/PairingGroupElementAsBinary.h"
+#include "pairing/PairingGroupType.h"
 #include "util/SecurityLevel.h"
 #include "util/Status.h"
 
@@ -45,6 +50,45 @@ CryptidStatus cryptid_ibs_hess_setup(
         *publicParametersAsBinary,
     const SecurityLevel securityLevel);
 
+/**
+ * ## Description
+ *
+ * Same as {@code cryptid_ibs_hess_setup}, on the selected pairing group. The
+ * identities, the private keys and the first part of the signatures are
+ * elements of \f$G_1\f$, while \f$P\f$ and \f$P_{pub}\f$ are elements of
+ * \f$G_2\f$. pairingGroup_BLS12_381 supports the security levels up to MEDIUM.
+ *
+ * ## Parameters
+ *
+ *   * masterSecretAsBinary
+ *     * Out parameter which will hold the master secret. If the return value is
+ * CRYPTID_SUCCESS, then it will point to a
+ * [HessIdentityBasedSignatureMasterSecretAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureMasterSecretAsBinary.h#HessIdentityBasedSignatureMasterSecretAsBinary)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * publicParametersAsBinary
+ *     * Pointer in which the public parameters will be stored. If the return
+ * value is CRYPTID_SUCCESS then it will point to correctly filled
+ * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary)
+ * instance.
+ *   * securityLevel
+ *     * The desired security level.
+ *   * pairingGroupType
+ *     * The pairing group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right,
+ * CRYPTID_SECURITY_LEVEL_NOT_SUPPORTED_ERROR if the group does not reach the
+ * security level.
+ */
+CryptidStatus cryptid_ibs_hess_setupForPairingGroup(
+    HessIdentityBasedSignatureMasterSecretAsBinary *masterSecretAsBinary,
+    HessIdentityBasedSignaturePublicParametersAsBinary
+        *publicParametersAsBinary,
+    const SecurityLevel securityLevel,
+    const PairingGroupType pairingGroupType);
+
 /**
  * ## Description
  *
@@ -54,8 +98,8 @@ CryptidStatus cryptid_ibs_hess_setup(
  *
  *   * result
  *     * Out parameter holding the private key in binary format. If the return
- * value is CRYPTID_SUCCESS, then it will point to an
- * [AffinePointAsBinary](codebase://elliptic/AffinePointAsBinary.h#AffinePointAsBinary)
+ * value is CRYPTID_SUCCESS, then it will point to a
+ * [PairingGroupElementAsBinary](codebase://pairing/PairingGroupElementAsBinary.h#PairingGroupElementAsBinary)
  * instance, that must be destroyed by the caller. Initialization is done by
  * this function.
  *   * identity
@@ -72,7 +116,7 @@ CryptidStatus cryptid_ibs_hess_setup(
  * CRYPTID_SUCCESS if everything went right.
  */
 CryptidStatus cryptid_ibs_hess_extract(
-    AffinePointAsBinary *result, const char *const identity,
+    PairingGroupElementAsBinary *result, const char *const identity,
     const size_t identityLength,
     const HessIdentityBasedSignatureMasterSecretAsBinary masterSecretAsBinary,
     const HessIdentityBasedSignaturePublicParametersAsBinary
@@ -112,7 +156,7 @@ CryptidStatus
 cryptid_ibs_hess_sign(HessIdentityBasedSignatureSignatureAsBinary *result,
                       const char *const message, const size_t messageLength,
                       const char *const identity, const size_t identityLength,
-                      const AffinePointAsBinary privateKeyAsBinary,
+                      const PairingGroupElementAsBinary privateKeyAsBinary,
                       const HessIdentityBasedSignaturePublicParametersAsBinary
                           publicParametersAsBinary);
 
@@ -147,6 +191,332 @@ CryptidStatus cryptid_ibs_hess_verify(
     const HessIdentityBasedSignaturePublicParametersAsBinary
         publicParametersAsBinary);
 
+/**
+ * ## Description
+ *
+ * Imports and validates the public parameters once, and precomputes the values
+ * the prepared variants of extraction, signing and verification reuse: the
+ * constants of the curve, the Miller lines of \f$P\f$ and the point
+ * \f$-P_{pub}\f$. Worth it when the same public parameters serve many
+ * operations.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter holding the prepared public parameters. If the return
+ * value is CRYPTID_SUCCESS, then it will point to a
+ * [HessIdentityBasedSignaturePreparedPublicParameters](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePreparedPublicParameters.h#HessIdentityBasedSignaturePreparedPublicParameters)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * publicParametersAsBinary
+ *     * The Hess-IBS public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibs_hess_prepare(
+    HessIdentityBasedSignaturePreparedPublicParameters *result,
+    const HessIdentityBasedSignaturePublicParametersAsBinary
+        publicParametersAsBinary);
+
+/**
+ * ## Description
+ *
+ * Imports and validates a private key once.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter holding the prepared private key. If the return value is
+ * CRYPTID_SUCCESS, then it will point to a
+ * [HessIdentityBasedSignaturePreparedPrivateKey](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePreparedPrivateKey.h#HessIdentityBasedSignaturePreparedPrivateKey)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * privateKeyAsBinary
+ *     * The private key to prepare.
+ *   * preparedPublicParameters
+ *     * The prepared Hess-IBS public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibs_hess_preparePrivateKey(
+    HessIdentityBasedSignaturePreparedPrivateKey *result,
+    const PairingGroupElementAsBinary privateKeyAsBinary,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters);
+
+/**
+ * ## Description
+ *
+ * Imports and validates a private key once, together with the values of its
+ * identity that signing needs: \f$Q_{id}\f$ and a fixed-base table of
+ * \f$\mathrm{Pairing}(Q_{id}, P)\f$. Worth it when the same signer signs many
+ * messages, as signing with a prepared signer skips hashing the identity,
+ * importing the key and the pairing.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter holding the prepared signer. If the return value is
+ * CRYPTID_SUCCESS, then it will point to a
+ * [HessIdentityBasedSignaturePreparedSigner](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePreparedSigner.h#HessIdentityBasedSignaturePreparedSigner)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * identity
+ *     * The identity string of the signer.
+ *   * identityLength
+ *     * The length of the identity string.
+ *   * privateKeyAsBinary
+ *     * The private key of the identity.
+ *   * preparedPublicParameters
+ *     * The prepared Hess-IBS public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibs_hess_prepareSigner(
+    HessIdentityBasedSignaturePreparedSigner *result,
+    const char *const identity, const size_t identityLength,
+    const PairingGroupElementAsBinary privateKeyAsBinary,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters);
+
+/**
+ * ## Description
+ *
+ * Builds fixed-base tables of \f$Q_{id}\f$ and \f$S_{id}\f$ for a prepared
+ * signer, so that signing computes \f$u = [v]S_{id} + [k]Q_{id}\f$ from the
+ * tables instead of a multi-scalar multiplication. Tables that already exist
+ * are kept. Does nothing on pairingGroup_BLS12_381. Should be called before
+ * the signer is shared between threads.
+ *
+ * ## Parameters
+ *
+ *   * preparedSigner
+ *     * The prepared signer, prepared against
+ * {@code preparedPublicParameters}.
+ *   * preparedPublicParameters
+ *     * The prepared Hess-IBS public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibs_hess_prepareSignerTables(
+    HessIdentityBasedSignaturePreparedSigner *preparedSigner,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters);
+
+/**
+ * ## Description
+ *
+ * Hashes a signer identity and computes its pairing value
+ * \f$\mathrm{Pairing}(Q_{id}, -P_{pub})\f$ once, together with a fixed-base
+ * table of it. Worth it when many signatures of the same signer are verified,
+ * as verification with a prepared identity skips both hashing the identity
+ * and one of the two pairings.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter holding the prepared identity. If the return value is
+ * CRYPTID_SUCCESS, then it will point to a
+ * [HessIdentityBasedSignaturePreparedIdentity](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePreparedIdentity.h#HessIdentityBasedSignaturePreparedIdentity)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * identity
+ *     * The identity string to prepare.
+ *   * identityLength
+ *     * The length of the identity string.
+ *   * preparedPublicParameters
+ *     * The prepared Hess-IBS public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibs_hess_prepareIdentity(
+    HessIdentityBasedSignaturePreparedIdentity *result,
+    const char *const identity, const size_t identityLength,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters);
+
+/**
+ * ## Description
+ *
+ * Same as {@code cryptid_ibs_hess_extract}, with prepared public parameters.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter holding the private key in binary format. If the return
+ * value is CRYPTID_SUCCESS, then it will point to a
+ * [PairingGroupElementAsBinary](codebase://pairing/PairingGroupElementAsBinary.h#PairingGroupElementAsBinary)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * identity
+ *     * The identity string we're extracting the private key for.
+ *   * identityLength
+ *     * The length of the identity string.
+ *   * masterSecretAsBinary
+ *     * The master secret corresponding to the public parameters.
+ *   * preparedPublicParameters
+ *     * The prepared Hess-IBS public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibs_hess_extractPrepared(
+    PairingGroupElementAsBinary *result, const char *const identity,
+    const size_t identityLength,
+    const HessIdentityBasedSignatureMasterSecretAsBinary masterSecretAsBinary,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters);
+
+/**
+ * ## Description
+ *
+ * Same as {@code cryptid_ibs_hess_sign}, with a prepared private key and
+ * prepared public parameters. The pairing reuses the Miller lines of \f$P\f$.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter storing the signature. If the return value is
+ * CRYPTID_SUCCESS then it will point to a
+ * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * message
+ *     * The string to sign.
+ *   * messageLength
+ *     * The length of the message.
+ *   * identity
+ *     * The identity string to sign with.
+ *   * identityLength
+ *     * The length of the identity.
+ *   * preparedPrivateKey
+ *     * The prepared private key to sign with.
+ *   * preparedPublicParameters
+ *     * The prepared Hess-IBS public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibs_hess_signPrepared(
+    HessIdentityBasedSignatureSignatureAsBinary *result,
+    const char *const message, const size_t messageLength,
+    const char *const identity, const size_t identityLength,
+    const HessIdentityBasedSignaturePreparedPrivateKey *preparedPrivateKey,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters);
+
+/**
+ * ## Description
+ *
+ * Same as {@code cryptid_ibs_hess_signPrepared}, with a prepared signer. No
+ * pairing is computed: \f$\mathrm{theta}^k\f$ is computed from the
+ * fixed-base table of the signer, leaving a single two-term scalar
+ * multiplication and hashing.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter holding the signature. If the return value is
+ * CRYPTID_SUCCESS, then it will point to a
+ * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary)
+ * instance, that must be destroyed by the caller. Initialization is done by
+ * this function.
+ *   * message
+ *     * The string to sign.
+ *   * messageLength
+ *     * The length of the message.
+ *   * preparedSigner
+ *     * The signer, prepared against {@code preparedPublicParameters}.
+ *   * preparedPublicParameters
+ *     * The prepared Hess-IBS public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right.
+ */
+CryptidStatus cryptid_ibs_hess_signWithPreparedSigner(
+    HessIdentityBasedSignatureSignatureAsBinary *result,
+    const char *const message, const size_t messageLength,
+    const HessIdentityBasedSignaturePreparedSigner *preparedSigner,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters);
+
+/**
+ * ## Description
+ *
+ * Same as {@code cryptid_ibs_hess_verify}, with prepared public parameters.
+ *
+ * ## Parameters
+ *
+ *   * message
+ *     * The string which was signed.
+ *   * messageLength
+ *     * The length of the message.
+ *   * signatureAsBinary
+ *     * The digital signature of the message, which needs to be verified.
+ *   * identity
+ *     * The identity string the message was signed with.
+ *   * identityLength
+ *     * The length of the identity.
+ *   * preparedPublicParameters
+ *     * The prepared Hess-IBS public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if the signature was valid.
+ */
+CryptidStatus cryptid_ibs_hess_verifyPrepared(
+    const char *const message, const size_t messageLength,
+    const HessIdentityBasedSignatureSignatureAsBinary signatureAsBinary,
+    const char *const identity, const size_t identityLength,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters);
+
+/**
+ * ## Description
+ *
+ * Same as {@code cryptid_ibs_hess_verifyPrepared}, with a prepared signer
+ * identity. Only \f$\mathrm{Pairing}(u, P)\f$ is computed, reusing the
+ * Miller lines of \f$P\f$, and the pairing value of the identity is raised to
+ * the power of \f$v\f$ from its fixed-base table.
+ *
+ * ## Parameters
+ *
+ *   * message
+ *     * The string which was signed.
+ *   * messageLength
+ *     * The length of the message.
+ *   * signatureAsBinary
+ *     * The digital signature of the message, which needs to be verified.
+ *   * preparedIdentity
+ *     * The identity the message was signed with, prepared against
+ * {@code preparedPublicParameters}.
+ *   * preparedPublicParameters
+ *     * The prepared Hess-IBS public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if the signature was valid.
+ */
+CryptidStatus cryptid_ibs_hess_verifyWithPreparedIdentity(
+    const char *const message, const size_t messageLength,
+    const HessIdentityBasedSignatureSignatureAsBinary signatureAsBinary,
+    const HessIdentityBasedSignaturePreparedIdentity *preparedIdentity,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters);
+
 #endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef __CRYPTID_HESS_IDENTITY_BASED_SIGNATURE_PREPARED_IDENTITY_H
+#define __CRYPTID_HESS_IDENTITY_BASED_SIGNATURE_PREPARED_IDENTITY_H
+
+#include "pairing/PairingGroupElement.h"
+
+/**
+ * ## Description
+ *
+ * Hess-IBS signer identity with its pairing value computed once. Created by
+ * {@code cryptid_ibs_hess_prepareIdentity} and accepted by
+ * {@code cryptid_ibs_hess_verifyWithPreparedIdentity}, which then needs a
+ * single pairing instead of two. It is only read by verification, so it can
+ * be shared between threads.
+ */
+typedef struct HessIdentityBasedSignaturePreparedIdentity {
+  /**
+   * ## Description
+   *
+   * \f$\mathrm{theta2} = \mathrm{Pairing}(Q_{id}, -P_{pub})\f$ with its
+   * fixed-base table, computing \f$\mathrm{theta2}^v\f$ on verification.
+   */
+  PairingGroupElement theta2;
+} HessIdentityBasedSignaturePreparedIdentity;
+
+/**
+ * ## Description
+ *
+ * Frees a
+ * [HessIdentityBasedSignaturePreparedIdentity](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePreparedIdentity.h#HessIdentityBasedSignaturePreparedIdentity).
+ *
+ * ## Parameters
+ *
+ *   * preparedIdentity
+ *     * The prepared identity to be destroyed.
+ */
+void hessIdentityBasedSignaturePreparedIdentity_destroy(
+    HessIdentityBasedSignaturePreparedIdentity preparedIdentity);
+
+#endif
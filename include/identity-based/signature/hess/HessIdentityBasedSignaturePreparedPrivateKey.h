@@ -0,0 +1,36 @@
+#ifndef __CRYPTID_HESS_IDENTITY_BASED_SIGNATURE_PREPARED_PRIVATE_KEY_H
+#define __CRYPTID_HESS_IDENTITY_BASED_SIGNATURE_PREPARED_PRIVATE_KEY_H
+
+#include "pairing/PairingGroupElement.h"
+
+/**
+ * ## Description
+ *
+ * Hess-IBS private key imported and validated once. Created by
+ * {@code cryptid_ibs_hess_preparePrivateKey} and accepted by
+ * {@code cryptid_ibs_hess_signPrepared}.
+ */
+typedef struct HessIdentityBasedSignaturePreparedPrivateKey {
+  /**
+   * ## Description
+   *
+   * The validated private key \f$S_{id}\f$.
+   */
+  PairingGroupElement privateKey;
+} HessIdentityBasedSignaturePreparedPrivateKey;
+
+/**
+ * ## Description
+ *
+ * Frees a
+ * [HessIdentityBasedSignaturePreparedPrivateKey](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePreparedPrivateKey.h#HessIdentityBasedSignaturePreparedPrivateKey).
+ *
+ * ## Parameters
+ *
+ *   * preparedPrivateKey
+ *     * The prepared private key to be destroyed.
+ */
+void hessIdentityBasedSignaturePreparedPrivateKey_destroy(
+    HessIdentityBasedSignaturePreparedPrivateKey preparedPrivateKey);
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef __CRYPTID_HESS_IDENTITY_BASED_SIGNATURE_PREPARED_PUBLICPARAMETERS_H
+#define __CRYPTID_HESS_IDENTITY_BASED_SIGNATURE_PREPARED_PUBLICPARAMETERS_H
+
+#include "identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h"
+#include "pairing/PairingGroup.h"
+
+/**
+ * ## Description
+ *
+ * Hess-IBS public parameters imported and validated once, together with the
+ * constants every operation derives from them. Created by
+ * {@code cryptid_ibs_hess_prepare} and accepted by the prepared variants of the
+ * operations. It is only read by the operations, so it can be shared between
+ * threads.
+ */
+typedef struct HessIdentityBasedSignaturePreparedPublicParameters {
+  /**
+   * ## Description
+   *
+   * The validated public parameters.
+   */
+  HessIdentityBasedSignaturePublicParameters publicParameters;
+
+  /**
+   * ## Description
+   *
+   * The pairing group of the operations, holding the derived constants of the
+   * curve.
+   */
+  PairingGroup group;
+
+  /**
+   * ## Description
+   *
+   * A copy of \f$P\f$ prepared as a pairing argument, computing
+   * \f$\mathrm{Pairing}(Q_{id}, P)\f$ on signing. The \f$P\f$ of the
+   * public parameters is left unprepared, so that verification computes its
+   * two pairings with a single final exponentiation.
+   */
+  PairingGroupElement preparedPointP;
+
+  /**
+   * ## Description
+   *
+   * \f$-P_{pub}\f$, the second argument of one of the pairings on
+   * verification.
+   */
+  PairingGroupElement negativePointPpublic;
+} HessIdentityBasedSignaturePreparedPublicParameters;
+
+/**
+ * ## Description
+ *
+ * Frees a
+ * [HessIdentityBasedSignaturePreparedPublicParameters](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePreparedPublicParameters.h#HessIdentityBasedSignaturePreparedPublicParameters).
+ *
+ * ## Parameters
+ *
+ *   * preparedPublicParameters
+ *     * The prepared public parameters to be destroyed.
+ */
+void hessIdentityBasedSignaturePreparedPublicParameters_destroy(
+    HessIdentityBasedSignaturePreparedPublicParameters
+        preparedPublicParameters);
+
+#endif
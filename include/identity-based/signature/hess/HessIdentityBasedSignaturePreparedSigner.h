@@ -0,0 +1,55 @@
+#ifndef __CRYPTID_HESS_IDENTITY_BASED_SIGNATURE_PREPARED_SIGNER_H
+#define __CRYPTID_HESS_IDENTITY_BASED_SIGNATURE_PREPARED_SIGNER_H
+
+#include "pairing/PairingGroupElement.h"
+
+/**
+ * ## Description
+ *
+ * Hess-IBS signer with every value that does not depend on the message
+ * computed once. Created by {@code cryptid_ibs_hess_prepareSigner} and
+ * accepted by {@code cryptid_ibs_hess_signWithPreparedSigner}. It is only read
+ * by signing, so it can be shared between threads once prepared.
+ */
+typedef struct HessIdentityBasedSignaturePreparedSigner {
+  /**
+   * ## Description
+   *
+   * The hashed identity \f$Q_{id}\f$ of the signer, holding its fixed-base
+   * table once prepared by {@code cryptid_ibs_hess_prepareSignerTables}.
+   */
+  PairingGroupElement pointQId;
+
+  /**
+   * ## Description
+   *
+   * The validated private key \f$S_{id}\f$ of the signer, holding its
+   * fixed-base table once prepared by
+   * {@code cryptid_ibs_hess_prepareSignerTables}.
+   */
+  PairingGroupElement privateKey;
+
+  /**
+   * ## Description
+   *
+   * \f$\mathrm{theta} = \mathrm{Pairing}(Q_{id}, P)\f$ with its fixed-base
+   * table, computing \f$\mathrm{theta}^k\f$ on signing.
+   */
+  PairingGroupElement theta;
+} HessIdentityBasedSignaturePreparedSigner;
+
+/**
+ * ## Description
+ *
+ * Frees a
+ * [HessIdentityBasedSignaturePreparedSigner](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePreparedSigner.h#HessIdentityBasedSignaturePreparedSigner).
+ *
+ * ## Parameters
+ *
+ *   * preparedSigner
+ *     * The prepared signer to be destroyed.
+ */
+void hessIdentityBasedSignaturePreparedSigner_destroy(
+    HessIdentityBasedSignaturePreparedSigner preparedSigner);
+
+#endif
@@ -3,21 +3,30 @@
 
 #include "gmp.h"
 
-#include "elliptic/AffinePoint.h"
 #include "elliptic/EllipticCurve.h"
+#include "pairing/PairingGroup.h"
 #include "util/HashFunction.h"
 #include "util/Validation.h"
 
 /**
  * ## Description
  *
- * Struct storing the Hess-IBS Public Parameters.
+ * Struct storing the Hess-IBS Public Parameters. The identities are hashed to
+ * \f$G_1\f$, while the points of the parameters are in \f$G_2\f$.
  */
 typedef struct HessIdentityBasedSignaturePublicParameters {
   /**
    * ## Description
    *
-   * The Type-1 elliptic curve we're operating over.
+   * The type of the pairing group the system operates on.
+   */
+  PairingGroupType pairingGroupType;
+
+  /**
+   * ## Description
+   *
+   * The elliptic curve holding \f$G_1\f$, as described by
+   * {@code pairingGroup_describe}.
    */
   EllipticCurve ellipticCurve;
 
@@ -31,23 +40,19 @@ typedef struct HessIdentityBasedSignaturePublicParameters {
   /**
    * ## Description
    *
-   * A generator point of group order
-   * [q](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.q)
-   * on
-   * [ellipticCurve](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.ellipticCurve).
+   * A generator of \f$G_2\f$ of group order
+   * [q](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.q).
    */
-  AffinePoint pointP;
+  PairingGroupElement pointP;
 
   /**
    * ## Description
    *
-   * A point on
-   * [ellipticCurve](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.ellipticCurve)
-   * which is
+   * The element of \f$G_2\f$ which is
    * [pointP](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.pointP)
    * multiplied with the master secret.
    */
-  AffinePoint pointPpublic;
+  PairingGroupElement pointPpublic;
 
   /**
    * ## Description
@@ -62,7 +67,8 @@ typedef struct HessIdentityBasedSignaturePublicParameters {
  *
  * Initializes a new
  * [HessIdentityBasedSignaturePublicParameters](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters)
- * with the specified values.
+ * with the specified values. Note, that the points are taken over, and are
+ * destroyed together with the parameters.
  *
  * ## Parameters
  *
@@ -70,20 +76,18 @@ typedef struct HessIdentityBasedSignaturePublicParameters {
  *     * The
  * [HessIdentityBasedSignaturePublicParameters](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters)
  * to be initialized.
+ *   * pairingGroupType
+ *     * The type of the pairing group, the system operates on.
  *   * ellipticCurve
- *     * The [EllipticCurve](codebase://elliptic/EllipticCurve.h#EllipticCurve),
- * the system operates on.
+ *     * The [EllipticCurve](codebase://elliptic/EllipticCurve.h#EllipticCurve)
+ * holding \f$G_1\f$.
  *   * q
  *     * The field order of the subgroup, the system operates on.
  *   * pointP
- *     * A generator point of group order
- * [q](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.q)
- * on
- * [ellipticCurve](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.ellipticCurve).
+ *     * A generator of \f$G_2\f$ of group order
+ * [q](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.q).
  *   * pointPpublic
- *     * A point on
- * [ellipticCurve](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.ellipticCurve)
- * which is
+ *     * The element of \f$G_2\f$ which is
  * [pointP](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.pointP)
  * multiplied with the master secret.
  *   * hashFunction
@@ -91,8 +95,9 @@ typedef struct HessIdentityBasedSignaturePublicParameters {
  */
 void hessIdentityBasedSignaturePublicParameters_init(
     HessIdentityBasedSignaturePublicParameters *publicParametersOutput,
-    const EllipticCurve ellipticCurve, const mpz_t q, const AffinePoint pointP,
-    const AffinePoint pointPpublic, const HashFunction hashFunction);
+    const PairingGroupType pairingGroupType, const EllipticCurve ellipticCurve,
+    const mpz_t q, const PairingGroupElement pointP,
+    const PairingGroupElement pointPpublic, const HashFunction hashFunction);
 
 /**
  * ## Description
@@ -113,7 +118,9 @@ void hessIdentityBasedSignaturePublicParameters_destroy(
 /**
  * ## Description
  *
- * Validates that the specified public parameters are correct.
+ * Validates that the specified public parameters are correct. The curve and
+ * the order are checked by {@code pairingGroup_acquire}, and the points by
+ * {@code pairingGroup_fromBinary}, when the parameters are read.
  *
  * ## Parameters
  *
@@ -121,12 +128,15 @@ void hessIdentityBasedSignaturePublicParameters_destroy(
  *     * The
  * [HessIdentityBasedSignaturePublicParameters](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters)
  * to check.
+ *   * group
+ *     * The pairing group the parameters were read with.
  *
  * ## Return Value
  *
  * CRYPTID_VALIDATION_SUCCESS if the parameters are valid.
  */
 CryptidValidationResult hessIdentityBasedSignaturePublicParameters_isValid(
-    const HessIdentityBasedSignaturePublicParameters publicParameters);
+    const HessIdentityBasedSignaturePublicParameters publicParameters,
+    const PairingGroup *group);
 
 #endif
@@ -1,10 +1,11 @@
 #ifndef __CRYPTID_HESS_IDENTITY_BASED_SIGNATURE_PUBLICPARAMETERS_AS_BINARY_H
 #define __CRYPTID_HESS_IDENTITY_BASED_SIGNATURE_PUBLICPARAMETERS_AS_BINARY_H
 
-#include "elliptic/AffinePointAsBinary.h"
 #include "elliptic/EllipticCurveAsBinary.h"
 #include "identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h"
+#include "pairing/PairingGroupElementAsBinary.h"
 #include "util/HashFunction.h"
+#include "util/Status.h"
 
 /**
  * ## Description
@@ -16,8 +17,14 @@ typedef struct HessIdentityBasedSignaturePublicParametersAsBinary {
   /**
    * ## Description
    *
-   * The Type-1 elliptic curve we're operating over represented by binary
-   * values.
+   * The type of the pairing group the system operates on.
+   */
+  PairingGroupType pairingGroupType;
+
+  /**
+   * ## Description
+   *
+   * The elliptic curve holding \f$G_1\f$ represented by binary values.
    */
   EllipticCurveAsBinary ellipticCurve;
 
@@ -37,21 +44,17 @@ typedef struct HessIdentityBasedSignaturePublicParametersAsBinary {
   size_t qLength;
 
   /**
-   * The binary representation of a generator point of group order
-   * [q](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.q)
-   * on
-   * [ellipticCurve](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.ellipticCurve).
+   * The binary representation of a generator of \f$G_2\f$ of group order
+   * [q](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.q).
    */
-  AffinePointAsBinary pointP;
+  PairingGroupElementAsBinary pointP;
 
   /**
-   * The binary representation of a point on
-   * [ellipticCurve](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.ellipticCurve)
-   * which is
+   * The binary representation of the element of \f$G_2\f$ which is
    * [pointP](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.pointP)
    * multiplied with the master secret.
    */
-  AffinePointAsBinary pointPpublic;
+  PairingGroupElementAsBinary pointPpublic;
 
   /**
    * The hash function, used by the system.
@@ -72,9 +75,11 @@ typedef struct HessIdentityBasedSignaturePublicParametersAsBinary {
  *     * The
  * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary)
  * to be initialized.
+ *   * pairingGroupType
+ *     * The type of the pairing group, the system operates on.
  *   * ellipticCurve
- *     * The [EllipticCurve](codebase://elliptic/EllipticCurve.h#EllipticCurve),
- * the system operates on, but in binary representation.
+ *     * The [EllipticCurve](codebase://elliptic/EllipticCurve.h#EllipticCurve)
+ * holding \f$G_1\f$, but in binary representation.
  *   * q
  *     * The binary representation pf the field order of the subgroup, the
  * system operates on.
@@ -82,14 +87,10 @@ typedef struct HessIdentityBasedSignaturePublicParametersAsBinary {
  *     * The length of
  * [q](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary.q).
  *   * pointP
- *     * The binary representation of a generator point of group order
- * [q](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.q)
- * on
- * [ellipticCurve](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.ellipticCurve).
+ *     * The binary representation of a generator of \f$G_2\f$ of group order
+ * [q](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.q).
  *   * pointPpublic
- *     * The binary representation of a point on
- * [ellipticCurve](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.ellipticCurve)
- * which is
+ *     * The binary representation of the element of \f$G_2\f$ which is
  * [pointP](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters.pointP)
  * multiplied with the master secret.
  *   * hashFunction
@@ -98,9 +99,11 @@ typedef struct HessIdentityBasedSignaturePublicParametersAsBinary {
 void hessIdentityBasedSignaturePublicParametersAsBinary_init(
     HessIdentityBasedSignaturePublicParametersAsBinary
         *publicParametersAsBinaryOutput,
+    const PairingGroupType pairingGroupType,
     const EllipticCurveAsBinary ellipticCurve, const void *const q,
-    const size_t qLength, const AffinePointAsBinary pointP,
-    const AffinePointAsBinary pointPpublic, const HashFunction hashFunction);
+    const size_t qLength, const PairingGroupElementAsBinary pointP,
+    const PairingGroupElementAsBinary pointPpublic,
+    const HashFunction hashFunction);
 
 /**
  * ## Description
@@ -125,31 +128,43 @@ void hessIdentityBasedSignaturePublicParametersAsBinary_destroy(
  * Converts a
  * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary)
  * to
- * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary).
+ * [HessIdentityBasedSignaturePublicParameters](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters),
+ * reading the points as elements of \f$G_2\f$ of a group set up by
+ * {@code pairingGroup_acquire} from the curve and the order of the parameters.
  *
  * ## Parameters
  *
  *   * publicParametersOutput
  *     * The
- * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary)
+ * [HessIdentityBasedSignaturePublicParameters](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters)
  * to be initialized based on a
  * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary).
+ * On CRYPTID_SUCCESS, this should be destroyed by the caller.
  *   * publicParametersAsBinary
  *     * The
  * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary),
  * which needs to be converted to
- * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary).
+ * [HessIdentityBasedSignaturePublicParameters](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters).
+ *   * group
+ *     * The pairing group of the parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right,
+ * CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR if a point is not a valid element of
+ * \f$G_2\f$.
  */
-void hessIdentityBasedSignaturePublicParametersAsBinary_toHessIdentityBasedSignaturePublicParameters(
+CryptidStatus hessIdentityBasedSignaturePublicParametersAsBinary_toHessIdentityBasedSignaturePublicParameters(
     HessIdentityBasedSignaturePublicParameters *publicParametersOutput,
     const HessIdentityBasedSignaturePublicParametersAsBinary
-        publicParametersAsBinary);
+        publicParametersAsBinary,
+    const PairingGroup *group);
 
 /**
  * ## Description
  *
  * Converts a
- * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary)
+ * [HessIdentityBasedSignaturePublicParameters](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters)
  * to
  * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary).
  *
@@ -159,16 +174,19 @@ void hessIdentityBasedSignaturePublicParametersAsBinary_toHessIdentityBasedSigna
  *     * The
  * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary)
  * to be initialized based on a
- * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary).
+ * [HessIdentityBasedSignaturePublicParameters](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters).
  *   * publicParameters
  *     * The
- * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary),
+ * [HessIdentityBasedSignaturePublicParameters](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h#HessIdentityBasedSignaturePublicParameters),
  * which needs to be converted to
  * [HessIdentityBasedSignaturePublicParametersAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignaturePublicParametersAsBinary.h#HessIdentityBasedSignaturePublicParametersAsBinary).
+ *   * group
+ *     * The pairing group of the parameters.
  */
 void hessIdentityBasedSignaturePublicParametersAsBinary_fromHessIdentityBasedSignaturePublicParameters(
     HessIdentityBasedSignaturePublicParametersAsBinary
         *publicParametersAsBinaryOutput,
-    const HessIdentityBasedSignaturePublicParameters publicParameters);
+    const HessIdentityBasedSignaturePublicParameters publicParameters,
+    const PairingGroup *group);
 
 #endif
@@ -3,8 +3,7 @@
 
 #include "gmp.h"
 
-#include "elliptic/AffinePoint.h"
-#include "elliptic/EllipticCurve.h"
+#include "pairing/PairingGroupElement.h"
 #include "util/Validation.h"
 
 /**
@@ -16,9 +15,9 @@ typedef struct HessIdentityBasedSignatureSignature {
   /**
    * ## Description
    *
-   * A point in \f$E(F_p)\f$ representing a part of the signature.
+   * An element of \f$G_1\f$ representing a part of the signature.
    */
-  AffinePoint u;
+  PairingGroupElement u;
 
   /**
    * ## Description
@@ -33,7 +32,9 @@ typedef struct HessIdentityBasedSignatureSignature {
  *
  * Initializes a new
  * [HessIdentityBasedSignatureSignature](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignature.h#HessIdentityBasedSignatureSignature)
- * with the specified values.
+ * with the specified values. Note, that
+ * [u](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignature.h#HessIdentityBasedSignatureSignature.u)
+ * is taken over, and is destroyed together with the signature.
  *
  * ## Parameters
  *
@@ -42,13 +43,13 @@ typedef struct HessIdentityBasedSignatureSignature {
  * [HessIdentityBasedSignatureSignature](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignature.h#HessIdentityBasedSignatureSignature)
  * to be initialized.
  *   * u
- *     * A point in \f$E(F_p)\f$ representing a part of the signature.
+ *     * An element of \f$G_1\f$ representing a part of the signature.
  *   * v
  *     * An integer representing a part of the signature.
  */
 void hessIdentityBasedSignatureSignature_init(
-    HessIdentityBasedSignatureSignature *signatureOutput, const AffinePoint u,
-    const mpz_t v);
+    HessIdentityBasedSignatureSignature *signatureOutput,
+    const PairingGroupElement u, const mpz_t v);
 
 /**
  * ## Description
@@ -69,7 +70,9 @@ void hessIdentityBasedSignatureSignature_destroy(
 /**
  * ## Description
  *
- * Validates that the specified signature is correct.
+ * Validates that the specified signature is correct. The first part of the
+ * signature is checked by {@code pairingGroup_fromBinary}, when the signature
+ * is read.
  *
  * ## Parameters
  *
@@ -77,15 +80,12 @@ void hessIdentityBasedSignatureSignature_destroy(
  *     * The
  * [HessIdentityBasedSignatureSignature](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignature.h#HessIdentityBasedSignatureSignature)
  * to check.
- *   * ellipticCurve
- *     * The elliptic curve, we are operating over.
  *
  * ## Return Value
  *
  * CRYPTID_VALIDATION_SUCCESS if the signature is valid.
  */
 CryptidValidationResult hessIdentityBasedSignatureSignature_isValid(
-    const HessIdentityBasedSignatureSignature signature,
-    const EllipticCurve ellipticCurve);
+    const HessIdentityBasedSignatureSignature signature);
 
 #endif
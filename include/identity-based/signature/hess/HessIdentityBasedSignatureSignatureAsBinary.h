@@ -1,8 +1,10 @@
 #ifndef __CRYPTID_HESS_IDENTITY_BASED_SIGNATURE_SIGNATURE_AS_BINARY_H
 #define __CRYPTID_HESS_IDENTITY_BASED_SIGNATURE_SIGNATURE_AS_BINARY_H
 
-#include "elliptic/AffinePointAsBinary.h"
 #include "identity-based/signature/hess/HessIdentityBasedSignatureSignature.h"
+#include "pairing/PairingGroup.h"
+#include "pairing/PairingGroupElementAsBinary.h"
+#include "util/Status.h"
 
 /**
  * ## Description
@@ -13,10 +15,10 @@ typedef struct HessIdentityBasedSignatureSignatureAsBinary {
   /**
    * ## Description
    *
-   * A binary representation of a point in \f$E(F_p)\f$ representing a part of
-   * the signature.
+   * A binary representation of an element of \f$G_1\f$ representing a part
+   * of the signature.
    */
-  AffinePointAsBinary u;
+  PairingGroupElementAsBinary u;
 
   /**
    * ## Description
@@ -48,8 +50,8 @@ typedef struct HessIdentityBasedSignatureSignatureAsBinary {
  * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary)
  * to be initialized.
  *   * u
- *     * A binary representation of a point in \f$E(F_p)\f$ representing a part
- * of the signature.
+ *     * A binary representation of an element of \f$G_1\f$ representing a
+ * part of the signature.
  *   * v
  *     * A binary string representing a part of the signature.
  *   * vLength
@@ -58,7 +60,8 @@ typedef struct HessIdentityBasedSignatureSignatureAsBinary {
  */
 void hessIdentityBasedSignatureSignatureAsBinary_init(
     HessIdentityBasedSignatureSignatureAsBinary *signatureAsBinaryOutput,
-    const AffinePointAsBinary u, const void *const v, const size_t vLength);
+    const PairingGroupElementAsBinary u, const void *const v,
+    const size_t vLength);
 
 /**
  * ## Description
@@ -82,30 +85,40 @@ void hessIdentityBasedSignatureSignatureAsBinary_destroy(
  * Converts a
  * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary)
  * to
- * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary).
+ * [HessIdentityBasedSignatureSignature](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignature.h#HessIdentityBasedSignatureSignature),
+ * reading the first part of the signature as an element of \f$G_1\f$.
  *
  * ## Parameters
  *
  *   * signatureOutput
  *     * The
- * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary)
+ * [HessIdentityBasedSignatureSignature](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignature.h#HessIdentityBasedSignatureSignature)
  * to be initialized based on a
  * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary).
+ * On CRYPTID_SUCCESS, this should be destroyed by the caller.
  *   * signatureAsBinary
  *     * The
  * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary),
  * which needs to be converted to
- * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary).
+ * [HessIdentityBasedSignatureSignature](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignature.h#HessIdentityBasedSignatureSignature).
+ *   * group
+ *     * The pairing group of the public parameters.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_ILLEGAL_SIGNATURE_ERROR if
+ * the first part of the signature is not a valid element of \f$G_1\f$.
  */
-void hessIdentityBasedSignatureSignatureAsBinary_toHessIdentityBasedSignatureSignature(
+CryptidStatus hessIdentityBasedSignatureSignatureAsBinary_toHessIdentityBasedSignatureSignature(
     HessIdentityBasedSignatureSignature *signatureOutput,
-    const HessIdentityBasedSignatureSignatureAsBinary signatureAsBinary);
+    const HessIdentityBasedSignatureSignatureAsBinary signatureAsBinary,
+    const PairingGroup *group);
 
 /**
  * ## Description
  *
  * Converts a
- * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary)
+ * [HessIdentityBasedSignatureSignature](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignature.h#HessIdentityBasedSignatureSignature)
  * to
  * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary).
  *
@@ -115,15 +128,18 @@ void hessIdentityBasedSignatureSignatureAsBinary_toHessIdentityBasedSignatureSig
  *     * The
  * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary)
  * to be initialized based on a
- * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary).
+ * [HessIdentityBasedSignatureSignature](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignature.h#HessIdentityBasedSignatureSignature).
  *   * signature
  *     * The
- * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary),
+ * [HessIdentityBasedSignatureSignature](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignature.h#HessIdentityBasedSignatureSignature),
  * which needs to be converted to
  * [HessIdentityBasedSignatureSignatureAsBinary](codebase://identity-based/signature/hess/HessIdentityBasedSignatureSignatureAsBinary.h#HessIdentityBasedSignatureSignatureAsBinary).
+ *   * group
+ *     * The pairing group of the public parameters.
  */
 void hessIdentityBasedSignatureSignatureAsBinary_fromHessIdentityBasedSignatureSignature(
     HessIdentityBasedSignatureSignatureAsBinary *signatureAsBinaryOutput,
-    const HessIdentityBasedSignatureSignature signature);
+    const HessIdentityBasedSignatureSignature signature,
+    const PairingGroup *group);
 
 #endif
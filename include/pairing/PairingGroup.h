@@ -0,0 +1,596 @@
+#ifndef __CRYPTID_PAIRING_GROUP_H
+#define __CRYPTID_PAIRING_GROUP_H
+
+#include <stddef.h>
+
+#include "gmp.h"
+
+#include "bls12-381/Bls12381Context.h"
+#include "elliptic/EllipticCurve.h"
+#include "elliptic/EllipticCurveContext.h"
+#include "pairing/PairingGroupElement.h"
+#include "pairing/PairingGroupType.h"
+#include "util/HashFunction.h"
+#include "util/Status.h"
+
+// References
+//  * [RFC-5091] Xavier Boyen, Luther Martin. 2007. RFC 5091. Identity-Based
+//  Cryptography Standard (IBCS) #1: Supersingular Curve Implementations of the
+//  BF and BB1 Cryptosystems
+
+/**
+ * ## Description
+ *
+ * A pairing \f$e : G_1 \times G_2 \rightarrow G_T\f$ of prime order, hiding
+ * the curve and the pairing a scheme runs on. The operations dispatch on
+ * {@code type}. A group set up by {@code pairingGroup_init*} borrows its
+ * context, which must outlive the group, and does not need to be destroyed. A
+ * group set up by {@code pairingGroup_acquire*} holds a shared context, and
+ * should be released with {@code pairingGroup_release}.
+ */
+typedef struct PairingGroup {
+  /**
+   * ## Description
+   *
+   * The type of the group, selecting the context.
+   */
+  PairingGroupType type;
+
+  /**
+   * ## Description
+   *
+   * The context of the curve of pairingGroup_TYPE_1.
+   */
+  const EllipticCurveContext *curveContext;
+
+  /**
+   * ## Description
+   *
+   * The context of pairingGroup_BLS12_381.
+   */
+  const Bls12381Context *bls12381Context;
+} PairingGroup;
+
+/**
+ * ## Description
+ *
+ * Initializes a pairingGroup_TYPE_1 group on a supersingular curve of
+ * [RFC-5091].
+ *
+ * ## Parameters
+ *
+ *   * groupOutput
+ *     * The PairingGroup to be initialized.
+ *   * curveContext
+ *     * The context of the curve, holding the order of the subgroup.
+ */
+void pairingGroup_initType1(PairingGroup *groupOutput,
+                            const EllipticCurveContext *curveContext);
+
+/**
+ * ## Description
+ *
+ * Initializes a pairingGroup_BLS12_381 group.
+ *
+ * ## Parameters
+ *
+ *   * groupOutput
+ *     * The PairingGroup to be initialized.
+ *   * bls12381Context
+ *     * The BLS12-381 context.
+ */
+void pairingGroup_initBls12381(PairingGroup *groupOutput,
+                               const Bls12381Context *bls12381Context);
+
+/**
+ * ## Description
+ *
+ * Sets up a pairingGroup_TYPE_1 group on a supersingular curve of [RFC-5091],
+ * looking up the context of the curve in the
+ * [EllipticCurveContextCache](codebase://elliptic/EllipticCurveContextCache.h).
+ * The curve is not validated.
+ *
+ * ## Parameters
+ *
+ *   * groupOutput
+ *     * The PairingGroup to be set up. On CRYPTID_SUCCESS, this should be
+ * released by the caller.
+ *   * ellipticCurve
+ *     * The supersingular curve.
+ *   * subgroupOrder
+ *     * The prime order of the subgroups.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus pairingGroup_acquireType1(PairingGroup *groupOutput,
+                                        const EllipticCurve ellipticCurve,
+                                        const mpz_t subgroupOrder);
+
+/**
+ * ## Description
+ *
+ * Sets up a pairingGroup_BLS12_381 group with the context from the
+ * [Bls12381ContextCache](codebase://bls12-381/Bls12381ContextCache.h).
+ *
+ * ## Parameters
+ *
+ *   * groupOutput
+ *     * The PairingGroup to be set up. On CRYPTID_SUCCESS, this should be
+ * released by the caller.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus pairingGroup_acquireBls12381(PairingGroup *groupOutput);
+
+/**
+ * ## Description
+ *
+ * Sets up the group recorded by public parameters, the way
+ * {@code pairingGroup_describe} writes it. A pairingGroup_TYPE_1 description
+ * is checked to be a supersingular curve of [RFC-5091] with a prime order
+ * dividing \f$p + 1\f$, remembering the descriptions that passed. A
+ * pairingGroup_BLS12_381 description has to match the constants of the curve.
+ *
+ * ## Parameters
+ *
+ *   * groupOutput
+ *     * The PairingGroup to be set up. On CRYPTID_SUCCESS, this should be
+ * released by the caller.
+ *   * type
+ *     * The type of the group.
+ *   * ellipticCurve
+ *     * The curve holding \f$G_1\f$.
+ *   * subgroupOrder
+ *     * The order of the subgroups.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right,
+ * CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR if the description does not belong
+ * to a group of the type, error otherwise.
+ */
+CryptidStatus pairingGroup_acquire(PairingGroup *groupOutput,
+                                   const PairingGroupType type,
+                                   const EllipticCurve ellipticCurve,
+                                   const mpz_t subgroupOrder);
+
+/**
+ * ## Description
+ *
+ * Releases the context of a group set up by {@code pairingGroup_acquire*}.
+ * After calling this function on a PairingGroup instance, that instance should
+ * not be used anymore.
+ *
+ * ## Parameters
+ *
+ *   * group
+ *     * The PairingGroup to be released.
+ */
+void pairingGroup_release(const PairingGroup group);
+
+/**
+ * ## Description
+ *
+ * Writes the curve holding \f$G_1\f$ and the prime order of the subgroups,
+ * the way public parameters record them. On pairingGroup_BLS12_381, this is
+ * \f$y^2 = x^3 + 4\f$ over \f$F_p\f$ and \f$r\f$.
+ *
+ * ## Parameters
+ *
+ *   * ellipticCurveOutput
+ *     * The EllipticCurve to be initialized. Should be destroyed by the caller.
+ *   * subgroupOrder
+ *     * Initialized integer set to the order of the subgroups.
+ *   * group
+ *     * The group to describe.
+ */
+void pairingGroup_describe(EllipticCurve *ellipticCurveOutput,
+                           mpz_t subgroupOrder, const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Generates a random element of \f$G_1\f$ or \f$G_2\f$ other than the
+ * identity, which is a generator as the order of the subgroups is prime.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the element. On CRYPTID_SUCCESS, this should be
+ * destroyed by the caller.
+ *   * subgroup
+ *     * The subgroup of the element, either pairingGroup_G1 or pairingGroup_G2.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_ILLEGAL_SUBGROUP_ERROR if
+ * the subgroup is \f$G_T\f$, error otherwise.
+ */
+CryptidStatus pairingGroup_random(PairingGroupElement *result,
+                                  const PairingGroupSubgroup subgroup,
+                                  const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Cryptographically hashes a string to an element of \f$G_1\f$.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the element. On CRYPTID_SUCCESS, this should be
+ * destroyed by the caller.
+ *   * message
+ *     * The string to hash.
+ *   * messageLength
+ *     * The length of the string.
+ *   * hashFunction
+ *     * The hash function to use.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus pairingGroup_hashToG1(PairingGroupElement *result,
+                                    const char *const message,
+                                    const size_t messageLength,
+                                    const HashFunction hashFunction,
+                                    const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Multiplies an element of \f$G_1\f$ or \f$G_2\f$ with a scalar, using its
+ * fixed-base table if it has been prepared.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the product. On CRYPTID_SUCCESS, this should be
+ * destroyed by the caller.
+ *   * element
+ *     * The element to multiply.
+ *   * scalar
+ *     * The scalar to multiply with.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_ILLEGAL_SUBGROUP_ERROR if
+ * the element is in \f$G_T\f$, error otherwise.
+ */
+CryptidStatus pairingGroup_multiply(PairingGroupElement *result,
+                                    const PairingGroupElement *element,
+                                    const mpz_t scalar,
+                                    const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Computes the sum \f$\sum_{i} s_i P_i\f$ of elements of the same subgroup,
+ * either \f$G_1\f$ or \f$G_2\f$. On pairingGroup_TYPE_1, the terms share a
+ * single doubling chain, unless every element has been prepared as a fixed
+ * base.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the sum. On CRYPTID_SUCCESS, this should be destroyed
+ * by the caller.
+ *   * elements
+ *     * The elements to multiply.
+ *   * scalars
+ *     * The scalars to multiply with, one for every element.
+ *   * count
+ *     * The number of terms, at least one.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_ILLEGAL_SUBGROUP_ERROR if
+ * the elements are in \f$G_T\f$, error otherwise.
+ */
+CryptidStatus pairingGroup_multiScalarMultiply(
+    PairingGroupElement *result, const PairingGroupElement *elements,
+    const mpz_srcptr *scalars, const size_t count, const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Adds two elements of \f$G_1\f$ or of \f$G_2\f$.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the sum. On CRYPTID_SUCCESS, this should be destroyed
+ * by the caller.
+ *   * element1
+ *     * An element.
+ *   * element2
+ *     * An element of the same subgroup.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_ILLEGAL_SUBGROUP_ERROR if
+ * the elements are in \f$G_T\f$ or in different subgroups, error otherwise.
+ */
+CryptidStatus pairingGroup_add(PairingGroupElement *result,
+                               const PairingGroupElement *element1,
+                               const PairingGroupElement *element2,
+                               const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Negates an element of \f$G_1\f$ or \f$G_2\f$.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the negated element. On CRYPTID_SUCCESS, this should
+ * be destroyed by the caller.
+ *   * element
+ *     * The element to negate.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_ILLEGAL_SUBGROUP_ERROR if
+ * the element is in \f$G_T\f$.
+ */
+CryptidStatus pairingGroup_negate(PairingGroupElement *result,
+                                  const PairingGroupElement *element,
+                                  const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Multiplies two elements of \f$G_T\f$.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the product. On CRYPTID_SUCCESS, this should be
+ * destroyed by the caller.
+ *   * element1
+ *     * An element of \f$G_T\f$.
+ *   * element2
+ *     * An element of \f$G_T\f$.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_ILLEGAL_SUBGROUP_ERROR if
+ * the elements are not in \f$G_T\f$.
+ */
+CryptidStatus pairingGroup_mul(PairingGroupElement *result,
+                               const PairingGroupElement *element1,
+                               const PairingGroupElement *element2,
+                               const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Raises an element of \f$G_T\f$ to a power, using its fixed-base table if it
+ * has been prepared.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the power. On CRYPTID_SUCCESS, this should be
+ * destroyed by the caller.
+ *   * element
+ *     * The base.
+ *   * exponent
+ *     * The exponent, which may be negative.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_ILLEGAL_SUBGROUP_ERROR if
+ * the element is not in \f$G_T\f$.
+ */
+CryptidStatus pairingGroup_pow(PairingGroupElement *result,
+                               const PairingGroupElement *element,
+                               const mpz_t exponent,
+                               const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Computes the pairing \f$e(P, Q)\f$. On pairingGroup_TYPE_1 the pairing is
+ * symmetric, so either argument may be the one prepared by
+ * {@code pairingGroup_preparePairingArgument}.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the value of the pairing in \f$G_T\f$. On
+ * CRYPTID_SUCCESS, this should be destroyed by the caller.
+ *   * p
+ *     * An element of \f$G_1\f$.
+ *   * q
+ *     * An element of \f$G_2\f$.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_ILLEGAL_SUBGROUP_ERROR if
+ * the arguments are not in \f$G_1\f$ and \f$G_2\f$, error otherwise.
+ */
+CryptidStatus pairingGroup_pair(PairingGroupElement *result,
+                                const PairingGroupElement *p,
+                                const PairingGroupElement *q,
+                                const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Computes the product of pairings \f$\prod_{i} e(P_i, Q_i)\f$. On
+ * pairingGroup_TYPE_1, the Miller loops share their squarings and the product
+ * has a single final exponentiation, unless one of the arguments has been
+ * prepared by {@code pairingGroup_preparePairingArgument}.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the product in \f$G_T\f$. On CRYPTID_SUCCESS, this
+ * should be destroyed by the caller.
+ *   * ps
+ *     * Elements of \f$G_1\f$.
+ *   * qs
+ *     * Elements of \f$G_2\f$, one for every element of {@code ps}.
+ *   * count
+ *     * The number of pairs, at least one.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_ILLEGAL_SUBGROUP_ERROR if
+ * the arguments are not in \f$G_1\f$ and \f$G_2\f$, error otherwise.
+ */
+CryptidStatus pairingGroup_pairProduct(PairingGroupElement *result,
+                                       const PairingGroupElement *ps,
+                                       const PairingGroupElement *qs,
+                                       const size_t count,
+                                       const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Checks whether two elements of the same subgroup are equal.
+ *
+ * ## Parameters
+ *
+ *   * element1
+ *     * The first element.
+ *   * element2
+ *     * The second element.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * 1 if the elements are equal, 0 otherwise.
+ */
+int pairingGroup_isEquals(const PairingGroupElement *element1,
+                          const PairingGroupElement *element2,
+                          const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Represents an element as a string of octets. On pairingGroup_TYPE_1, the
+ * elements of \f$G_T\f$ are written by {@code canonical} and the points as
+ * their big-endian coordinates of \f$\mathrm{Ceiling}(\frac{\log(p)}{8})\f$
+ * octets each, all zeros for the point at infinity. On pairingGroup_BLS12_381,
+ * the {@code bls12381_*ToBinary} encodings are used.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the string. SHOULD NOT BE INITIALIZED, and should be
+ * freed by the caller.
+ *   * resultLength
+ *     * Out parameter to the length of the string.
+ *   * element
+ *     * The element to represent.
+ *   * group
+ *     * The group to operate on.
+ */
+void pairingGroup_toBinary(unsigned char **result, int *const resultLength,
+                           const PairingGroupElement *element,
+                           const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Reads the representation of an element written by
+ * {@code pairingGroup_toBinary}, checking that it encodes an element of the
+ * subgroup.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter to the element. On CRYPTID_SUCCESS, this should be
+ * destroyed by the caller.
+ *   * subgroup
+ *     * The subgroup of the element.
+ *   * input
+ *     * The representation.
+ *   * inputLength
+ *     * The length of the representation.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right,
+ * CRYPTID_ILLEGAL_POINT_ENCODING_ERROR if the input is not a valid encoding.
+ */
+CryptidStatus pairingGroup_fromBinary(PairingGroupElement *result,
+                                      const PairingGroupSubgroup subgroup,
+                                      const unsigned char *const input,
+                                      const int inputLength,
+                                      const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Precomputes a fixed-base table of an element, speeding up
+ * {@code pairingGroup_multiply} and {@code pairingGroup_pow} with it. Does
+ * nothing on pairingGroup_BLS12_381.
+ *
+ * ## Parameters
+ *
+ *   * element
+ *     * The element to prepare.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, error otherwise.
+ */
+CryptidStatus pairingGroup_prepareFixedBase(PairingGroupElement *element,
+                                            const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Precomputes the Miller loop of a point, speeding up
+ * {@code pairingGroup_pair} with it. Does nothing on pairingGroup_BLS12_381.
+ *
+ * ## Parameters
+ *
+ *   * element
+ *     * The element of \f$G_1\f$ or \f$G_2\f$ to prepare.
+ *   * group
+ *     * The group to operate on.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, CRYPTID_ILLEGAL_SUBGROUP_ERROR if
+ * the element is in \f$G_T\f$, error otherwise.
+ */
+CryptidStatus pairingGroup_preparePairingArgument(PairingGroupElement *element,
+                                                  const PairingGroup *group);
+
+#endif
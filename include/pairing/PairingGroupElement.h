@@ -0,0 +1,174 @@
+#ifndef __CRYPTID_PAIRING_GROUP_ELEMENT_H
+#define __CRYPTID_PAIRING_GROUP_ELEMENT_H
+
+#include "bls12-381/Fp12Element.h"
+#include "bls12-381/TwistAffinePoint.h"
+#include "complex/Complex.h"
+#include "complex/GtFixedBaseTable.h"
+#include "elliptic/AffineFixedBaseTable.h"
+#include "elliptic/AffinePoint.h"
+#include "elliptic/FieldAffinePoint.h"
+#include "elliptic/PreparedPairingArgument.h"
+#include "field/FieldElement.h"
+#include "field/MontgomeryContext.h"
+#include "pairing/PairingGroupType.h"
+
+/**
+ * ## Description
+ *
+ * An element of one of the subgroups of a
+ * [PairingGroup](codebase://pairing/PairingGroup.h#PairingGroup). Only the
+ * representation belonging to {@code type} and {@code subgroup} is set, the
+ * rest of the fields are meaningless.
+ */
+typedef struct PairingGroupElement {
+  /**
+   * ## Description
+   *
+   * The type of the group the element belongs to.
+   */
+  PairingGroupType type;
+
+  /**
+   * ## Description
+   *
+   * The subgroup the element belongs to.
+   */
+  PairingGroupSubgroup subgroup;
+
+  /**
+   * ## Description
+   *
+   * The element of \f$G_1\f$ or \f$G_2\f$ of pairingGroup_TYPE_1.
+   */
+  AffinePoint affinePoint;
+
+  /**
+   * ## Description
+   *
+   * The element of \f$G_T\f$ of pairingGroup_TYPE_1.
+   */
+  Complex complex;
+
+  /**
+   * ## Description
+   *
+   * The storage of the pairingGroup_BLS12_381 representations.
+   */
+  mp_limb_t *limbs;
+
+  /**
+   * ## Description
+   *
+   * The element of \f$G_1\f$ of pairingGroup_BLS12_381.
+   */
+  FieldAffinePoint fieldAffinePoint;
+
+  /**
+   * ## Description
+   *
+   * The element of \f$G_2\f$ of pairingGroup_BLS12_381.
+   */
+  TwistAffinePoint twistAffinePoint;
+
+  /**
+   * ## Description
+   *
+   * The element of \f$G_T\f$ of pairingGroup_BLS12_381.
+   */
+  Fp12Element fp12Element;
+
+  /**
+   * ## Description
+   *
+   * Fixed-base table of a point, set by {@code pairingGroup_prepareFixedBase}.
+   * NULL if the element is not prepared.
+   */
+  AffineFixedBaseTable *affineFixedBaseTable;
+
+  /**
+   * ## Description
+   *
+   * Fixed-base table of an element of \f$G_T\f$, set by
+   * {@code pairingGroup_prepareFixedBase}. NULL if the element is not prepared.
+   */
+  GtFixedBaseTable *gtFixedBaseTable;
+
+  /**
+   * ## Description
+   *
+   * The point prepared as a pairing argument, set by
+   * {@code pairingGroup_preparePairingArgument}. NULL if the element is not
+   * prepared.
+   */
+  PreparedPairingArgument *preparedPairingArgument;
+} PairingGroupElement;
+
+/**
+ * ## Description
+ *
+ * Initializes a new pairingGroup_TYPE_1 element with a copy of a point.
+ *
+ * ## Parameters
+ *
+ *   * elementOutput
+ *     * The PairingGroupElement to be initialized.
+ *   * point
+ *     * The point to copy.
+ *   * subgroup
+ *     * The subgroup of the point, either pairingGroup_G1 or pairingGroup_G2.
+ */
+void pairingGroupElement_fromAffinePoint(PairingGroupElement *elementOutput,
+                                         const AffinePoint point,
+                                         const PairingGroupSubgroup subgroup);
+
+/**
+ * ## Description
+ *
+ * Initializes a new pairingGroup_TYPE_1 element of \f$G_T\f$ with a copy of
+ * an element of \f$F_p^2\f$.
+ *
+ * ## Parameters
+ *
+ *   * elementOutput
+ *     * The PairingGroupElement to be initialized.
+ *   * complex
+ *     * The element of \f$F_p^2\f$ to copy.
+ */
+void pairingGroupElement_fromComplex(PairingGroupElement *elementOutput,
+                                     const Complex complex);
+
+/**
+ * ## Description
+ *
+ * Initializes a new pairingGroup_BLS12_381 element with freshly allocated
+ * storage. The value of the element is unset.
+ *
+ * ## Parameters
+ *
+ *   * elementOutput
+ *     * The PairingGroupElement to be initialized.
+ *   * subgroup
+ *     * The subgroup of the element.
+ *   * montgomeryContext
+ *     * The context of the base field of BLS12-381.
+ */
+void pairingGroupElement_initBls12381(
+    PairingGroupElement *elementOutput, const PairingGroupSubgroup subgroup,
+    const MontgomeryContext *montgomeryContext);
+
+/**
+ * ## Description
+ *
+ * Frees a PairingGroupElement, together with its precomputations. After
+ * calling this function on a PairingGroupElement instance, that instance
+ * should not be used anymore.
+ *
+ * ## Parameters
+ *
+ *   * element
+ *     * The PairingGroupElement to be destroyed.
+ */
+void pairingGroupElement_destroy(PairingGroupElement element);
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef __CRYPTID_PAIRING_GROUP_ELEMENT_AS_BINARY_H
+#define __CRYPTID_PAIRING_GROUP_ELEMENT_AS_BINARY_H
+
+#include <stddef.h>
+
+#include "pairing/PairingGroup.h"
+#include "pairing/PairingGroupElement.h"
+#include "pairing/PairingGroupType.h"
+#include "util/Status.h"
+
+/**
+ * ## Description
+ *
+ * Represents an element of \f$G_1\f$, \f$G_2\f$ or \f$G_T\f$ with the string
+ * of octets written by {@code pairingGroup_toBinary}.
+ */
+typedef struct PairingGroupElementAsBinary {
+  /**
+   * ## Description
+   *
+   * The binary representation of the element.
+   */
+  void *element;
+
+  /**
+   * ## Description
+   *
+   * The length of the element's binary representation.
+   */
+  size_t elementLength;
+} PairingGroupElementAsBinary;
+
+/**
+ * ## Description
+ *
+ * Initializes a new PairingGroupElementAsBinary with a copy of a binary
+ * representation.
+ *
+ * ## Parameters
+ *
+ *   * elementAsBinaryOutput
+ *     * The PairingGroupElementAsBinary to be initialized.
+ *   * element
+ *     * The binary representation of the element.
+ *   * elementLength
+ *     * The length of the element's binary representation.
+ */
+void pairingGroupElementAsBinary_init(
+    PairingGroupElementAsBinary *elementAsBinaryOutput,
+    const void *const element, const size_t elementLength);
+
+/**
+ * ## Description
+ *
+ * Frees a PairingGroupElementAsBinary. After calling this function on a
+ * PairingGroupElementAsBinary instance, that instance should not be used
+ * anymore.
+ *
+ * ## Parameters
+ *
+ *   * elementAsBinary
+ *     * The PairingGroupElementAsBinary to be destroyed.
+ */
+void pairingGroupElementAsBinary_destroy(
+    PairingGroupElementAsBinary elementAsBinary);
+
+/**
+ * ## Description
+ *
+ * Converts a PairingGroupElementAsBinary to PairingGroupElement, checking that
+ * it represents an element of the subgroup.
+ *
+ * ## Parameters
+ *
+ *   * elementOutput
+ *     * The PairingGroupElement to be initialized. On CRYPTID_SUCCESS, this
+ * should be destroyed by the caller.
+ *   * subgroup
+ *     * The subgroup of the element, pairingGroup_G1, pairingGroup_G2 or
+ * pairingGroup_GT.
+ *   * elementAsBinary
+ *     * The PairingGroupElementAsBinary to convert.
+ *   * group
+ *     * The group the element belongs to.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_SUCCESS if everything went right, the error of
+ * {@code pairingGroup_fromBinary} otherwise.
+ */
+CryptidStatus pairingGroupElementAsBinary_toPairingGroupElement(
+    PairingGroupElement *elementOutput, const PairingGroupSubgroup subgroup,
+    const PairingGroupElementAsBinary elementAsBinary,
+    const PairingGroup *group);
+
+/**
+ * ## Description
+ *
+ * Converts a PairingGroupElement to PairingGroupElementAsBinary.
+ *
+ * ## Parameters
+ *
+ *   * elementAsBinaryOutput
+ *     * The PairingGroupElementAsBinary to be initialized.
+ *   * element
+ *     * The element of \f$G_1\f$, \f$G_2\f$ or \f$G_T\f$ to convert.
+ *   * group
+ *     * The group the element belongs to.
+ */
+void pairingGroupElementAsBinary_fromPairingGroupElement(
+    PairingGroupElementAsBinary *elementAsBinaryOutput,
+    const PairingGroupElement *element, const PairingGroup *group);
+
+#endif
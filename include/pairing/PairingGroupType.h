@@ -0,0 +1,31 @@
+#ifndef __CRYPTID_PAIRING_GROUP_TYPE_H
+#define __CRYPTID_PAIRING_GROUP_TYPE_H
+
+/**
+ * ## Description
+ *
+ * The currently supported pairing groups.
+ *
+ *   * pairingGroup_TYPE_1
+ *     * The supersingular curves of [RFC-5091] with the modified Tate pairing,
+ * where \f$G_1 = G_2\f$.
+ *   * pairingGroup_BLS12_381
+ *     * The BLS12-381 curve with the optimal ate pairing.
+ */
+typedef enum PairingGroupType {
+  pairingGroup_TYPE_1 = 0,
+  pairingGroup_BLS12_381 = 1
+} PairingGroupType;
+
+/**
+ * ## Description
+ *
+ * The subgroups of a pairing \f$e : G_1 \times G_2 \rightarrow G_T\f$.
+ */
+typedef enum PairingGroupSubgroup {
+  pairingGroup_G1 = 0,
+  pairingGroup_G2 = 1,
+  pairingGroup_GT = 2
+} PairingGroupSubgroup;
+
+#endif
@@ -0,0 +1,3 @@
+#ifndef __CRYPTID_PAIRING_GROUP_MODULE
+#define __CRYPTID_PAIRING_GROUP_MODULE
+#endif
\ No newline at end of file
@@ -0,0 +1,122 @@
+#ifndef __CRYPTID_HASH_TO_POINT_CACHE_H
+#define __CRYPTID_HASH_TO_POINT_CACHE_H
+
+#include <stddef.h>
+
+#include "elliptic/AffinePoint.h"
+#include "util/HashFunction.h"
+
+/**
+ * ## Description
+ *
+ * The number of independently locked shards of the cache, so that threads
+ * hashing different identities rarely wait for each other.
+ */
+#define HASH_TO_POINT_CACHE_SHARD_COUNT 8
+
+/**
+ * ## Description
+ *
+ * The capacity of the cache before the first call to
+ * {@code hashToPointCache_setCapacity}. The cache is disabled by default. Can
+ * be overridden at compile time.
+ */
+#ifndef HASH_TO_POINT_CACHE_DEFAULT_CAPACITY
+#define HASH_TO_POINT_CACHE_DEFAULT_CAPACITY 0
+#endif
+
+/**
+ * ## Description
+ *
+ * Sets the number of points the cache of {@code hashToPoint} holds, and
+ * empties it. The capacity is rounded up to a multiple of
+ * {@code HASH_TO_POINT_CACHE_SHARD_COUNT}, and each shard evicts its least
+ * recently used point once full. A capacity of zero disables the cache. Safe
+ * to call from multiple threads.
+ *
+ * ## Parameters
+ *
+ *   * capacity
+ *     * The number of points to hold.
+ */
+void hashToPointCache_setCapacity(const size_t capacity);
+
+/**
+ * ## Description
+ *
+ * Looks up the point an identity hashes to. Safe to call from multiple
+ * threads.
+ *
+ * ## Parameters
+ *
+ *   * result
+ *     * Out parameter storing the point. If the return value is 1, it must be
+ * destroyed by the caller.
+ *   * fingerprint
+ *     * The fingerprint of the curve, see
+ * [EllipticCurveContext](codebase://elliptic/EllipticCurveContext.h#EllipticCurveContext).
+ *   * hashFunction
+ *     * The hash function the identity is hashed with.
+ *   * id
+ *     * The identity.
+ *   * idLength
+ *     * The length of the identity.
+ *
+ * ## Return Value
+ *
+ * 1 if the point was in the cache, 0 otherwise.
+ */
+int hashToPointCache_get(AffinePoint *result, const unsigned char *fingerprint,
+                         const HashFunction hashFunction,
+                         const char *const id, const int idLength);
+
+/**
+ * ## Description
+ *
+ * Stores the point an identity hashes to. Safe to call from multiple threads.
+ *
+ * ## Parameters
+ *
+ *   * point
+ *     * The point, copied by the cache.
+ *   * fingerprint
+ *     * The fingerprint of the curve, see
+ * [EllipticCurveContext](codebase://elliptic/EllipticCurveContext.h#EllipticCurveContext).
+ *   * hashFunction
+ *     * The hash function the identity is hashed with.
+ *   * id
+ *     * The identity.
+ *   * idLength
+ *     * The length of the identity.
+ */
+void hashToPointCache_put(const AffinePoint point,
+                          const unsigned char *fingerprint,
+                          const HashFunction hashFunction,
+                          const char *const id, const int idLength);
+
+/**
+ * ## Description
+ *
+ * Reads the counters of the cache. Safe to call from multiple threads.
+ *
+ * ## Parameters
+ *
+ *   * hitCount
+ *     * Out parameter storing the number of lookups that found their point.
+ *   * missCount
+ *     * Out parameter storing the number of lookups that did not.
+ *   * size
+ *     * Out parameter storing the number of points held.
+ */
+void hashToPointCache_getStatistics(size_t *hitCount, size_t *missCount,
+                                    size_t *size);
+
+/**
+ * ## Description
+ *
+ * Removes every point from the cache and resets its counters. Safe to call
+ * from multiple threads.
+ */
+void hashToPointCache_flush(void);
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef __CRYPTID_MUTEX_H
+#define __CRYPTID_MUTEX_H
+
+#if defined(__wasi__)
+
+/**
+ * ## Description
+ *
+ * Mutual exclusion lock guarding the shared state of the library. WASI has
+ * no threads, so it is a no-op there.
+ */
+typedef int CryptidMutex;
+
+/**
+ * ## Description
+ *
+ * Static initializer of a
+ * [CryptidMutex](codebase://util/Mutex.h#CryptidMutex).
+ */
+#define CRYPTID_MUTEX_INITIALIZER 0
+
+#elif defined(_WIN32)
+
+#include <windows.h>
+
+typedef SRWLOCK CryptidMutex;
+
+#define CRYPTID_MUTEX_INITIALIZER SRWLOCK_INIT
+
+#else
+
+#include <pthread.h>
+
+typedef pthread_mutex_t CryptidMutex;
+
+#define CRYPTID_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+
+#endif
+
+/**
+ * ## Description
+ *
+ * Acquires the mutex, blocking until it is available.
+ *
+ * ## Parameters
+ *
+ *   * mutex
+ *     * The mutex to acquire.
+ */
+void mutex_lock(CryptidMutex *mutex);
+
+/**
+ * ## Description
+ *
+ * Releases the mutex, previously acquired by the calling thread.
+ *
+ * ## Parameters
+ *
+ *   * mutex
+ *     * The mutex to release.
+ */
+void mutex_unlock(CryptidMutex *mutex);
+
+#endif
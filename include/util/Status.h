@@ -139,7 +139,36 @@ typedef enum {
    *
    * The given hash type is invalid.
    */
-  CRPYTID_UNKNOWN_HASH_TYPE_ERROR
+  CRPYTID_UNKNOWN_HASH_TYPE_ERROR,
+
+  /*
+   * ## Description
+   *
+   * The field of the elliptic curve is larger than the widest supported
+   * fixed-width field element.
+   */
+  CRYPTID_FIELD_SIZE_NOT_SUPPORTED_ERROR,
+
+  /*
+   * ## Description
+   *
+   * The given encoding does not represent a valid group element.
+   */
+  CRYPTID_ILLEGAL_POINT_ENCODING_ERROR,
+
+  /*
+   * ## Description
+   *
+   * The operation is not defined on the subgroup of the given group element.
+   */
+  CRYPTID_ILLEGAL_SUBGROUP_ERROR,
+
+  /*
+   * ## Description
+   *
+   * The selected pairing group does not reach the given security level.
+   */
+  CRYPTID_SECURITY_LEVEL_NOT_SUPPORTED_ERROR
 } CryptidStatus;
 
 #endif
@@ -6,6 +6,7 @@
 #include "complex/Complex.h"
 #include "elliptic/AffinePoint.h"
 #include "elliptic/EllipticCurve.h"
+#include "elliptic/EllipticCurveContext.h"
 #include "util/HashFunction.h"
 #include "util/Status.h"
 
@@ -35,6 +36,8 @@ void hashToRange(mpz_t result, const unsigned char *const s, const int sLength,
  * ## Description
  *
  * Cryptographically hashes a string to a point on the specified elliptic curve.
+ * The points are looked up in and stored to the cache configured by
+ * {@code hashToPointCache_setCapacity}, which is disabled by default.
  *
  * ## Parameters
  *
@@ -45,10 +48,9 @@ void hashToRange(mpz_t result, const unsigned char *const s, const int sLength,
  *     * A string.
  *   * idLength
  *     * The length of the id string.
- *   * q
- *     * A prime.
- *   * ellipticCurve
- *     * The curve to operate on.
+ *   * context
+ *     * The context of the curve to operate on, holding the prime order
+ * \f$q\f$ of the subgroup.
  *   * hashFunction
  *     * The hash function to use.
  *
@@ -57,8 +59,8 @@ void hashToRange(mpz_t result, const unsigned char *const s, const int sLength,
  * CRYPTID_SUCCESS if everything went right.
  */
 CryptidStatus hashToPoint(AffinePoint *result, const char *const id,
-                          const int idLength, const mpz_t q,
-                          const EllipticCurve ellipticCurve,
+                          const int idLength,
+                          const EllipticCurveContext *context,
                           const HashFunction hashFunction);
 
 /**
@@ -0,0 +1,104 @@
+#ifndef __CRYPTID_VALIDATION_MEMO_H
+#define __CRYPTID_VALIDATION_MEMO_H
+
+#include <stddef.h>
+
+#include "gmp.h"
+#include "util/Validation.h"
+
+/**
+ * ## Description
+ *
+ * The number of keys the memo holds. Once full, the oldest key is evicted.
+ * Can be overridden at compile time.
+ */
+#ifndef VALIDATION_MEMO_CAPACITY
+#define VALIDATION_MEMO_CAPACITY 64
+#endif
+
+/**
+ * ## Description
+ *
+ * The length of a key in octets, the size of a SHA-256 digest.
+ */
+#define VALIDATION_MEMO_KEY_LENGTH 32
+
+/**
+ * ## Description
+ *
+ * Digest of a serialized set of values, identifying them in the validation
+ * memo.
+ */
+typedef struct ValidationMemoKey {
+  /**
+   * ## Description
+   *
+   * The SHA-256 digest of the domain and the values.
+   */
+  unsigned char digest[VALIDATION_MEMO_KEY_LENGTH];
+} ValidationMemoKey;
+
+/**
+ * ## Description
+ *
+ * Computes the key of a set of values. Every value is serialized with its sign
+ * and length, so different sets of values yield different keys, up to the
+ * collision resistance of SHA-256.
+ *
+ * ## Parameters
+ *
+ *   * key
+ *     * Out parameter holding the key.
+ *   * domain
+ *     * Zero-terminated string naming what the values are, so that the same
+ * values validated as different objects yield different keys.
+ *   * values
+ *     * The values to compute the key of.
+ *   * valueCount
+ *     * The number of values.
+ */
+void validationMemo_computeKey(ValidationMemoKey *key, const char *const domain,
+                               const mpz_srcptr *values,
+                               const size_t valueCount);
+
+/**
+ * ## Description
+ *
+ * Checks whether the values with the specified key have already passed their
+ * validation. Safe to call from multiple threads.
+ *
+ * ## Parameters
+ *
+ *   * key
+ *     * The key to look up.
+ *
+ * ## Return Value
+ *
+ * CRYPTID_VALIDATION_SUCCESS if the key is in the memo.
+ */
+CryptidValidationResult
+validationMemo_isKnownValid(const ValidationMemoKey *key);
+
+/**
+ * ## Description
+ *
+ * Records that the values with the specified key have passed their
+ * validation. Should only be called with the key of values that did. Safe to
+ * call from multiple threads.
+ *
+ * ## Parameters
+ *
+ *   * key
+ *     * The key to record.
+ */
+void validationMemo_rememberValid(const ValidationMemoKey *key);
+
+/**
+ * ## Description
+ *
+ * Removes every key from the memo, so that the next validations are carried
+ * out in full. Safe to call from multiple threads.
+ */
+void validationMemo_flush(void);
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef __CRYPTID_WINDOWED_NAF_H
+#define __CRYPTID_WINDOWED_NAF_H
+
+#include <stddef.h>
+
+#include "gmp.h"
+
+/**
+ * ## Description
+ *
+ * Returns the number of digits a buffer must be able to hold for the
+ * width-\f$w\f$ NAF of the specified number, for any \f$w\f$.
+ *
+ * ## Parameters
+ *
+ *   * s
+ *     * A non-negative number.
+ *
+ * ## Return Value
+ *
+ * The required length of the digit buffer.
+ */
+size_t windowedNaf_maxLength(const mpz_t s);
+
+/**
+ * ## Description
+ *
+ * Computes the width-\f$w\f$ NAF of a number. Every nonzero digit is odd,
+ * less than \f$2^{w - 1}\f$ in absolute value, and followed by at least
+ * \f$w - 1\f$ zero digits. Implementation of Algorithm 3.35 in
+ * [Guide-to-ECC].
+ *
+ * ## Parameters
+ *
+ *   * digits
+ *     * Out parameter storing the digits, least significant first. Must hold
+ * at least {@code windowedNaf_maxLength(s)} digits.
+ *   * s
+ *     * A non-negative number.
+ *   * windowSize
+ *     * The width \f$w\f$, between 2 and 8.
+ *
+ * ## Return Value
+ *
+ * The number of digits, without leading zeros.
+ */
+size_t windowedNaf_recode(signed char *digits, const mpz_t s,
+                          const int windowSize);
+
+#endif
@@ -1,28 +1,23 @@
-
 #include <stdlib.h>
 #include <string.h>
 
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryption.h"
-#include "elliptic/TatePairing.h"
+#include "pairing/PairingGroup.h"
 #include "util/PrimalityTest.h"
 #include "util/RandBytes.h"
 #include "util/Utils.h"
 
 static const unsigned int SOLINAS_GENERATION_ATTEMPT_LIMIT = 100;
-static const unsigned int POINT_GENERATION_ATTEMPT_LIMIT = 100;
 
 static const unsigned int Q_LENGTH_MAPPING[] = {160, 224, 256, 384, 512};
 static const unsigned int P_LENGTH_MAPPING[] = {512, 1024, 1536, 3840, 7680};
 
-// Returns a publickey and a masterkey with the specified securityLevel
-CryptidStatus cryptid_abe_bsw_setup(
-    bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary
-        *publickeyAsBinary,
-    bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary
-        *masterkeyAsBinary,
-    const SecurityLevel securityLevel) {
-  bswCiphertextPolicyAttributeBasedEncryptionMasterKey *masterkey =
-      malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionMasterKey));
+// Sets up a pairingGroup_TYPE_1 group on the curve y^2 = x^3 + 1 over F_p,
+// with p = 12 * r * q - 1 for a Solinas prime q. On CRYPTID_SUCCESS, the group
+// should be released by the caller.
+static CryptidStatus
+bswCiphertextPolicyAttributeBasedEncryption_setUpType1PairingGroup(
+    PairingGroup *group, const SecurityLevel securityLevel) {
   // Construct the elliptic curve and its subgroup of interest
   // Select a random \f$n_q\f$-bit Solinas prime \f$q\f$.
   mpz_t q;
@@ -57,106 +52,156 @@ CryptidStatus cryptid_abe_bsw_setup(
   EllipticCurve ec;
   ellipticCurve_init(&ec, zero, one, p);
 
-  // Select a point \f$P\f$ of order \f$q\f$ in \f$E(F_p)\f$.
-  AffinePoint pointP;
-  do {
-    AffinePoint pointPprime;
-    status =
-        random_affinePoint(&pointPprime, ec, POINT_GENERATION_ATTEMPT_LIMIT);
-
-    if (status) {
-      mpz_clears(p, q, r, NULL);
-      ellipticCurve_destroy(ec);
-      return status;
-    }
-
-    mpz_t rMul;
-    mpz_init_set(rMul, r);
-    mpz_mul_ui(rMul, rMul, 12);
+  mpz_clears(zero, one, NULL);
 
-    status = affine_wNAFMultiply(&pointP, pointPprime, rMul, ec);
+  status = pairingGroup_acquireType1(group, ec, q);
 
-    if (status) {
-      mpz_clears(p, q, r, rMul, NULL);
-      ellipticCurve_destroy(ec);
-      affine_destroy(pointPprime);
-      return status;
-    }
+  mpz_clears(p, q, r, NULL);
+  ellipticCurve_destroy(ec);
 
-    mpz_clear(rMul);
-    affine_destroy(pointPprime);
-  } while (affine_isInfinity(pointP));
+  return status;
+}
 
-  mpz_t pMinusOne;
-  mpz_init(pMinusOne);
-  mpz_sub_ui(pMinusOne, p, 1);
+// Returns a publickey and a masterkey with the specified securityLevel
+CryptidStatus cryptid_abe_bsw_setup(
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary
+        *publickeyAsBinary,
+    bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary
+        *masterkeyAsBinary,
+    const SecurityLevel securityLevel) {
+  return cryptid_abe_bsw_setupForPairingGroup(publickeyAsBinary,
+                                              masterkeyAsBinary, securityLevel,
+                                              pairingGroup_TYPE_1);
+}
 
-  mpz_t alpha;
-  mpz_init(alpha);
-  random_mpzInRange(alpha, pMinusOne);
+// Returns a publickey and a masterkey with the specified securityLevel on the
+// selected pairing group
+CryptidStatus cryptid_abe_bsw_setupForPairingGroup(
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary
+        *publickeyAsBinary,
+    bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary
+        *masterkeyAsBinary,
+    const SecurityLevel securityLevel,
+    const PairingGroupType pairingGroupType) {
+  PairingGroup group;
+  CryptidStatus status;
+  switch (pairingGroupType) {
+  case pairingGroup_TYPE_1:
+    status = bswCiphertextPolicyAttributeBasedEncryption_setUpType1PairingGroup(
+        &group, securityLevel);
+    break;
+  case pairingGroup_BLS12_381:
+    // The subgroups of BLS12-381 are of 255 bits.
+    if (securityLevel > MEDIUM) {
+      return CRYPTID_SECURITY_LEVEL_NOT_SUPPORTED_ERROR;
+    }
+    status = pairingGroup_acquireBls12381(&group);
+    break;
+  default:
+    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+  }
 
-  mpz_t beta;
-  mpz_init(beta);
-  random_mpzInRange(beta, pMinusOne);
+  if (status) {
+    return status;
+  }
 
+  // The group is handed over to the public key below.
   bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey =
       malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionPublicKey));
+  publickey->pairingGroupType = pairingGroupType;
+  publickey->group = group;
+  mpz_init(publickey->q);
+  pairingGroup_describe(&publickey->ellipticCurve, publickey->q, &group);
+  hashFunction_initForSecurityLevel(&(publickey->hashFunction), securityLevel);
 
-  publickey->ellipticCurve = ec;
-  publickey->g = pointP;
-
-  status = affine_wNAFMultiply(&publickey->h, publickey->g, beta,
-                               publickey->ellipticCurve);
+  // Select the generators g1 and g2 of G1 and G2.
+  status = pairingGroup_random(&publickey->g1, pairingGroup_G1, &group);
   if (status) {
-    mpz_clears(p, q, r, pMinusOne, alpha, beta, NULL);
-    ellipticCurve_destroy(ec);
+    mpz_clear(publickey->q);
+    ellipticCurve_destroy(publickey->ellipticCurve);
+    pairingGroup_release(group);
+    free(publickey);
     return status;
   }
 
-  mpz_t betaInverse;
-  mpz_init(betaInverse);
-  mpz_invert(betaInverse, beta, q);
-
-  status = affine_wNAFMultiply(&publickey->f, publickey->g, betaInverse,
-                               publickey->ellipticCurve);
+  status = pairingGroup_random(&publickey->g2, pairingGroup_G2, &group);
   if (status) {
-    mpz_clears(p, q, r, pMinusOne, alpha, beta, betaInverse, NULL);
+    pairingGroupElement_destroy(publickey->g1);
+    mpz_clear(publickey->q);
+    ellipticCurve_destroy(publickey->ellipticCurve);
+    pairingGroup_release(group);
+    free(publickey);
     return status;
   }
 
-  mpz_init(masterkey->beta);
-  mpz_set(masterkey->beta, beta);
+  // alpha is in [0, q - 1], beta is in [1, q - 1] to be invertible.
+  mpz_t alpha, beta, betaInverse, qMinusTwo;
+  mpz_inits(alpha, beta, betaInverse, qMinusTwo, NULL);
+  bswCiphertextPolicyAttributeBasedEncryptionRandomNumber(alpha, publickey);
+  mpz_sub_ui(qMinusTwo, publickey->q, 2);
+  random_mpzInRange(beta, qMinusTwo);
+  mpz_add_ui(beta, beta, 1);
+  mpz_invert(betaInverse, beta, publickey->q);
 
-  status = affine_wNAFMultiply(&masterkey->g_alpha, publickey->g, alpha,
-                               publickey->ellipticCurve);
-  if (status) {
-    mpz_clears(p, q, r, pMinusOne, alpha, beta, betaInverse, NULL);
-    return status;
-  }
+  bswCiphertextPolicyAttributeBasedEncryptionMasterKey *masterkey =
+      malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionMasterKey));
 
-  mpz_init(publickey->q);
-  mpz_set(publickey->q, q);
+  // h = g2^beta, f = g1^(1/beta), g_alpha = g1^alpha and
+  // eggalpha = e(g1, g2)^alpha
+  PairingGroupElement pairValue;
+  status = pairingGroup_multiply(&publickey->h, &publickey->g2, beta, &group);
+  if (!status) {
+    status = pairingGroup_multiply(&publickey->f, &publickey->g1, betaInverse,
+                                   &group);
+    if (status) {
+      pairingGroupElement_destroy(publickey->h);
+    }
+  }
+  if (!status) {
+    status = pairingGroup_multiply(&masterkey->g_alpha, &publickey->g1, alpha,
+                                   &group);
+    if (status) {
+      pairingGroupElement_destroy(publickey->h);
+      pairingGroupElement_destroy(publickey->f);
+    }
+  }
+  if (!status) {
+    status =
+        pairingGroup_pair(&pairValue, &publickey->g1, &publickey->g2, &group);
+    if (status) {
+      pairingGroupElement_destroy(publickey->h);
+      pairingGroupElement_destroy(publickey->f);
+      pairingGroupElement_destroy(masterkey->g_alpha);
+    }
+  }
+  if (!status) {
+    status = pairingGroup_pow(&publickey->eggalpha, &pairValue, alpha, &group);
+    pairingGroupElement_destroy(pairValue);
+    if (status) {
+      pairingGroupElement_destroy(publickey->h);
+      pairingGroupElement_destroy(publickey->f);
+      pairingGroupElement_destroy(masterkey->g_alpha);
+    }
+  }
 
-  hashFunction_initForSecurityLevel(&(publickey->hashFunction), securityLevel);
+  mpz_clears(alpha, betaInverse, qMinusTwo, NULL);
 
-  Complex pairValue;
-  status = tate_performPairing(&pairValue, pointP, pointP, 2, q, ec);
   if (status) {
-    complex_destroy(pairValue);
+    mpz_clear(beta);
+    free(masterkey);
+    pairingGroupElement_destroy(publickey->g1);
+    pairingGroupElement_destroy(publickey->g2);
+    mpz_clear(publickey->q);
+    ellipticCurve_destroy(publickey->ellipticCurve);
+    pairingGroup_release(group);
+    free(publickey);
     return status;
   }
 
-  Complex eggalpha;
-  complex_modPow(&eggalpha, pairValue, alpha,
-                 publickey->ellipticCurve.fieldOrder);
-  publickey->eggalpha = eggalpha;
-  complex_destroy(pairValue);
-
+  mpz_init_set(masterkey->beta, beta);
+  mpz_clear(beta);
   masterkey->publickey = publickey;
 
-  mpz_clears(zero, one, NULL);
-  mpz_clears(p, q, r, pMinusOne, alpha, beta, betaInverse, NULL);
-
   bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
       publickeyAsBinary, publickey);
   bswChiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionMasterKey(
@@ -167,6 +212,30 @@ CryptidStatus cryptid_abe_bsw_setup(
   return CRYPTID_SUCCESS;
 }
 
+// Masks length octets of input with a hash of the element of G_T, which is
+// used as a key encapsulated by the ciphertext. Masking twice with the same key
+// yields the input.
+static unsigned char *bswCiphertextPolicyAttributeBasedEncryption_mask(
+    const unsigned char *input, const size_t length,
+    const PairingGroupElement *key,
+    const bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey) {
+  unsigned char *keyBinary;
+  int keyBinaryLength;
+  pairingGroup_toBinary(&keyBinary, &keyBinaryLength, key, &publickey->group);
+
+  unsigned char *mask;
+  hashBytes(&mask, (int)length, keyBinary, keyBinaryLength,
+            publickey->hashFunction);
+  free(keyBinary);
+
+  // hashBytes allocates an extra null octet, which terminates the result.
+  for (size_t i = 0; i < length; i++) {
+    mask[i] ^= input[i];
+  }
+
+  return mask;
+}
+
 // Encrypts message with the specified accessTree and publicKey to encrypted
 CryptidStatus cryptid_abe_bsw_encrypt(
     bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary
@@ -176,10 +245,6 @@ CryptidStatus cryptid_abe_bsw_encrypt(
     const char *const message, const size_t messageLength,
     const bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary
         *publickeyAsBinary) {
-  bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage *encrypted =
-      malloc(
-          sizeof(bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage));
-
   if (!message) {
     return CRYPTID_MESSAGE_NULL_ERROR;
   }
@@ -198,231 +263,268 @@ CryptidStatus cryptid_abe_bsw_encrypt(
 
   bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey =
       malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionPublicKey));
-  bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
-      publickey, publickeyAsBinary);
+  CryptidStatus status =
+      bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
+          publickey, publickeyAsBinary);
+  if (status) {
+    free(publickey);
+    return status;
+  }
+
+  const PairingGroup *group = &publickey->group;
+
+  // g2 is multiplied and an attribute is hashed for every leaf of the tree
+  status =
+      bswCiphertextPolicyAttributeBasedEncryptionPublicKey_prepare(publickey);
+  if (status) {
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(publickey);
+    return status;
+  }
 
   bswCiphertextPolicyAttributeBasedEncryptionAccessTree *accessTree =
       malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionAccessTree));
-  bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionAccessTree(
-      accessTree, accessTreeAsBinary);
-
-  mpz_t pMinusOne;
-  mpz_init(pMinusOne);
-  mpz_sub_ui(pMinusOne, publickey->ellipticCurve.fieldOrder, 1);
+  status =
+      bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionAccessTree(
+          accessTree, accessTreeAsBinary, group);
+  if (status) {
+    free(accessTree);
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(publickey);
+    return status;
+  }
 
   mpz_t s;
   mpz_init(s);
-  random_mpzInRange(s, pMinusOne);
-  bswCiphertextPolicyAttributeBasedEncryptionAccessTreeCompute(accessTree, s,
-                                                               publickey);
+  bswCiphertextPolicyAttributeBasedEncryptionRandomNumber(s, publickey);
+  status = bswCiphertextPolicyAttributeBasedEncryptionAccessTreeCompute(
+      accessTree, s, publickey);
+  if (status) {
+    mpz_clear(s);
+    bswCiphertextPolicyAttributeBasedEncryptionAccessTree_destroy(accessTree);
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(publickey);
+    return status;
+  }
 
+  bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage *encrypted =
+      malloc(
+          sizeof(bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage));
   encrypted->tree = accessTree;
-  Complex eggalphas;
-  complex_modPow(&eggalphas, publickey->eggalpha, s,
-                 publickey->ellipticCurve.fieldOrder);
-
-  mpz_t M;
-  mpz_init(M);
-  size_t n = messageLength;
-  size_t startFrom = 0;
-  char *msg = malloc(sizeof(char) * messageLength);
-  strncpy(msg, message, messageLength);
-  bswCiphertextPolicyAttributeBasedEncryptionCtildeSet *prevSet =
-      (bswCiphertextPolicyAttributeBasedEncryptionCtildeSet *)malloc(
-          sizeof(bswCiphertextPolicyAttributeBasedEncryptionCtildeSet));
-  encrypted->cTildeSet = prevSet;
-  prevSet->last = ABE_CTILDE_SET_NOT_COMPUTED;
-
-  // Splitting message to parts if M >= ellipticCurve.fieldOrder
-  // Splitted parts of the message is stored in a set
-  // (bswCiphertextPolicyAttributeBasedEncryptionCtildeSet)
-  while (n > 0) {
-    while (prevSet->last == ABE_CTILDE_SET_NOT_COMPUTED ||
-           mpz_cmp(M, publickey->ellipticCurve.fieldOrder) >= 0) {
-      if (prevSet->last == ABE_CTILDE_SET_NOT_LAST) {
-        n--;
-      }
-      prevSet->last = ABE_CTILDE_SET_NOT_LAST;
-      char *msgPart = malloc(sizeof(char) * (n + 1));
-      strncpy(msgPart, msg + 0, n);
-      msgPart[n] = '\0';
-      mpz_import(M, n + 1, 1, 1, 0, 0, msgPart);
-      free(msgPart);
-    }
-    Complex cTilde;
-    complex_modMulInteger(&cTilde, M, eggalphas,
-                          publickey->ellipticCurve.fieldOrder);
-    prevSet->cTilde = cTilde;
-    startFrom += n;
-    n = messageLength - startFrom;
-    prevSet->cTildeSet =
-        (bswCiphertextPolicyAttributeBasedEncryptionCtildeSet *)malloc(
-            sizeof(bswCiphertextPolicyAttributeBasedEncryptionCtildeSet));
-    prevSet = prevSet->cTildeSet;
-    prevSet->last = ABE_CTILDE_SET_NOT_COMPUTED;
-    strncpy(msg, message + startFrom, n);
-  }
-  free(msg);
-  complex_destroy(eggalphas);
-  prevSet->cTildeSet = NULL;
-  prevSet->last = ABE_CTILDE_SET_LAST;
-
-  CryptidStatus status = affine_wNAFMultiply(&encrypted->c, publickey->h, s,
-                                             publickey->ellipticCurve);
+
+  // c = h^s
+  status = pairingGroup_multiply(&encrypted->c, &publickey->h, s, group);
+  if (status) {
+    mpz_clear(s);
+    free(encrypted);
+    bswCiphertextPolicyAttributeBasedEncryptionAccessTree_destroy(accessTree);
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(publickey);
+    return status;
+  }
+
+  // cTilde = M xor H(e(g1, g2)^(alpha * s))
+  PairingGroupElement eggalphas;
+  status = pairingGroup_pow(&eggalphas, &publickey->eggalpha, s, group);
+  mpz_clear(s);
   if (status) {
-    mpz_clear(M);
-    mpz_clears(pMinusOne, s, NULL);
-    affine_destroy(encrypted->c);
+    pairingGroupElement_destroy(encrypted->c);
+    free(encrypted);
+    bswCiphertextPolicyAttributeBasedEncryptionAccessTree_destroy(accessTree);
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(publickey);
     return status;
   }
 
-  mpz_clear(M);
-  mpz_clears(pMinusOne, s, NULL);
+  encrypted->cTildeLength = messageLength;
+  encrypted->cTilde = bswCiphertextPolicyAttributeBasedEncryption_mask(
+      (const unsigned char *)message, messageLength, &eggalphas, publickey);
+  pairingGroupElement_destroy(eggalphas);
 
-  bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(publickey);
   bswChiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionEncryptedMessage(
-      encryptedAsBinary, encrypted);
+      encryptedAsBinary, encrypted, group);
 
   bswCiphertextPolicyAttributeBasedEncryptionAccessTree_destroy(
       encrypted->tree);
   bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage_destroy(
       encrypted);
+  bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(publickey);
 
   return CRYPTID_SUCCESS;
 }
 
-// Generates a secretkey with the specified attributes using masterkey
-CryptidStatus cryptid_abe_bsw_keygen(
-    bswCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary
-        *secretkeyAsBinary,
-    const bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary
-        *masterkeyAsBinary,
-    char **attributes, const int numAttributes) {
-  bswCiphertextPolicyAttributeBasedEncryptionMasterKey *masterkey =
-      malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionMasterKey));
-  bswChiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionMasterKey(
-      masterkey, masterkeyAsBinary);
-
-  bswCiphertextPolicyAttributeBasedEncryptionSecretKey *secretkey =
-      malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionSecretKey));
-
-  bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey =
-      masterkey->publickey;
-
-  AffinePoint gR;
-
-  mpz_t r;
-  mpz_init(r);
-  bswCiphertextPolicyAttributeBasedEncryptionRandomNumber(r, publickey);
-
-  CryptidStatus status =
-      affine_wNAFMultiply(&gR, publickey->g, r, publickey->ellipticCurve);
+// Computes the components of attribute j of a secret key for a random rj,
+// dJ = base * H(j)^rj and dJa = dJaBase * g2^rj, where a NULL dJaBase stands
+// for the identity
+static CryptidStatus
+bswCiphertextPolicyAttributeBasedEncryption_computeAttributeComponents(
+    PairingGroupElement *dJ, PairingGroupElement *dJa, const char *attribute,
+    const PairingGroupElement *base, const PairingGroupElement *dJaBase,
+    const bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey) {
+  const PairingGroup *group = &publickey->group;
+
+  mpz_t rj;
+  mpz_init(rj);
+  bswCiphertextPolicyAttributeBasedEncryptionRandomNumber(rj, publickey);
+
+  // H(j)
+  PairingGroupElement Hj;
+  CryptidStatus status = pairingGroup_hashToG1(
+      &Hj, attribute, strlen(attribute), publickey->hashFunction, group);
   if (status) {
+    mpz_clear(rj);
     return status;
   }
 
-  // Equivalent to g^(a+r)
-  AffinePoint gar;
-  affine_add(&gar, masterkey->g_alpha, gR, publickey->ellipticCurve);
-
-  AffinePoint garBi;
-
-  mpz_t betaInverse;
-  mpz_init(betaInverse);
-  mpz_invert(betaInverse, masterkey->beta, publickey->q);
+  // H(j)^rj in CPABE publication
+  PairingGroupElement HjRj;
+  status = pairingGroup_multiply(&HjRj, &Hj, rj, group);
+  pairingGroupElement_destroy(Hj);
+  if (status) {
+    mpz_clear(rj);
+    return status;
+  }
 
-  // Equivalent to g^((a+r)/beta)
-  status =
-      affine_wNAFMultiply(&garBi, gar, betaInverse, publickey->ellipticCurve);
+  status = pairingGroup_add(dJ, base, &HjRj, group);
+  pairingGroupElement_destroy(HjRj);
   if (status) {
-    affine_destroy(garBi);
-    mpz_clear(r);
-    mpz_clear(betaInverse);
+    mpz_clear(rj);
+    return status;
+  }
 
-    affine_destroy(gR);
-    affine_destroy(gar);
-    bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(
-        masterkey->publickey);
-    bswCiphertextPolicyAttributeBasedEncryptionMasterKey_destroy(masterkey);
-    bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(secretkey);
+  // g2^(rj) in CPABE publication
+  PairingGroupElement g2Rj;
+  status = pairingGroup_multiply(&g2Rj, &publickey->g2, rj, group);
+  mpz_clear(rj);
+  if (status) {
+    pairingGroupElement_destroy(*dJ);
     return status;
   }
 
-  secretkey->numAttributes = numAttributes;
+  if (!dJaBase) {
+    *dJa = g2Rj;
+    return CRYPTID_SUCCESS;
+  }
 
-  secretkey->d = garBi;
+  status = pairingGroup_add(dJa, dJaBase, &g2Rj, group);
+  pairingGroupElement_destroy(g2Rj);
+  if (status) {
+    pairingGroupElement_destroy(*dJ);
+  }
+  return status;
+}
 
+// Fills the attributes of secretkey with the components computed by
+// computeAttributeComponents, freeing everything but d on failure
+static CryptidStatus
+bswCiphertextPolicyAttributeBasedEncryption_computeSecretKeyAttributes(
+    bswCiphertextPolicyAttributeBasedEncryptionSecretKey *secretkey,
+    char **attributes, const int numAttributes,
+    const PairingGroupElement *bases, const PairingGroupElement *dJaBases) {
+  secretkey->numAttributes = numAttributes;
   secretkey->attributes = malloc(sizeof(char *) * numAttributes);
-  secretkey->dJ = malloc(sizeof(AffinePoint) * numAttributes);
-  secretkey->dJa = malloc(sizeof(AffinePoint) * numAttributes);
+  secretkey->dJ = malloc(sizeof(PairingGroupElement) * numAttributes);
+  secretkey->dJa = malloc(sizeof(PairingGroupElement) * numAttributes);
 
   for (int i = 0; i < numAttributes; i++) {
-    int attributeLength = strlen(attributes[i]);
-
-    mpz_t rj;
-    mpz_init(rj);
-    bswCiphertextPolicyAttributeBasedEncryptionRandomNumber(rj, publickey);
-
-    // H(j)
-    AffinePoint Hj;
-
-    status = hashToPoint(&Hj, attributes[i], attributeLength, publickey->q,
-                         publickey->ellipticCurve, publickey->hashFunction);
-
-    if (status) {
-      return status;
-    }
-
-    // H(j)^rj in CPABE publication
-    AffinePoint HjRj;
-
-    status = affine_wNAFMultiply(&HjRj, Hj, rj, publickey->ellipticCurve);
-    if (status) {
-      return status;
-    }
-
-    // (H(j)^rj)*(g^r) in CPABE publication
-    AffinePoint dJ;
-    affine_add(&dJ, HjRj, gR, publickey->ellipticCurve);
-    secretkey->dJ[i] = dJ;
-
-    // g^(rj) in CPABE publication
-    AffinePoint dJa;
-    status =
-        affine_wNAFMultiply(&dJa, publickey->g, rj, publickey->ellipticCurve);
+    CryptidStatus status =
+        bswCiphertextPolicyAttributeBasedEncryption_computeAttributeComponents(
+            &secretkey->dJ[i], &secretkey->dJa[i], attributes[i], &bases[i],
+            dJaBases ? &dJaBases[i] : NULL, secretkey->publickey);
     if (status) {
+      for (int j = 0; j < i; j++) {
+        pairingGroupElement_destroy(secretkey->dJ[j]);
+        pairingGroupElement_destroy(secretkey->dJa[j]);
+        free(secretkey->attributes[j]);
+      }
+      free(secretkey->attributes);
+      free(secretkey->dJ);
+      free(secretkey->dJa);
       return status;
     }
-    secretkey->dJa[i] = dJa;
 
     secretkey->attributes[i] = malloc(strlen(attributes[i]) + 1);
     strcpy(secretkey->attributes[i], attributes[i]);
+  }
 
-    secretkey->publickey = masterkey->publickey;
+  return CRYPTID_SUCCESS;
+}
 
-    affine_destroy(Hj);
-    affine_destroy(HjRj);
+// Generates a secretkey with the specified attributes using masterkey
+CryptidStatus cryptid_abe_bsw_keygen(
+    bswCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary
+        *secretkeyAsBinary,
+    const bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary
+        *masterkeyAsBinary,
+    char **attributes, const int numAttributes) {
+  bswCiphertextPolicyAttributeBasedEncryptionMasterKey *masterkey =
+      malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionMasterKey));
+  CryptidStatus status =
+      bswChiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionMasterKey(
+          masterkey, masterkeyAsBinary);
+  if (status) {
+    free(masterkey);
+    return status;
+  }
 
-    mpz_clear(rj);
+  bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey =
+      masterkey->publickey;
+  const PairingGroup *group = &publickey->group;
+
+  // g2 is multiplied once for every attribute
+  status =
+      bswCiphertextPolicyAttributeBasedEncryptionPublicKey_prepare(publickey);
+  if (status) {
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(publickey);
+    bswCiphertextPolicyAttributeBasedEncryptionMasterKey_destroy(masterkey);
+    return status;
   }
 
-  mpz_clear(r);
-  mpz_clear(betaInverse);
+  mpz_t r, betaInverse;
+  mpz_inits(r, betaInverse, NULL);
+  bswCiphertextPolicyAttributeBasedEncryptionRandomNumber(r, publickey);
+  mpz_invert(betaInverse, masterkey->beta, publickey->q);
 
-  affine_destroy(gR);
-  affine_destroy(gar);
+  bswCiphertextPolicyAttributeBasedEncryptionSecretKey *secretkey =
+      malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionSecretKey));
+  secretkey->publickey = publickey;
+
+  // g1^r, shared by every dJ
+  PairingGroupElement gR;
+  status = pairingGroup_multiply(&gR, &publickey->g1, r, group);
+  if (!status) {
+    // Equivalent to g1^(alpha + r)
+    PairingGroupElement gar;
+    status = pairingGroup_add(&gar, &masterkey->g_alpha, &gR, group);
+    if (!status) {
+      // Equivalent to g1^((alpha + r) / beta)
+      status = pairingGroup_multiply(&secretkey->d, &gar, betaInverse, group);
+      pairingGroupElement_destroy(gar);
+    }
+    if (!status) {
+      PairingGroupElement bases[numAttributes > 0 ? numAttributes : 1];
+      for (int i = 0; i < numAttributes; i++) {
+        bases[i] = gR;
+      }
+      status =
+          bswCiphertextPolicyAttributeBasedEncryption_computeSecretKeyAttributes(
+              secretkey, attributes, numAttributes, bases, NULL);
+      if (status) {
+        pairingGroupElement_destroy(secretkey->d);
+      }
+    }
+    pairingGroupElement_destroy(gR);
+  }
 
-  bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionSecretKey(
-      secretkeyAsBinary, secretkey);
+  mpz_clears(r, betaInverse, NULL);
 
-  bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(
-      masterkey->publickey);
+  if (!status) {
+    bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionSecretKey(
+        secretkeyAsBinary, secretkey);
+    bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(secretkey);
+  } else {
+    free(secretkey);
+  }
 
+  bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(publickey);
   bswCiphertextPolicyAttributeBasedEncryptionMasterKey_destroy(masterkey);
 
-  bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(secretkey);
-
-  return CRYPTID_SUCCESS;
+  return status;
 }
 
 // Delegates to another secretkeyNew from secretkey with attributes being a
@@ -435,135 +537,121 @@ CryptidStatus cryptid_abe_bsw_delegate(
     char **attributes, const int numAttributes) {
   bswCiphertextPolicyAttributeBasedEncryptionSecretKey *secretkey =
       malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionSecretKey));
-  bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionSecretKey(
-      secretkey, secretkeyAsBinary);
-
-  bswCiphertextPolicyAttributeBasedEncryptionSecretKey *secretkeyNew =
-      malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionSecretKey));
-
-  bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey =
-      secretkey->publickey;
-
-  AffinePoint fR;
-  AffinePoint gR;
-
-  mpz_t r;
-  mpz_init(r);
-  bswCiphertextPolicyAttributeBasedEncryptionRandomNumber(r, publickey);
-
   CryptidStatus status =
-      affine_wNAFMultiply(&fR, publickey->f, r, publickey->ellipticCurve);
+      bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionSecretKey(
+          secretkey, secretkeyAsBinary);
   if (status) {
+    free(secretkey);
     return status;
   }
 
-  status = affine_wNAFMultiply(&gR, publickey->g, r, publickey->ellipticCurve);
-  if (status) {
-    return status;
-  }
-
-  secretkeyNew->numAttributes = numAttributes;
-
-  affine_add(&secretkeyNew->d, secretkey->d, fR, publickey->ellipticCurve);
-
-  secretkeyNew->attributes = malloc(sizeof(char *) * numAttributes);
-  secretkeyNew->dJ = malloc(sizeof(AffinePoint) * numAttributes);
-  secretkeyNew->dJa = malloc(sizeof(AffinePoint) * numAttributes);
+  bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey =
+      secretkey->publickey;
+  const PairingGroup *group = &publickey->group;
 
+  // Every attribute has to be one of the attributes of secretkey
+  int otherIDs[numAttributes > 0 ? numAttributes : 1];
   for (int i = 0; i < numAttributes; i++) {
-    int attributeLength = strlen(attributes[i]);
-
-    int otherID = -1;
+    otherIDs[i] = -1;
     for (int o = 0; o < secretkey->numAttributes; o++) {
       if (strcmp(secretkey->attributes[o], attributes[i]) == 0) {
-        otherID = o;
+        otherIDs[i] = o;
         break;
       }
     }
-    if (otherID == -1) {
+    if (otherIDs[i] == -1) {
+      bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(publickey);
+      bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(secretkey);
       return CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR;
     }
+  }
 
-    mpz_t rj;
-    mpz_init(rj);
-    bswCiphertextPolicyAttributeBasedEncryptionRandomNumber(rj, publickey);
+  // g2 is multiplied once for every attribute
+  status =
+      bswCiphertextPolicyAttributeBasedEncryptionPublicKey_prepare(publickey);
+  if (status) {
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(publickey);
+    bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(secretkey);
+    return status;
+  }
 
-    // H(j)
-    AffinePoint Hj;
+  mpz_t r;
+  mpz_init(r);
+  bswCiphertextPolicyAttributeBasedEncryptionRandomNumber(r, publickey);
 
-    status = hashToPoint(&Hj, attributes[i], attributeLength, publickey->q,
-                         publickey->ellipticCurve, publickey->hashFunction);
+  bswCiphertextPolicyAttributeBasedEncryptionSecretKey *secretkeyNew =
+      malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionSecretKey));
+  secretkeyNew->publickey = publickey;
+
+  PairingGroupElement fR;
+  status = pairingGroup_multiply(&fR, &publickey->f, r, group);
+  if (!status) {
+    // d * f^r
+    status = pairingGroup_add(&secretkeyNew->d, &secretkey->d, &fR, group);
+    pairingGroupElement_destroy(fR);
+  }
 
+  PairingGroupElement gR;
+  if (!status) {
+    status = pairingGroup_multiply(&gR, &publickey->g1, r, group);
     if (status) {
-      return status;
+      pairingGroupElement_destroy(secretkeyNew->d);
     }
+  }
 
-    // H(j)^rj in CPABE publication
-    AffinePoint HjRj;
+  mpz_clear(r);
 
-    status = affine_wNAFMultiply(&HjRj, Hj, rj, publickey->ellipticCurve);
+  if (!status) {
+    // dJ * g1^r, to which H(j)^rj is added, and dJa, to which g2^rj is added
+    PairingGroupElement bases[numAttributes > 0 ? numAttributes : 1];
+    PairingGroupElement dJaBases[numAttributes > 0 ? numAttributes : 1];
+    int numBases = 0;
+    for (; numBases < numAttributes && !status; numBases++) {
+      status = pairingGroup_add(&bases[numBases],
+                                &secretkey->dJ[otherIDs[numBases]], &gR, group);
+      dJaBases[numBases] = secretkey->dJa[otherIDs[numBases]];
+    }
     if (status) {
-      return status;
+      numBases--;
+    } else {
+      status =
+          bswCiphertextPolicyAttributeBasedEncryption_computeSecretKeyAttributes(
+              secretkeyNew, attributes, numAttributes, bases, dJaBases);
     }
-
-    // (H(j)^rj)*dJ in CPABE publication
-    AffinePoint dJ;
-    affine_add(&dJ, HjRj, gR, publickey->ellipticCurve);
-
-    AffinePoint dJDk;
-    affine_add(&dJDk, dJ, secretkey->dJ[otherID], publickey->ellipticCurve);
-    secretkeyNew->dJ[i] = dJDk;
-
-    AffinePoint dJa;
-    status =
-        affine_wNAFMultiply(&dJa, publickey->g, rj, publickey->ellipticCurve);
     if (status) {
-      return status;
+      pairingGroupElement_destroy(secretkeyNew->d);
     }
 
-    AffinePoint dJadJK;
-    affine_add(&dJadJK, dJa, secretkey->dJa[otherID], publickey->ellipticCurve);
-    secretkeyNew->dJa[i] = dJadJK;
-
-    secretkeyNew->attributes[i] = malloc(strlen(attributes[i]) + 1);
-    strcpy(secretkeyNew->attributes[i], attributes[i]);
-
-    secretkeyNew->publickey = secretkey->publickey;
-
-    affine_destroy(Hj);
-    affine_destroy(HjRj);
-    affine_destroy(dJ);
-    affine_destroy(dJa);
-
-    mpz_clear(rj);
+    for (int i = 0; i < numBases; i++) {
+      pairingGroupElement_destroy(bases[i]);
+    }
+    pairingGroupElement_destroy(gR);
   }
 
-  mpz_clear(r);
-
-  affine_destroy(fR);
-  affine_destroy(gR);
-
-  bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionSecretKey(
-      secretkeyAsBinaryNew, secretkeyNew);
-
-  bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(
-      secretkey->publickey);
+  if (!status) {
+    bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionSecretKey(
+        secretkeyAsBinaryNew, secretkeyNew);
+    bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(secretkeyNew);
+  } else {
+    free(secretkeyNew);
+  }
 
+  bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(publickey);
   bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(secretkey);
 
-  bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(secretkeyNew);
-
-  return CRYPTID_SUCCESS;
+  return status;
 }
 
 // Subfunction of decrypt, calculating A value (result) of encrypted and
 // accessTree (node)
 CryptidStatus bswCiphertextPolicyAttributeBasedEncryptionDecryptNode(
-    Complex *result, int *statusCode,
+    PairingGroupElement *result, int *statusCode,
     const bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage
         *encrypted,
     const bswCiphertextPolicyAttributeBasedEncryptionSecretKey *secretkey,
     const bswCiphertextPolicyAttributeBasedEncryptionAccessTree *node) {
+  const PairingGroup *group = &secretkey->publickey->group;
+
   if (bswCiphertextPolicyAttributeBasedEncryptionAccessTree_isLeaf(node)) {
     int found = -1;
     for (int i = 0; i < secretkey->numAttributes; i++) {
@@ -573,62 +661,54 @@ CryptidStatus bswCiphertextPolicyAttributeBasedEncryptionDecryptNode(
       }
     }
     if (found >= 0) {
-      Complex pairValue;
-      CryptidStatus status = tate_performPairing(
-          &pairValue, secretkey->dJ[found], node->cY, 2,
-          secretkey->publickey->q, secretkey->publickey->ellipticCurve);
-      if (status) {
-        return status;
+      if (!node->computed) {
+        return CRYPTID_ILLEGAL_CIPHERTEXT_ERROR;
       }
 
-      Complex pairValueA;
-      status = tate_performPairing(&pairValueA, secretkey->dJa[found],
-                                   node->cYa, 2, secretkey->publickey->q,
-                                   secretkey->publickey->ellipticCurve);
+      // e(dJ, cY) / e(cYa, dJa) = e(dJ, cY) * e(cYa, -dJa), computed as a
+      // product of pairings
+      PairingGroupElement negativeDJa;
+      CryptidStatus status =
+          pairingGroup_negate(&negativeDJa, &secretkey->dJa[found], group);
       if (status) {
         return status;
       }
 
-      Complex pairValueAinverse;
-      status = complex_multiplicativeInverse(
-          &pairValueAinverse, pairValueA,
-          secretkey->publickey->ellipticCurve.fieldOrder);
+      const PairingGroupElement ps[] = {secretkey->dJ[found], node->cYa};
+      const PairingGroupElement qs[] = {node->cY, negativeDJa};
+      status = pairingGroup_pairProduct(result, ps, qs, 2, group);
+      pairingGroupElement_destroy(negativeDJa);
       if (status) {
         return status;
       }
 
-      complex_modMul(result, pairValue, pairValueAinverse,
-                     secretkey->publickey->ellipticCurve.fieldOrder);
-
-      complex_destroy(pairValue);
-      complex_destroy(pairValueA);
-      complex_destroy(pairValueAinverse);
-
       *statusCode = 1;
     }
   } else {
-    Complex Sx[node->numChildren];
+    PairingGroupElement Sx[node->numChildren];
     int Codes[node->numChildren];
     int num = 0;
     for (int i = 0; i < node->numChildren; i++) {
+      Codes[i] = 0;
       if (node->children[i] && node->children[i] != NULL) {
-        Complex F;
+        PairingGroupElement F;
         int code = 0;
         CryptidStatus status =
             bswCiphertextPolicyAttributeBasedEncryptionDecryptNode(
                 &F, &code, encrypted, secretkey, node->children[i]);
         if (status) {
+          for (int j = 0; j < i; j++) {
+            if (Codes[j]) {
+              pairingGroupElement_destroy(Sx[j]);
+            }
+          }
           return status;
         }
         if (code) {
           Sx[i] = F;
           Codes[i] = 1;
           num++;
-        } else {
-          Codes[i] = 0;
         }
-      } else {
-        Codes[i] = 0;
       }
     }
 
@@ -642,40 +722,42 @@ CryptidStatus bswCiphertextPolicyAttributeBasedEncryptionDecryptNode(
         }
       }
 
-      Complex fX;
-      complex_initLong(&fX, 1, 0);
+      // fX = PRODUCT(Sx[indexes[c]] ^ resultLagrange), accumulated in result
+      CryptidStatus status = CRYPTID_SUCCESS;
+      int accumulated = 0;
       for (int i = 0; i < num; i++) {
-        int resultLagrange = Lagrange_coefficient(indexes[i], indexes, num, 0);
-        mpz_t resultMpz;
-        mpz_init_set_ui(resultMpz, abs(resultLagrange));
-        Complex res;
-        complex_modPow(&res, Sx[indexes[i] - 1], resultMpz,
-                       secretkey->publickey->ellipticCurve
-                           .fieldOrder); // Sx[indexes[c]] ^ resultLagrange
-        complex_destroy(Sx[indexes[i] - 1]);
-        Complex tmp;
-        if (resultLagrange < 0) {
-          // Workaround for a^(-b) = 1/(a^b)
-          CryptidStatus status = complex_multiplicativeInverse(
-              &tmp, res, secretkey->publickey->ellipticCurve.fieldOrder);
-          if (status) {
-            return status;
+        PairingGroupElement *sX = &Sx[indexes[i] - 1];
+        if (!status) {
+          int resultLagrange =
+              Lagrange_coefficient(indexes[i], indexes, num, 0);
+          mpz_t resultMpz;
+          mpz_init_set_si(resultMpz, resultLagrange);
+
+          PairingGroupElement res;
+          status = pairingGroup_pow(&res, sX, resultMpz, group);
+          mpz_clear(resultMpz);
+
+          if (!status && accumulated) {
+            PairingGroupElement fX;
+            status = pairingGroup_mul(&fX, result, &res, group);
+            pairingGroupElement_destroy(*result);
+            pairingGroupElement_destroy(res);
+            *result = fX;
+            accumulated = !status;
+          } else if (!status) {
+            *result = res;
+            accumulated = 1;
           }
-          complex_destroy(res);
-        } else {
-          tmp = res;
         }
-
-        Complex oldfX = fX;
-        // fX = fX * (Sx[indexes[c]] ^ resultLagrange)
-        complex_modMul(&fX, oldfX, tmp,
-                       secretkey->publickey->ellipticCurve.fieldOrder);
-
-        complex_destroy(oldfX);
-        complex_destroy(tmp);
-        mpz_clear(resultMpz);
+        pairingGroupElement_destroy(*sX);
       }
-      *result = fX;
+      if (status) {
+        if (accumulated) {
+          pairingGroupElement_destroy(*result);
+        }
+        return status;
+      }
+
       *statusCode = 1;
     }
   }
@@ -683,125 +765,119 @@ CryptidStatus bswCiphertextPolicyAttributeBasedEncryptionDecryptNode(
   return CRYPTID_SUCCESS;
 }
 
+// Frees the secret key and the encrypted message decrypt works on, together
+// with the public key of the secret key and the access tree of the message.
+static void bswCiphertextPolicyAttributeBasedEncryption_destroyDecryptionInput(
+    bswCiphertextPolicyAttributeBasedEncryptionSecretKey *secretkey,
+    bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage *encrypted) {
+  bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(
+      secretkey->publickey);
+
+  bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(secretkey);
+
+  bswCiphertextPolicyAttributeBasedEncryptionAccessTree_destroy(
+      encrypted->tree);
+  bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage_destroy(
+      encrypted);
+}
+
 CryptidStatus cryptid_abe_bsw_decrypt(
     char **result,
     const bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary
         *encryptedAsBinary,
     const bswCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary
         *secretkeyAsBinary) {
+  if (!result) {
+    return CRYPTID_RESULT_POINTER_NULL_ERROR;
+  }
+
   bswCiphertextPolicyAttributeBasedEncryptionSecretKey *secretkey =
       malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionSecretKey));
-  bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionSecretKey(
-      secretkey, secretkeyAsBinary);
+  CryptidStatus status =
+      bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionSecretKey(
+          secretkey, secretkeyAsBinary);
+  if (status) {
+    free(secretkey);
+    return status;
+  }
+
+  const PairingGroup *group = &secretkey->publickey->group;
+
   bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage *encrypted =
       malloc(
           sizeof(bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage));
-  bswChiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionEncryptedMessage(
-      encrypted, encryptedAsBinary);
-  if (!result) {
-    return CRYPTID_RESULT_POINTER_NULL_ERROR;
+  status =
+      bswChiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionEncryptedMessage(
+          encrypted, encryptedAsBinary, group);
+  if (status) {
+    free(encrypted);
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(
+        secretkey->publickey);
+    bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(secretkey);
+    return status;
   }
+
   // Check whether the attributes satisfy the accessTree
   int satisfy =
       bswCiphertextPolicyAttributeBasedEncryptionAccessTree_satisfyValue(
           encrypted->tree, secretkey->attributes, secretkey->numAttributes);
   if (satisfy == 0) {
-    bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(
-        secretkey->publickey);
-
-    bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(secretkey);
-
-    bswCiphertextPolicyAttributeBasedEncryptionAccessTree_destroy(
-        encrypted->tree);
-    bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage_destroy(
-        encrypted);
+    bswCiphertextPolicyAttributeBasedEncryption_destroyDecryptionInput(
+        secretkey, encrypted);
     return CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR;
   }
-  Complex A;
+
+  PairingGroupElement A;
   int code = 0;
-  CryptidStatus status = bswCiphertextPolicyAttributeBasedEncryptionDecryptNode(
+  status = bswCiphertextPolicyAttributeBasedEncryptionDecryptNode(
       &A, &code, encrypted, secretkey, encrypted->tree);
   if (status) {
+    bswCiphertextPolicyAttributeBasedEncryption_destroyDecryptionInput(
+        secretkey, encrypted);
     return status;
   }
   if (code == 0) {
-    bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(
-        secretkey->publickey);
-
-    bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(secretkey);
-
-    bswCiphertextPolicyAttributeBasedEncryptionAccessTree_destroy(
-        encrypted->tree);
-    bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage_destroy(
-        encrypted);
+    bswCiphertextPolicyAttributeBasedEncryption_destroyDecryptionInput(
+        secretkey, encrypted);
     return CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR;
   }
 
-  Complex eCD;
-  status = tate_performPairing(&eCD, encrypted->c, secretkey->d, 2,
-                               secretkey->publickey->q,
-                               secretkey->publickey->ellipticCurve);
+  // e(d, c) / A = e(g1, g2)^(alpha * s)
+  PairingGroupElement eDC;
+  status = pairingGroup_pair(&eDC, &secretkey->d, &encrypted->c, group);
   if (status) {
+    pairingGroupElement_destroy(A);
+    bswCiphertextPolicyAttributeBasedEncryption_destroyDecryptionInput(
+        secretkey, encrypted);
     return status;
   }
 
-  Complex eCDinverse;
-  status = complex_multiplicativeInverse(
-      &eCDinverse, eCD, secretkey->publickey->ellipticCurve.fieldOrder);
+  mpz_t minusOne;
+  mpz_init_set_si(minusOne, -1);
+  PairingGroupElement aInverse;
+  status = pairingGroup_pow(&aInverse, &A, minusOne, group);
+  mpz_clear(minusOne);
+  pairingGroupElement_destroy(A);
+
+  PairingGroupElement eggalphas;
+  if (!status) {
+    status = pairingGroup_mul(&eggalphas, &eDC, &aInverse, group);
+    pairingGroupElement_destroy(aInverse);
+  }
+  pairingGroupElement_destroy(eDC);
   if (status) {
+    bswCiphertextPolicyAttributeBasedEncryption_destroyDecryptionInput(
+        secretkey, encrypted);
     return status;
   }
 
-  complex_destroy(eCD);
-
-  bswCiphertextPolicyAttributeBasedEncryptionCtildeSet *lastSet =
-      encrypted->cTildeSet;
-  char *fullString = malloc(1);
-  fullString[0] = '\0';
-  // Iterating over sets of encrypted (splitted) messages
-  while (lastSet->last == ABE_CTILDE_SET_NOT_LAST) {
-    Complex cTildeA;
-    complex_modMul(&cTildeA, lastSet->cTilde, A,
-                   secretkey->publickey->ellipticCurve.fieldOrder);
-
-    // Finally equivalent to cTilde/(e(C, D)/A) = M
-    Complex decrypted;
-    complex_modMul(&decrypted, cTildeA, eCDinverse,
-                   secretkey->publickey->ellipticCurve.fieldOrder);
-    complex_destroy(cTildeA);
-
-    size_t resultLength;
-    char *tmpResult =
-        mpz_export(NULL, &resultLength, 1, 1, 0, 0, decrypted.real);
-
-    char *prevFullString = malloc(strlen(fullString) + 1);
-    strcpy(prevFullString, fullString);
-    free(fullString);
-
-    // Concat splitted parts of message
-    fullString = concat(prevFullString, tmpResult);
-    free(prevFullString);
-    free(tmpResult);
-
-    complex_destroy(decrypted);
-
-    lastSet = lastSet->cTildeSet;
-  }
-
-  complex_destroy(A);
-  complex_destroy(eCDinverse);
-
-  *result = fullString;
-
-  bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(
+  *result = (char *)bswCiphertextPolicyAttributeBasedEncryption_mask(
+      encrypted->cTilde, encrypted->cTildeLength, &eggalphas,
       secretkey->publickey);
+  pairingGroupElement_destroy(eggalphas);
 
-  bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(secretkey);
-
-  bswCiphertextPolicyAttributeBasedEncryptionAccessTree_destroy(
-      encrypted->tree);
-  bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessage_destroy(
-      encrypted);
+  bswCiphertextPolicyAttributeBasedEncryption_destroyDecryptionInput(
+      secretkey, encrypted);
 
   return CRYPTID_SUCCESS;
-}
\ No newline at end of file
+}
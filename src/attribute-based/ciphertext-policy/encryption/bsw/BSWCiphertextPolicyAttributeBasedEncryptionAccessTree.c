@@ -73,40 +73,51 @@ CryptidStatus bswCiphertextPolicyAttributeBasedEncryptionAccessTreeCompute(
       mpz_t sum;
       mpz_init(sum);
       bswCiphertextPolicyAttributeBasedEncryptionPolynomSum(q, i + 1, sum);
-      bswCiphertextPolicyAttributeBasedEncryptionAccessTreeCompute(
-          accessTree->children[i], sum, publickey);
+      mpz_mod(sum, sum, publickey->q);
+      CryptidStatus status =
+          bswCiphertextPolicyAttributeBasedEncryptionAccessTreeCompute(
+              accessTree->children[i], sum, publickey);
       mpz_clear(sum);
+      if (status) {
+        bswCiphertextPolicyAttributeBasedEncryptionPolynom_destroy(q);
+        return status;
+      }
     }
 
     bswCiphertextPolicyAttributeBasedEncryptionPolynom_destroy(q);
   } else {
-    AffinePoint cY;
-    CryptidStatus status =
-        affine_wNAFMultiply(&cY, publickey->g, s, publickey->ellipticCurve);
+    const PairingGroup *group = &publickey->group;
+
+    PairingGroupElement cY;
+    CryptidStatus status = pairingGroup_multiply(&cY, &publickey->g2, s, group);
     if (status) {
-      affine_destroy(cY);
       return status;
     }
 
     // H(att(x))
-    AffinePoint hashedPoint;
+    PairingGroupElement hashedPoint;
 
-    status = hashToPoint(&hashedPoint, accessTree->attribute,
-                         accessTree->attributeLength, publickey->q,
-                         publickey->ellipticCurve, publickey->hashFunction);
+    status = pairingGroup_hashToG1(&hashedPoint, accessTree->attribute,
+                                   accessTree->attributeLength,
+                                   publickey->hashFunction, group);
 
     if (status) {
+      pairingGroupElement_destroy(cY);
       return status;
     }
 
-    AffinePoint cYa;
-    status =
-        affine_wNAFMultiply(&cYa, hashedPoint, s, publickey->ellipticCurve);
+    PairingGroupElement cYa;
+    status = pairingGroup_multiply(&cYa, &hashedPoint, s, group);
+    pairingGroupElement_destroy(hashedPoint);
     if (status) {
+      pairingGroupElement_destroy(cY);
       return status;
     }
 
-    affine_destroy(hashedPoint);
+    if (accessTree->computed) {
+      pairingGroupElement_destroy(accessTree->cY);
+      pairingGroupElement_destroy(accessTree->cYa);
+    }
 
     accessTree->cY = cY;
     accessTree->cYa = cYa;
@@ -124,8 +135,8 @@ void bswCiphertextPolicyAttributeBasedEncryptionAccessTree_destroy(
         tree->children[i]);
   }
   if (tree->computed) {
-    affine_destroy(tree->cY);
-    affine_destroy(tree->cYa);
+    pairingGroupElement_destroy(tree->cY);
+    pairingGroupElement_destroy(tree->cYa);
   }
   if (tree->numChildren > 0) {
     free(tree->children);
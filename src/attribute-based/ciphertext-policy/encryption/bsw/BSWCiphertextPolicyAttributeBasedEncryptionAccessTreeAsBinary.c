@@ -32,8 +32,8 @@ void bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary
         *accessTreeAsBinary) {
   if (accessTreeAsBinary->computed) {
-    affineAsBinary_destroy(accessTreeAsBinary->cY);
-    affineAsBinary_destroy(accessTreeAsBinary->cYa);
+    pairingGroupElementAsBinary_destroy(accessTreeAsBinary->cY);
+    pairingGroupElementAsBinary_destroy(accessTreeAsBinary->cYa);
   }
 
   int numChildren = accessTreeAsBinary->numChildren;
@@ -52,10 +52,12 @@ void bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_destroy(
   free(accessTreeAsBinary);
 }
 
-void bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionAccessTree(
+CryptidStatus
+bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionAccessTree(
     bswCiphertextPolicyAttributeBasedEncryptionAccessTree *accessTree,
     const bswCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary
-        *accessTreeAsBinary) {
+        *accessTreeAsBinary,
+    const PairingGroup *group) {
   accessTree->value = accessTreeAsBinary->value;
 
   accessTree->computed = accessTreeAsBinary->computed;
@@ -65,8 +67,16 @@ void bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_toBswChipher
   accessTree->attributeLength = accessTreeAsBinary->attributeLength;
 
   if (accessTree->computed) {
-    affineAsBinary_toAffine(&accessTree->cY, accessTreeAsBinary->cY);
-    affineAsBinary_toAffine(&accessTree->cYa, accessTreeAsBinary->cYa);
+    if (pairingGroupElementAsBinary_toPairingGroupElement(
+            &accessTree->cY, pairingGroup_G2, accessTreeAsBinary->cY, group)) {
+      return CRYPTID_ILLEGAL_CIPHERTEXT_ERROR;
+    }
+    if (pairingGroupElementAsBinary_toPairingGroupElement(
+            &accessTree->cYa, pairingGroup_G1, accessTreeAsBinary->cYa,
+            group)) {
+      pairingGroupElement_destroy(accessTree->cY);
+      return CRYPTID_ILLEGAL_CIPHERTEXT_ERROR;
+    }
   }
 
   if (accessTree->attributeLength > 0) {
@@ -86,15 +96,33 @@ void bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_toBswChipher
   for (int i = 0; i < accessTree->numChildren; i++) {
     accessTree->children[i] =
         malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionAccessTree));
-    bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionAccessTree(
-        accessTree->children[i], accessTreeAsBinary->children[i]);
+    CryptidStatus status =
+        bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionAccessTree(
+            accessTree->children[i], accessTreeAsBinary->children[i], group);
+    if (status) {
+      free(accessTree->children[i]);
+      for (int j = 0; j < i; j++) {
+        bswCiphertextPolicyAttributeBasedEncryptionAccessTree_destroy(
+            accessTree->children[j]);
+      }
+      free(accessTree->children);
+      free(accessTree->attribute);
+      if (accessTree->computed) {
+        pairingGroupElement_destroy(accessTree->cY);
+        pairingGroupElement_destroy(accessTree->cYa);
+      }
+      return status;
+    }
   }
+
+  return CRYPTID_SUCCESS;
 }
 
 void bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionAccessTree(
     bswCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary
         *accessTreeAsBinary,
-    const bswCiphertextPolicyAttributeBasedEncryptionAccessTree *accessTree) {
+    const bswCiphertextPolicyAttributeBasedEncryptionAccessTree *accessTree,
+    const PairingGroup *group) {
   accessTreeAsBinary->value = accessTree->value;
 
   accessTreeAsBinary->computed = accessTree->computed;
@@ -104,8 +132,10 @@ void bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_fromBswChiph
   accessTreeAsBinary->attributeLength = accessTree->attributeLength;
 
   if (accessTree->computed) {
-    affineAsBinary_fromAffine(&accessTreeAsBinary->cY, accessTree->cY);
-    affineAsBinary_fromAffine(&accessTreeAsBinary->cYa, accessTree->cYa);
+    pairingGroupElementAsBinary_fromPairingGroupElement(
+        &accessTreeAsBinary->cY, &accessTree->cY, group);
+    pairingGroupElementAsBinary_fromPairingGroupElement(
+        &accessTreeAsBinary->cYa, &accessTree->cYa, group);
   }
 
   if (accessTree->attributeLength > 0) {
@@ -125,6 +155,6 @@ void bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_fromBswChiph
     accessTreeAsBinary->children[i] = malloc(
         sizeof(bswCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary));
     bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionAccessTree(
-        accessTreeAsBinary->children[i], accessTree->children[i]);
+        accessTreeAsBinary->children[i], accessTree->children[i], group);
   }
 }
\ No newline at end of file
@@ -4,6 +4,6 @@
 void bswCiphertextPolicyAttributeBasedEncryptionMasterKey_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionMasterKey *masterkey) {
   mpz_clear(masterkey->beta);
-  affine_destroy(masterkey->g_alpha);
+  pairingGroupElement_destroy(masterkey->g_alpha);
   free(masterkey);
 }
\ No newline at end of file
@@ -3,24 +3,40 @@
 void bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary *masterkey) {
   free(masterkey->beta);
-  affineAsBinary_destroy(masterkey->g_alpha);
+  pairingGroupElementAsBinary_destroy(masterkey->g_alpha);
   bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_destroy(
       masterkey->publickey);
   free(masterkey);
 }
 
-void bswChiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionMasterKey(
+CryptidStatus
+bswChiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionMasterKey(
     bswCiphertextPolicyAttributeBasedEncryptionMasterKey *masterKey,
     const bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary
         *masterKeyAsBinary) {
+  masterKey->publickey =
+      malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionPublicKey));
+  CryptidStatus status =
+      bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
+          masterKey->publickey, masterKeyAsBinary->publickey);
+  if (status) {
+    free(masterKey->publickey);
+    return status;
+  }
+
+  if (pairingGroupElementAsBinary_toPairingGroupElement(
+          &(masterKey->g_alpha), pairingGroup_G1, masterKeyAsBinary->g_alpha,
+          &masterKey->publickey->group)) {
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(
+        masterKey->publickey);
+    return CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR;
+  }
+
   mpz_init(masterKey->beta);
   mpz_import(masterKey->beta, masterKeyAsBinary->betaLength, 1, 1, 0, 0,
              masterKeyAsBinary->beta);
-  affineAsBinary_toAffine(&(masterKey->g_alpha), masterKeyAsBinary->g_alpha);
-  masterKey->publickey =
-      malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionPublicKey));
-  bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
-      masterKey->publickey, masterKeyAsBinary->publickey);
+
+  return CRYPTID_SUCCESS;
 }
 
 void bswChiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionMasterKey(
@@ -29,7 +45,9 @@ void bswChiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary_fromBswChiphe
     const bswCiphertextPolicyAttributeBasedEncryptionMasterKey *masterKey) {
   masterKeyAsBinary->beta = mpz_export(NULL, &masterKeyAsBinary->betaLength, 1,
                                        1, 0, 0, masterKey->beta);
-  affineAsBinary_fromAffine(&(masterKeyAsBinary->g_alpha), masterKey->g_alpha);
+  pairingGroupElementAsBinary_fromPairingGroupElement(
+      &(masterKeyAsBinary->g_alpha), &masterKey->g_alpha,
+      &masterKey->publickey->group);
   masterKeyAsBinary->publickey = malloc(
       sizeof(bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary));
   bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
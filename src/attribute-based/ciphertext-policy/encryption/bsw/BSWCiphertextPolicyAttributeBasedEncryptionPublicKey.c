@@ -4,10 +4,17 @@
 void bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey) {
   ellipticCurve_destroy(publickey->ellipticCurve);
-  affine_destroy(publickey->g);
-  affine_destroy(publickey->f);
-  affine_destroy(publickey->h);
   mpz_clear(publickey->q);
-  complex_destroy(publickey->eggalpha);
+  pairingGroupElement_destroy(publickey->g1);
+  pairingGroupElement_destroy(publickey->g2);
+  pairingGroupElement_destroy(publickey->h);
+  pairingGroupElement_destroy(publickey->f);
+  pairingGroupElement_destroy(publickey->eggalpha);
+  pairingGroup_release(publickey->group);
   free(publickey);
-}
\ No newline at end of file
+}
+
+CryptidStatus bswCiphertextPolicyAttributeBasedEncryptionPublicKey_prepare(
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey) {
+  return pairingGroup_prepareFixedBase(&publickey->g2, &publickey->group);
+}
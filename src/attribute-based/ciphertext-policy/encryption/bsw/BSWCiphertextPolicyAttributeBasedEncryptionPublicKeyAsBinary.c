@@ -3,43 +3,82 @@
 void bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary *publickey) {
   ellipticCurveAsBinary_destroy(publickey->ellipticCurve);
-  affineAsBinary_destroy(publickey->g);
-  affineAsBinary_destroy(publickey->h);
-  affineAsBinary_destroy(publickey->f);
-  complexAsBinary_destroy(publickey->eggalpha);
+  pairingGroupElementAsBinary_destroy(publickey->g1);
+  pairingGroupElementAsBinary_destroy(publickey->g2);
+  pairingGroupElementAsBinary_destroy(publickey->h);
+  pairingGroupElementAsBinary_destroy(publickey->f);
+  pairingGroupElementAsBinary_destroy(publickey->eggalpha);
   free(publickey->q);
   free(publickey);
 }
 
-void bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
+CryptidStatus
+bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
     bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey,
     const bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary
         *publickeyAsBinary) {
-  publickey->hashFunction = publickeyAsBinary->hashFunction;
+  ellipticCurveAsBinary_toEllipticCurve(&(publickey->ellipticCurve),
+                                        publickeyAsBinary->ellipticCurve);
   mpz_init(publickey->q);
   mpz_import(publickey->q, publickeyAsBinary->qLength, 1, 1, 0, 0,
              publickeyAsBinary->q);
-  affineAsBinary_toAffine(&(publickey->g), publickeyAsBinary->g);
-  affineAsBinary_toAffine(&(publickey->h), publickeyAsBinary->h);
-  affineAsBinary_toAffine(&(publickey->f), publickeyAsBinary->f);
-  complexAsBinary_toComplex(&(publickey->eggalpha),
-                            publickeyAsBinary->eggalpha);
-  ellipticCurveAsBinary_toEllipticCurve(&(publickey->ellipticCurve),
-                                        publickeyAsBinary->ellipticCurve);
+
+  CryptidStatus status = pairingGroup_acquire(
+      &publickey->group, publickeyAsBinary->pairingGroupType,
+      publickey->ellipticCurve, publickey->q);
+  if (status) {
+    ellipticCurve_destroy(publickey->ellipticCurve);
+    mpz_clear(publickey->q);
+    return status;
+  }
+
+  PairingGroupElement *elements[] = {&publickey->g1, &publickey->g2,
+                                     &publickey->h, &publickey->f,
+                                     &publickey->eggalpha};
+  const PairingGroupSubgroup subgroups[] = {pairingGroup_G1, pairingGroup_G2,
+                                            pairingGroup_G2, pairingGroup_G1,
+                                            pairingGroup_GT};
+  const PairingGroupElementAsBinary elementsAsBinary[] = {
+      publickeyAsBinary->g1, publickeyAsBinary->g2, publickeyAsBinary->h,
+      publickeyAsBinary->f, publickeyAsBinary->eggalpha};
+  for (int i = 0; i < 5; i++) {
+    if (pairingGroupElementAsBinary_toPairingGroupElement(
+            elements[i], subgroups[i], elementsAsBinary[i],
+            &publickey->group)) {
+      for (int j = 0; j < i; j++) {
+        pairingGroupElement_destroy(*elements[j]);
+      }
+      pairingGroup_release(publickey->group);
+      ellipticCurve_destroy(publickey->ellipticCurve);
+      mpz_clear(publickey->q);
+      return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+    }
+  }
+
+  publickey->pairingGroupType = publickeyAsBinary->pairingGroupType;
+  publickey->hashFunction = publickeyAsBinary->hashFunction;
+
+  return CRYPTID_SUCCESS;
 }
 
 void bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
     bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary
         *publickeyAsBinary,
     const bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey) {
+  publickeyAsBinary->pairingGroupType = publickey->pairingGroupType;
   publickeyAsBinary->hashFunction = publickey->hashFunction;
   publickeyAsBinary->q =
       mpz_export(NULL, &publickeyAsBinary->qLength, 1, 1, 0, 0, publickey->q);
-  affineAsBinary_fromAffine(&(publickeyAsBinary->g), publickey->g);
-  affineAsBinary_fromAffine(&(publickeyAsBinary->h), publickey->h);
-  affineAsBinary_fromAffine(&(publickeyAsBinary->f), publickey->f);
-  complexAsBinary_fromComplex(&(publickeyAsBinary->eggalpha),
-                              publickey->eggalpha);
+  pairingGroupElementAsBinary_fromPairingGroupElement(
+      &(publickeyAsBinary->g1), &publickey->g1, &publickey->group);
+  pairingGroupElementAsBinary_fromPairingGroupElement(
+      &(publickeyAsBinary->g2), &publickey->g2, &publickey->group);
+  pairingGroupElementAsBinary_fromPairingGroupElement(
+      &(publickeyAsBinary->h), &publickey->h, &publickey->group);
+  pairingGroupElementAsBinary_fromPairingGroupElement(
+      &(publickeyAsBinary->f), &publickey->f, &publickey->group);
+  pairingGroupElementAsBinary_fromPairingGroupElement(
+      &(publickeyAsBinary->eggalpha), &publickey->eggalpha, &publickey->group);
   ellipticCurveAsBinary_fromEllipticCurve(&(publickeyAsBinary->ellipticCurve),
                                           publickey->ellipticCurve);
-}
\ No newline at end of file
+}
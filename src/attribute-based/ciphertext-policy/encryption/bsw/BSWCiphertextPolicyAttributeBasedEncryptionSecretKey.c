@@ -4,13 +4,13 @@
 void bswCiphertextPolicyAttributeBasedEncryptionSecretKey_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionSecretKey *secretkey) {
   for (int i = 0; i < secretkey->numAttributes; i++) {
-    affine_destroy(secretkey->dJ[i]);
-    affine_destroy(secretkey->dJa[i]);
+    pairingGroupElement_destroy(secretkey->dJ[i]);
+    pairingGroupElement_destroy(secretkey->dJa[i]);
     free(secretkey->attributes[i]);
   }
   free(secretkey->dJ);
   free(secretkey->dJa);
   free(secretkey->attributes);
-  affine_destroy(secretkey->d);
+  pairingGroupElement_destroy(secretkey->d);
   free(secretkey);
 }
\ No newline at end of file
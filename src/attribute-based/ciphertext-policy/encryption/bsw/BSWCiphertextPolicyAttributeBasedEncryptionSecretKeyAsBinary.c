@@ -2,10 +2,10 @@
 
 void bswCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_destroy(
     bswCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary *secretkey) {
-  affineAsBinary_destroy(secretkey->d);
+  pairingGroupElementAsBinary_destroy(secretkey->d);
   for (int i = 0; i < secretkey->numAttributes; i++) {
-    affineAsBinary_destroy(secretkey->dJ[i]);
-    affineAsBinary_destroy(secretkey->dJa[i]);
+    pairingGroupElementAsBinary_destroy(secretkey->dJ[i]);
+    pairingGroupElementAsBinary_destroy(secretkey->dJa[i]);
     free(secretkey->attributes[i]);
   }
   free(secretkey->attributes);
@@ -17,45 +17,92 @@ void bswCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_destroy(
   free(secretkey);
 }
 
-void bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionSecretKey(
+CryptidStatus
+bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionSecretKey(
     bswCiphertextPolicyAttributeBasedEncryptionSecretKey *secretKey,
     const bswCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary
         *secretKeyAsBinary) {
-  affineAsBinary_toAffine(&(secretKey->d), secretKeyAsBinary->d);
-  secretKey->numAttributes = secretKeyAsBinary->numAttributes;
-  secretKey->attributes = malloc(sizeof(char *) * secretKey->numAttributes);
-  secretKey->dJ = malloc(sizeof(AffinePoint) * secretKey->numAttributes);
-  secretKey->dJa = malloc(sizeof(AffinePoint) * secretKey->numAttributes);
-  for (int i = 0; i < secretKey->numAttributes; i++) {
-    affineAsBinary_toAffine(&(secretKey->dJ[i]), secretKeyAsBinary->dJ[i]);
-    affineAsBinary_toAffine(&(secretKey->dJa[i]), secretKeyAsBinary->dJa[i]);
+  secretKey->publickey =
+      malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionPublicKey));
+  CryptidStatus status =
+      bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
+          secretKey->publickey, secretKeyAsBinary->publickey);
+  if (status) {
+    free(secretKey->publickey);
+    return status;
+  }
+
+  const PairingGroup *group = &secretKey->publickey->group;
+  int numAttributes = secretKeyAsBinary->numAttributes;
+
+  if (pairingGroupElementAsBinary_toPairingGroupElement(
+          &(secretKey->d), pairingGroup_G1, secretKeyAsBinary->d, group)) {
+    bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(
+        secretKey->publickey);
+    return CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR;
+  }
+
+  secretKey->dJ = malloc(sizeof(PairingGroupElement) * numAttributes);
+  secretKey->dJa = malloc(sizeof(PairingGroupElement) * numAttributes);
+  for (int i = 0; i < numAttributes; i++) {
+    if (pairingGroupElementAsBinary_toPairingGroupElement(
+            &(secretKey->dJ[i]), pairingGroup_G1, secretKeyAsBinary->dJ[i],
+            group)) {
+      status = CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR;
+    } else if (pairingGroupElementAsBinary_toPairingGroupElement(
+                   &(secretKey->dJa[i]), pairingGroup_G2,
+                   secretKeyAsBinary->dJa[i], group)) {
+      pairingGroupElement_destroy(secretKey->dJ[i]);
+      status = CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR;
+    }
+
+    if (status) {
+      for (int j = 0; j < i; j++) {
+        pairingGroupElement_destroy(secretKey->dJ[j]);
+        pairingGroupElement_destroy(secretKey->dJa[j]);
+      }
+      free(secretKey->dJ);
+      free(secretKey->dJa);
+      pairingGroupElement_destroy(secretKey->d);
+      bswCiphertextPolicyAttributeBasedEncryptionPublicKey_destroy(
+          secretKey->publickey);
+      return status;
+    }
+  }
+
+  secretKey->numAttributes = numAttributes;
+  secretKey->attributes = malloc(sizeof(char *) * numAttributes);
+  for (int i = 0; i < numAttributes; i++) {
     secretKey->attributes[i] =
         malloc(secretKeyAsBinary->attributeLengths[i] + 1);
     strcpy(secretKey->attributes[i], secretKeyAsBinary->attributes[i]);
   }
-  secretKey->publickey =
-      malloc(sizeof(bswCiphertextPolicyAttributeBasedEncryptionPublicKey));
-  bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_toBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
-      secretKey->publickey, secretKeyAsBinary->publickey);
+
+  return CRYPTID_SUCCESS;
 }
 
 void bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionSecretKey(
     bswCiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary
         *secretKeyAsBinary,
     const bswCiphertextPolicyAttributeBasedEncryptionSecretKey *secretKey) {
-  affineAsBinary_fromAffine(&(secretKeyAsBinary->d), secretKey->d);
+  const PairingGroup *group = &secretKey->publickey->group;
+
+  pairingGroupElementAsBinary_fromPairingGroupElement(&(secretKeyAsBinary->d),
+                                                      &secretKey->d, group);
   secretKeyAsBinary->numAttributes = secretKey->numAttributes;
   secretKeyAsBinary->attributes =
       malloc(sizeof(char *) * secretKeyAsBinary->numAttributes);
   secretKeyAsBinary->attributeLengths =
       malloc(sizeof(int) * secretKeyAsBinary->numAttributes);
-  secretKeyAsBinary->dJ =
-      malloc(sizeof(AffinePointAsBinary) * secretKeyAsBinary->numAttributes);
-  secretKeyAsBinary->dJa =
-      malloc(sizeof(AffinePointAsBinary) * secretKeyAsBinary->numAttributes);
+  secretKeyAsBinary->dJ = malloc(sizeof(PairingGroupElementAsBinary) *
+                                 secretKeyAsBinary->numAttributes);
+  secretKeyAsBinary->dJa = malloc(sizeof(PairingGroupElementAsBinary) *
+                                  secretKeyAsBinary->numAttributes);
   for (int i = 0; i < secretKey->numAttributes; i++) {
-    affineAsBinary_fromAffine(&(secretKeyAsBinary->dJ[i]), secretKey->dJ[i]);
-    affineAsBinary_fromAffine(&(secretKeyAsBinary->dJa[i]), secretKey->dJa[i]);
+    pairingGroupElementAsBinary_fromPairingGroupElement(
+        &(secretKeyAsBinary->dJ[i]), &secretKey->dJ[i], group);
+    pairingGroupElementAsBinary_fromPairingGroupElement(
+        &(secretKeyAsBinary->dJa[i]), &secretKey->dJa[i], group);
     secretKeyAsBinary->attributeLengths[i] = strlen(secretKey->attributes[i]);
     secretKeyAsBinary->attributes[i] =
         malloc(strlen(secretKey->attributes[i]) + 1);
@@ -65,4 +112,4 @@ void bswChiphertextPolicyAttributeBasedEncryptionSecretKeyAsBinary_fromBswChiphe
       sizeof(bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary));
   bswChiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary_fromBswChiphertextPolicyAttributeBasedEncryptionPublicKey(
       secretKeyAsBinary->publickey, secretKey->publickey);
-}
\ No newline at end of file
+}
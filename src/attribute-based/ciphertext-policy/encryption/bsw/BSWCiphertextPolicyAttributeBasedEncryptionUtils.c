@@ -24,18 +24,18 @@ char *concat(const char *s1, const char *s2) {
   return result;
 }
 
-// Used for generating random numbers in the elliptic curve's fieldOrder of the
+// Used for generating random exponents modulo the order q of the groups of the
 // publickey
 void bswCiphertextPolicyAttributeBasedEncryptionRandomNumber(
     mpz_t randElement,
     const bswCiphertextPolicyAttributeBasedEncryptionPublicKey *publickey) {
-  mpz_t pMinusOne;
-  mpz_init(pMinusOne);
-  mpz_sub_ui(pMinusOne, publickey->ellipticCurve.fieldOrder, 1);
+  mpz_t qMinusOne;
+  mpz_init(qMinusOne);
+  mpz_sub_ui(qMinusOne, publickey->q, 1);
 
-  random_mpzInRange(randElement, pMinusOne);
+  random_mpzInRange(randElement, qMinusOne);
 
-  mpz_clear(pMinusOne);
+  mpz_clear(qMinusOne);
 }
 
 // Returning whether an array of attributes contains a specific attribute
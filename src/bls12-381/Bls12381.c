@@ -0,0 +1,574 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "gmp.h"
+
+#include "bls12-381/Bls12381.h"
+#include "complex/GtElement.h"
+#include "elliptic/JacobianPoint.h"
+#include "util/Utils.h"
+#include "util/WindowedNaf.h"
+
+// References
+//  * [Guide-to-Pairing] Nadia El Mrabet and Marc Joye (Eds.). 2017. Guide to
+//  Pairing-Based Cryptography. Chapman and Hall/CRC.
+//  * [ZCash-Serialization] ZCash. 2017. BLS12-381 serialization.
+//  https://github.com/zkcrypto/pairing/tree/master/src/bls12_381
+
+// The length of a serialized coordinate of \f$F_p\f$.
+static const size_t FIELD_ELEMENT_BINARY_LENGTH = 48;
+
+// The flag bits in the first octet of an encoding.
+static const unsigned char FLAG_MASK = 0xe0;
+static const unsigned char INFINITY_FLAG = 0x40;
+
+// The number of counters {@code bls12381_hashToG1} tries. Every candidate is a
+// valid \f$x\f$ coordinate with probability about one half.
+static const int HASH_TO_G1_ATTEMPT_LIMIT = 256;
+
+static int bls12381_g1IsOnCurve(const FieldAffinePoint *point,
+                                const Bls12381Context *context) {
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+
+  if (point->isInfinity) {
+    return 1;
+  }
+
+  // \f$y^2 = x^3 + 4\f$
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t left[n], right[n];
+  fieldElement_square(left, point->y, montgomeryContext);
+  fieldElement_square(right, point->x, montgomeryContext);
+  fieldElement_mul(right, right, point->x, montgomeryContext);
+  fieldElement_add(right, right, context->curveB, montgomeryContext);
+
+  return fieldElement_isEquals(left, right, montgomeryContext);
+}
+
+int bls12381_g1IsValid(const FieldAffinePoint *point,
+                       const Bls12381Context *context) {
+  if (!bls12381_g1IsOnCurve(point, context)) {
+    return 0;
+  }
+
+  mp_limb_t limbs[2 * context->montgomeryContext.limbCount];
+  FieldAffinePoint multiple =
+      fieldAffine_view(limbs, &context->montgomeryContext);
+  if (bls12381_g1Multiply(&multiple, point, context->groupOrder, context)) {
+    return 0;
+  }
+
+  return multiple.isInfinity;
+}
+
+int bls12381_g2IsValid(const TwistAffinePoint *point,
+                       const Bls12381Context *context) {
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+
+  if (!twistAffine_isOnCurve(point, &context->twistB, montgomeryContext)) {
+    return 0;
+  }
+
+  mp_limb_t limbs[4 * montgomeryContext->limbCount];
+  TwistAffinePoint multiple = twistAffine_view(limbs, montgomeryContext);
+  if (twistAffine_multiply(&multiple, point, context->groupOrder,
+                           montgomeryContext)) {
+    return 0;
+  }
+
+  return multiple.isInfinity;
+}
+
+int bls12381_gtIsValid(const Fp12Element *element,
+                       const Bls12381Context *context) {
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[36 * n];
+  Fp12Element product = fp12Element_view(limbs, montgomeryContext);
+  Fp12Element frobenius = fp12Element_view(limbs + 12 * n, montgomeryContext);
+  Fp12Element one = fp12Element_view(limbs + 24 * n, montgomeryContext);
+  fp12Element_setOne(&one, montgomeryContext);
+
+  // \f$f^{p^6 + 1} = \bar{f} f = 1\f$, so the order divides
+  // \f$(p^2 + 1)(p^4 - p^2 + 1)\f$.
+  fp12Element_conjugate(&product, element, montgomeryContext);
+  fp12Element_mul(&product, &product, element, montgomeryContext);
+  if (!fp12Element_isEquals(&product, &one, montgomeryContext)) {
+    return 0;
+  }
+
+  // \f$f^{p^4} f = f^{p^2}\f$, so the order divides \f$p^4 - p^2 + 1\f$ and
+  // the conjugate is the inverse.
+  fp12Element_frobenius(&frobenius, element, context->frobeniusCoefficients,
+                        montgomeryContext);
+  fp12Element_frobenius(&frobenius, &frobenius,
+                        context->frobeniusCoefficients, montgomeryContext);
+  fp12Element_copy(&product, &frobenius, montgomeryContext);
+  fp12Element_frobenius(&product, &product, context->frobeniusCoefficients,
+                        montgomeryContext);
+  fp12Element_frobenius(&product, &product, context->frobeniusCoefficients,
+                        montgomeryContext);
+  fp12Element_mul(&product, &product, element, montgomeryContext);
+  if (!fp12Element_isEquals(&product, &frobenius, montgomeryContext)) {
+    return 0;
+  }
+
+  bls12381_gtPow(&product, element, context->groupOrder, context);
+
+  return fp12Element_isEquals(&product, &one, montgomeryContext);
+}
+
+CryptidStatus bls12381_g1Multiply(FieldAffinePoint *result,
+                                  const FieldAffinePoint *point,
+                                  const mpz_t scalar,
+                                  const Bls12381Context *context) {
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+
+  if (point->isInfinity || mpz_sgn(scalar) == 0) {
+    result->isInfinity = 1;
+    return CRYPTID_SUCCESS;
+  }
+
+  // \f$[-k]P = [k](-P)\f$
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[5 * n];
+  FieldAffinePoint base = *point;
+  if (mpz_sgn(scalar) < 0) {
+    base = fieldAffine_view(limbs, montgomeryContext);
+    fieldAffine_negate(&base, point, montgomeryContext);
+  }
+
+  mpz_t magnitude;
+  mpz_init(magnitude);
+  mpz_abs(magnitude, scalar);
+
+  JacobianPoint accumulator = jacobian_view(limbs + 2 * n, montgomeryContext);
+  jacobian_setInfinity(&accumulator, montgomeryContext);
+
+  for (size_t i = mpz_sizeinbase(magnitude, 2); i-- > 0;) {
+    jacobian_double(&accumulator, &accumulator, context->curveA,
+                    montgomeryContext);
+
+    if (mpz_tstbit(magnitude, i)) {
+      jacobian_addMixed(&accumulator, &accumulator, &base, context->curveA,
+                        montgomeryContext);
+    }
+  }
+
+  mpz_clear(magnitude);
+
+  return jacobian_toFieldAffinePoint(result, &accumulator, montgomeryContext);
+}
+
+static void bls12381_mulByLine(Fp12Element *f, const ComplexFieldElement *slope,
+                               const TwistAffinePoint *t,
+                               const FieldElement *minusPX,
+                               const FieldElement *pY,
+                               const Bls12381Context *context) {
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+
+  // The line through \f$\psi(T)\f$ with slope \f$\frac{\lambda}{w}\f$, where
+  // \f$\psi(x, y) = (\frac{x}{w^2}, \frac{y}{w^3})\f$ maps the twist into
+  // \f$E(F_{p^{12}})\f$, evaluates at \f$P\f$ to
+  // \f$y_P - \frac{\lambda x_P}{w} + \frac{\lambda x_T - y_T}{w^3}\f$. Scaling
+  // by \f$w^3\f$, which lies in a proper subfield and vanishes in the final
+  // exponentiation, leaves
+  // \f$(\lambda x_T - y_T) - \lambda x_P w^2 + y_P w^3\f$, see
+  // [Guide-to-Pairing].
+  mp_limb_t limbs[12 * montgomeryContext->limbCount];
+  Fp12Element line = fp12Element_view(limbs, montgomeryContext);
+  fp12Element_setOne(&line, montgomeryContext);
+
+  complexFieldElement_mul(&line.c0.c0, slope, &t->x, montgomeryContext);
+  complexFieldElement_sub(&line.c0.c0, &line.c0.c0, &t->y, montgomeryContext);
+
+  fieldElement_mul(line.c0.c1.real, slope->real, minusPX, montgomeryContext);
+  fieldElement_mul(line.c0.c1.imaginary, slope->imaginary, minusPX,
+                   montgomeryContext);
+
+  fieldElement_copy(line.c1.c1.real, pY, montgomeryContext);
+
+  fp12Element_mul(f, f, &line, montgomeryContext);
+}
+
+CryptidStatus bls12381_performPairing(Fp12Element *result,
+                                      const FieldAffinePoint *p,
+                                      const TwistAffinePoint *q,
+                                      const Bls12381Context *context) {
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+
+  if (p->isInfinity || q->isInfinity) {
+    fp12Element_setOne(result, montgomeryContext);
+    return CRYPTID_SUCCESS;
+  }
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t minusPX[n], limbs[46 * n];
+  fieldElement_negate(minusPX, p->x, montgomeryContext);
+
+  mpz_t loopCount;
+  mpz_init(loopCount);
+  mpz_abs(loopCount, context->x);
+
+  // Miller loop over the bits of \f$|x|\f$. The vertical lines take values in
+  // \f$F_{p^6}\f$ and are eliminated by the final exponentiation.
+  Fp12Element f = fp12Element_view(limbs, montgomeryContext);
+  fp12Element_setOne(&f, montgomeryContext);
+
+  TwistAffinePoint t = twistAffine_view(limbs + 12 * n, montgomeryContext);
+  TwistAffinePoint previous =
+      twistAffine_view(limbs + 16 * n, montgomeryContext);
+  ComplexFieldElement slope =
+      complexFieldElement_view(limbs + 20 * n, montgomeryContext);
+  twistAffine_copy(&t, q, montgomeryContext);
+  CryptidStatus status = CRYPTID_SUCCESS;
+
+  for (size_t i = mpz_sizeinbase(loopCount, 2) - 1; i-- > 0;) {
+    fp12Element_square(&f, &f, montgomeryContext);
+
+    twistAffine_copy(&previous, &t, montgomeryContext);
+    status = twistAffine_double(&t, &slope, &t, montgomeryContext);
+    if (status) {
+      break;
+    }
+    bls12381_mulByLine(&f, &slope, &previous, minusPX, p->y, context);
+
+    if (mpz_tstbit(loopCount, i)) {
+      twistAffine_copy(&previous, &t, montgomeryContext);
+      status = twistAffine_add(&t, &slope, &t, q, montgomeryContext);
+      if (status) {
+        break;
+      }
+      bls12381_mulByLine(&f, &slope, &previous, minusPX, p->y, context);
+    }
+  }
+
+  mpz_clear(loopCount);
+
+  if (status) {
+    return status;
+  }
+
+  // As \f$x < 0\f$, the Miller function is \f$f_{x, Q} = f_{|x|, Q}^{-1}\f$ up
+  // to a vertical line. The conjugate becomes the inverse once the final
+  // exponentiation maps it into the cyclotomic subgroup.
+  fp12Element_conjugate(&f, &f, montgomeryContext);
+
+  // The easy part \f$f^{(p^6 - 1)(p^2 + 1)}\f$, after which \f$f\f$ lies in the
+  // cyclotomic subgroup.
+  Fp12Element inverse = fp12Element_view(limbs + 22 * n, montgomeryContext);
+  status = fp12Element_invert(&inverse, &f, montgomeryContext);
+  if (status) {
+    return status;
+  }
+  fp12Element_conjugate(&f, &f, montgomeryContext);
+  fp12Element_mul(&f, &f, &inverse, montgomeryContext);
+
+  Fp12Element frobenius = fp12Element_view(limbs + 34 * n, montgomeryContext);
+  fp12Element_frobenius(&frobenius, &f, context->frobeniusCoefficients,
+                        montgomeryContext);
+  fp12Element_frobenius(&frobenius, &frobenius,
+                        context->frobeniusCoefficients, montgomeryContext);
+  fp12Element_mul(&f, &frobenius, &f, montgomeryContext);
+
+  // The hard part \f$\frac{p^4 - p^2 + 1}{r}\f$.
+  fp12Element_powDigits(result, &f, context->hardPartDigits,
+                        context->hardPartDigitCount,
+                        context->hardPartWindowSize, montgomeryContext);
+
+  return CRYPTID_SUCCESS;
+}
+
+void bls12381_gtPow(Fp12Element *power, const Fp12Element *base,
+                    const mpz_t exponent, const Bls12381Context *context) {
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+
+  // \f$b^{-e} = \bar{b}^e\f$
+  mp_limb_t actualBaseLimbs[12 * montgomeryContext->limbCount];
+  Fp12Element actualBase = *base;
+  if (mpz_sgn(exponent) < 0) {
+    actualBase = fp12Element_view(actualBaseLimbs, montgomeryContext);
+    fp12Element_conjugate(&actualBase, base, montgomeryContext);
+  }
+
+  mpz_t absoluteExponent;
+  mpz_init(absoluteExponent);
+  mpz_abs(absoluteExponent, exponent);
+
+  // The same trade-off between the table and the additions as in
+  // \f$F_{p^2}\f$, capped by the table of {@code fp12Element_powDigits}.
+  int windowSize = gtElement_windowSize(absoluteExponent);
+  if (windowSize > FP12ELEMENT_MAX_WINDOW_SIZE) {
+    windowSize = FP12ELEMENT_MAX_WINDOW_SIZE;
+  }
+  signed char *digits =
+      (signed char *)malloc(windowedNaf_maxLength(absoluteExponent));
+  const size_t digitCount =
+      windowedNaf_recode(digits, absoluteExponent, windowSize);
+
+  fp12Element_powDigits(power, &actualBase, digits, digitCount, windowSize,
+                        montgomeryContext);
+
+  free(digits);
+  mpz_clear(absoluteExponent);
+}
+
+CryptidStatus bls12381_hashToG1(FieldAffinePoint *result,
+                                const unsigned char *const message,
+                                const size_t messageLength,
+                                const HashFunction hashFunction,
+                                const Bls12381Context *context) {
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+  const mpz_srcptr fieldOrder = context->fieldOrder;
+
+  unsigned char *candidate = (unsigned char *)malloc(messageLength + 1);
+  memcpy(candidate, message, messageLength);
+
+  mpz_t x, y, rightHandSide, ySquared;
+  mpz_inits(x, y, rightHandSide, ySquared, NULL);
+
+  CryptidStatus status = CRYPTID_ATTEMPT_LIMIT_REACHED_ERROR;
+  for (int counter = 0; counter < HASH_TO_G1_ATTEMPT_LIMIT; counter++) {
+    candidate[messageLength] = (unsigned char)counter;
+    hashToRange(x, candidate, (int)messageLength + 1, fieldOrder,
+                hashFunction);
+
+    // \f$y = (x^3 + 4)^{\frac{p + 1}{4}}\f$ is a square root of
+    // \f$x^3 + 4\f$ if it has any, as \f$p \equiv 3 \pmod 4\f$.
+    mpz_powm_ui(rightHandSide, x, 3, fieldOrder);
+    mpz_add_ui(rightHandSide, rightHandSide, 4);
+    mpz_mod(rightHandSide, rightHandSide, fieldOrder);
+
+    mpz_powm(y, rightHandSide, context->squareRootExponent, fieldOrder);
+    mpz_powm_ui(ySquared, y, 2, fieldOrder);
+    if (mpz_cmp(ySquared, rightHandSide)) {
+      continue;
+    }
+
+    mp_limb_t pointLimbs[2 * montgomeryContext->limbCount];
+    FieldAffinePoint point = fieldAffine_view(pointLimbs, montgomeryContext);
+    fieldElement_fromMpz(point.x, x, montgomeryContext);
+    fieldElement_fromMpz(point.y, y, montgomeryContext);
+    point.isInfinity = 0;
+
+    // Clearing the cofactor of \f$E(F_p)\f$ leaves an element of \f$G_1\f$.
+    status = bls12381_g1Multiply(result, &point, context->g1Cofactor, context);
+    if (status || !result->isInfinity) {
+      break;
+    }
+    status = CRYPTID_ATTEMPT_LIMIT_REACHED_ERROR;
+  }
+
+  mpz_clears(x, y, rightHandSide, ySquared, NULL);
+  free(candidate);
+
+  return status;
+}
+
+static void bls12381_writeFieldElement(unsigned char *output,
+                                       const FieldElement *element,
+                                       const Bls12381Context *context) {
+  mpz_t value;
+  mpz_init(value);
+  fieldElement_toMpz(value, element, &context->montgomeryContext);
+
+  // Big-endian, padded with leading zeros.
+  const size_t length = (mpz_sizeinbase(value, 2) + 7) / 8;
+  memset(output, 0, FIELD_ELEMENT_BINARY_LENGTH);
+  mpz_export(output + FIELD_ELEMENT_BINARY_LENGTH - length, NULL, 1, 1, 1, 0,
+             value);
+
+  mpz_clear(value);
+}
+
+static int bls12381_readFieldElement(FieldElement *result,
+                                     const unsigned char *const input,
+                                     const Bls12381Context *context) {
+  mpz_t value;
+  mpz_init(value);
+  mpz_import(value, FIELD_ELEMENT_BINARY_LENGTH, 1, 1, 1, 0, input);
+
+  const int isReduced = mpz_cmp(value, context->fieldOrder) < 0;
+  if (isReduced) {
+    fieldElement_fromMpz(result, value, &context->montgomeryContext);
+  }
+
+  mpz_clear(value);
+
+  return isReduced;
+}
+
+// Reads the flags of an encoding, returning 1 and setting {@code isInfinity}
+// if they are valid for an uncompressed point.
+static int bls12381_readFlags(int *isInfinity, const unsigned char *const input,
+                              const size_t length) {
+  const unsigned char flags = input[0] & FLAG_MASK;
+
+  if (flags == 0) {
+    *isInfinity = 0;
+    return 1;
+  }
+
+  if (flags != INFINITY_FLAG || (input[0] & ~FLAG_MASK)) {
+    return 0;
+  }
+
+  for (size_t i = 1; i < length; i++) {
+    if (input[i]) {
+      return 0;
+    }
+  }
+
+  *isInfinity = 1;
+  return 1;
+}
+
+void bls12381_g1ToBinary(unsigned char *output, const FieldAffinePoint *point,
+                         const Bls12381Context *context) {
+  if (point->isInfinity) {
+    memset(output, 0, BLS12381_G1_BINARY_LENGTH);
+    output[0] = INFINITY_FLAG;
+    return;
+  }
+
+  bls12381_writeFieldElement(output, point->x, context);
+  bls12381_writeFieldElement(output + FIELD_ELEMENT_BINARY_LENGTH, point->y,
+                             context);
+}
+
+CryptidStatus bls12381_g1FromBinary(FieldAffinePoint *result,
+                                    const unsigned char *const input,
+                                    const Bls12381Context *context) {
+  int isInfinity;
+  if (!bls12381_readFlags(&isInfinity, input, BLS12381_G1_BINARY_LENGTH)) {
+    return CRYPTID_ILLEGAL_POINT_ENCODING_ERROR;
+  }
+
+  if (isInfinity) {
+    result->isInfinity = 1;
+    return CRYPTID_SUCCESS;
+  }
+
+  mp_limb_t limbs[2 * context->montgomeryContext.limbCount];
+  FieldAffinePoint point = fieldAffine_view(limbs, &context->montgomeryContext);
+  point.isInfinity = 0;
+  if (!bls12381_readFieldElement(point.x, input, context) ||
+      !bls12381_readFieldElement(
+          point.y, input + FIELD_ELEMENT_BINARY_LENGTH, context) ||
+      !bls12381_g1IsValid(&point, context)) {
+    return CRYPTID_ILLEGAL_POINT_ENCODING_ERROR;
+  }
+
+  fieldAffine_copy(result, &point, &context->montgomeryContext);
+
+  return CRYPTID_SUCCESS;
+}
+
+void bls12381_g2ToBinary(unsigned char *output, const TwistAffinePoint *point,
+                         const Bls12381Context *context) {
+  if (point->isInfinity) {
+    memset(output, 0, BLS12381_G2_BINARY_LENGTH);
+    output[0] = INFINITY_FLAG;
+    return;
+  }
+
+  bls12381_writeFieldElement(output, point->x.imaginary, context);
+  bls12381_writeFieldElement(output + FIELD_ELEMENT_BINARY_LENGTH,
+                             point->x.real, context);
+  bls12381_writeFieldElement(output + 2 * FIELD_ELEMENT_BINARY_LENGTH,
+                             point->y.imaginary, context);
+  bls12381_writeFieldElement(output + 3 * FIELD_ELEMENT_BINARY_LENGTH,
+                             point->y.real, context);
+}
+
+CryptidStatus bls12381_g2FromBinary(TwistAffinePoint *result,
+                                    const unsigned char *const input,
+                                    const Bls12381Context *context) {
+  int isInfinity;
+  if (!bls12381_readFlags(&isInfinity, input, BLS12381_G2_BINARY_LENGTH)) {
+    return CRYPTID_ILLEGAL_POINT_ENCODING_ERROR;
+  }
+
+  if (isInfinity) {
+    result->isInfinity = 1;
+    return CRYPTID_SUCCESS;
+  }
+
+  mp_limb_t limbs[4 * context->montgomeryContext.limbCount];
+  TwistAffinePoint point = twistAffine_view(limbs, &context->montgomeryContext);
+  point.isInfinity = 0;
+  if (!bls12381_readFieldElement(point.x.imaginary, input, context) ||
+      !bls12381_readFieldElement(
+          point.x.real, input + FIELD_ELEMENT_BINARY_LENGTH, context) ||
+      !bls12381_readFieldElement(
+          point.y.imaginary, input + 2 * FIELD_ELEMENT_BINARY_LENGTH,
+          context) ||
+      !bls12381_readFieldElement(
+          point.y.real, input + 3 * FIELD_ELEMENT_BINARY_LENGTH, context) ||
+      !bls12381_g2IsValid(&point, context)) {
+    return CRYPTID_ILLEGAL_POINT_ENCODING_ERROR;
+  }
+
+  twistAffine_copy(result, &point, &context->montgomeryContext);
+
+  return CRYPTID_SUCCESS;
+}
+
+static void bls12381_writeFp2Element(unsigned char *output,
+                                     const ComplexFieldElement *element,
+                                     const Bls12381Context *context) {
+  bls12381_writeFieldElement(output, element->imaginary, context);
+  bls12381_writeFieldElement(output + FIELD_ELEMENT_BINARY_LENGTH,
+                             element->real, context);
+}
+
+void bls12381_gtToBinary(unsigned char *output, const Fp12Element *element,
+                         const Bls12381Context *context) {
+  const Fp6Element *halves[] = {&element->c0, &element->c1};
+  for (int i = 0; i < 2; i++) {
+    const ComplexFieldElement *coefficients[] = {&halves[i]->c0, &halves[i]->c1,
+                                                 &halves[i]->c2};
+    for (int j = 0; j < 3; j++) {
+      bls12381_writeFp2Element(
+          output + (3 * i + j) * 2 * FIELD_ELEMENT_BINARY_LENGTH,
+          coefficients[j], context);
+    }
+  }
+}
+
+static int bls12381_readFp2Element(ComplexFieldElement *result,
+                                   const unsigned char *const input,
+                                   const Bls12381Context *context) {
+  return bls12381_readFieldElement(result->imaginary, input, context) &&
+         bls12381_readFieldElement(
+             result->real, input + FIELD_ELEMENT_BINARY_LENGTH, context);
+}
+
+CryptidStatus bls12381_gtFromBinary(Fp12Element *result,
+                                    const unsigned char *const input,
+                                    const Bls12381Context *context) {
+  mp_limb_t limbs[12 * context->montgomeryContext.limbCount];
+  Fp12Element element = fp12Element_view(limbs, &context->montgomeryContext);
+
+  Fp6Element *halves[] = {&element.c0, &element.c1};
+  for (int i = 0; i < 2; i++) {
+    ComplexFieldElement *coefficients[] = {&halves[i]->c0, &halves[i]->c1,
+                                           &halves[i]->c2};
+    for (int j = 0; j < 3; j++) {
+      if (!bls12381_readFp2Element(
+              coefficients[j],
+              input + (3 * i + j) * 2 * FIELD_ELEMENT_BINARY_LENGTH,
+              context)) {
+        return CRYPTID_ILLEGAL_POINT_ENCODING_ERROR;
+      }
+    }
+  }
+
+  if (!bls12381_gtIsValid(&element, context)) {
+    return CRYPTID_ILLEGAL_POINT_ENCODING_ERROR;
+  }
+
+  fp12Element_copy(result, &element, &context->montgomeryContext);
+
+  return CRYPTID_SUCCESS;
+}
@@ -0,0 +1,165 @@
+#include <stdlib.h>
+
+#include "gmp.h"
+
+#include "bls12-381/Bls12381Context.h"
+#include "bls12-381/Fp12Element.h"
+#include "util/WindowedNaf.h"
+
+// References
+//  * [BLS12-381] Sean Bowe. 2017. BLS12-381: New zk-SNARK Elliptic Curve
+//  Construction. https://electriccoin.co/blog/new-snark-curve/
+
+static const char *const X_HEX = "-d201000000010000";
+
+static const char *const G1_X_HEX =
+    "17f1d3a73197d7942695638c4fa9ac0fc3688c4f9774b905a14e3a3f171bac586c55e83ff9"
+    "7a1aeffb3af00adb22c6bb";
+static const char *const G1_Y_HEX =
+    "08b3f481e3aaa0f1a09e30ed741d8ae4fcf5e095d5d00af600db18cb2c04b3edd03cc744a2"
+    "888ae40caa232946c5e7e1";
+
+static const char *const G2_X_REAL_HEX =
+    "024aa2b2f08f0a91260805272dc51051c6e47ad4fa403b02b4510b647ae3d1770bac0326a8"
+    "05bbefd48056c8c121bdb8";
+static const char *const G2_X_IMAGINARY_HEX =
+    "13e02b6052719f607dacd3a088274f65596bd0d09920b61ab5da61bbdc7f5049334cf11213"
+    "945d57e5ac7d055d042b7e";
+static const char *const G2_Y_REAL_HEX =
+    "0ce5d527727d6e118cc9cdc6da2e351aadfd9baa8cbdd3a76d429a695160d12c923ac9cc3b"
+    "aca289e193548608b82801";
+static const char *const G2_Y_IMAGINARY_HEX =
+    "0606c4a02ea734cc32acd2b02bc28b99cb3e287e85a763af267492ab572e99ab3f370d275c"
+    "ec1da1aaa9075ff05f79be";
+
+static void bls12381Context_fieldElementFromHex(
+    FieldElement *result, const char *const hex,
+    const MontgomeryContext *montgomeryContext) {
+  mpz_t value;
+  mpz_init_set_str(value, hex, 16);
+  fieldElement_fromMpz(result, value, montgomeryContext);
+  mpz_clear(value);
+}
+
+CryptidStatus bls12381Context_init(Bls12381Context *contextOutput) {
+  const MontgomeryContext *montgomeryContext =
+      &contextOutput->montgomeryContext;
+
+  mpz_init_set_str(contextOutput->x, X_HEX, 16);
+  mpz_inits(contextOutput->fieldOrder, contextOutput->groupOrder,
+            contextOutput->g1Cofactor, contextOutput->squareRootExponent,
+            NULL);
+
+  mpz_t tmp;
+  mpz_init(tmp);
+
+  // \f$r = x^4 - x^2 + 1\f$
+  mpz_pow_ui(tmp, contextOutput->x, 2);
+  mpz_pow_ui(contextOutput->groupOrder, tmp, 2);
+  mpz_sub(contextOutput->groupOrder, contextOutput->groupOrder, tmp);
+  mpz_add_ui(contextOutput->groupOrder, contextOutput->groupOrder, 1);
+
+  // \f$\frac{(x - 1)^2}{3}\f$
+  mpz_sub_ui(tmp, contextOutput->x, 1);
+  mpz_pow_ui(tmp, tmp, 2);
+  mpz_divexact_ui(contextOutput->g1Cofactor, tmp, 3);
+
+  // \f$p = \frac{(x - 1)^2}{3} r + x\f$
+  mpz_mul(contextOutput->fieldOrder, contextOutput->g1Cofactor,
+          contextOutput->groupOrder);
+  mpz_add(contextOutput->fieldOrder, contextOutput->fieldOrder,
+          contextOutput->x);
+
+  // \f$\frac{p + 1}{4}\f$
+  mpz_add_ui(contextOutput->squareRootExponent, contextOutput->fieldOrder, 1);
+  mpz_divexact_ui(contextOutput->squareRootExponent,
+                  contextOutput->squareRootExponent, 4);
+
+  montgomeryContext_init(&contextOutput->montgomeryContext,
+                         contextOutput->fieldOrder);
+
+  CryptidStatus status = fieldElement_checkSupported(montgomeryContext);
+  if (status) {
+    mpz_clears(contextOutput->x, contextOutput->fieldOrder,
+               contextOutput->groupOrder, contextOutput->g1Cofactor,
+               contextOutput->squareRootExponent, tmp, NULL);
+    montgomeryContext_destroy(contextOutput->montgomeryContext);
+    return status;
+  }
+
+  // \f$a\f$, \f$b\f$, the twist coefficient, the six Frobenius
+  // coefficients and the two generators.
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t *limbs = (mp_limb_t *)malloc(22 * n * sizeof(mp_limb_t));
+  contextOutput->limbs = limbs;
+  contextOutput->curveA = limbs;
+  contextOutput->curveB = limbs + n;
+  contextOutput->twistB =
+      complexFieldElement_view(limbs + 2 * n, montgomeryContext);
+  for (int k = 0; k < 6; ++k) {
+    contextOutput->frobeniusCoefficients[k] =
+        complexFieldElement_view(limbs + (4 + 2 * k) * n, montgomeryContext);
+  }
+  contextOutput->g1Generator =
+      fieldAffine_view(limbs + 16 * n, montgomeryContext);
+  contextOutput->g2Generator =
+      twistAffine_view(limbs + 18 * n, montgomeryContext);
+
+  fieldElement_setZero(contextOutput->curveA, montgomeryContext);
+
+  mpz_set_ui(tmp, 4);
+  fieldElement_fromMpz(contextOutput->curveB, tmp, montgomeryContext);
+  fieldElement_copy(contextOutput->twistB.real, contextOutput->curveB,
+                    montgomeryContext);
+  fieldElement_copy(contextOutput->twistB.imaginary, contextOutput->curveB,
+                    montgomeryContext);
+
+  fp12Element_frobeniusCoefficients(contextOutput->frobeniusCoefficients,
+                                    contextOutput->fieldOrder,
+                                    montgomeryContext);
+
+  bls12381Context_fieldElementFromHex(contextOutput->g1Generator.x, G1_X_HEX,
+                                      montgomeryContext);
+  bls12381Context_fieldElementFromHex(contextOutput->g1Generator.y, G1_Y_HEX,
+                                      montgomeryContext);
+  contextOutput->g1Generator.isInfinity = 0;
+
+  bls12381Context_fieldElementFromHex(contextOutput->g2Generator.x.real,
+                                      G2_X_REAL_HEX, montgomeryContext);
+  bls12381Context_fieldElementFromHex(contextOutput->g2Generator.x.imaginary,
+                                      G2_X_IMAGINARY_HEX, montgomeryContext);
+  bls12381Context_fieldElementFromHex(contextOutput->g2Generator.y.real,
+                                      G2_Y_REAL_HEX, montgomeryContext);
+  bls12381Context_fieldElementFromHex(contextOutput->g2Generator.y.imaginary,
+                                      G2_Y_IMAGINARY_HEX, montgomeryContext);
+  contextOutput->g2Generator.isInfinity = 0;
+
+  // The hard part \f$\frac{p^4 - p^2 + 1}{r}\f$ of the final exponent has
+  // about 1270 bits, enough for the widest window to pay off.
+  mpz_t hardPart;
+  mpz_init(hardPart);
+  mpz_pow_ui(tmp, contextOutput->fieldOrder, 2);
+  mpz_pow_ui(hardPart, tmp, 2);
+  mpz_sub(hardPart, hardPart, tmp);
+  mpz_add_ui(hardPart, hardPart, 1);
+  mpz_divexact(hardPart, hardPart, contextOutput->groupOrder);
+
+  contextOutput->hardPartWindowSize = FP12ELEMENT_MAX_WINDOW_SIZE;
+  contextOutput->hardPartDigits =
+      (signed char *)malloc(windowedNaf_maxLength(hardPart));
+  contextOutput->hardPartDigitCount =
+      windowedNaf_recode(contextOutput->hardPartDigits, hardPart,
+                         contextOutput->hardPartWindowSize);
+
+  mpz_clears(hardPart, tmp, NULL);
+
+  return CRYPTID_SUCCESS;
+}
+
+void bls12381Context_destroy(Bls12381Context context) {
+  mpz_clears(context.x, context.fieldOrder, context.groupOrder,
+             context.g1Cofactor, context.squareRootExponent, NULL);
+  free(context.hardPartDigits);
+  free(context.limbs);
+  montgomeryContext_destroy(context.montgomeryContext);
+}
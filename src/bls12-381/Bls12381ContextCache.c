@@ -0,0 +1,98 @@
+#include <stdlib.h>
+
+#include "bls12-381/Bls12381ContextCache.h"
+#include "util/Mutex.h"
+
+typedef struct Bls12381ContextCacheEntry {
+  // The first member, so that a released context leads back to its entry.
+  Bls12381Context context;
+
+  // The number of callers holding the context, plus one while it is in the
+  // cache.
+  size_t referenceCount;
+} Bls12381ContextCacheEntry;
+
+static CryptidMutex bls12381ContextCacheMutex = CRYPTID_MUTEX_INITIALIZER;
+
+static Bls12381ContextCacheEntry *bls12381ContextCacheEntry = NULL;
+
+// Drops a reference to the entry, and tells whether it was the last one. Must
+// be called with the mutex held.
+static int bls12381ContextCache_unreference(Bls12381ContextCacheEntry *entry) {
+  entry->referenceCount--;
+
+  return entry->referenceCount == 0;
+}
+
+static void
+bls12381ContextCache_destroyEntry(Bls12381ContextCacheEntry *entry) {
+  bls12381Context_destroy(entry->context);
+  free(entry);
+}
+
+CryptidStatus bls12381ContextCache_acquire(const Bls12381Context **result) {
+  mutex_lock(&bls12381ContextCacheMutex);
+  Bls12381ContextCacheEntry *entry = bls12381ContextCacheEntry;
+  if (entry) {
+    entry->referenceCount++;
+    mutex_unlock(&bls12381ContextCacheMutex);
+    *result = &entry->context;
+    return CRYPTID_SUCCESS;
+  }
+  mutex_unlock(&bls12381ContextCacheMutex);
+
+  // The constants are derived outside of the lock, as they take
+  // exponentiations in the field.
+  Bls12381ContextCacheEntry *created =
+      (Bls12381ContextCacheEntry *)malloc(sizeof(Bls12381ContextCacheEntry));
+  CryptidStatus status = bls12381Context_init(&created->context);
+  if (status) {
+    free(created);
+    return status;
+  }
+  created->referenceCount = 2;
+
+  mutex_lock(&bls12381ContextCacheMutex);
+  // Another thread may have derived the context meanwhile.
+  entry = bls12381ContextCacheEntry;
+  if (entry) {
+    entry->referenceCount++;
+    mutex_unlock(&bls12381ContextCacheMutex);
+    bls12381ContextCache_destroyEntry(created);
+    *result = &entry->context;
+    return CRYPTID_SUCCESS;
+  }
+  bls12381ContextCacheEntry = created;
+  mutex_unlock(&bls12381ContextCacheMutex);
+
+  *result = &created->context;
+  return CRYPTID_SUCCESS;
+}
+
+void bls12381ContextCache_release(const Bls12381Context *context) {
+  Bls12381ContextCacheEntry *entry = (Bls12381ContextCacheEntry *)context;
+
+  mutex_lock(&bls12381ContextCacheMutex);
+  const int isLastReference = bls12381ContextCache_unreference(entry);
+  mutex_unlock(&bls12381ContextCacheMutex);
+
+  if (isLastReference) {
+    bls12381ContextCache_destroyEntry(entry);
+  }
+}
+
+void bls12381ContextCache_flush(void) {
+  Bls12381ContextCacheEntry *evicted = NULL;
+
+  mutex_lock(&bls12381ContextCacheMutex);
+  Bls12381ContextCacheEntry *entry = bls12381ContextCacheEntry;
+  if (entry && bls12381ContextCache_unreference(entry)) {
+    evicted = entry;
+  }
+  bls12381ContextCacheEntry = NULL;
+  mutex_unlock(&bls12381ContextCacheMutex);
+
+  if (evicted) {
+    bls12381ContextCache_destroyEntry(evicted);
+  }
+}
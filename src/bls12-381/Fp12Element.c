@@ -0,0 +1,429 @@
+#include "bls12-381/Fp12Element.h"
+
+// References:
+//   * [Guide-to-Pairing] Nadia El Mrabet and Marc Joye (Eds.). 2017. Guide to
+//   Pairing-Based Cryptography. Chapman and Hall/CRC.
+
+static void fp2_setZero(ComplexFieldElement *result,
+                        const MontgomeryContext *montgomeryContext) {
+  fieldElement_setZero(result->real, montgomeryContext);
+  fieldElement_setZero(result->imaginary, montgomeryContext);
+}
+
+static void fp2_negate(ComplexFieldElement *result,
+                       const ComplexFieldElement *operand,
+                       const MontgomeryContext *montgomeryContext) {
+  fieldElement_negate(result->real, operand->real, montgomeryContext);
+  fieldElement_negate(result->imaginary, operand->imaginary,
+                      montgomeryContext);
+}
+
+static int fp2_isEquals(const ComplexFieldElement *element1,
+                        const ComplexFieldElement *element2,
+                        const MontgomeryContext *montgomeryContext) {
+  return fieldElement_isEquals(element1->real, element2->real,
+                               montgomeryContext) &&
+         fieldElement_isEquals(element1->imaginary, element2->imaginary,
+                               montgomeryContext);
+}
+
+static void fp2_mulByNonResidue(ComplexFieldElement *result,
+                                const ComplexFieldElement *operand,
+                                const MontgomeryContext *montgomeryContext) {
+  // \f$(a + bi)(1 + i) = (a - b) + (a + b)i\f$
+  mp_limb_t real[montgomeryContext->limbCount];
+  fieldElement_sub(real, operand->real, operand->imaginary,
+                   montgomeryContext);
+  fieldElement_add(result->imaginary, operand->real, operand->imaginary,
+                   montgomeryContext);
+  fieldElement_copy(result->real, real, montgomeryContext);
+}
+
+static void fp6_copy(Fp6Element *result, const Fp6Element *operand,
+                     const MontgomeryContext *montgomeryContext) {
+  complexFieldElement_copy(&result->c0, &operand->c0, montgomeryContext);
+  complexFieldElement_copy(&result->c1, &operand->c1, montgomeryContext);
+  complexFieldElement_copy(&result->c2, &operand->c2, montgomeryContext);
+}
+
+static void fp6_setZero(Fp6Element *result,
+                        const MontgomeryContext *montgomeryContext) {
+  fp2_setZero(&result->c0, montgomeryContext);
+  fp2_setZero(&result->c1, montgomeryContext);
+  fp2_setZero(&result->c2, montgomeryContext);
+}
+
+static void fp6_add(Fp6Element *sum, const Fp6Element *augend,
+                    const Fp6Element *addend,
+                    const MontgomeryContext *montgomeryContext) {
+  complexFieldElement_add(&sum->c0, &augend->c0, &addend->c0,
+                          montgomeryContext);
+  complexFieldElement_add(&sum->c1, &augend->c1, &addend->c1,
+                          montgomeryContext);
+  complexFieldElement_add(&sum->c2, &augend->c2, &addend->c2,
+                          montgomeryContext);
+}
+
+static void fp6_sub(Fp6Element *difference, const Fp6Element *minuend,
+                    const Fp6Element *subtrahend,
+                    const MontgomeryContext *montgomeryContext) {
+  complexFieldElement_sub(&difference->c0, &minuend->c0, &subtrahend->c0,
+                          montgomeryContext);
+  complexFieldElement_sub(&difference->c1, &minuend->c1, &subtrahend->c1,
+                          montgomeryContext);
+  complexFieldElement_sub(&difference->c2, &minuend->c2, &subtrahend->c2,
+                          montgomeryContext);
+}
+
+static void fp6_negate(Fp6Element *result, const Fp6Element *operand,
+                       const MontgomeryContext *montgomeryContext) {
+  fp2_negate(&result->c0, &operand->c0, montgomeryContext);
+  fp2_negate(&result->c1, &operand->c1, montgomeryContext);
+  fp2_negate(&result->c2, &operand->c2, montgomeryContext);
+}
+
+static void fp6_mulByV(Fp6Element *result, const Fp6Element *operand,
+                       const MontgomeryContext *montgomeryContext) {
+  // \f$(c_0 + c_1 v + c_2 v^2) v = \xi c_2 + c_0 v + c_1 v^2\f$
+  mp_limb_t limbs[2 * montgomeryContext->limbCount];
+  ComplexFieldElement c2 = complexFieldElement_view(limbs, montgomeryContext);
+  fp2_mulByNonResidue(&c2, &operand->c2, montgomeryContext);
+  complexFieldElement_copy(&result->c2, &operand->c1, montgomeryContext);
+  complexFieldElement_copy(&result->c1, &operand->c0, montgomeryContext);
+  complexFieldElement_copy(&result->c0, &c2, montgomeryContext);
+}
+
+static void fp6_mul(Fp6Element *product, const Fp6Element *a,
+                    const Fp6Element *b,
+                    const MontgomeryContext *montgomeryContext) {
+  // Karatsuba multiplication with six multiplications in \f$F_{p^2}\f$, see
+  // Section 5.2 in [Guide-to-Pairing].
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[16 * n];
+  ComplexFieldElement t0 = complexFieldElement_view(limbs, montgomeryContext);
+  ComplexFieldElement t1 =
+      complexFieldElement_view(limbs + 2 * n, montgomeryContext);
+  ComplexFieldElement t2 =
+      complexFieldElement_view(limbs + 4 * n, montgomeryContext);
+  ComplexFieldElement s =
+      complexFieldElement_view(limbs + 6 * n, montgomeryContext);
+  ComplexFieldElement u =
+      complexFieldElement_view(limbs + 8 * n, montgomeryContext);
+  ComplexFieldElement c0 =
+      complexFieldElement_view(limbs + 10 * n, montgomeryContext);
+  ComplexFieldElement c1 =
+      complexFieldElement_view(limbs + 12 * n, montgomeryContext);
+  ComplexFieldElement c2 =
+      complexFieldElement_view(limbs + 14 * n, montgomeryContext);
+
+  complexFieldElement_mul(&t0, &a->c0, &b->c0, montgomeryContext);
+  complexFieldElement_mul(&t1, &a->c1, &b->c1, montgomeryContext);
+  complexFieldElement_mul(&t2, &a->c2, &b->c2, montgomeryContext);
+
+  // \f$c_0 = t_0 + \xi((a_1 + a_2)(b_1 + b_2) - t_1 - t_2)\f$
+  complexFieldElement_add(&s, &a->c1, &a->c2, montgomeryContext);
+  complexFieldElement_add(&u, &b->c1, &b->c2, montgomeryContext);
+  complexFieldElement_mul(&c0, &s, &u, montgomeryContext);
+  complexFieldElement_sub(&c0, &c0, &t1, montgomeryContext);
+  complexFieldElement_sub(&c0, &c0, &t2, montgomeryContext);
+  fp2_mulByNonResidue(&c0, &c0, montgomeryContext);
+  complexFieldElement_add(&c0, &c0, &t0, montgomeryContext);
+
+  // \f$c_1 = (a_0 + a_1)(b_0 + b_1) - t_0 - t_1 + \xi t_2\f$
+  complexFieldElement_add(&s, &a->c0, &a->c1, montgomeryContext);
+  complexFieldElement_add(&u, &b->c0, &b->c1, montgomeryContext);
+  complexFieldElement_mul(&c1, &s, &u, montgomeryContext);
+  complexFieldElement_sub(&c1, &c1, &t0, montgomeryContext);
+  complexFieldElement_sub(&c1, &c1, &t1, montgomeryContext);
+  fp2_mulByNonResidue(&u, &t2, montgomeryContext);
+  complexFieldElement_add(&c1, &c1, &u, montgomeryContext);
+
+  // \f$c_2 = (a_0 + a_2)(b_0 + b_2) - t_0 - t_2 + t_1\f$
+  complexFieldElement_add(&s, &a->c0, &a->c2, montgomeryContext);
+  complexFieldElement_add(&u, &b->c0, &b->c2, montgomeryContext);
+  complexFieldElement_mul(&c2, &s, &u, montgomeryContext);
+  complexFieldElement_sub(&c2, &c2, &t0, montgomeryContext);
+  complexFieldElement_sub(&c2, &c2, &t2, montgomeryContext);
+  complexFieldElement_add(&c2, &c2, &t1, montgomeryContext);
+
+  complexFieldElement_copy(&product->c0, &c0, montgomeryContext);
+  complexFieldElement_copy(&product->c1, &c1, montgomeryContext);
+  complexFieldElement_copy(&product->c2, &c2, montgomeryContext);
+}
+
+static CryptidStatus fp6_invert(Fp6Element *inverse, const Fp6Element *a,
+                                const MontgomeryContext *montgomeryContext) {
+  // Algorithm 5.23 in [Guide-to-Pairing]:
+  // \f$A = a_0^2 - \xi a_1 a_2\f$, \f$B = \xi a_2^2 - a_0 a_1\f$,
+  // \f$C = a_1^2 - a_0 a_2\f$ and \f$F = a_0 A + \xi(a_2 B + a_1 C)\f$,
+  // then the inverse is \f$\frac{A + Bv + Cv^2}{F}\f$.
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[10 * n];
+  ComplexFieldElement A = complexFieldElement_view(limbs, montgomeryContext);
+  ComplexFieldElement B =
+      complexFieldElement_view(limbs + 2 * n, montgomeryContext);
+  ComplexFieldElement C =
+      complexFieldElement_view(limbs + 4 * n, montgomeryContext);
+  ComplexFieldElement F =
+      complexFieldElement_view(limbs + 6 * n, montgomeryContext);
+  ComplexFieldElement t =
+      complexFieldElement_view(limbs + 8 * n, montgomeryContext);
+
+  complexFieldElement_square(&A, &a->c0, montgomeryContext);
+  complexFieldElement_mul(&t, &a->c1, &a->c2, montgomeryContext);
+  fp2_mulByNonResidue(&t, &t, montgomeryContext);
+  complexFieldElement_sub(&A, &A, &t, montgomeryContext);
+
+  complexFieldElement_square(&B, &a->c2, montgomeryContext);
+  fp2_mulByNonResidue(&B, &B, montgomeryContext);
+  complexFieldElement_mul(&t, &a->c0, &a->c1, montgomeryContext);
+  complexFieldElement_sub(&B, &B, &t, montgomeryContext);
+
+  complexFieldElement_square(&C, &a->c1, montgomeryContext);
+  complexFieldElement_mul(&t, &a->c0, &a->c2, montgomeryContext);
+  complexFieldElement_sub(&C, &C, &t, montgomeryContext);
+
+  complexFieldElement_mul(&F, &a->c2, &B, montgomeryContext);
+  complexFieldElement_mul(&t, &a->c1, &C, montgomeryContext);
+  complexFieldElement_add(&F, &F, &t, montgomeryContext);
+  fp2_mulByNonResidue(&F, &F, montgomeryContext);
+  complexFieldElement_mul(&t, &a->c0, &A, montgomeryContext);
+  complexFieldElement_add(&F, &F, &t, montgomeryContext);
+
+  CryptidStatus status = complexFieldElement_invert(&F, &F, montgomeryContext);
+  if (status) {
+    return status;
+  }
+
+  complexFieldElement_mul(&inverse->c0, &A, &F, montgomeryContext);
+  complexFieldElement_mul(&inverse->c1, &B, &F, montgomeryContext);
+  complexFieldElement_mul(&inverse->c2, &C, &F, montgomeryContext);
+
+  return CRYPTID_SUCCESS;
+}
+
+Fp6Element fp6Element_view(mp_limb_t *limbs,
+                           const MontgomeryContext *montgomeryContext) {
+  const size_t n = montgomeryContext->limbCount;
+  Fp6Element element;
+
+  element.c0 = complexFieldElement_view(limbs, montgomeryContext);
+  element.c1 = complexFieldElement_view(limbs + 2 * n, montgomeryContext);
+  element.c2 = complexFieldElement_view(limbs + 4 * n, montgomeryContext);
+
+  return element;
+}
+
+Fp12Element fp12Element_view(mp_limb_t *limbs,
+                             const MontgomeryContext *montgomeryContext) {
+  const size_t n = montgomeryContext->limbCount;
+  Fp12Element element;
+
+  element.c0 = fp6Element_view(limbs, montgomeryContext);
+  element.c1 = fp6Element_view(limbs + 6 * n, montgomeryContext);
+
+  return element;
+}
+
+void fp12Element_copy(Fp12Element *result, const Fp12Element *operand,
+                      const MontgomeryContext *montgomeryContext) {
+  fp6_copy(&result->c0, &operand->c0, montgomeryContext);
+  fp6_copy(&result->c1, &operand->c1, montgomeryContext);
+}
+
+void fp12Element_setOne(Fp12Element *result,
+                        const MontgomeryContext *montgomeryContext) {
+  complexFieldElement_setOne(&result->c0.c0, montgomeryContext);
+  fp2_setZero(&result->c0.c1, montgomeryContext);
+  fp2_setZero(&result->c0.c2, montgomeryContext);
+  fp6_setZero(&result->c1, montgomeryContext);
+}
+
+int fp12Element_isEquals(const Fp12Element *element1,
+                         const Fp12Element *element2,
+                         const MontgomeryContext *montgomeryContext) {
+  return fp2_isEquals(&element1->c0.c0, &element2->c0.c0, montgomeryContext) &&
+         fp2_isEquals(&element1->c0.c1, &element2->c0.c1, montgomeryContext) &&
+         fp2_isEquals(&element1->c0.c2, &element2->c0.c2, montgomeryContext) &&
+         fp2_isEquals(&element1->c1.c0, &element2->c1.c0, montgomeryContext) &&
+         fp2_isEquals(&element1->c1.c1, &element2->c1.c1, montgomeryContext) &&
+         fp2_isEquals(&element1->c1.c2, &element2->c1.c2, montgomeryContext);
+}
+
+void fp12Element_mul(Fp12Element *product, const Fp12Element *multiplier,
+                     const Fp12Element *multiplicand,
+                     const MontgomeryContext *montgomeryContext) {
+  // Karatsuba multiplication with three multiplications in \f$F_{p^6}\f$:
+  // \f$c_0 = t_0 + t_1 v\f$ and \f$c_1 = (a_0 + a_1)(b_0 + b_1) - t_0 - t_1\f$
+  // with \f$t_0 = a_0 b_0\f$ and \f$t_1 = a_1 b_1\f$.
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[24 * n];
+  Fp6Element t0 = fp6Element_view(limbs, montgomeryContext);
+  Fp6Element t1 = fp6Element_view(limbs + 6 * n, montgomeryContext);
+  Fp6Element s = fp6Element_view(limbs + 12 * n, montgomeryContext);
+  Fp6Element u = fp6Element_view(limbs + 18 * n, montgomeryContext);
+
+  fp6_mul(&t0, &multiplier->c0, &multiplicand->c0, montgomeryContext);
+  fp6_mul(&t1, &multiplier->c1, &multiplicand->c1, montgomeryContext);
+
+  fp6_add(&s, &multiplier->c0, &multiplier->c1, montgomeryContext);
+  fp6_add(&u, &multiplicand->c0, &multiplicand->c1, montgomeryContext);
+  fp6_mul(&product->c1, &s, &u, montgomeryContext);
+  fp6_sub(&product->c1, &product->c1, &t0, montgomeryContext);
+  fp6_sub(&product->c1, &product->c1, &t1, montgomeryContext);
+
+  fp6_mulByV(&t1, &t1, montgomeryContext);
+  fp6_add(&product->c0, &t0, &t1, montgomeryContext);
+}
+
+void fp12Element_square(Fp12Element *square, const Fp12Element *operand,
+                        const MontgomeryContext *montgomeryContext) {
+  // Complex squaring with two multiplications in \f$F_{p^6}\f$:
+  // \f$c_0 = (a_0 + a_1)(a_0 + a_1 v) - t - tv\f$ and \f$c_1 = 2t\f$ with
+  // \f$t = a_0 a_1\f$.
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[24 * n];
+  Fp6Element t = fp6Element_view(limbs, montgomeryContext);
+  Fp6Element tv = fp6Element_view(limbs + 6 * n, montgomeryContext);
+  Fp6Element s = fp6Element_view(limbs + 12 * n, montgomeryContext);
+  Fp6Element u = fp6Element_view(limbs + 18 * n, montgomeryContext);
+
+  fp6_mul(&t, &operand->c0, &operand->c1, montgomeryContext);
+  fp6_mulByV(&tv, &t, montgomeryContext);
+
+  fp6_add(&s, &operand->c0, &operand->c1, montgomeryContext);
+  fp6_mulByV(&u, &operand->c1, montgomeryContext);
+  fp6_add(&u, &u, &operand->c0, montgomeryContext);
+
+  fp6_mul(&square->c0, &s, &u, montgomeryContext);
+  fp6_sub(&square->c0, &square->c0, &t, montgomeryContext);
+  fp6_sub(&square->c0, &square->c0, &tv, montgomeryContext);
+  fp6_add(&square->c1, &t, &t, montgomeryContext);
+}
+
+void fp12Element_conjugate(Fp12Element *result, const Fp12Element *operand,
+                           const MontgomeryContext *montgomeryContext) {
+  if (result != operand) {
+    fp6_copy(&result->c0, &operand->c0, montgomeryContext);
+  }
+  fp6_negate(&result->c1, &operand->c1, montgomeryContext);
+}
+
+CryptidStatus fp12Element_invert(Fp12Element *inverse,
+                                 const Fp12Element *operand,
+                                 const MontgomeryContext *montgomeryContext) {
+  // \f$(a_0 + a_1 w)^{-1} = \frac{a_0 - a_1 w}{a_0^2 - a_1^2 v}\f$
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[12 * n];
+  Fp6Element t0 = fp6Element_view(limbs, montgomeryContext);
+  Fp6Element t1 = fp6Element_view(limbs + 6 * n, montgomeryContext);
+
+  fp6_mul(&t0, &operand->c0, &operand->c0, montgomeryContext);
+  fp6_mul(&t1, &operand->c1, &operand->c1, montgomeryContext);
+  fp6_mulByV(&t1, &t1, montgomeryContext);
+  fp6_sub(&t0, &t0, &t1, montgomeryContext);
+
+  CryptidStatus status = fp6_invert(&t0, &t0, montgomeryContext);
+  if (status) {
+    return status;
+  }
+
+  fp6_mul(&inverse->c0, &operand->c0, &t0, montgomeryContext);
+  fp6_mul(&inverse->c1, &operand->c1, &t0, montgomeryContext);
+  fp6_negate(&inverse->c1, &inverse->c1, montgomeryContext);
+
+  return CRYPTID_SUCCESS;
+}
+
+void fp12Element_frobeniusCoefficients(
+    ComplexFieldElement *coefficients, const mpz_t fieldOrder,
+    const MontgomeryContext *montgomeryContext) {
+  mpz_t exponent;
+  mpz_init(exponent);
+  mpz_sub_ui(exponent, fieldOrder, 1);
+  mpz_divexact_ui(exponent, exponent, 6);
+
+  mp_limb_t xiLimbs[2 * montgomeryContext->limbCount];
+  ComplexFieldElement xi = complexFieldElement_view(xiLimbs, montgomeryContext);
+  complexFieldElement_setOne(&xi, montgomeryContext);
+  fieldElement_setOne(xi.imaginary, montgomeryContext);
+
+  // \f$\gamma_1 = \xi^{\frac{p - 1}{6}}\f$ and \f$\gamma_k = \gamma_1^k\f$
+  complexFieldElement_setOne(&coefficients[0], montgomeryContext);
+  complexFieldElement_pow(&coefficients[1], &xi, exponent, montgomeryContext);
+  for (int k = 2; k < 6; ++k) {
+    complexFieldElement_mul(&coefficients[k], &coefficients[k - 1],
+                            &coefficients[1], montgomeryContext);
+  }
+
+  mpz_clear(exponent);
+}
+
+void fp12Element_frobenius(Fp12Element *result, const Fp12Element *operand,
+                           const ComplexFieldElement *coefficients,
+                           const MontgomeryContext *montgomeryContext) {
+  // The coefficient of \f$w^k\f$ is \f$c_0.c_{k / 2}\f$ for even, and
+  // \f$c_1.c_{(k - 1) / 2}\f$ for odd \f$k\f$.
+  ComplexFieldElement *even[3] = {&result->c0.c0, &result->c0.c1,
+                                  &result->c0.c2};
+  ComplexFieldElement *odd[3] = {&result->c1.c0, &result->c1.c1,
+                                 &result->c1.c2};
+  const ComplexFieldElement *evenOperand[3] = {&operand->c0.c0,
+                                               &operand->c0.c1,
+                                               &operand->c0.c2};
+  const ComplexFieldElement *oddOperand[3] = {&operand->c1.c0,
+                                              &operand->c1.c1,
+                                              &operand->c1.c2};
+
+  for (int j = 0; j < 3; ++j) {
+    complexFieldElement_conjugate(even[j], evenOperand[j], montgomeryContext);
+    complexFieldElement_mul(even[j], even[j], &coefficients[2 * j],
+                            montgomeryContext);
+
+    complexFieldElement_conjugate(odd[j], oddOperand[j], montgomeryContext);
+    complexFieldElement_mul(odd[j], odd[j], &coefficients[2 * j + 1],
+                            montgomeryContext);
+  }
+}
+
+void fp12Element_powDigits(Fp12Element *power, const Fp12Element *base,
+                           const signed char *digits, const size_t digitCount,
+                           const int windowSize,
+                           const MontgomeryContext *montgomeryContext) {
+  // Same as {@code gtElement_powDigits}.
+  const size_t n = montgomeryContext->limbCount;
+  const int tableSize = 1 << (windowSize - 2);
+  mp_limb_t tableLimbs[tableSize * 12 * n];
+  Fp12Element table[1 << (FP12ELEMENT_MAX_WINDOW_SIZE - 2)];
+  for (int i = 0; i < tableSize; i++) {
+    table[i] = fp12Element_view(tableLimbs + i * 12 * n, montgomeryContext);
+  }
+  mp_limb_t limbs[36 * n];
+  Fp12Element baseSquared = fp12Element_view(limbs, montgomeryContext);
+  Fp12Element result = fp12Element_view(limbs + 12 * n, montgomeryContext);
+  Fp12Element inverse = fp12Element_view(limbs + 24 * n, montgomeryContext);
+
+  fp12Element_copy(&table[0], base, montgomeryContext);
+  fp12Element_square(&baseSquared, base, montgomeryContext);
+  for (int i = 1; i < tableSize; i++) {
+    fp12Element_mul(&table[i], &table[i - 1], &baseSquared,
+                    montgomeryContext);
+  }
+
+  fp12Element_setOne(&result, montgomeryContext);
+
+  for (size_t i = digitCount; i-- > 0;) {
+    fp12Element_square(&result, &result, montgomeryContext);
+
+    if (digits[i] > 0) {
+      fp12Element_mul(&result, &result, &table[digits[i] / 2],
+                      montgomeryContext);
+    } else if (digits[i] < 0) {
+      fp12Element_conjugate(&inverse, &table[-digits[i] / 2],
+                            montgomeryContext);
+      fp12Element_mul(&result, &result, &inverse, montgomeryContext);
+    }
+  }
+
+  fp12Element_copy(power, &result, montgomeryContext);
+}
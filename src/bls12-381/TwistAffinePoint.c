@@ -0,0 +1,234 @@
+#include "bls12-381/TwistAffinePoint.h"
+
+static int fp2_isZero(const ComplexFieldElement *element,
+                      const MontgomeryContext *montgomeryContext) {
+  return fieldElement_isZero(element->real, montgomeryContext) &&
+         fieldElement_isZero(element->imaginary, montgomeryContext);
+}
+
+static int fp2_isEquals(const ComplexFieldElement *element1,
+                        const ComplexFieldElement *element2,
+                        const MontgomeryContext *montgomeryContext) {
+  return fieldElement_isEquals(element1->real, element2->real,
+                               montgomeryContext) &&
+         fieldElement_isEquals(element1->imaginary, element2->imaginary,
+                               montgomeryContext);
+}
+
+TwistAffinePoint twistAffine_view(mp_limb_t *limbs,
+                                  const MontgomeryContext *montgomeryContext) {
+  TwistAffinePoint point;
+
+  point.x = complexFieldElement_view(limbs, montgomeryContext);
+  point.y = complexFieldElement_view(limbs + 2 * montgomeryContext->limbCount,
+                                     montgomeryContext);
+  point.isInfinity = 1;
+
+  return point;
+}
+
+void twistAffine_copy(TwistAffinePoint *result, const TwistAffinePoint *point,
+                      const MontgomeryContext *montgomeryContext) {
+  result->isInfinity = point->isInfinity;
+  if (!point->isInfinity) {
+    complexFieldElement_copy(&result->x, &point->x, montgomeryContext);
+    complexFieldElement_copy(&result->y, &point->y, montgomeryContext);
+  }
+}
+
+int twistAffine_isEquals(const TwistAffinePoint *point1,
+                         const TwistAffinePoint *point2,
+                         const MontgomeryContext *montgomeryContext) {
+  if (point1->isInfinity || point2->isInfinity) {
+    return point1->isInfinity && point2->isInfinity;
+  }
+
+  return fp2_isEquals(&point1->x, &point2->x, montgomeryContext) &&
+         fp2_isEquals(&point1->y, &point2->y, montgomeryContext);
+}
+
+int twistAffine_isOnCurve(const TwistAffinePoint *point,
+                          const ComplexFieldElement *curveB,
+                          const MontgomeryContext *montgomeryContext) {
+  if (point->isInfinity) {
+    return 1;
+  }
+
+  // \f$y^2 = x^3 + b\f$
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[4 * n];
+  ComplexFieldElement left = complexFieldElement_view(limbs, montgomeryContext);
+  ComplexFieldElement right =
+      complexFieldElement_view(limbs + 2 * n, montgomeryContext);
+  complexFieldElement_square(&left, &point->y, montgomeryContext);
+  complexFieldElement_square(&right, &point->x, montgomeryContext);
+  complexFieldElement_mul(&right, &right, &point->x, montgomeryContext);
+  complexFieldElement_add(&right, &right, curveB, montgomeryContext);
+
+  return fp2_isEquals(&left, &right, montgomeryContext);
+}
+
+void twistAffine_negate(TwistAffinePoint *result, const TwistAffinePoint *point,
+                        const MontgomeryContext *montgomeryContext) {
+  if (result != point) {
+    twistAffine_copy(result, point, montgomeryContext);
+  }
+
+  fieldElement_negate(result->y.real, point->y.real, montgomeryContext);
+  fieldElement_negate(result->y.imaginary, point->y.imaginary,
+                      montgomeryContext);
+}
+
+CryptidStatus twistAffine_double(TwistAffinePoint *result,
+                                 ComplexFieldElement *slope,
+                                 const TwistAffinePoint *point,
+                                 const MontgomeryContext *montgomeryContext) {
+  // Doubling infinity or a point with zero \f$y\f$ coordinate yields infinity.
+  if (point->isInfinity || fp2_isZero(&point->y, montgomeryContext)) {
+    result->isInfinity = 1;
+    return CRYPTID_SUCCESS;
+  }
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[6 * n];
+  ComplexFieldElement m = complexFieldElement_view(limbs, montgomeryContext);
+  ComplexFieldElement tmp =
+      complexFieldElement_view(limbs + 2 * n, montgomeryContext);
+  ComplexFieldElement x3 =
+      complexFieldElement_view(limbs + 4 * n, montgomeryContext);
+
+  // \f$\frac{3x^{2}}{2y}\f$
+  complexFieldElement_square(&tmp, &point->x, montgomeryContext);
+  complexFieldElement_add(&m, &tmp, &tmp, montgomeryContext);
+  complexFieldElement_add(&m, &m, &tmp, montgomeryContext);
+
+  complexFieldElement_add(&tmp, &point->y, &point->y, montgomeryContext);
+  CryptidStatus status =
+      complexFieldElement_invert(&tmp, &tmp, montgomeryContext);
+  if (status) {
+    return status;
+  }
+  complexFieldElement_mul(&m, &m, &tmp, montgomeryContext);
+
+  // \f$x_3 = m^{2}-2x_1\f$
+  complexFieldElement_square(&x3, &m, montgomeryContext);
+  complexFieldElement_sub(&x3, &x3, &point->x, montgomeryContext);
+  complexFieldElement_sub(&x3, &x3, &point->x, montgomeryContext);
+
+  // \f$y_3 = m(x - x_3) - y\f$
+  complexFieldElement_sub(&tmp, &point->x, &x3, montgomeryContext);
+  complexFieldElement_mul(&tmp, &m, &tmp, montgomeryContext);
+  complexFieldElement_sub(&result->y, &tmp, &point->y, montgomeryContext);
+
+  complexFieldElement_copy(&result->x, &x3, montgomeryContext);
+  result->isInfinity = 0;
+
+  if (slope) {
+    complexFieldElement_copy(slope, &m, montgomeryContext);
+  }
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus twistAffine_add(TwistAffinePoint *result,
+                              ComplexFieldElement *slope,
+                              const TwistAffinePoint *point1,
+                              const TwistAffinePoint *point2,
+                              const MontgomeryContext *montgomeryContext) {
+  if (point1->isInfinity) {
+    twistAffine_copy(result, point2, montgomeryContext);
+    return CRYPTID_SUCCESS;
+  }
+
+  if (point2->isInfinity) {
+    twistAffine_copy(result, point1, montgomeryContext);
+    return CRYPTID_SUCCESS;
+  }
+
+  if (fp2_isEquals(&point1->x, &point2->x, montgomeryContext)) {
+    if (fp2_isEquals(&point1->y, &point2->y, montgomeryContext)) {
+      return twistAffine_double(result, slope, point1, montgomeryContext);
+    }
+
+    result->isInfinity = 1;
+    return CRYPTID_SUCCESS;
+  }
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[6 * n];
+  ComplexFieldElement m = complexFieldElement_view(limbs, montgomeryContext);
+  ComplexFieldElement tmp =
+      complexFieldElement_view(limbs + 2 * n, montgomeryContext);
+  ComplexFieldElement x3 =
+      complexFieldElement_view(limbs + 4 * n, montgomeryContext);
+
+  // \f$\frac{y_2 - y_1}{x_2 - x_1}\f$
+  complexFieldElement_sub(&tmp, &point2->x, &point1->x, montgomeryContext);
+  CryptidStatus status =
+      complexFieldElement_invert(&tmp, &tmp, montgomeryContext);
+  if (status) {
+    return status;
+  }
+  complexFieldElement_sub(&m, &point2->y, &point1->y, montgomeryContext);
+  complexFieldElement_mul(&m, &m, &tmp, montgomeryContext);
+
+  // \f$x_3 = m^{2} - x_1 - x_2\f$
+  complexFieldElement_square(&x3, &m, montgomeryContext);
+  complexFieldElement_sub(&x3, &x3, &point1->x, montgomeryContext);
+  complexFieldElement_sub(&x3, &x3, &point2->x, montgomeryContext);
+
+  // \f$y_3 = m(x_1 - x_3) - y_1\f$
+  complexFieldElement_sub(&tmp, &point1->x, &x3, montgomeryContext);
+  complexFieldElement_mul(&tmp, &m, &tmp, montgomeryContext);
+  complexFieldElement_sub(&result->y, &tmp, &point1->y, montgomeryContext);
+
+  complexFieldElement_copy(&result->x, &x3, montgomeryContext);
+  result->isInfinity = 0;
+
+  if (slope) {
+    complexFieldElement_copy(slope, &m, montgomeryContext);
+  }
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus twistAffine_multiply(TwistAffinePoint *result,
+                                   const TwistAffinePoint *point,
+                                   const mpz_t scalar,
+                                   const MontgomeryContext *montgomeryContext) {
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[8 * n];
+  TwistAffinePoint accumulator = twistAffine_view(limbs, montgomeryContext);
+
+  // \f$[-k]P = [k](-P)\f$
+  TwistAffinePoint base = *point;
+  if (mpz_sgn(scalar) < 0) {
+    base = twistAffine_view(limbs + 4 * n, montgomeryContext);
+    twistAffine_negate(&base, point, montgomeryContext);
+  }
+
+  mpz_t magnitude;
+  mpz_init(magnitude);
+  mpz_abs(magnitude, scalar);
+
+  CryptidStatus status = CRYPTID_SUCCESS;
+  for (size_t i = mpz_sizeinbase(magnitude, 2); i-- > 0 && !status;) {
+    status =
+        twistAffine_double(&accumulator, NULL, &accumulator, montgomeryContext);
+
+    if (!status && mpz_tstbit(magnitude, i)) {
+      status = twistAffine_add(&accumulator, NULL, &accumulator, &base,
+                               montgomeryContext);
+    }
+  }
+
+  mpz_clear(magnitude);
+
+  if (status) {
+    return status;
+  }
+
+  twistAffine_copy(result, &accumulator, montgomeryContext);
+
+  return CRYPTID_SUCCESS;
+}
@@ -66,19 +66,19 @@ void complex_destroyMany(const size_t argumentCount, ...) {
 
 void complex_modAdd(Complex *sum, const Complex augend, const Complex addend,
                     const mpz_t modulus) {
+  complex_init(sum);
+  complex_modAddInto(sum, &augend, &addend, modulus);
+}
+
+void complex_modAddInto(Complex *sum, const Complex *augend,
+                        const Complex *addend, const mpz_t modulus) {
   // Calculated as
   // \f$(r_1 + r_2 \mod m, i_1 + i_2 \mod m)\f$.
-  mpz_t sumReal, sumImaginary;
-  mpz_inits(sumReal, sumImaginary, NULL);
-
-  mpz_add(sumReal, augend.real, addend.real);
-  mpz_mod(sumReal, sumReal, modulus);
+  mpz_add(sum->real, augend->real, addend->real);
+  mpz_mod(sum->real, sum->real, modulus);
 
-  mpz_add(sumImaginary, augend.imaginary, addend.imaginary);
-  mpz_mod(sumImaginary, sumImaginary, modulus);
-
-  complex_initMpz(sum, sumReal, sumImaginary);
-  mpz_clears(sumReal, sumImaginary, NULL);
+  mpz_add(sum->imaginary, augend->imaginary, addend->imaginary);
+  mpz_mod(sum->imaginary, sum->imaginary, modulus);
 }
 
 void complex_additiveInverse(Complex *inverse, const Complex operand,
@@ -114,87 +114,114 @@ void complex_modAddInteger(Complex *sum, const Complex augend,
 
 void complex_modMul(Complex *product, const Complex multiplier,
                     const Complex multiplicand, const mpz_t modulus) {
-  // Calculated as
-  // \f$((r_1 \cdot r_2 - i_1 \cdot i_2) \mod m, (i_1 \cdot r_2 + r_1 \cdot i_2)
-  // \mod m)\f$.
-  mpz_t productReal, productImaginary, leftProduct, rightProduct;
-  mpz_inits(productReal, productImaginary, leftProduct, rightProduct, NULL);
-
-  mpz_mul(leftProduct, multiplier.real, multiplicand.real);
-  mpz_mul(rightProduct, multiplier.imaginary, multiplicand.imaginary);
-  mpz_sub(productReal, leftProduct, rightProduct);
-  mpz_mod(productReal, productReal, modulus);
-
-  mpz_mul(leftProduct, multiplier.imaginary, multiplicand.real);
-  mpz_mul(rightProduct, multiplier.real, multiplicand.imaginary);
-  mpz_add(productImaginary, leftProduct, rightProduct);
-  mpz_mod(productImaginary, productImaginary, modulus);
-
-  complex_initMpz(product, productReal, productImaginary);
-  mpz_clears(productReal, productImaginary, leftProduct, rightProduct, NULL);
+  complex_init(product);
+  complex_modMulInto(product, &multiplier, &multiplicand, modulus);
+}
+
+void complex_modMulInto(Complex *product, const Complex *multiplier,
+                        const Complex *multiplicand, const mpz_t modulus) {
+  // Karatsuba-style product with three multiplications instead of four:
+  // \f$((r_1 \cdot r_2 - i_1 \cdot i_2) \mod m, ((r_1 + i_1)(r_2 + i_2) - r_1
+  // \cdot r_2 - i_1 \cdot i_2) \mod m)\f$.
+  mpz_t realProduct, imaginaryProduct, sum;
+  mpz_inits(realProduct, imaginaryProduct, sum, NULL);
+
+  mpz_mul(realProduct, multiplier->real, multiplicand->real);
+  mpz_mul(imaginaryProduct, multiplier->imaginary, multiplicand->imaginary);
+  mpz_add(sum, multiplicand->real, multiplicand->imaginary);
+
+  // From here on, the operands are not read anymore, hence the product may
+  // alias them.
+  mpz_add(product->imaginary, multiplier->real, multiplier->imaginary);
+  mpz_mul(product->imaginary, product->imaginary, sum);
+  mpz_sub(product->imaginary, product->imaginary, realProduct);
+  mpz_sub(product->imaginary, product->imaginary, imaginaryProduct);
+  mpz_mod(product->imaginary, product->imaginary, modulus);
+
+  mpz_sub(product->real, realProduct, imaginaryProduct);
+  mpz_mod(product->real, product->real, modulus);
+
+  mpz_clears(realProduct, imaginaryProduct, sum, NULL);
+}
+
+void complex_modSquare(Complex *square, const Complex operand,
+                       const mpz_t modulus) {
+  complex_init(square);
+  complex_modSquareInto(square, &operand, modulus);
+}
+
+void complex_modSquareInto(Complex *square, const Complex *operand,
+                           const mpz_t modulus) {
+  // Calculated with two multiplications as
+  // \f$((r + i)(r - i) \mod m, 2 \cdot r \cdot i \mod m)\f$.
+  mpz_t product, difference;
+  mpz_inits(product, difference, NULL);
+
+  mpz_mul(product, operand->real, operand->imaginary);
+  mpz_sub(difference, operand->real, operand->imaginary);
+
+  mpz_add(square->real, operand->real, operand->imaginary);
+  mpz_mul(square->real, square->real, difference);
+  mpz_mod(square->real, square->real, modulus);
+
+  mpz_mul_2exp(square->imaginary, product, 1);
+  mpz_mod(square->imaginary, square->imaginary, modulus);
+
+  mpz_clears(product, difference, NULL);
 }
 
 void complex_modPow(Complex *power, const Complex base, const mpz_t exponent,
                     const mpz_t modulus) {
+  complex_init(power);
+  complex_modPowInto(power, &base, exponent, modulus);
+}
+
+void complex_modPowInto(Complex *power, const Complex *base,
+                        const mpz_t exponent, const mpz_t modulus) {
   if (!mpz_cmp_ui(modulus, 1)) {
-    complex_initLong(power, 0, 0);
+    mpz_set_ui(power->real, 0);
+    mpz_set_ui(power->imaginary, 0);
     return;
   }
 
-  mpz_t baseRealCopy, baseImaginaryCopy, exponentCopy, exponentRemainder;
-  mpz_inits(baseRealCopy, baseImaginaryCopy, exponentCopy, exponentRemainder,
-            NULL);
-
-  complex_initLong(power, 1, 0);
-
-  mpz_set(baseRealCopy, base.real);
-  mpz_mod(baseRealCopy, baseRealCopy, modulus);
-
-  mpz_set(baseImaginaryCopy, base.imaginary);
-  mpz_mod(baseImaginaryCopy, baseImaginaryCopy, modulus);
-
   Complex baseCopy;
-  complex_initMpz(&baseCopy, baseRealCopy, baseImaginaryCopy);
+  complex_init(&baseCopy);
+  mpz_mod(baseCopy.real, base->real, modulus);
+  mpz_mod(baseCopy.imaginary, base->imaginary, modulus);
 
-  mpz_set(exponentCopy, exponent);
+  mpz_set_ui(power->real, 1);
+  mpz_set_ui(power->imaginary, 0);
 
-  while (mpz_cmp_ui(exponentCopy, 0) > 0) {
-    mpz_mod_ui(exponentRemainder, exponentCopy, 2);
-    if (!mpz_cmp_ui(exponentRemainder, 1)) {
-      Complex tmp;
-      complex_modMul(&tmp, baseCopy, *power, modulus);
-      complex_destroy(*power);
-      *power = tmp;
-    }
-
-    mpz_fdiv_q_2exp(exponentCopy, exponentCopy, 1);
+  // Left-to-right square and multiply, non-positive exponents yield one.
+  if (mpz_sgn(exponent) > 0) {
+    for (int i = mpz_sizeinbase(exponent, 2) - 1; i >= 0; --i) {
+      complex_modSquareInto(power, power, modulus);
 
-    Complex tmp;
-    complex_modMul(&tmp, baseCopy, baseCopy, modulus);
-    complex_destroy(baseCopy);
-    baseCopy = tmp;
+      if (mpz_tstbit(exponent, i)) {
+        complex_modMulInto(power, power, &baseCopy, modulus);
+      }
+    }
   }
 
   complex_destroy(baseCopy);
-  mpz_clears(baseRealCopy, baseImaginaryCopy, exponentCopy, exponentRemainder,
-             NULL);
 }
 
 void complex_modMulInteger(Complex *product, const mpz_t multiplier,
                            const Complex multiplicand, const mpz_t modulus) {
+  complex_init(product);
+  complex_modMulIntegerInto(product, multiplier, &multiplicand, modulus);
+}
+
+void complex_modMulIntegerInto(Complex *product, const mpz_t multiplier,
+                               const Complex *multiplicand,
+                               const mpz_t modulus) {
   // Calculated as
   // \f$(r \cdot s \mod m, i \cdot s \mod m)\f$.
-  mpz_t productReal, productImaginary;
-  mpz_inits(productReal, productImaginary, NULL);
-
-  mpz_mul(productReal, multiplier, multiplicand.real);
-  mpz_mod(productReal, productReal, modulus);
-
-  mpz_mul(productImaginary, multiplier, multiplicand.imaginary);
-  mpz_mod(productImaginary, productImaginary, modulus);
+  mpz_mul(product->real, multiplier, multiplicand->real);
+  mpz_mod(product->real, product->real, modulus);
 
-  complex_initMpz(product, productReal, productImaginary);
-  mpz_clears(productReal, productImaginary, NULL);
+  mpz_mul(product->imaginary, multiplier, multiplicand->imaginary);
+  mpz_mod(product->imaginary, product->imaginary, modulus);
 }
 
 // The inverse of z is z^{-1} = \frac{1}{z} =
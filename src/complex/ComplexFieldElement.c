@@ -0,0 +1,171 @@
+#include "complex/ComplexFieldElement.h"
+
+ComplexFieldElement
+complexFieldElement_view(mp_limb_t *limbs,
+                         const MontgomeryContext *montgomeryContext) {
+  ComplexFieldElement element;
+
+  element.real = limbs;
+  element.imaginary = limbs + montgomeryContext->limbCount;
+
+  return element;
+}
+
+void complexFieldElement_fromComplex(
+    ComplexFieldElement *result, const Complex complex,
+    const MontgomeryContext *montgomeryContext) {
+  fieldElement_fromMpz(result->real, complex.real, montgomeryContext);
+  fieldElement_fromMpz(result->imaginary, complex.imaginary,
+                       montgomeryContext);
+}
+
+void complexFieldElement_toComplex(Complex *result,
+                                   const ComplexFieldElement *element,
+                                   const MontgomeryContext *montgomeryContext) {
+  complex_init(result);
+  fieldElement_toMpz(result->real, element->real, montgomeryContext);
+  fieldElement_toMpz(result->imaginary, element->imaginary,
+                     montgomeryContext);
+}
+
+void complexFieldElement_setOne(ComplexFieldElement *result,
+                                const MontgomeryContext *montgomeryContext) {
+  fieldElement_setOne(result->real, montgomeryContext);
+  fieldElement_setZero(result->imaginary, montgomeryContext);
+}
+
+void complexFieldElement_copy(ComplexFieldElement *result,
+                              const ComplexFieldElement *element,
+                              const MontgomeryContext *montgomeryContext) {
+  fieldElement_copy(result->real, element->real, montgomeryContext);
+  fieldElement_copy(result->imaginary, element->imaginary, montgomeryContext);
+}
+
+void complexFieldElement_add(ComplexFieldElement *sum,
+                             const ComplexFieldElement *augend,
+                             const ComplexFieldElement *addend,
+                             const MontgomeryContext *montgomeryContext) {
+  fieldElement_add(sum->real, augend->real, addend->real, montgomeryContext);
+  fieldElement_add(sum->imaginary, augend->imaginary, addend->imaginary,
+                   montgomeryContext);
+}
+
+void complexFieldElement_addFieldElement(
+    ComplexFieldElement *sum, const ComplexFieldElement *augend,
+    const FieldElement *addend, const MontgomeryContext *montgomeryContext) {
+  fieldElement_add(sum->real, augend->real, addend, montgomeryContext);
+  fieldElement_copy(sum->imaginary, augend->imaginary, montgomeryContext);
+}
+
+void complexFieldElement_sub(ComplexFieldElement *difference,
+                             const ComplexFieldElement *minuend,
+                             const ComplexFieldElement *subtrahend,
+                             const MontgomeryContext *montgomeryContext) {
+  fieldElement_sub(difference->real, minuend->real, subtrahend->real,
+                   montgomeryContext);
+  fieldElement_sub(difference->imaginary, minuend->imaginary,
+                   subtrahend->imaginary, montgomeryContext);
+}
+
+void complexFieldElement_mul(ComplexFieldElement *product,
+                             const ComplexFieldElement *multiplier,
+                             const ComplexFieldElement *multiplicand,
+                             const MontgomeryContext *montgomeryContext) {
+  // Karatsuba-style product with three multiplications:
+  // \f$(a + bi)(c + di) = (ac - bd) + ((a + b)(c + d) - ac - bd)i\f$
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t ac[n], bd[n], sum1[n], sum2[n];
+
+  fieldElement_mul(ac, multiplier->real, multiplicand->real,
+                   montgomeryContext);
+  fieldElement_mul(bd, multiplier->imaginary, multiplicand->imaginary,
+                   montgomeryContext);
+  fieldElement_add(sum1, multiplier->real, multiplier->imaginary,
+                   montgomeryContext);
+  fieldElement_add(sum2, multiplicand->real, multiplicand->imaginary,
+                   montgomeryContext);
+  fieldElement_mul(sum1, sum1, sum2, montgomeryContext);
+
+  fieldElement_sub(product->real, ac, bd, montgomeryContext);
+  fieldElement_sub(sum1, sum1, ac, montgomeryContext);
+  fieldElement_sub(product->imaginary, sum1, bd, montgomeryContext);
+}
+
+void complexFieldElement_square(ComplexFieldElement *square,
+                                const ComplexFieldElement *operand,
+                                const MontgomeryContext *montgomeryContext) {
+  // \f$(a + bi)^2 = (a + b)(a - b) + 2abi\f$
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t sum[n], difference[n], ab[n];
+
+  fieldElement_add(sum, operand->real, operand->imaginary, montgomeryContext);
+  fieldElement_sub(difference, operand->real, operand->imaginary,
+                   montgomeryContext);
+  fieldElement_mul(ab, operand->real, operand->imaginary, montgomeryContext);
+
+  fieldElement_mul(square->real, sum, difference, montgomeryContext);
+  fieldElement_add(square->imaginary, ab, ab, montgomeryContext);
+}
+
+void complexFieldElement_mulFieldElement(
+    ComplexFieldElement *product, const FieldElement *multiplier,
+    const ComplexFieldElement *multiplicand,
+    const MontgomeryContext *montgomeryContext) {
+  fieldElement_mul(product->real, multiplier, multiplicand->real,
+                   montgomeryContext);
+  fieldElement_mul(product->imaginary, multiplier, multiplicand->imaginary,
+                   montgomeryContext);
+}
+
+void complexFieldElement_pow(ComplexFieldElement *power,
+                             const ComplexFieldElement *base,
+                             const mpz_t exponent,
+                             const MontgomeryContext *montgomeryContext) {
+  // Left-to-right square and multiply.
+  mp_limb_t resultLimbs[2 * montgomeryContext->limbCount];
+  ComplexFieldElement result =
+      complexFieldElement_view(resultLimbs, montgomeryContext);
+  complexFieldElement_setOne(&result, montgomeryContext);
+
+  for (int i = (int)mpz_sizeinbase(exponent, 2) - 1; i >= 0; --i) {
+    complexFieldElement_square(&result, &result, montgomeryContext);
+
+    if (mpz_tstbit(exponent, i)) {
+      complexFieldElement_mul(&result, &result, base, montgomeryContext);
+    }
+  }
+
+  complexFieldElement_copy(power, &result, montgomeryContext);
+}
+
+void complexFieldElement_conjugate(ComplexFieldElement *result,
+                                   const ComplexFieldElement *operand,
+                                   const MontgomeryContext *montgomeryContext) {
+  fieldElement_copy(result->real, operand->real, montgomeryContext);
+  fieldElement_negate(result->imaginary, operand->imaginary,
+                      montgomeryContext);
+}
+
+CryptidStatus
+complexFieldElement_invert(ComplexFieldElement *inverse,
+                           const ComplexFieldElement *operand,
+                           const MontgomeryContext *montgomeryContext) {
+  // \f$(a + bi)^{-1} = \frac{a - bi}{a^2 + b^2}\f$
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t norm[n], tmp[n];
+
+  fieldElement_square(norm, operand->real, montgomeryContext);
+  fieldElement_square(tmp, operand->imaginary, montgomeryContext);
+  fieldElement_add(norm, norm, tmp, montgomeryContext);
+
+  CryptidStatus status = fieldElement_invert(norm, norm, montgomeryContext);
+  if (status) {
+    return status;
+  }
+
+  fieldElement_mul(inverse->real, operand->real, norm, montgomeryContext);
+  fieldElement_mul(tmp, operand->imaginary, norm, montgomeryContext);
+  fieldElement_negate(inverse->imaginary, tmp, montgomeryContext);
+
+  return CRYPTID_SUCCESS;
+}
@@ -0,0 +1,144 @@
+#include <stdlib.h>
+
+#include "complex/GtElement.h"
+#include "util/WindowedNaf.h"
+
+// References:
+//   * [Granger-Scott] Robert Granger and Michael Scott. 2010. Faster Squaring
+//   in the Cyclotomic Subgroup of Sixth Degree Extensions. In Public Key
+//   Cryptography - PKC 2010. Springer Berlin Heidelberg, 209-223.
+
+GtElement gtElement_view(mp_limb_t *limbs,
+                         const MontgomeryContext *montgomeryContext) {
+  GtElement element;
+  element.value = complexFieldElement_view(limbs, montgomeryContext);
+  return element;
+}
+
+void gtElement_fromComplex(GtElement *result, const Complex complex,
+                           const MontgomeryContext *montgomeryContext) {
+  complexFieldElement_fromComplex(&result->value, complex, montgomeryContext);
+}
+
+void gtElement_toComplex(Complex *result, const GtElement *element,
+                         const MontgomeryContext *montgomeryContext) {
+  complexFieldElement_toComplex(result, &element->value, montgomeryContext);
+}
+
+void gtElement_mul(GtElement *product, const GtElement *multiplier,
+                   const GtElement *multiplicand,
+                   const MontgomeryContext *montgomeryContext) {
+  complexFieldElement_mul(&product->value, &multiplier->value,
+                          &multiplicand->value, montgomeryContext);
+}
+
+void gtElement_square(GtElement *square, const GtElement *operand,
+                      const MontgomeryContext *montgomeryContext) {
+  // The degree two case of [Granger-Scott]. With \f$a^2 + b^2 = 1\f$,
+  // \f$(a + bi)^2 = (2a^2 - 1) + ((a + b)^2 - 1)i\f$.
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t aSquared[n], sumSquared[n], one[n];
+
+  fieldElement_square(aSquared, operand->value.real, montgomeryContext);
+  fieldElement_add(sumSquared, operand->value.real,
+                   operand->value.imaginary, montgomeryContext);
+  fieldElement_square(sumSquared, sumSquared, montgomeryContext);
+  fieldElement_setOne(one, montgomeryContext);
+
+  fieldElement_add(square->value.real, aSquared, aSquared,
+                   montgomeryContext);
+  fieldElement_sub(square->value.real, square->value.real, one,
+                   montgomeryContext);
+  fieldElement_sub(square->value.imaginary, sumSquared, one,
+                   montgomeryContext);
+}
+
+void gtElement_inverse(GtElement *inverse, const GtElement *operand,
+                       const MontgomeryContext *montgomeryContext) {
+  complexFieldElement_conjugate(&inverse->value, &operand->value,
+                                montgomeryContext);
+}
+
+int gtElement_windowSize(const mpz_t exponent) {
+  // A window of width \f$w\f$ costs \f$2^{w - 2}\f$ multiplications to set
+  // up, and leaves a multiplication for every \f$w + 1\f$ bits on average.
+  const size_t bitCount = mpz_sizeinbase(exponent, 2);
+
+  int windowSize = 2;
+  while (windowSize < GTELEMENT_MAX_WINDOW_SIZE &&
+         (1u << (windowSize - 1)) + bitCount / (windowSize + 2) <
+             (1u << (windowSize - 2)) + bitCount / (windowSize + 1)) {
+    windowSize++;
+  }
+
+  return windowSize;
+}
+
+void gtElement_powDigits(GtElement *power, const GtElement *base,
+                         const signed char *digits, const size_t digitCount,
+                         const int windowSize,
+                         const MontgomeryContext *montgomeryContext) {
+  // Left-to-right signed window exponentiation with the odd powers
+  // \f$b, b^3, \ldots, b^{2^{w - 1} - 1}\f$. The negative powers are the
+  // conjugates of these.
+  const size_t n = montgomeryContext->limbCount;
+  const int tableSize = 1 << (windowSize - 2);
+  mp_limb_t tableLimbs[tableSize * 2 * n], limbs[6 * n];
+  GtElement table[1 << (GTELEMENT_MAX_WINDOW_SIZE - 2)];
+  for (int i = 0; i < tableSize; i++) {
+    table[i] = gtElement_view(tableLimbs + i * 2 * n, montgomeryContext);
+  }
+  GtElement baseSquared = gtElement_view(limbs, montgomeryContext);
+  GtElement result = gtElement_view(limbs + 2 * n, montgomeryContext);
+  GtElement inverse = gtElement_view(limbs + 4 * n, montgomeryContext);
+
+  complexFieldElement_copy(&table[0].value, &base->value, montgomeryContext);
+  gtElement_square(&baseSquared, base, montgomeryContext);
+  for (int i = 1; i < tableSize; i++) {
+    gtElement_mul(&table[i], &table[i - 1], &baseSquared, montgomeryContext);
+  }
+
+  complexFieldElement_setOne(&result.value, montgomeryContext);
+
+  for (size_t i = digitCount; i-- > 0;) {
+    gtElement_square(&result, &result, montgomeryContext);
+
+    if (digits[i] > 0) {
+      gtElement_mul(&result, &result, &table[digits[i] / 2],
+                    montgomeryContext);
+    } else if (digits[i] < 0) {
+      gtElement_inverse(&inverse, &table[-digits[i] / 2], montgomeryContext);
+      gtElement_mul(&result, &result, &inverse, montgomeryContext);
+    }
+  }
+
+  complexFieldElement_copy(&power->value, &result.value, montgomeryContext);
+}
+
+void gtElement_pow(GtElement *power, const GtElement *base,
+                   const mpz_t exponent,
+                   const MontgomeryContext *montgomeryContext) {
+  // \f$b^{-e} = \bar{b}^e\f$
+  mp_limb_t actualBaseLimbs[2 * montgomeryContext->limbCount];
+  GtElement actualBase = *base;
+  if (mpz_sgn(exponent) < 0) {
+    actualBase = gtElement_view(actualBaseLimbs, montgomeryContext);
+    gtElement_inverse(&actualBase, base, montgomeryContext);
+  }
+
+  mpz_t absoluteExponent;
+  mpz_init(absoluteExponent);
+  mpz_abs(absoluteExponent, exponent);
+
+  const int windowSize = gtElement_windowSize(absoluteExponent);
+  signed char *digits =
+      (signed char *)malloc(windowedNaf_maxLength(absoluteExponent));
+  const size_t digitCount =
+      windowedNaf_recode(digits, absoluteExponent, windowSize);
+
+  gtElement_powDigits(power, &actualBase, digits, digitCount, windowSize,
+                      montgomeryContext);
+
+  free(digits);
+  mpz_clear(absoluteExponent);
+}
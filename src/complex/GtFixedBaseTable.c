@@ -0,0 +1,135 @@
+#include <stdlib.h>
+
+#include "complex/GtFixedBaseTable.h"
+#include "field/FieldElement.h"
+
+// References:
+//   * [Guide-to-ECC] Darrel Hankerson, Alfred J. Menezes, and Scott Vanstone.
+//   2010. Guide to Elliptic Curve Cryptography (1st ed.). Springer Publishing
+//   Company, Incorporated.
+
+CryptidStatus gtFixedBaseTable_init(GtFixedBaseTable *tableOutput,
+                                    const Complex base, const mpz_t order,
+                                    const int windowSize,
+                                    const mpz_t fieldOrder) {
+  MontgomeryContext *montgomeryContext = &tableOutput->montgomeryContext;
+  montgomeryContext_init(montgomeryContext, fieldOrder);
+
+  CryptidStatus status = fieldElement_checkSupported(montgomeryContext);
+  if (status) {
+    montgomeryContext_destroy(*montgomeryContext);
+    return status;
+  }
+
+  int w = windowSize;
+  if (w < 1) {
+    w = 1;
+  } else if (w > GT_FIXED_BASE_MAX_WINDOW_SIZE) {
+    w = GT_FIXED_BASE_MAX_WINDOW_SIZE;
+  }
+
+  // The comb covers \f$w \cdot d \geq t\f$ bits, where \f$t\f$ is the length
+  // of the order.
+  int orderLength = (int)mpz_sizeinbase(order, 2);
+  int d = (orderLength + w - 1) / w;
+
+  mpz_init_set(tableOutput->order, order);
+  tableOutput->windowSize = w;
+  tableOutput->spacing = d;
+
+  size_t tableSize = ((size_t)1 << w) - 1;
+  const size_t n = montgomeryContext->limbCount;
+  tableOutput->elementLimbs =
+      (mp_limb_t *)malloc(tableSize * 2 * n * sizeof(mp_limb_t));
+  tableOutput->elements = (GtElement *)malloc(tableSize * sizeof(GtElement));
+  for (size_t j = 0; j < tableSize; ++j) {
+    tableOutput->elements[j] = gtElement_view(
+        tableOutput->elementLimbs + j * 2 * n, montgomeryContext);
+  }
+
+  // The teeth \f$g^{2^{id}}\f$ for \f$i = 0, \ldots, w - 1\f$.
+  mp_limb_t *teethLimbs =
+      (mp_limb_t *)malloc(w * 2 * n * sizeof(mp_limb_t));
+  GtElement *teeth = (GtElement *)malloc(w * sizeof(GtElement));
+  for (int i = 0; i < w; ++i) {
+    teeth[i] = gtElement_view(teethLimbs + i * 2 * n, montgomeryContext);
+  }
+  gtElement_fromComplex(&teeth[0], base, montgomeryContext);
+
+  for (int i = 1; i < w; ++i) {
+    complexFieldElement_copy(&teeth[i].value, &teeth[i - 1].value,
+                             montgomeryContext);
+    for (int j = 0; j < d; ++j) {
+      gtElement_square(&teeth[i], &teeth[i], montgomeryContext);
+    }
+  }
+
+  // Entry \f$j\f$ is obtained from the entry without its highest bit by
+  // multiplying with the corresponding tooth.
+  for (size_t j = 1; j <= tableSize; ++j) {
+    int highestBit = 0;
+    while ((j >> (highestBit + 1)) != 0) {
+      highestBit++;
+    }
+
+    size_t rest = j ^ ((size_t)1 << highestBit);
+    if (rest == 0) {
+      complexFieldElement_copy(&tableOutput->elements[j - 1].value,
+                               &teeth[highestBit].value, montgomeryContext);
+    } else {
+      gtElement_mul(&tableOutput->elements[j - 1],
+                    &tableOutput->elements[rest - 1], &teeth[highestBit],
+                    montgomeryContext);
+    }
+  }
+
+  free(teeth);
+  free(teethLimbs);
+
+  return CRYPTID_SUCCESS;
+}
+
+void gtFixedBaseTable_destroy(GtFixedBaseTable table) {
+  free(table.elements);
+  free(table.elementLimbs);
+  mpz_clear(table.order);
+  montgomeryContext_destroy(table.montgomeryContext);
+}
+
+void gtElement_fixedBasePow(Complex *result, const GtFixedBaseTable *table,
+                            const mpz_t exponent) {
+  // Implementation of Algorithm 3.44 in [Guide-to-ECC], written
+  // multiplicatively.
+  const MontgomeryContext *montgomeryContext = &table->montgomeryContext;
+
+  mpz_t k;
+  mpz_init(k);
+  mpz_mod(k, exponent, table->order);
+
+  // \f$Q = 1\f$
+  mp_limb_t qLimbs[2 * montgomeryContext->limbCount];
+  GtElement q = gtElement_view(qLimbs, montgomeryContext);
+  complexFieldElement_setOne(&q.value, montgomeryContext);
+
+  for (int column = table->spacing - 1; column >= 0; column--) {
+    // \f$Q = Q^2\f$
+    gtElement_square(&q, &q, montgomeryContext);
+
+    // \f$K^{column} = (K_{w - 1}^{column}, \ldots, K_0^{column})\f$, the
+    // bits of the exponent under the teeth of the comb.
+    size_t index = 0;
+    for (int tooth = table->windowSize - 1; tooth >= 0; tooth--) {
+      index = (index << 1) |
+              mpz_tstbit(k, (mp_bitcnt_t)tooth * table->spacing + column);
+    }
+
+    // \f$Q = Q \cdot G[K^{column}]\f$
+    if (index != 0) {
+      gtElement_mul(&q, &q, &table->elements[index - 1], montgomeryContext);
+    }
+  }
+
+  mpz_clear(k);
+
+  gtElement_toComplex(result, &q, montgomeryContext);
+}
@@ -0,0 +1,191 @@
+#include <stdlib.h>
+
+#include "elliptic/AffineFixedBaseTable.h"
+#include "elliptic/JacobianPoint.h"
+
+// References:
+//   * [Guide-to-ECC] Darrel Hankerson, Alfred J. Menezes, and Scott Vanstone.
+//   2010. Guide to Elliptic Curve Cryptography (1st ed.). Springer Publishing
+//   Company, Incorporated.
+
+CryptidStatus affineFixedBaseTable_init(AffineFixedBaseTable *tableOutput,
+                                        const AffinePoint basePoint,
+                                        const mpz_t order, const int windowSize,
+                                        const EllipticCurve ellipticCurve) {
+  MontgomeryContext *montgomeryContext = &tableOutput->montgomeryContext;
+  montgomeryContext_init(montgomeryContext, ellipticCurve.fieldOrder);
+
+  CryptidStatus status = fieldElement_checkSupported(montgomeryContext);
+  if (status) {
+    montgomeryContext_destroy(*montgomeryContext);
+    return status;
+  }
+
+  int w = windowSize;
+  if (w < 1) {
+    w = 1;
+  } else if (w > AFFINE_FIXED_BASE_MAX_WINDOW_SIZE) {
+    w = AFFINE_FIXED_BASE_MAX_WINDOW_SIZE;
+  }
+
+  // The comb covers \f$w \cdot d \geq t\f$ bits, where \f$t\f$ is the length
+  // of the order.
+  int orderLength = (int)mpz_sizeinbase(order, 2);
+  int d = (orderLength + w - 1) / w;
+
+  mpz_init_set(tableOutput->order, order);
+  tableOutput->windowSize = w;
+  tableOutput->spacing = d;
+
+  size_t tableSize = ((size_t)1 << w) - 1;
+  const size_t n = montgomeryContext->limbCount;
+
+  tableOutput->limbs =
+      (mp_limb_t *)malloc((1 + 2 * tableSize) * n * sizeof(mp_limb_t));
+  tableOutput->curveA = tableOutput->limbs;
+  tableOutput->points =
+      (FieldAffinePoint *)malloc(tableSize * sizeof(FieldAffinePoint));
+  for (size_t j = 0; j < tableSize; ++j) {
+    tableOutput->points[j] = fieldAffine_view(
+        tableOutput->limbs + (1 + 2 * j) * n, montgomeryContext);
+  }
+
+  fieldElement_fromMpz(tableOutput->curveA, ellipticCurve.a,
+                       montgomeryContext);
+
+  // The teeth \f$2^{id}P\f$ for \f$i = 0, \ldots, w - 1\f$. The scratch
+  // storage holds the Jacobian teeth and entries, then the affine teeth.
+  mp_limb_t *scratch = (mp_limb_t *)malloc(
+      (3 * w + 3 * tableSize + 2 * w) * n * sizeof(mp_limb_t));
+  JacobianPoint *teeth = (JacobianPoint *)malloc(w * sizeof(JacobianPoint));
+  FieldAffinePoint *affineTeeth =
+      (FieldAffinePoint *)malloc(w * sizeof(FieldAffinePoint));
+  JacobianPoint *entries =
+      (JacobianPoint *)malloc(tableSize * sizeof(JacobianPoint));
+  for (int i = 0; i < w; ++i) {
+    teeth[i] = jacobian_view(scratch + 3 * i * n, montgomeryContext);
+    affineTeeth[i] = fieldAffine_view(
+        scratch + (3 * w + 3 * tableSize + 2 * i) * n, montgomeryContext);
+  }
+  for (size_t j = 0; j < tableSize; ++j) {
+    entries[j] = jacobian_view(scratch + (3 * w + 3 * j) * n,
+                               montgomeryContext);
+  }
+
+  mp_limb_t fieldPointLimbs[2 * n];
+  FieldAffinePoint fieldPoint =
+      fieldAffine_view(fieldPointLimbs, montgomeryContext);
+  fieldAffine_fromAffinePoint(&fieldPoint, basePoint, montgomeryContext);
+  jacobian_fromFieldAffinePoint(&teeth[0], &fieldPoint, montgomeryContext);
+
+  for (int i = 1; i < w; ++i) {
+    jacobian_copy(&teeth[i], &teeth[i - 1], montgomeryContext);
+    for (int j = 0; j < d; ++j) {
+      jacobian_double(&teeth[i], &teeth[i], tableOutput->curveA,
+                      montgomeryContext);
+    }
+  }
+
+  status = jacobian_toFieldAffinePoints(affineTeeth, teeth, w,
+                                        montgomeryContext);
+  if (status) {
+    free(scratch);
+    free(teeth);
+    free(affineTeeth);
+    free(entries);
+    affineFixedBaseTable_destroy(*tableOutput);
+    return status;
+  }
+
+  // Entry \f$j\f$ is obtained from the entry without its highest bit by
+  // adding the corresponding tooth.
+  for (size_t j = 1; j <= tableSize; ++j) {
+    int highestBit = 0;
+    while ((j >> (highestBit + 1)) != 0) {
+      highestBit++;
+    }
+
+    size_t rest = j ^ ((size_t)1 << highestBit);
+    if (rest == 0) {
+      jacobian_fromFieldAffinePoint(&entries[j - 1], &affineTeeth[highestBit],
+                                    montgomeryContext);
+    } else {
+      jacobian_addMixed(&entries[j - 1], &entries[rest - 1],
+                        &affineTeeth[highestBit], tableOutput->curveA,
+                        montgomeryContext);
+    }
+  }
+
+  status = jacobian_toFieldAffinePoints(tableOutput->points, entries,
+                                        tableSize, montgomeryContext);
+
+  free(scratch);
+  free(teeth);
+  free(affineTeeth);
+  free(entries);
+
+  if (status) {
+    affineFixedBaseTable_destroy(*tableOutput);
+    return status;
+  }
+
+  return CRYPTID_SUCCESS;
+}
+
+void affineFixedBaseTable_destroy(AffineFixedBaseTable table) {
+  free(table.points);
+  free(table.limbs);
+  mpz_clear(table.order);
+  montgomeryContext_destroy(table.montgomeryContext);
+}
+
+CryptidStatus affine_fixedBaseMultiply(AffinePoint *result,
+                                       const AffineFixedBaseTable *table,
+                                       const mpz_t s) {
+  // Implementation of Algorithm 3.44 in [Guide-to-ECC], carried out in
+  // Jacobian coordinates.
+  const MontgomeryContext *montgomeryContext = &table->montgomeryContext;
+
+  mpz_t k;
+  mpz_init(k);
+  mpz_mod(k, s, table->order);
+
+  // \f$Q = \infty\f$
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t pointQLimbs[3 * n];
+  JacobianPoint pointQ = jacobian_view(pointQLimbs, montgomeryContext);
+  jacobian_setInfinity(&pointQ, montgomeryContext);
+
+  for (int column = table->spacing - 1; column >= 0; column--) {
+    // \f$Q = 2Q\f$
+    jacobian_double(&pointQ, &pointQ, table->curveA, montgomeryContext);
+
+    // \f$K^{column} = (K_{w - 1}^{column}, \ldots, K_0^{column})\f$, the
+    // bits of the scalar under the teeth of the comb.
+    size_t index = 0;
+    for (int tooth = table->windowSize - 1; tooth >= 0; tooth--) {
+      index = (index << 1) |
+              mpz_tstbit(k, (mp_bitcnt_t)tooth * table->spacing + column);
+    }
+
+    // \f$Q = Q + P[K^{column}]\f$
+    if (index != 0) {
+      jacobian_addMixed(&pointQ, &pointQ, &table->points[index - 1],
+                        table->curveA, montgomeryContext);
+    }
+  }
+
+  mpz_clear(k);
+
+  mp_limb_t affineQLimbs[2 * n];
+  FieldAffinePoint affineQ = fieldAffine_view(affineQLimbs, montgomeryContext);
+  CryptidStatus status =
+      jacobian_toFieldAffinePoint(&affineQ, &pointQ, montgomeryContext);
+  if (status) {
+    return status;
+  }
+
+  fieldAffine_toAffinePoint(result, &affineQ, montgomeryContext);
+
+  return CRYPTID_SUCCESS;
+}
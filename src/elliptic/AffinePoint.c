@@ -2,6 +2,11 @@
 #include <string.h>
 
 #include "elliptic/AffinePoint.h"
+#include "elliptic/FieldAffinePoint.h"
+#include "elliptic/JacobianPoint.h"
+#include "field/FieldElement.h"
+#include "field/MontgomeryContext.h"
+#include "util/WindowedNaf.h"
 
 // References:
 //   * [Guide-to-ECC] Darrel Hankerson, Alfred J. Menezes, and Scott Vanstone.
@@ -15,6 +20,7 @@ void affine_init(AffinePoint *affinePointOutput, const mpz_t x, const mpz_t y) {
   mpz_inits(affinePointOutput->x, affinePointOutput->y, NULL);
   mpz_set(affinePointOutput->x, x);
   mpz_set(affinePointOutput->y, y);
+  affinePointOutput->isInfinity = !mpz_cmp_si(x, -1) && !mpz_cmp_si(y, -1);
 }
 
 void affine_initLong(AffinePoint *affinePointOutput, const long x,
@@ -22,6 +28,7 @@ void affine_initLong(AffinePoint *affinePointOutput, const long x,
   mpz_inits(affinePointOutput->x, affinePointOutput->y, NULL);
   mpz_set_si(affinePointOutput->x, x);
   mpz_set_si(affinePointOutput->y, y);
+  affinePointOutput->isInfinity = x == -1 && y == -1;
 }
 
 void affine_destroy(AffinePoint affinePoint) {
@@ -47,67 +54,88 @@ int affine_isEquals(const AffinePoint affinePoint1,
 }
 
 int affine_isInfinity(const AffinePoint affinePoint) {
-  AffinePoint infty = affine_infinity();
+  return affinePoint.isInfinity;
+}
 
-  int result = affine_isEquals(infty, affinePoint);
-  affine_destroy(infty);
+void affine_negate(AffinePoint *result, const AffinePoint affinePoint,
+                   const EllipticCurve ellipticCurve) {
+  if (affinePoint.isInfinity) {
+    *result = affine_infinity();
+    return;
+  }
 
-  return result;
+  mpz_t y;
+  mpz_init(y);
+  mpz_neg(y, affinePoint.y);
+  mpz_mod(y, y, ellipticCurve.fieldOrder);
+
+  affine_init(result, affinePoint.x, y);
+
+  mpz_clear(y);
 }
 
 CryptidStatus affine_double(AffinePoint *result, const AffinePoint affinePoint,
                             const EllipticCurve ellipticCurve) {
-  // Double-only implementation of Algorithm 3.1 in [Intro-to-IBE].
+  mpz_inits(result->x, result->y, NULL);
 
-  // Doubling infinity yields infinity.
-  if (affine_isInfinity(affinePoint)) {
-    *result = affine_infinity();
-    return CRYPTID_SUCCESS;
+  CryptidStatus status = affine_doubleInto(result, &affinePoint, ellipticCurve);
+  if (status) {
+    affine_destroy(*result);
   }
 
-  mpz_t x1PowTwo, threex1PowTwo, num, y1MulTwo, denom, numMulDenom, m, mPowTwo,
-      mPowTwoSubx1, x3, x1Subx3, mMulx1Subx3, y3;
+  return status;
+}
+
+static void affine_setInfinity(AffinePoint *result) {
+  mpz_set_si(result->x, -1);
+  mpz_set_si(result->y, -1);
+  result->isInfinity = 1;
+}
 
-  // If the \f$y\f$ coordinate is equal to zero, then the result is infinity.
-  if (!mpz_cmp_ui(affinePoint.y, 0)) {
-    *result = affine_infinity();
+CryptidStatus affine_doubleInto(AffinePoint *result,
+                                const AffinePoint *affinePoint,
+                                const EllipticCurve ellipticCurve) {
+  // Double-only implementation of Algorithm 3.1 in [Intro-to-IBE].
+
+  // Doubling infinity yields infinity. If the \f$y\f$ coordinate is equal to
+  // zero, then the result is infinity as well.
+  if (affine_isInfinity(*affinePoint) || !mpz_sgn(affinePoint->y)) {
+    affine_setInfinity(result);
     return CRYPTID_SUCCESS;
   }
 
-  mpz_inits(x1PowTwo, threex1PowTwo, num, y1MulTwo, denom, numMulDenom, m,
-            mPowTwo, mPowTwoSubx1, x3, x1Subx3, mMulx1Subx3, y3, NULL);
+  mpz_t m, tmp, x3;
+  mpz_inits(m, tmp, x3, NULL);
 
   // See Equation 3.4 in [Intro-to-IBE].
   // \f$\frac{3x^{2} + a}{2y}
-  mpz_powm_ui(x1PowTwo, affinePoint.x, 2, ellipticCurve.fieldOrder);
-  mpz_mul_ui(threex1PowTwo, x1PowTwo, 3);
-  mpz_add(num, threex1PowTwo, ellipticCurve.a);
+  mpz_mul(tmp, affinePoint->x, affinePoint->x);
+  mpz_mul_ui(tmp, tmp, 3);
+  mpz_add(tmp, tmp, ellipticCurve.a);
 
-  mpz_mul_ui(y1MulTwo, affinePoint.y, 2);
-  mpz_invert(denom, y1MulTwo, ellipticCurve.fieldOrder);
+  mpz_mul_2exp(m, affinePoint->y, 1);
+  mpz_invert(m, m, ellipticCurve.fieldOrder);
 
-  mpz_mul(numMulDenom, num, denom);
-  mpz_mod(m, numMulDenom, ellipticCurve.fieldOrder);
+  mpz_mul(m, m, tmp);
+  mpz_mod(m, m, ellipticCurve.fieldOrder);
 
-  // Same as in {@code affine_add}.
+  // Same as in {@code affine_addInto}.
   // \f$x_3 = m^{2}-2x_1\f$
-  mpz_powm_ui(mPowTwo, m, 2, ellipticCurve.fieldOrder);
-  mpz_sub(mPowTwoSubx1, mPowTwo, affinePoint.x);
-  mpz_mod(mPowTwoSubx1, mPowTwoSubx1, ellipticCurve.fieldOrder);
-  mpz_sub(x3, mPowTwoSubx1, affinePoint.x);
+  mpz_mul(x3, m, m);
+  mpz_sub(x3, x3, affinePoint->x);
+  mpz_sub(x3, x3, affinePoint->x);
   mpz_mod(x3, x3, ellipticCurve.fieldOrder);
 
   // \f$y_3 = m(x - x_3) - y\f$
-  mpz_sub(x1Subx3, affinePoint.x, x3);
-  mpz_mod(x1Subx3, x1Subx3, ellipticCurve.fieldOrder);
-  mpz_mul(mMulx1Subx3, m, x1Subx3);
-  mpz_sub(y3, mMulx1Subx3, affinePoint.y);
-  mpz_mod(y3, y3, ellipticCurve.fieldOrder);
+  mpz_sub(tmp, affinePoint->x, x3);
+  mpz_mul(tmp, m, tmp);
+  mpz_sub(result->y, tmp, affinePoint->y);
+  mpz_mod(result->y, result->y, ellipticCurve.fieldOrder);
 
-  affine_init(result, x3, y3);
+  mpz_swap(result->x, x3);
+  result->isInfinity = 0;
 
-  mpz_clears(x1PowTwo, threex1PowTwo, num, y1MulTwo, denom, numMulDenom, m,
-             mPowTwo, mPowTwoSubx1, x3, x1Subx3, mMulx1Subx3, y3, NULL);
+  mpz_clears(m, tmp, x3, NULL);
 
   return CRYPTID_SUCCESS;
 }
@@ -115,291 +143,465 @@ CryptidStatus affine_double(AffinePoint *result, const AffinePoint affinePoint,
 CryptidStatus affine_add(AffinePoint *result, const AffinePoint affinePoint1,
                          const AffinePoint affinePoint2,
                          const EllipticCurve ellipticCurve) {
-  // Implementation of Algorithm 3.1 in [Intro-to-IBE].
+  mpz_inits(result->x, result->y, NULL);
 
-  mpz_t m, num, denom, numMulDenom, y2Suby1, x2Subx1, x2Subx1Mod, x3, y3,
-      mPowTwo, mPowTwoSubx1, x1Subx3, mMulx1Subx3;
+  CryptidStatus status =
+      affine_addInto(result, &affinePoint1, &affinePoint2, ellipticCurve);
+  if (status) {
+    affine_destroy(*result);
+  }
+
+  return status;
+}
+
+CryptidStatus affine_addInto(AffinePoint *result,
+                             const AffinePoint *affinePoint1,
+                             const AffinePoint *affinePoint2,
+                             const EllipticCurve ellipticCurve) {
+  // Implementation of Algorithm 3.1 in [Intro-to-IBE].
 
   // Adding infinity to a point does not change the point.
-  if (affine_isInfinity(affinePoint1)) {
-    affine_init(result, affinePoint2.x, affinePoint2.y);
+  if (affine_isInfinity(*affinePoint1)) {
+    mpz_set(result->x, affinePoint2->x);
+    mpz_set(result->y, affinePoint2->y);
+    result->isInfinity = affinePoint2->isInfinity;
     return CRYPTID_SUCCESS;
   }
 
-  if (affine_isInfinity(affinePoint2)) {
-    affine_init(result, affinePoint1.x, affinePoint1.y);
+  if (affine_isInfinity(*affinePoint2)) {
+    mpz_set(result->x, affinePoint1->x);
+    mpz_set(result->y, affinePoint1->y);
+    result->isInfinity = 0;
     return CRYPTID_SUCCESS;
   }
 
-  mpz_inits(m, num, denom, numMulDenom, y2Suby1, x2Subx1, x2Subx1Mod, x3, y3,
-            mPowTwo, mPowTwoSubx1, x1Subx3, mMulx1Subx3, NULL);
-
   // If the points are equal to each other, we can speed things up
   // by performing a point doubling instead of an addition.
-  if (affine_isEquals(affinePoint1, affinePoint2)) {
-    mpz_clears(m, num, denom, numMulDenom, y2Suby1, x2Subx1, x2Subx1Mod, x3, y3,
-               mPowTwo, mPowTwoSubx1, x1Subx3, mMulx1Subx3, NULL);
-    CryptidStatus status = affine_double(result, affinePoint1, ellipticCurve);
-    return status;
+  if (affine_isEquals(*affinePoint1, *affinePoint2)) {
+    return affine_doubleInto(result, affinePoint1, ellipticCurve);
   }
 
   // Having equal \f$x\f$ coordinates (and different points) a divide-by-zero
   // error would happen, thus we return infinity. Note, that in the algorithm,
   // this check is the first step, however, that's wrong.
-  if (!mpz_cmp(affinePoint1.x, affinePoint2.x)) {
-    mpz_clears(m, num, denom, numMulDenom, y2Suby1, x2Subx1, x2Subx1Mod, x3, y3,
-               mPowTwo, mPowTwoSubx1, x1Subx3, mMulx1Subx3, NULL);
-    *result = affine_infinity();
+  if (!mpz_cmp(affinePoint1->x, affinePoint2->x)) {
+    affine_setInfinity(result);
     return CRYPTID_SUCCESS;
   }
 
-  // \f$\frac{y_2 - y_1}{x_2 - x_1}\f$
-  mpz_sub(y2Suby1, affinePoint2.y, affinePoint1.y);
-  mpz_mod(num, y2Suby1, ellipticCurve.fieldOrder);
+  mpz_t m, tmp, x3;
+  mpz_inits(m, tmp, x3, NULL);
 
-  mpz_sub(x2Subx1, affinePoint2.x, affinePoint1.x);
-  mpz_mod(x2Subx1Mod, x2Subx1, ellipticCurve.fieldOrder);
-  mpz_invert(denom, x2Subx1Mod, ellipticCurve.fieldOrder);
+  // \f$\frac{y_2 - y_1}{x_2 - x_1}\f$
+  mpz_sub(tmp, affinePoint2->x, affinePoint1->x);
+  mpz_mod(tmp, tmp, ellipticCurve.fieldOrder);
+  mpz_invert(tmp, tmp, ellipticCurve.fieldOrder);
 
-  mpz_mul(numMulDenom, num, denom);
-  mpz_mod(m, numMulDenom, ellipticCurve.fieldOrder);
+  mpz_sub(m, affinePoint2->y, affinePoint1->y);
+  mpz_mul(m, m, tmp);
+  mpz_mod(m, m, ellipticCurve.fieldOrder);
 
   // \f$x_3 = m^{2}-x_1-x_2\f$
-  mpz_powm_ui(mPowTwo, m, 2, ellipticCurve.fieldOrder);
-  mpz_sub(mPowTwoSubx1, mPowTwo, affinePoint1.x);
-  mpz_sub(x3, mPowTwoSubx1, affinePoint2.x);
+  mpz_mul(x3, m, m);
+  mpz_sub(x3, x3, affinePoint1->x);
+  mpz_sub(x3, x3, affinePoint2->x);
   mpz_mod(x3, x3, ellipticCurve.fieldOrder);
 
   // \f$y_3 = m(x_1 - x_3) - y_1\f$
-  mpz_sub(x1Subx3, affinePoint1.x, x3);
-  mpz_mul(mMulx1Subx3, m, x1Subx3);
-  mpz_sub(y3, mMulx1Subx3, affinePoint1.y);
-  mpz_mod(y3, y3, ellipticCurve.fieldOrder);
+  mpz_sub(tmp, affinePoint1->x, x3);
+  mpz_mul(tmp, m, tmp);
+  mpz_sub(result->y, tmp, affinePoint1->y);
+  mpz_mod(result->y, result->y, ellipticCurve.fieldOrder);
 
-  affine_init(result, x3, y3);
+  mpz_swap(result->x, x3);
+  result->isInfinity = 0;
 
-  mpz_clears(m, num, denom, numMulDenom, y2Suby1, x2Subx1, x2Subx1Mod, x3, y3,
-             mPowTwo, mPowTwoSubx1, x1Subx3, mMulx1Subx3, NULL);
+  mpz_clears(m, tmp, x3, NULL);
 
   return CRYPTID_SUCCESS;
 }
 
-static CryptidStatus affine_multiply(AffinePoint *result,
-                                     const AffinePoint affinePoint,
-                                     const mpz_t s,
-                                     const EllipticCurve ellipticCurve) {
-  // Implementation of Algorithm 3.26 in [Guide-to-ECC].
+static int affine_wNAFWindowSize(const size_t bitLength) {
+  // A window of width \f$w\f$ costs \f$2^{w - 2}\f$ table additions and
+  // saves additions in the main loop, as the density of the nonzero digits is
+  // \f$\frac{1}{w + 1}\f$. The thresholds below are the crossover points of the
+  // two, counting a table entry somewhat more expensive than an addition due to
+  // its normalization.
+  static const size_t thresholds[] = {16, 52, 156, 437, 1165, 2995};
+
+  int windowSize = 2;
+  for (size_t i = 0; i < sizeof(thresholds) / sizeof(thresholds[0]); i++) {
+    if (bitLength < thresholds[i]) {
+      break;
+    }
+    windowSize++;
+  }
 
-  // Multiplication by zero yields infinity.
-  if (!mpz_cmp_ui(s, 0)) {
-    *result = affine_infinity();
+  return windowSize;
+}
+
+static CryptidStatus
+affine_wNAFPrecompute(FieldAffinePoint *preCalculatedPoints,
+                      const size_t tableSize, const FieldAffinePoint *point,
+                      const FieldElement *curveA,
+                      const MontgomeryContext *montgomeryContext) {
+  // Precomputation of the odd multiples \f$P, 3P, 5P, \ldots, (2^{w-1}-1)P\f$,
+  // each one obtained from the previous by adding \f$2P\f$. The negative
+  // multiples are negated on the fly.
+  fieldAffine_copy(&preCalculatedPoints[0], point, montgomeryContext);
+  if (tableSize == 1) {
     return CRYPTID_SUCCESS;
   }
 
-  // Multiplying infinity yields infinity.
-  if (affine_isInfinity(affinePoint)) {
+  // \f$2P\f$, normalized so that it can be used in mixed additions.
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t doubledLimbs[3 * n], twoPLimbs[2 * n];
+  JacobianPoint doubled = jacobian_view(doubledLimbs, montgomeryContext);
+  FieldAffinePoint twoP = fieldAffine_view(twoPLimbs, montgomeryContext);
+  jacobian_fromFieldAffinePoint(&doubled, point, montgomeryContext);
+  jacobian_double(&doubled, &doubled, curveA, montgomeryContext);
+  CryptidStatus status =
+      jacobian_toFieldAffinePoint(&twoP, &doubled, montgomeryContext);
+  if (status) {
+    return status;
+  }
+
+  // The table is kept on the heap, as it would be a considerable chunk of the
+  // stack on constrained targets.
+  mp_limb_t *jacobianLimbs =
+      (mp_limb_t *)malloc(3 * tableSize * n * sizeof(mp_limb_t));
+  JacobianPoint *jacobianPoints =
+      (JacobianPoint *)malloc(tableSize * sizeof(JacobianPoint));
+  for (size_t i = 0; i < tableSize; i++) {
+    jacobianPoints[i] =
+        jacobian_view(jacobianLimbs + 3 * i * n, montgomeryContext);
+  }
+  jacobian_fromFieldAffinePoint(&jacobianPoints[0], point, montgomeryContext);
+  for (size_t i = 1; i < tableSize; i++) {
+    jacobian_addMixed(&jacobianPoints[i], &jacobianPoints[i - 1], &twoP,
+                      curveA, montgomeryContext);
+  }
+
+  // A single inversion normalizes the whole table.
+  status = jacobian_toFieldAffinePoints(preCalculatedPoints + 1,
+                                        jacobianPoints + 1, tableSize - 1,
+                                        montgomeryContext);
+  free(jacobianPoints);
+  free(jacobianLimbs);
+
+  return status;
+}
+
+static void affine_wNAFAddDigit(JacobianPoint *pointQ,
+                                const FieldAffinePoint *preCalculatedPoints,
+                                const int digit, const FieldElement *curveA,
+                                const MontgomeryContext *montgomeryContext) {
+  // The digit \f$k\f$ selects \f$|k| \cdot P\f$ at index \f$(|k| - 1) / 2\f$.
+  if (digit > 0) {
+    jacobian_addMixed(pointQ, pointQ, &preCalculatedPoints[digit / 2], curveA,
+                      montgomeryContext);
+  } else if (digit < 0) {
+    mp_limb_t negatedPointLimbs[2 * montgomeryContext->limbCount];
+    FieldAffinePoint negatedPoint =
+        fieldAffine_view(negatedPointLimbs, montgomeryContext);
+    fieldAffine_negate(&negatedPoint, &preCalculatedPoints[-digit / 2],
+                       montgomeryContext);
+    jacobian_addMixed(pointQ, pointQ, &negatedPoint, curveA,
+                      montgomeryContext);
+  }
+}
+
+CryptidStatus affine_wNAFMultiply(AffinePoint *result,
+                                  const AffinePoint affinePoint, const mpz_t s,
+                                  const EllipticCurveContext *curveContext) {
+  // Multiplying infinity, or multiplying by a non-positive scalar yields
+  // infinity.
+  if (affine_isInfinity(affinePoint) || mpz_sgn(s) <= 0) {
     *result = affine_infinity();
     return CRYPTID_SUCCESS;
   }
 
-  AffinePoint pointN;
-  affine_init(&pointN, affinePoint.x, affinePoint.y);
+  // The multiplication is carried out on fixed-width Montgomery form
+  // coordinates.
+  const MontgomeryContext *montgomeryContext = &curveContext->montgomeryContext;
+  const FieldElement *curveA = curveContext->curveA;
+  const size_t n = montgomeryContext->limbCount;
+
+  const int windowSize = affine_wNAFWindowSize(mpz_sizeinbase(s, 2));
+
+  signed char *nafForm = (signed char *)malloc(windowedNaf_maxLength(s));
+  const size_t digitCount = windowedNaf_recode(nafForm, s, windowSize);
+
+  mp_limb_t fieldPointLimbs[2 * n];
+  FieldAffinePoint fieldPoint =
+      fieldAffine_view(fieldPointLimbs, montgomeryContext);
+  fieldAffine_fromAffinePoint(&fieldPoint, affinePoint, montgomeryContext);
+
+  const size_t tableSize = (size_t)1 << (windowSize - 2);
+  mp_limb_t *tableLimbs =
+      (mp_limb_t *)malloc(2 * tableSize * n * sizeof(mp_limb_t));
+  FieldAffinePoint *preCalculatedPoints =
+      (FieldAffinePoint *)malloc(tableSize * sizeof(FieldAffinePoint));
+  for (size_t i = 0; i < tableSize; i++) {
+    preCalculatedPoints[i] =
+        fieldAffine_view(tableLimbs + 2 * i * n, montgomeryContext);
+  }
+  CryptidStatus status =
+      affine_wNAFPrecompute(preCalculatedPoints, tableSize, &fieldPoint, curveA,
+                            montgomeryContext);
+  if (status) {
+    free(preCalculatedPoints);
+    free(tableLimbs);
+    free(nafForm);
+    return status;
+  }
+
+  // Implementation of Algorithm 3.36 in [Guide-to-ECC].
+  // Window NAF method for point multiplication, carried out in Jacobian
+  // coordinates, so that doublings and additions do not need field inversions.
+
   // \f$Q = \infty\f$
-  AffinePoint pointQ = affine_infinity();
-
-  // Binary expansion of the multiplier.
-  char *d = mpz_get_str(NULL, 2, s);
-
-  // Right-to-left iteration
-  for (int i = strlen(d) - 1; i >= 0; i--) {
-    CryptidStatus status;
-
-    // If \f$k_i = 1\f$ then \f$Q = Q + P\f$.
-    if (d[i] == '1') {
-      AffinePoint tmp;
-      status = affine_add(&tmp, pointQ, pointN, ellipticCurve);
-      if (status) {
-        affine_destroy(pointN);
-        affine_destroy(pointQ);
-        free(d);
-        return status;
-      }
-      affine_destroy(pointQ);
-      pointQ = tmp;
-    }
+  mp_limb_t pointQLimbs[3 * n];
+  JacobianPoint pointQ = jacobian_view(pointQLimbs, montgomeryContext);
+  jacobian_setInfinity(&pointQ, montgomeryContext);
 
-    // \f$P = 2P\f$
-    AffinePoint tmp;
-    status = affine_double(&tmp, pointN, ellipticCurve);
-    if (status) {
-      affine_destroy(pointN);
-      affine_destroy(pointQ);
-      free(d);
-      return status;
-    }
-    affine_destroy(pointN);
-    pointN = tmp;
+  for (size_t j = digitCount; j-- > 0;) {
+    // \f$Q = 2 \cdot Q\f$
+    jacobian_double(&pointQ, &pointQ, curveA, montgomeryContext);
+
+    // Add the precomputed point corresponding to the current digit to Q.
+    affine_wNAFAddDigit(&pointQ, preCalculatedPoints, nafForm[j], curveA,
+                        montgomeryContext);
   }
 
-  free(d);
+  free(preCalculatedPoints);
+  free(tableLimbs);
+  free(nafForm);
 
-  affine_destroy(pointN);
+  // A single inversion brings the result back to affine coordinates.
+  mp_limb_t affineQLimbs[2 * n];
+  FieldAffinePoint affineQ = fieldAffine_view(affineQLimbs, montgomeryContext);
+  status = jacobian_toFieldAffinePoint(&affineQ, &pointQ, montgomeryContext);
+  if (status) {
+    return status;
+  }
+
+  fieldAffine_toAffinePoint(result, &affineQ, montgomeryContext);
 
-  *result = pointQ;
   return CRYPTID_SUCCESS;
 }
 
-CryptidStatus affine_wNAFMultiply(AffinePoint *result,
-                                  const AffinePoint affinePoint, const mpz_t s,
-                                  const EllipticCurve ellipticCurve) {
-  // Precomputation of small scalar point multiplications used for Window NAF
-  // point multiplication \f$-1 \cdot P, 1 \cdot P, -3 \cdot P, 3 \cdot P, -5
-  // \cdot P, 5 \cdot P, -7 \cdot P, 7 \cdot P, ... \f$ until we reach
-  // \f$2^{w-1}-1\f$, where \f$w\f$ is the window size.
-
-  mpz_t d;
-  mpz_init_set(d, s);
-
-  // Defination of the window size.
-  int twoPowW = 32;
-  int twoPowWSubOne = 16;
-  AffinePoint preCalculatedPoints[16];
-  int *nafForm = (int *)calloc(0, sizeof(int));
-
-  mpz_t yNegate, yNegateModP, tmpS;
-  mpz_inits(yNegate, yNegateModP, NULL);
-  mpz_neg(yNegate, affinePoint.y);
-  mpz_mod(yNegateModP, yNegate, ellipticCurve.fieldOrder);
-
-  // \f$-1 \cdot P = (x, -y) and 1 \cdot P = P\f$.
-  affine_init(&(preCalculatedPoints[0]), affinePoint.x, yNegateModP);
-  affine_init(&(preCalculatedPoints[1]), affinePoint.x, affinePoint.y);
-  mpz_clears(yNegate, yNegateModP, NULL);
-
-  int actualIndex = 2;
-
-  CryptidStatus status;
-
-  // The others need to be computed with small multiplications.
-  for (int i = 3; i < twoPowWSubOne; i += 2) {
-    mpz_init_set_ui(tmpS, i);
-
-    // The computation of \f$x \cdot P \f$
-    status = affine_multiply(&preCalculatedPoints[actualIndex + 1], affinePoint,
-                             tmpS, ellipticCurve);
-    if (status) {
-      mpz_clears(d, tmpS, NULL);
-      for (int j = 0; j < actualIndex; j++) {
-        affine_destroy(preCalculatedPoints[j]);
-      }
-      return status;
+static CryptidStatus
+affine_strausMultiply(JacobianPoint *result, const FieldAffinePoint *points,
+                      const mpz_srcptr *scalars, const size_t count,
+                      const FieldElement *curveA,
+                      const MontgomeryContext *montgomeryContext) {
+  // Interleaving method with a width-\f$w\f$ NAF for every point, see
+  // Algorithm 3.51 in [Guide-to-ECC]. The doublings are shared by all the
+  // points.
+  signed char **nafForms = (signed char **)calloc(count, sizeof(signed char *));
+  size_t *digitCounts = (size_t *)calloc(count, sizeof(size_t));
+  FieldAffinePoint **tables =
+      (FieldAffinePoint **)calloc(count, sizeof(FieldAffinePoint *));
+  mp_limb_t **tableLimbs =
+      (mp_limb_t **)calloc(count, sizeof(mp_limb_t *));
+  const size_t n = montgomeryContext->limbCount;
+
+  CryptidStatus status = CRYPTID_SUCCESS;
+  size_t maxDigitCount = 0;
+  for (size_t i = 0; i < count && !status; i++) {
+    const int windowSize = affine_wNAFWindowSize(mpz_sizeinbase(scalars[i], 2));
+    const size_t tableSize = (size_t)1 << (windowSize - 2);
+
+    nafForms[i] = (signed char *)malloc(windowedNaf_maxLength(scalars[i]));
+    digitCounts[i] = windowedNaf_recode(nafForms[i], scalars[i], windowSize);
+    if (digitCounts[i] > maxDigitCount) {
+      maxDigitCount = digitCounts[i];
+    }
+
+    tableLimbs[i] =
+        (mp_limb_t *)malloc(2 * tableSize * n * sizeof(mp_limb_t));
+    tables[i] =
+        (FieldAffinePoint *)malloc(tableSize * sizeof(FieldAffinePoint));
+    for (size_t k = 0; k < tableSize; k++) {
+      tables[i][k] =
+          fieldAffine_view(tableLimbs[i] + 2 * k * n, montgomeryContext);
     }
+    status = affine_wNAFPrecompute(tables[i], tableSize, &points[i], curveA,
+                                   montgomeryContext);
+  }
 
-    // If we negate the y-coordinate of the earlier computed mulitplication, we
-    // get \f$-x \cdot P\f$
-    mpz_inits(yNegate, yNegateModP, NULL);
+  if (!status) {
+    jacobian_setInfinity(result, montgomeryContext);
+    for (size_t j = maxDigitCount; j-- > 0;) {
+      jacobian_double(result, result, curveA, montgomeryContext);
 
-    mpz_neg(yNegate, preCalculatedPoints[actualIndex + 1].y);
-    mpz_mod(yNegateModP, yNegate, ellipticCurve.fieldOrder);
+      for (size_t i = 0; i < count; i++) {
+        if (j < digitCounts[i]) {
+          affine_wNAFAddDigit(result, tables[i], nafForms[i][j], curveA,
+                              montgomeryContext);
+        }
+      }
+    }
+  }
 
-    affine_init(&(preCalculatedPoints[actualIndex]),
-                preCalculatedPoints[actualIndex + 1].x, yNegateModP);
+  for (size_t i = 0; i < count; i++) {
+    free(nafForms[i]);
+    free(tables[i]);
+    free(tableLimbs[i]);
+  }
+  free(nafForms);
+  free(digitCounts);
+  free(tables);
+  free(tableLimbs);
 
-    actualIndex += 2;
+  return status;
+}
 
-    mpz_clears(yNegate, yNegateModP, tmpS, NULL);
+static void
+affine_pippengerMultiply(JacobianPoint *result, const FieldAffinePoint *points,
+                         const mpz_srcptr *scalars, const size_t count,
+                         const FieldElement *curveA,
+                         const MontgomeryContext *montgomeryContext) {
+  // Bucket method of Pippenger. The scalars are split into windows of
+  // \f$c\f$ bits. In every window, each point is added to the bucket of its
+  // digit, then the buckets are summed as
+  // \f$\sum_{b} b \cdot B_b\f$ with two running sums.
+  size_t bitLength = 0;
+  for (size_t i = 0; i < count; i++) {
+    const size_t length = mpz_sizeinbase(scalars[i], 2);
+    if (length > bitLength) {
+      bitLength = length;
+    }
   }
 
-  mpz_t dModTwo, mod, dSub, dDivideTwo;
+  // A window of \f$c\f$ bits costs \f$n\f$ bucket additions and \f$2^{c + 1}\f$
+  // additions for summing the buckets. The window is capped, as the buckets
+  // of the fixed-width points take up a lot of memory.
+  int windowSize = 1;
+  size_t bestCost = (size_t)-1;
+  for (int c = 1; c <= AFFINE_MULTI_SCALAR_MAX_BUCKET_BITS; c++) {
+    const size_t windowCount = (bitLength + c - 1) / c;
+    const size_t cost = windowCount * (count + ((size_t)2 << c));
+    if (cost < bestCost) {
+      bestCost = cost;
+      windowSize = c;
+    }
+  }
 
-  // Implementation of Algorithm 3.35 in [Guide-to-ECC].
-  // Computing the width-\f$w\f$ NAF of a positive integer.
+  const size_t bucketCount = ((size_t)1 << windowSize) - 1;
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t *bucketLimbs =
+      (mp_limb_t *)malloc(3 * bucketCount * n * sizeof(mp_limb_t));
+  JacobianPoint *buckets =
+      (JacobianPoint *)malloc(bucketCount * sizeof(JacobianPoint));
+  for (size_t b = 0; b < bucketCount; b++) {
+    buckets[b] = jacobian_view(bucketLimbs + 3 * b * n, montgomeryContext);
+  }
+  mp_limb_t runningSumLimbs[3 * n], windowSumLimbs[3 * n];
+  JacobianPoint runningSum = jacobian_view(runningSumLimbs, montgomeryContext);
+  JacobianPoint windowSum = jacobian_view(windowSumLimbs, montgomeryContext);
 
-  int i = 0;
-  while (mpz_cmp_ui(d, 0) > 0) {
-    nafForm = (int *)realloc(nafForm, (i + 1) * sizeof(int));
-    mpz_init(dModTwo);
-    mpz_mod_ui(dModTwo, d, 2);
+  jacobian_setInfinity(result, montgomeryContext);
 
-    // If the number which we want the NAF form of, is odd.
-    if (mpz_cmp_ui(dModTwo, 1) == 0) {
-      // \f$k mods 2^w\f$ denotes the integer \f$u\f$ satisfying \f$u \equiv k
-      // \pmod 2^w\f$ and \f$-2^{w-1} \leq u < 2^{w-1}\f$.
-      mpz_init(mod);
-      mpz_mod_ui(mod, d, twoPowW);
-      mpz_init(dSub);
-      if (mpz_cmp_ui(mod, twoPowWSubOne) >= 0) {
-        nafForm[i] = mpz_get_ui(mod) - twoPowW;
-        mpz_add_ui(dSub, d, abs(nafForm[i]));
-      } else {
-        nafForm[i] = mpz_get_ui(mod);
-        mpz_sub_ui(dSub, d, nafForm[i]);
-      }
-      mpz_clear(d);
-      mpz_init_set(d, dSub);
-      mpz_clears(dSub, mod, NULL);
-    } else {
-      nafForm[i] = 0;
+  const size_t windowCount = (bitLength + windowSize - 1) / windowSize;
+  for (size_t window = windowCount; window-- > 0;) {
+    // \f$Q = 2^c Q\f$
+    for (int i = 0; i < windowSize; i++) {
+      jacobian_double(result, result, curveA, montgomeryContext);
     }
-    mpz_init(dDivideTwo);
-    mpz_divexact_ui(dDivideTwo, d, 2);
-    mpz_clear(d);
-    mpz_init_set(d, dDivideTwo);
-    mpz_clears(dDivideTwo, dModTwo, NULL);
-    i++;
-  }
-  mpz_clear(d);
 
-  // Implementation of Algorithm 3.36 in [Guide-to-ECC].
-  // Window NAF method for point multiplication
+    for (size_t b = 0; b < bucketCount; b++) {
+      jacobian_setInfinity(&buckets[b], montgomeryContext);
+    }
 
-  // \f$Q = \infty\f$
-  AffinePoint pointQ = affine_infinity();
+    for (size_t i = 0; i < count; i++) {
+      size_t digit = 0;
+      for (int bit = windowSize - 1; bit >= 0; bit--) {
+        digit = (digit << 1) |
+                mpz_tstbit(scalars[i], window * windowSize + (size_t)bit);
+      }
 
-  // Iterate through the NAF form.
-  for (int j = i - 1; j >= 0; j--) {
-    AffinePoint tmp;
-    // \f$Q = 2 \cdot Q\f$
-    status = affine_double(&tmp, pointQ, ellipticCurve);
-    if (status) {
-      for (int o = 0; o < 16; o++) {
-        affine_destroy(preCalculatedPoints[o]);
+      if (digit != 0) {
+        jacobian_addMixed(&buckets[digit - 1], &buckets[digit - 1], &points[i],
+                          curveA, montgomeryContext);
       }
-      affine_destroy(pointQ);
-      return status;
     }
-    affine_destroy(pointQ);
-    affine_init(&pointQ, tmp.x, tmp.y);
-    affine_destroy(tmp);
-
-    // If the current value of the NAF form is not 0 continue with the body of
-    // the if, else we jump to the next step of the iteration.
-    int chosen = nafForm[j];
-    if (chosen != 0) {
-      // Add the value of the precomputed point, which is corresponding to the
-      // current NAF value, to Q.
-      int index = chosen > 0 ? chosen : abs(chosen) - 1;
-      AffinePoint tmp2;
-      status =
-          affine_add(&tmp2, pointQ, preCalculatedPoints[index], ellipticCurve);
-      if (status) {
-        for (int o = 0; o < 16; o++) {
-          affine_destroy(preCalculatedPoints[o]);
-        }
-        affine_destroy(pointQ);
-        return status;
-      }
-      affine_destroy(pointQ);
-      affine_init(&pointQ, tmp2.x, tmp2.y);
-      affine_destroy(tmp2);
+
+    // \f$\sum_{b = 1}^{2^c - 1} b \cdot B_b\f$, by adding the running sum of
+    // the buckets from the top in every step.
+    jacobian_setInfinity(&runningSum, montgomeryContext);
+    jacobian_setInfinity(&windowSum, montgomeryContext);
+    for (size_t b = bucketCount; b-- > 0;) {
+      jacobian_add(&runningSum, &runningSum, &buckets[b], curveA,
+                   montgomeryContext);
+      jacobian_add(&windowSum, &windowSum, &runningSum, curveA,
+                   montgomeryContext);
     }
+
+    jacobian_add(result, result, &windowSum, curveA, montgomeryContext);
   }
 
-  for (int o = 0; o < 16; o++) {
-    affine_destroy(preCalculatedPoints[o]);
+  free(buckets);
+  free(bucketLimbs);
+}
+
+CryptidStatus
+affine_multiScalarMultiply(AffinePoint *result, const AffinePoint *points,
+                           const mpz_srcptr *scalars, const size_t count,
+                           const EllipticCurveContext *curveContext) {
+  const MontgomeryContext *montgomeryContext = &curveContext->montgomeryContext;
+  const FieldElement *curveA = curveContext->curveA;
+  const size_t n = montgomeryContext->limbCount;
+  CryptidStatus status = CRYPTID_SUCCESS;
+
+  // Terms with infinity or a non-positive scalar do not contribute to the sum,
+  // just like in {@code affine_wNAFMultiply}.
+  mp_limb_t *fieldPointLimbs =
+      (mp_limb_t *)malloc(2 * count * n * sizeof(mp_limb_t));
+  FieldAffinePoint *fieldPoints =
+      (FieldAffinePoint *)malloc(count * sizeof(FieldAffinePoint));
+  mpz_srcptr *activeScalars = (mpz_srcptr *)malloc(count * sizeof(mpz_srcptr));
+  size_t activeCount = 0;
+  for (size_t i = 0; i < count; i++) {
+    fieldPoints[i] =
+        fieldAffine_view(fieldPointLimbs + 2 * i * n, montgomeryContext);
+    if (!affine_isInfinity(points[i]) && mpz_sgn(scalars[i]) > 0) {
+      fieldAffine_fromAffinePoint(&fieldPoints[activeCount], points[i],
+                                  montgomeryContext);
+      activeScalars[activeCount] = scalars[i];
+      activeCount++;
+    }
   }
-  free(nafForm);
-  *result = pointQ;
+
+  mp_limb_t pointQLimbs[3 * n];
+  JacobianPoint pointQ = jacobian_view(pointQLimbs, montgomeryContext);
+  if (activeCount <= AFFINE_MULTI_SCALAR_STRAUS_THRESHOLD) {
+    status = affine_strausMultiply(&pointQ, fieldPoints, activeScalars,
+                                   activeCount, curveA, montgomeryContext);
+  } else {
+    affine_pippengerMultiply(&pointQ, fieldPoints, activeScalars, activeCount,
+                             curveA, montgomeryContext);
+  }
+
+  free(fieldPoints);
+  free(fieldPointLimbs);
+  free(activeScalars);
+
+  if (status) {
+    return status;
+  }
+
+  // A single inversion brings the result back to affine coordinates.
+  mp_limb_t affineQLimbs[2 * n];
+  FieldAffinePoint affineQ = fieldAffine_view(affineQLimbs, montgomeryContext);
+  status = jacobian_toFieldAffinePoint(&affineQ, &pointQ, montgomeryContext);
+  if (status) {
+    return status;
+  }
+
+  fieldAffine_toAffinePoint(result, &affineQ, montgomeryContext);
+
   return CRYPTID_SUCCESS;
 }
 
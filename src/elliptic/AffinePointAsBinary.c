@@ -31,6 +31,8 @@ void affineAsBinary_toAffine(AffinePoint *affinePointOutput,
              affinePointAsBinary.x);
   mpz_import(affinePointOutput->y, affinePointAsBinary.yLength, 1, 1, 0, 0,
              affinePointAsBinary.y);
+  affinePointOutput->isInfinity = !mpz_cmp_si(affinePointOutput->x, -1) &&
+                                  !mpz_cmp_si(affinePointOutput->y, -1);
 }
 
 void affineAsBinary_fromAffine(AffinePointAsBinary *affinePointAsBinaryOutput,
@@ -11,10 +11,16 @@
 //   Encryption (Information Security and Privacy Series) (1 ed.). Artech House,
 //   Inc., Norwood, MA, USA.
 
+static int complexAffine_isSentinel(const Complex x, const Complex y) {
+  return !mpz_cmp_si(x.real, -1) && !mpz_sgn(x.imaginary) &&
+         !mpz_cmp_si(y.real, -1) && !mpz_sgn(y.imaginary);
+}
+
 void complexAffine_init(ComplexAffinePoint *complexAffinePointOutput,
                         const Complex x, const Complex y) {
   complex_initMpz(&complexAffinePointOutput->x, x.real, x.imaginary);
   complex_initMpz(&complexAffinePointOutput->y, y.real, y.imaginary);
+  complexAffinePointOutput->isInfinity = complexAffine_isSentinel(x, y);
 }
 
 void complexAffine_initLong(ComplexAffinePoint *complexAffinePointOutput,
@@ -22,6 +28,8 @@ void complexAffine_initLong(ComplexAffinePoint *complexAffinePointOutput,
                             const long yi) {
   complex_initLong(&complexAffinePointOutput->x, xr, xi);
   complex_initLong(&complexAffinePointOutput->y, yr, yi);
+  complexAffinePointOutput->isInfinity =
+      xr == -1 && xi == 0 && yr == -1 && yi == 0;
 }
 
 void complexAffine_destroy(ComplexAffinePoint complexAffinePoint) {
@@ -43,12 +51,7 @@ int complexAffine_isEquals(const ComplexAffinePoint complexAffinePoint1,
 }
 
 int complexAffine_isInfinity(const ComplexAffinePoint complexAffinePoint) {
-  ComplexAffinePoint infty = complexAffine_infinity();
-
-  int result = complexAffine_isEquals(infty, complexAffinePoint);
-  complexAffine_destroy(infty);
-
-  return result;
+  return complexAffinePoint.isInfinity;
 }
 
 CryptidStatus complexAffine_double(ComplexAffinePoint *result,
@@ -100,8 +103,8 @@ CryptidStatus complexAffine_double(ComplexAffinePoint *result,
   mpz_set_ui(tmp, 3);
 
   Complex ap1xSquared;
-  complex_modMul(&ap1xSquared, complexAffinePoint.x, complexAffinePoint.x,
-                 ellipticCurve.fieldOrder);
+  complex_modSquare(&ap1xSquared, complexAffinePoint.x,
+                    ellipticCurve.fieldOrder);
   Complex threeTimesAp1xSquared;
   complex_modMulInteger(&threeTimesAp1xSquared, tmp, ap1xSquared,
                         ellipticCurve.fieldOrder);
@@ -121,7 +124,7 @@ CryptidStatus complexAffine_double(ComplexAffinePoint *result,
   complex_additiveInverse(&x2AddInv, complexAffinePoint.x,
                           ellipticCurve.fieldOrder);
   Complex mSquared;
-  complex_modMul(&mSquared, m, m, ellipticCurve.fieldOrder);
+  complex_modSquare(&mSquared, m, ellipticCurve.fieldOrder);
 
   Complex x1AddInv;
   complex_additiveInverse(&x1AddInv, complexAffinePoint.x,
@@ -224,7 +227,7 @@ CryptidStatus complexAffine_add(ComplexAffinePoint *result,
   complex_additiveInverse(&x2AddInv, complexAffinePoint2.x,
                           ellipticCurve.fieldOrder);
   Complex mSquared;
-  complex_modMul(&mSquared, m, m, ellipticCurve.fieldOrder);
+  complex_modSquare(&mSquared, m, ellipticCurve.fieldOrder);
 
   Complex x1AddInvPlusx2AddInv;
   complex_modAdd(&x1AddInvPlusx2AddInv, x1AddInv, x2AddInv,
@@ -332,9 +335,9 @@ int complexAffine_isOnCurve(ComplexAffinePoint point,
   // is equal to
   // \f$x^3 + ax + b\f$.
   Complex ySquared;
-  complex_modMul(&ySquared, point.y, point.y, ellipticCurve.fieldOrder);
+  complex_modSquare(&ySquared, point.y, ellipticCurve.fieldOrder);
   Complex xSquared;
-  complex_modMul(&xSquared, point.x, point.x, ellipticCurve.fieldOrder);
+  complex_modSquare(&xSquared, point.x, ellipticCurve.fieldOrder);
   Complex xCubed;
   complex_modMul(&xCubed, xSquared, point.x, ellipticCurve.fieldOrder);
 
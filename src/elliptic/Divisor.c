@@ -9,7 +9,7 @@
 
 void divisor_evaluateVertical(Complex *result, const AffinePoint a,
                               const ComplexAffinePoint b,
-                              const EllipticCurve ec) {
+                              const EllipticCurveContext *context) {
   // Implementation of Algorithm 3.4.1 in [RFC-5091].
 
   // Let \f$r\f$ denote the result of the operation:
@@ -20,19 +20,21 @@ void divisor_evaluateVertical(Complex *result, const AffinePoint a,
     return;
   }
 
+  const mpz_srcptr fieldOrder = context->ellipticCurve.fieldOrder;
+
   mpz_t axAddInv;
   mpz_init(axAddInv);
   mpz_neg(axAddInv, a.x);
-  mpz_mod(axAddInv, axAddInv, ec.fieldOrder);
+  mpz_mod(axAddInv, axAddInv, fieldOrder);
 
-  complex_modAddInteger(result, b.x, axAddInv, ec.fieldOrder);
+  complex_modAddInteger(result, b.x, axAddInv, fieldOrder);
 
   mpz_clear(axAddInv);
 }
 
 CryptidStatus divisor_evaluateTangent(Complex *result, const AffinePoint a,
                                       const ComplexAffinePoint b,
-                                      const EllipticCurve ec) {
+                                      const EllipticCurveContext *context) {
   // Implementation of Algorithm 3.4.2 in [RFC-5091].
 
   // Argument check
@@ -47,58 +49,56 @@ CryptidStatus divisor_evaluateTangent(Complex *result, const AffinePoint a,
   }
 
   if (!mpz_cmp_ui(a.y, 0)) {
-    divisor_evaluateVertical(result, a, b, ec);
+    divisor_evaluateVertical(result, a, b, context);
     return CRYPTID_SUCCESS;
   }
 
   Complex axB, byB, resultPart;
-  mpz_t threeAddInv, minusThree, xasquared, aprime, bprime, bAddInv, bAddInvyA,
-      axA, axAaddInv, c;
-  mpz_inits(threeAddInv, minusThree, xasquared, aprime, bprime, bAddInv,
-            bAddInvyA, axA, axAaddInv, c, NULL);
+  mpz_t xasquared, aprime, bprime, bAddInv, bAddInvyA, axA, axAaddInv, c;
+  mpz_inits(xasquared, aprime, bprime, bAddInv, bAddInvyA, axA, axAaddInv, c,
+            NULL);
+  const mpz_srcptr fieldOrder = context->ellipticCurve.fieldOrder;
 
   // Line computation
   // \f$a^{\prime} = -3 \cdot x_A^2\f$
-  mpz_set_si(minusThree, -3);
-  mpz_mod(threeAddInv, minusThree, ec.fieldOrder);
-  mpz_powm_ui(xasquared, a.x, 2, ec.fieldOrder);
-  mpz_mul(aprime, xasquared, threeAddInv);
-  mpz_mod(aprime, aprime, ec.fieldOrder);
+  mpz_powm_ui(xasquared, a.x, 2, fieldOrder);
+  mpz_mul(aprime, xasquared, context->minusThree);
+  mpz_mod(aprime, aprime, fieldOrder);
 
   // \f$b^{\prime} = 2 \cdot y_A\f$
   mpz_mul_ui(bprime, a.y, 2);
-  mpz_mod(bprime, bprime, ec.fieldOrder);
+  mpz_mod(bprime, bprime, fieldOrder);
 
   // \f$c = -b^{\prime} \cdot y_A - a^{\prime} \cdot x_A\f$
   mpz_neg(bAddInv, bprime);
-  mpz_mod(bAddInv, bAddInv, ec.fieldOrder);
+  mpz_mod(bAddInv, bAddInv, fieldOrder);
   mpz_mul(bAddInvyA, bAddInv, a.y);
-  mpz_mod(bAddInvyA, bAddInvyA, ec.fieldOrder);
+  mpz_mod(bAddInvyA, bAddInvyA, fieldOrder);
   mpz_mul(axA, aprime, a.x);
-  mpz_mod(axA, axA, ec.fieldOrder);
+  mpz_mod(axA, axA, fieldOrder);
   mpz_neg(axAaddInv, axA);
-  mpz_mod(axAaddInv, axAaddInv, ec.fieldOrder);
+  mpz_mod(axAaddInv, axAaddInv, fieldOrder);
   mpz_add(c, bAddInvyA, axAaddInv);
-  mpz_mod(c, c, ec.fieldOrder);
+  mpz_mod(c, c, fieldOrder);
 
   // Evaluation at \f$B\f$
   // Let \f$r\f$ denote the result:
   // \f$r = a^{\prime} \cdot x_B + b^{\prime} \cdot y_B + c\f$
-  complex_modMulInteger(&axB, aprime, b.x, ec.fieldOrder);
-  complex_modMulInteger(&byB, bprime, b.y, ec.fieldOrder);
-  complex_modAdd(&resultPart, axB, byB, ec.fieldOrder);
-  complex_modAddInteger(result, resultPart, c, ec.fieldOrder);
+  complex_modMulInteger(&axB, aprime, b.x, fieldOrder);
+  complex_modMulInteger(&byB, bprime, b.y, fieldOrder);
+  complex_modAdd(&resultPart, axB, byB, fieldOrder);
+  complex_modAddInteger(result, resultPart, c, fieldOrder);
 
   complex_destroyMany(3, axB, byB, resultPart);
-  mpz_clears(threeAddInv, minusThree, xasquared, aprime, bprime, bAddInv,
-             bAddInvyA, axA, axAaddInv, c, NULL);
+  mpz_clears(xasquared, aprime, bprime, bAddInv, bAddInvyA, axA, axAaddInv, c,
+             NULL);
   return CRYPTID_SUCCESS;
 }
 
 CryptidStatus divisor_evaluateLine(Complex *result, const AffinePoint a,
                                    const AffinePoint aprime,
                                    const ComplexAffinePoint b,
-                                   const EllipticCurve ec) {
+                                   const EllipticCurveContext *context) {
   // Implementation of Algorithm 3.4.3 in [RFC-5091].
 
   // Argument check
@@ -108,27 +108,30 @@ CryptidStatus divisor_evaluateLine(Complex *result, const AffinePoint a,
 
   // Special cases
   if (affine_isInfinity(a)) {
-    divisor_evaluateVertical(result, aprime, b, ec);
+    divisor_evaluateVertical(result, aprime, b, context);
     return CRYPTID_SUCCESS;
   }
 
   AffinePoint aPlusAPrime;
-  CryptidStatus status = affine_add(&aPlusAPrime, a, aprime, ec);
+  CryptidStatus status =
+      affine_add(&aPlusAPrime, a, aprime, context->ellipticCurve);
   if (status) {
     return status;
   }
 
   if (affine_isInfinity(aprime) || affine_isInfinity(aPlusAPrime)) {
-    divisor_evaluateVertical(result, a, b, ec);
+    divisor_evaluateVertical(result, a, b, context);
     affine_destroy(aPlusAPrime);
     return CRYPTID_SUCCESS;
   }
   affine_destroy(aPlusAPrime);
 
   if (affine_isEquals(a, aprime)) {
-    return divisor_evaluateTangent(result, a, b, ec);
+    return divisor_evaluateTangent(result, a, b, context);
   }
 
+  const mpz_srcptr fieldOrder = context->ellipticCurve.fieldOrder;
+
   mpz_t linea, lineb, linebaddinv, q, t, taddinv, linec;
   mpz_inits(linea, lineb, linebaddinv, q, t, taddinv, linec, NULL);
   Complex axb, byb, resultPart;
@@ -136,34 +139,395 @@ CryptidStatus divisor_evaluateLine(Complex *result, const AffinePoint a,
   // Line computation
   // \f$a = y_A^{\prime} - y_A^{\prime\prime}\f$
   mpz_sub(linea, a.y, aprime.y);
-  mpz_mod(linea, linea, ec.fieldOrder);
+  mpz_mod(linea, linea, fieldOrder);
 
   // \f$b = x_A^{\prime\prime} - x_A^{\prime}\f$
   mpz_sub(lineb, aprime.x, a.x);
-  mpz_mod(lineb, lineb, ec.fieldOrder);
+  mpz_mod(lineb, lineb, fieldOrder);
 
   // \f$c = -b \cdot y_A^{\prime} - a \cdot x_A^{\prime}\f$
   mpz_neg(linebaddinv, lineb);
-  mpz_mod(linebaddinv, linebaddinv, ec.fieldOrder);
+  mpz_mod(linebaddinv, linebaddinv, fieldOrder);
   mpz_mul(q, linebaddinv, a.y);
-  mpz_mod(q, q, ec.fieldOrder);
+  mpz_mod(q, q, fieldOrder);
   mpz_mul(t, linea, a.x);
-  mpz_mod(t, t, ec.fieldOrder);
+  mpz_mod(t, t, fieldOrder);
   mpz_neg(taddinv, t);
-  mpz_mod(taddinv, taddinv, ec.fieldOrder);
+  mpz_mod(taddinv, taddinv, fieldOrder);
   mpz_add(linec, q, taddinv);
-  mpz_mod(linec, linec, ec.fieldOrder);
+  mpz_mod(linec, linec, fieldOrder);
 
   // Evaluation at B
   // Let \f$r\f$ denote the result:
   // \f$r = a \cdot x_B + b \cdot y_B + c\f$
-  complex_modMulInteger(&axb, linea, b.x, ec.fieldOrder);
-  complex_modMulInteger(&byb, lineb, b.y, ec.fieldOrder);
-  complex_modAddInteger(&resultPart, byb, linec, ec.fieldOrder);
-  complex_modAdd(result, axb, resultPart, ec.fieldOrder);
+  complex_modMulInteger(&axb, linea, b.x, fieldOrder);
+  complex_modMulInteger(&byb, lineb, b.y, fieldOrder);
+  complex_modAddInteger(&resultPart, byb, linec, fieldOrder);
+  complex_modAdd(result, axb, resultPart, fieldOrder);
 
   mpz_clears(linea, lineb, linebaddinv, q, t, taddinv, linec, NULL);
   complex_destroyMany(3, axb, byb, resultPart);
 
   return CRYPTID_SUCCESS;
-}
\ No newline at end of file
+}
+
+DivisorLine divisor_viewLine(mp_limb_t *limbs,
+                             const MontgomeryContext *montgomeryContext) {
+  DivisorLine line;
+
+  line.a = limbs;
+  line.b = limbs + montgomeryContext->limbCount;
+  line.c = limbs + 2 * montgomeryContext->limbCount;
+
+  return line;
+}
+
+void divisor_montgomeryEvaluateVertical(
+    ComplexFieldElement *result, const FieldAffinePoint *a,
+    const ComplexFieldElement *bX,
+    const MontgomeryContext *montgomeryContext) {
+  // Same as {@code divisor_evaluateVertical}.
+  if (a->isInfinity) {
+    complexFieldElement_setOne(result, montgomeryContext);
+    return;
+  }
+
+  // \f$r = x_B - x_A\f$
+  fieldElement_sub(result->real, bX->real, a->x, montgomeryContext);
+  fieldElement_copy(result->imaginary, bX->imaginary, montgomeryContext);
+}
+
+static void
+divisor_montgomeryVerticalLine(DivisorLine *line, const FieldAffinePoint *a,
+                               const MontgomeryContext *montgomeryContext) {
+  if (a->isInfinity) {
+    // The constant function 1.
+    fieldElement_setZero(line->a, montgomeryContext);
+    fieldElement_setZero(line->b, montgomeryContext);
+    fieldElement_setOne(line->c, montgomeryContext);
+    return;
+  }
+
+  // \f$x - x_A\f$
+  fieldElement_setOne(line->a, montgomeryContext);
+  fieldElement_setZero(line->b, montgomeryContext);
+  fieldElement_negate(line->c, a->x, montgomeryContext);
+}
+
+void divisor_montgomeryTangentLine(DivisorLine *line, const FieldAffinePoint *a,
+                                   const MontgomeryContext *montgomeryContext) {
+  // Same as {@code divisor_evaluateTangent}. The tangent is vertical at
+  // points of order 2, and the constant 1 at infinity.
+  if (a->isInfinity || fieldElement_isZero(a->y, montgomeryContext)) {
+    divisor_montgomeryVerticalLine(line, a, montgomeryContext);
+    return;
+  }
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t tmp[n];
+
+  // \f$a^{\prime} = -3 \cdot x_A^2\f$
+  fieldElement_square(tmp, a->x, montgomeryContext);
+  fieldElement_add(line->a, tmp, tmp, montgomeryContext);
+  fieldElement_add(line->a, line->a, tmp, montgomeryContext);
+  fieldElement_negate(line->a, line->a, montgomeryContext);
+
+  // \f$b^{\prime} = 2 \cdot y_A\f$
+  fieldElement_add(line->b, a->y, a->y, montgomeryContext);
+
+  // \f$c = -b^{\prime} \cdot y_A - a^{\prime} \cdot x_A\f$
+  fieldElement_mul(line->c, line->b, a->y, montgomeryContext);
+  fieldElement_mul(tmp, line->a, a->x, montgomeryContext);
+  fieldElement_add(line->c, line->c, tmp, montgomeryContext);
+  fieldElement_negate(line->c, line->c, montgomeryContext);
+}
+
+void divisor_montgomeryChordLine(DivisorLine *line, const FieldAffinePoint *a,
+                                 const FieldAffinePoint *aprime,
+                                 const MontgomeryContext *montgomeryContext) {
+  // Same as {@code divisor_evaluateLine}.
+  if (a->isInfinity) {
+    divisor_montgomeryVerticalLine(line, aprime, montgomeryContext);
+    return;
+  }
+
+  // \f$A^{\prime} + A^{\prime\prime}\f$ is infinity if and only if the points
+  // share their \f$x\f$ coordinate and are either different, or have zero
+  // \f$y\f$ coordinates. Checking this way saves us a point addition.
+  if (aprime->isInfinity) {
+    divisor_montgomeryVerticalLine(line, a, montgomeryContext);
+    return;
+  }
+
+  if (fieldElement_isEquals(a->x, aprime->x, montgomeryContext)) {
+    if (fieldElement_isEquals(a->y, aprime->y, montgomeryContext)) {
+      divisor_montgomeryTangentLine(line, a, montgomeryContext);
+    } else {
+      divisor_montgomeryVerticalLine(line, a, montgomeryContext);
+    }
+    return;
+  }
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t tmp[n];
+
+  // \f$a = y_A^{\prime} - y_A^{\prime\prime}\f$
+  fieldElement_sub(line->a, a->y, aprime->y, montgomeryContext);
+
+  // \f$b = x_A^{\prime\prime} - x_A^{\prime}\f$
+  fieldElement_sub(line->b, aprime->x, a->x, montgomeryContext);
+
+  // \f$c = -b \cdot y_A^{\prime} - a \cdot x_A^{\prime}\f$
+  fieldElement_mul(line->c, line->b, a->y, montgomeryContext);
+  fieldElement_mul(tmp, line->a, a->x, montgomeryContext);
+  fieldElement_add(line->c, line->c, tmp, montgomeryContext);
+  fieldElement_negate(line->c, line->c, montgomeryContext);
+}
+
+void divisor_montgomeryEvaluateDivisorLine(
+    ComplexFieldElement *result, const DivisorLine *line,
+    const ComplexFieldElement *bX, const ComplexFieldElement *bY,
+    const MontgomeryContext *montgomeryContext) {
+  mp_limb_t byBLimbs[2 * montgomeryContext->limbCount];
+  ComplexFieldElement byB =
+      complexFieldElement_view(byBLimbs, montgomeryContext);
+
+  // \f$r = a \cdot x_B + b \cdot y_B + c\f$
+  complexFieldElement_mulFieldElement(result, line->a, bX, montgomeryContext);
+  complexFieldElement_mulFieldElement(&byB, line->b, bY, montgomeryContext);
+  complexFieldElement_add(result, result, &byB, montgomeryContext);
+  complexFieldElement_addFieldElement(result, result, line->c,
+                                      montgomeryContext);
+}
+
+void divisor_montgomeryEvaluateTangent(
+    ComplexFieldElement *result, const FieldAffinePoint *a,
+    const ComplexFieldElement *bX, const ComplexFieldElement *bY,
+    const MontgomeryContext *montgomeryContext) {
+  mp_limb_t lineLimbs[3 * montgomeryContext->limbCount];
+  DivisorLine line = divisor_viewLine(lineLimbs, montgomeryContext);
+  divisor_montgomeryTangentLine(&line, a, montgomeryContext);
+  divisor_montgomeryEvaluateDivisorLine(result, &line, bX, bY,
+                                        montgomeryContext);
+}
+
+void divisor_montgomeryEvaluateLine(
+    ComplexFieldElement *result, const FieldAffinePoint *a,
+    const FieldAffinePoint *aprime, const ComplexFieldElement *bX,
+    const ComplexFieldElement *bY, const MontgomeryContext *montgomeryContext) {
+  mp_limb_t lineLimbs[3 * montgomeryContext->limbCount];
+  DivisorLine line = divisor_viewLine(lineLimbs, montgomeryContext);
+  divisor_montgomeryChordLine(&line, a, aprime, montgomeryContext);
+  divisor_montgomeryEvaluateDivisorLine(result, &line, bX, bY,
+                                        montgomeryContext);
+}
+
+void divisor_montgomeryMulDivisorLine(
+    ComplexFieldElement *result, const DivisorLine *line,
+    const ComplexFieldElement *bX, const FieldElement *bY,
+    const MontgomeryContext *montgomeryContext) {
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t valueLimbs[2 * n], byB[n];
+  ComplexFieldElement value =
+      complexFieldElement_view(valueLimbs, montgomeryContext);
+
+  // \f$r = r \cdot ((a \Re(x_B) + b y_B + c) + a \Im(x_B) i)\f$
+  fieldElement_mul(value.real, line->a, bX->real, montgomeryContext);
+  fieldElement_mul(byB, line->b, bY, montgomeryContext);
+  fieldElement_add(value.real, value.real, byB, montgomeryContext);
+  fieldElement_add(value.real, value.real, line->c, montgomeryContext);
+  fieldElement_mul(value.imaginary, line->a, bX->imaginary,
+                   montgomeryContext);
+
+  complexFieldElement_mul(result, result, &value, montgomeryContext);
+}
+
+static void
+divisor_jacobianVerticalLine(DivisorLine *line, const JacobianPoint *a,
+                             const MontgomeryContext *montgomeryContext) {
+  if (jacobian_isInfinity(a, montgomeryContext)) {
+    // The constant function 1.
+    fieldElement_setZero(line->a, montgomeryContext);
+    fieldElement_setZero(line->b, montgomeryContext);
+    fieldElement_setOne(line->c, montgomeryContext);
+    return;
+  }
+
+  // \f$Z^2 x - X\f$
+  fieldElement_square(line->a, a->z, montgomeryContext);
+  fieldElement_setZero(line->b, montgomeryContext);
+  fieldElement_negate(line->c, a->x, montgomeryContext);
+}
+
+void divisor_jacobianDoubleAndTangent(
+    JacobianPoint *result, DivisorLine *line, const JacobianPoint *a,
+    const FieldElement *curveA, const MontgomeryContext *montgomeryContext) {
+  // The doubling is the same as {@code jacobian_double}. The slope of the
+  // tangent is \f$\frac{M}{Z_3}\f$ with \f$M = 3X^2 + aZ^4\f$ and
+  // \f$Z_3 = 2YZ\f$, so the tangent scaled by \f$Z_3 Z^2\f$ is
+  // \f$M Z^2 x - Z_3 Z^2 y + (2Y^2 - MX)\f$.
+  if (jacobian_isInfinity(a, montgomeryContext) ||
+      fieldElement_isZero(a->y, montgomeryContext)) {
+    divisor_jacobianVerticalLine(line, a, montgomeryContext);
+    jacobian_setInfinity(result, montgomeryContext);
+    return;
+  }
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t xx[n], yy[n], yyyy[n], zz[n], s[n], m[n], z3[n], tmp[n];
+
+  fieldElement_square(xx, a->x, montgomeryContext);
+  fieldElement_square(yy, a->y, montgomeryContext);
+  fieldElement_square(yyyy, yy, montgomeryContext);
+  fieldElement_square(zz, a->z, montgomeryContext);
+
+  // \f$S = 2((X + YY)^2 - XX - YYYY)\f$
+  fieldElement_add(s, a->x, yy, montgomeryContext);
+  fieldElement_square(s, s, montgomeryContext);
+  fieldElement_sub(s, s, xx, montgomeryContext);
+  fieldElement_sub(s, s, yyyy, montgomeryContext);
+  fieldElement_add(s, s, s, montgomeryContext);
+
+  // \f$M = 3XX + aZZ^2\f$
+  fieldElement_add(m, xx, xx, montgomeryContext);
+  fieldElement_add(m, m, xx, montgomeryContext);
+  if (!fieldElement_isZero(curveA, montgomeryContext)) {
+    fieldElement_square(tmp, zz, montgomeryContext);
+    fieldElement_mul(tmp, tmp, curveA, montgomeryContext);
+    fieldElement_add(m, m, tmp, montgomeryContext);
+  }
+
+  // \f$Z_3 = (Y + Z)^2 - YY - ZZ\f$
+  fieldElement_add(z3, a->y, a->z, montgomeryContext);
+  fieldElement_square(z3, z3, montgomeryContext);
+  fieldElement_sub(z3, z3, yy, montgomeryContext);
+  fieldElement_sub(z3, z3, zz, montgomeryContext);
+
+  // The tangent, computed before the operand might be overwritten.
+  fieldElement_mul(line->a, m, zz, montgomeryContext);
+  fieldElement_mul(line->b, z3, zz, montgomeryContext);
+  fieldElement_negate(line->b, line->b, montgomeryContext);
+  fieldElement_mul(tmp, m, a->x, montgomeryContext);
+  fieldElement_add(line->c, yy, yy, montgomeryContext);
+  fieldElement_sub(line->c, line->c, tmp, montgomeryContext);
+
+  fieldElement_copy(result->z, z3, montgomeryContext);
+
+  // \f$X_3 = M^2 - 2S\f$
+  fieldElement_square(result->x, m, montgomeryContext);
+  fieldElement_sub(result->x, result->x, s, montgomeryContext);
+  fieldElement_sub(result->x, result->x, s, montgomeryContext);
+
+  // \f$Y_3 = M(S - X_3) - 8YYYY\f$
+  fieldElement_sub(s, s, result->x, montgomeryContext);
+  fieldElement_mul(s, m, s, montgomeryContext);
+  fieldElement_add(yyyy, yyyy, yyyy, montgomeryContext);
+  fieldElement_add(yyyy, yyyy, yyyy, montgomeryContext);
+  fieldElement_add(yyyy, yyyy, yyyy, montgomeryContext);
+  fieldElement_sub(result->y, s, yyyy, montgomeryContext);
+}
+
+void divisor_jacobianAddAndChord(JacobianPoint *result, DivisorLine *line,
+                                 const JacobianPoint *a,
+                                 const FieldAffinePoint *aprime,
+                                 const FieldElement *curveA,
+                                 const MontgomeryContext *montgomeryContext) {
+  // The addition is the same as {@code jacobian_addMixed}. The slope of the
+  // line is \f$\frac{r}{Z_3}\f$ with \f$r = 2(S_2 - Y)\f$ and
+  // \f$Z_3 = 2ZH\f$, so the line scaled by \f$Z_3\f$ is
+  // \f$rx - Z_3 y + (Z_3 y^{\prime} - r x^{\prime})\f$.
+  if (aprime->isInfinity) {
+    divisor_jacobianVerticalLine(line, a, montgomeryContext);
+    if (result != a) {
+      jacobian_copy(result, a, montgomeryContext);
+    }
+    return;
+  }
+
+  if (jacobian_isInfinity(a, montgomeryContext)) {
+    divisor_montgomeryVerticalLine(line, aprime, montgomeryContext);
+    jacobian_fromFieldAffinePoint(result, aprime, montgomeryContext);
+    return;
+  }
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t z1z1[n], u2[n], s2[n], h[n], hh[n], i[n], j[n], r[n], v[n],
+      z3[n];
+
+  // \f$U_2 = X_2 Z_1^2\f$, \f$S_2 = Y_2 Z_1^3\f$
+  fieldElement_square(z1z1, a->z, montgomeryContext);
+  fieldElement_mul(u2, aprime->x, z1z1, montgomeryContext);
+  fieldElement_mul(s2, a->z, z1z1, montgomeryContext);
+  fieldElement_mul(s2, aprime->y, s2, montgomeryContext);
+
+  // \f$H = U_2 - X_1\f$, \f$r = 2(S_2 - Y_1)\f$
+  fieldElement_sub(h, u2, a->x, montgomeryContext);
+  fieldElement_sub(r, s2, a->y, montgomeryContext);
+
+  if (fieldElement_isZero(h, montgomeryContext)) {
+    // Same \f$x\f$ coordinates: either a doubling or opposite points.
+    if (fieldElement_isZero(r, montgomeryContext)) {
+      divisor_jacobianDoubleAndTangent(result, line, a, curveA,
+                                       montgomeryContext);
+    } else {
+      divisor_montgomeryVerticalLine(line, aprime, montgomeryContext);
+      jacobian_setInfinity(result, montgomeryContext);
+    }
+    return;
+  }
+
+  fieldElement_add(r, r, r, montgomeryContext);
+
+  // \f$Z_3 = (Z_1 + H)^2 - Z_1Z_1 - HH\f$
+  fieldElement_square(hh, h, montgomeryContext);
+  fieldElement_add(z3, a->z, h, montgomeryContext);
+  fieldElement_square(z3, z3, montgomeryContext);
+  fieldElement_sub(z3, z3, z1z1, montgomeryContext);
+  fieldElement_sub(z3, z3, hh, montgomeryContext);
+
+  // The line only depends on the affine operand and the new \f$Z\f$.
+  fieldElement_copy(line->a, r, montgomeryContext);
+  fieldElement_negate(line->b, z3, montgomeryContext);
+  fieldElement_mul(line->c, z3, aprime->y, montgomeryContext);
+  fieldElement_mul(u2, r, aprime->x, montgomeryContext);
+  fieldElement_sub(line->c, line->c, u2, montgomeryContext);
+
+  // \f$I = 4H^2\f$, \f$J = HI\f$, \f$V = X_1 I\f$
+  fieldElement_add(i, hh, hh, montgomeryContext);
+  fieldElement_add(i, i, i, montgomeryContext);
+  fieldElement_mul(j, h, i, montgomeryContext);
+  fieldElement_mul(v, a->x, i, montgomeryContext);
+
+  // \f$2 Y_1 J\f$, computed before the operand might be overwritten.
+  fieldElement_mul(s2, a->y, j, montgomeryContext);
+  fieldElement_add(s2, s2, s2, montgomeryContext);
+
+  fieldElement_copy(result->z, z3, montgomeryContext);
+
+  // \f$X_3 = r^2 - J - 2V\f$
+  fieldElement_square(result->x, r, montgomeryContext);
+  fieldElement_sub(result->x, result->x, j, montgomeryContext);
+  fieldElement_sub(result->x, result->x, v, montgomeryContext);
+  fieldElement_sub(result->x, result->x, v, montgomeryContext);
+
+  // \f$Y_3 = r(V - X_3) - 2Y_1J\f$
+  fieldElement_sub(v, v, result->x, montgomeryContext);
+  fieldElement_mul(v, r, v, montgomeryContext);
+  fieldElement_sub(result->y, v, s2, montgomeryContext);
+}
+
+void divisor_jacobianEvaluateVertical(
+    ComplexFieldElement *result, const JacobianPoint *a,
+    const ComplexFieldElement *bX, const MontgomeryContext *montgomeryContext) {
+  if (jacobian_isInfinity(a, montgomeryContext)) {
+    complexFieldElement_setOne(result, montgomeryContext);
+    return;
+  }
+
+  // \f$r = Z^2 x_B - X\f$
+  mp_limb_t zz[montgomeryContext->limbCount];
+  fieldElement_square(zz, a->z, montgomeryContext);
+  fieldElement_mul(result->real, zz, bX->real, montgomeryContext);
+  fieldElement_sub(result->real, result->real, a->x, montgomeryContext);
+  fieldElement_mul(result->imaginary, zz, bX->imaginary, montgomeryContext);
+}
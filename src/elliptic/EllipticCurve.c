@@ -2,6 +2,7 @@
 
 #include "elliptic/EllipticCurve.h"
 #include "util/PrimalityTest.h"
+#include "util/ValidationMemo.h"
 
 void ellipticCurve_init(EllipticCurve *ellipticCurveOutput, const mpz_t a,
                         const mpz_t b, const mpz_t fieldOrder) {
@@ -29,8 +30,21 @@ void ellipticCurve_destroy(EllipticCurve ellipticCurve) {
 
 CryptidValidationResult
 ellipticCurve_isTypeOne(const EllipticCurve ellipticCurve) {
-  if (!mpz_cmp_ui(ellipticCurve.a, 0) && !mpz_cmp_ui(ellipticCurve.b, 1) &&
-      primalityTest_isProbablePrime(ellipticCurve.fieldOrder)) {
+  if (mpz_cmp_ui(ellipticCurve.a, 0) || mpz_cmp_ui(ellipticCurve.b, 1)) {
+    return CRYPTID_VALIDATION_FAILURE;
+  }
+
+  // The primality test dominates, so the field orders that passed it are
+  // remembered.
+  const mpz_srcptr values[] = {ellipticCurve.fieldOrder};
+  ValidationMemoKey key;
+  validationMemo_computeKey(&key, "EllipticCurve.fieldOrder", values, 1);
+  if (validationMemo_isKnownValid(&key)) {
+    return CRYPTID_VALIDATION_SUCCESS;
+  }
+
+  if (primalityTest_isProbablePrime(ellipticCurve.fieldOrder)) {
+    validationMemo_rememberValid(&key);
     return CRYPTID_VALIDATION_SUCCESS;
   }
 
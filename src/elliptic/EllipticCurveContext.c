@@ -0,0 +1,119 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "gmp.h"
+
+#include "complex/GtElement.h"
+#include "elliptic/EllipticCurveContext.h"
+#include "util/WindowedNaf.h"
+
+CryptidStatus ellipticCurveContext_init(EllipticCurveContext *contextOutput,
+                                        const EllipticCurve ellipticCurve,
+                                        const mpz_t subgroupOrder) {
+  const MontgomeryContext *montgomeryContext =
+      &contextOutput->montgomeryContext;
+  montgomeryContext_init(&contextOutput->montgomeryContext,
+                         ellipticCurve.fieldOrder);
+
+  CryptidStatus status = fieldElement_checkSupported(montgomeryContext);
+  if (status) {
+    montgomeryContext_destroy(contextOutput->montgomeryContext);
+    return status;
+  }
+
+  ellipticCurve_init(&contextOutput->ellipticCurve, ellipticCurve.a,
+                     ellipticCurve.b, ellipticCurve.fieldOrder);
+  mpz_init_set(contextOutput->subgroupOrder, subgroupOrder);
+
+  // The NAF is the width-2 NAF.
+  contextOutput->subgroupOrderDigits =
+      (signed char *)malloc(windowedNaf_maxLength(subgroupOrder));
+  contextOutput->subgroupOrderDigitCount = windowedNaf_recode(
+      contextOutput->subgroupOrderDigits, subgroupOrder, 2);
+
+  mpz_inits(contextOutput->cubeRootExponent, contextOutput->cofactor,
+            contextOutput->minusThree, NULL);
+
+  mpz_t tmp;
+  mpz_init(tmp);
+
+  // \f$\frac{2 \cdot p - 1}{3}\f$
+  mpz_mul_ui(tmp, ellipticCurve.fieldOrder, 2);
+  mpz_sub_ui(tmp, tmp, 1);
+  mpz_cdiv_q_ui(contextOutput->cubeRootExponent, tmp, 3);
+
+  // \f$\frac{p + 1}{q}\f$
+  mpz_add_ui(tmp, ellipticCurve.fieldOrder, 1);
+  mpz_cdiv_q(contextOutput->cofactor, tmp, subgroupOrder);
+
+  // The final exponent \f$\frac{p^2 - 1}{q}\f$ is \f$(p - 1)\f$ times the
+  // cofactor. Only the cofactor needs an actual exponentiation, so its digits
+  // are recoded once here.
+  contextOutput->cofactorWindowSize =
+      gtElement_windowSize(contextOutput->cofactor);
+  contextOutput->cofactorDigits =
+      (signed char *)malloc(windowedNaf_maxLength(contextOutput->cofactor));
+  contextOutput->cofactorDigitCount =
+      windowedNaf_recode(contextOutput->cofactorDigits,
+                         contextOutput->cofactor,
+                         contextOutput->cofactorWindowSize);
+
+  // \f$-3 \mod p\f$
+  mpz_set_si(tmp, -3);
+  mpz_mod(contextOutput->minusThree, tmp, ellipticCurve.fieldOrder);
+
+  const size_t n = montgomeryContext->limbCount;
+  contextOutput->limbs = (mp_limb_t *)malloc(3 * n * sizeof(mp_limb_t));
+  contextOutput->curveA = contextOutput->limbs;
+  contextOutput->xi =
+      complexFieldElement_view(contextOutput->limbs + n, montgomeryContext);
+
+  fieldElement_fromMpz(contextOutput->curveA, ellipticCurve.a,
+                       montgomeryContext);
+
+  // For Type-1 elliptic curves, the distortion map uses
+  // \f$\xi = \frac{p - 1}{2}(1 + 3^{\frac{p + 1}{4}}i)\f$, see
+  // {@code tate_performPairing}.
+  mpz_t axi, bxi, three;
+  mpz_inits(axi, bxi, three, NULL);
+
+  mpz_sub_ui(tmp, ellipticCurve.fieldOrder, 1);
+  mpz_cdiv_q_ui(axi, tmp, 2);
+
+  mpz_set_ui(three, 3);
+  mpz_add_ui(tmp, ellipticCurve.fieldOrder, 1);
+  mpz_cdiv_q_ui(tmp, tmp, 4);
+  mpz_powm(bxi, three, tmp, ellipticCurve.fieldOrder);
+  mpz_mul(bxi, bxi, axi);
+  mpz_mod(bxi, bxi, ellipticCurve.fieldOrder);
+
+  fieldElement_fromMpz(contextOutput->xi.real, axi, montgomeryContext);
+  fieldElement_fromMpz(contextOutput->xi.imaginary, bxi, montgomeryContext);
+
+  mpz_clears(axi, bxi, three, tmp, NULL);
+
+  ellipticCurveContext_computeFingerprint(contextOutput->fingerprint,
+                                         ellipticCurve, subgroupOrder);
+
+  return CRYPTID_SUCCESS;
+}
+
+void ellipticCurveContext_computeFingerprint(unsigned char *fingerprint,
+                                             const EllipticCurve ellipticCurve,
+                                             const mpz_t subgroupOrder) {
+  const mpz_srcptr values[] = {ellipticCurve.a, ellipticCurve.b,
+                               ellipticCurve.fieldOrder, subgroupOrder};
+  ValidationMemoKey key;
+  validationMemo_computeKey(&key, "EllipticCurveContext", values, 4);
+  memcpy(fingerprint, key.digest, VALIDATION_MEMO_KEY_LENGTH);
+}
+
+void ellipticCurveContext_destroy(EllipticCurveContext context) {
+  ellipticCurve_destroy(context.ellipticCurve);
+  mpz_clears(context.subgroupOrder, context.cubeRootExponent,
+             context.cofactor, context.minusThree, NULL);
+  free(context.subgroupOrderDigits);
+  free(context.cofactorDigits);
+  free(context.limbs);
+  montgomeryContext_destroy(context.montgomeryContext);
+}
@@ -0,0 +1,151 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "elliptic/EllipticCurveContextCache.h"
+#include "util/Mutex.h"
+
+typedef struct EllipticCurveContextCacheEntry {
+  // The first member, so that a released context leads back to its entry.
+  EllipticCurveContext context;
+
+  // The number of callers holding the context, plus one while it is in the
+  // cache.
+  size_t referenceCount;
+} EllipticCurveContextCacheEntry;
+
+static CryptidMutex ellipticCurveContextCacheMutex = CRYPTID_MUTEX_INITIALIZER;
+
+// The entries form a ring, {@code ellipticCurveContextCacheNext} is the slot
+// the next entry is written to, evicting the oldest one once the ring is full.
+static EllipticCurveContextCacheEntry
+    *ellipticCurveContextCacheEntries[ELLIPTIC_CURVE_CONTEXT_CACHE_CAPACITY];
+static size_t ellipticCurveContextCacheCount = 0;
+static size_t ellipticCurveContextCacheNext = 0;
+
+static EllipticCurveContextCacheEntry *
+ellipticCurveContextCache_find(const unsigned char *fingerprint) {
+  for (size_t i = 0; i < ellipticCurveContextCacheCount; i++) {
+    EllipticCurveContextCacheEntry *entry = ellipticCurveContextCacheEntries[i];
+    if (!memcmp(entry->context.fingerprint, fingerprint,
+                VALIDATION_MEMO_KEY_LENGTH)) {
+      return entry;
+    }
+  }
+
+  return NULL;
+}
+
+// Drops a reference to the entry, and tells whether it was the last one. Must
+// be called with the mutex held.
+static int
+ellipticCurveContextCache_unreference(EllipticCurveContextCacheEntry *entry) {
+  entry->referenceCount--;
+
+  return entry->referenceCount == 0;
+}
+
+static void
+ellipticCurveContextCache_destroyEntry(EllipticCurveContextCacheEntry *entry) {
+  ellipticCurveContext_destroy(entry->context);
+  free(entry);
+}
+
+CryptidStatus
+ellipticCurveContextCache_acquire(const EllipticCurveContext **result,
+                                  const EllipticCurve ellipticCurve,
+                                  const mpz_t subgroupOrder) {
+  unsigned char fingerprint[VALIDATION_MEMO_KEY_LENGTH];
+  ellipticCurveContext_computeFingerprint(fingerprint, ellipticCurve,
+                                          subgroupOrder);
+
+  mutex_lock(&ellipticCurveContextCacheMutex);
+  EllipticCurveContextCacheEntry *entry =
+      ellipticCurveContextCache_find(fingerprint);
+  if (entry) {
+    entry->referenceCount++;
+    mutex_unlock(&ellipticCurveContextCacheMutex);
+    *result = &entry->context;
+    return CRYPTID_SUCCESS;
+  }
+  mutex_unlock(&ellipticCurveContextCacheMutex);
+
+  // The constants are derived outside of the lock, as they take an
+  // exponentiation in the field.
+  EllipticCurveContextCacheEntry *created =
+      (EllipticCurveContextCacheEntry *)malloc(
+          sizeof(EllipticCurveContextCacheEntry));
+  CryptidStatus status =
+      ellipticCurveContext_init(&created->context, ellipticCurve, subgroupOrder);
+  if (status) {
+    free(created);
+    return status;
+  }
+  created->referenceCount = 2;
+
+  mutex_lock(&ellipticCurveContextCacheMutex);
+  // Another thread may have derived the same context meanwhile.
+  entry = ellipticCurveContextCache_find(fingerprint);
+  if (entry) {
+    entry->referenceCount++;
+    mutex_unlock(&ellipticCurveContextCacheMutex);
+    ellipticCurveContextCache_destroyEntry(created);
+    *result = &entry->context;
+    return CRYPTID_SUCCESS;
+  }
+
+  EllipticCurveContextCacheEntry *evicted = NULL;
+  if (ellipticCurveContextCacheCount == ELLIPTIC_CURVE_CONTEXT_CACHE_CAPACITY) {
+    EllipticCurveContextCacheEntry *oldest =
+        ellipticCurveContextCacheEntries[ellipticCurveContextCacheNext];
+    if (ellipticCurveContextCache_unreference(oldest)) {
+      evicted = oldest;
+    }
+  } else {
+    ellipticCurveContextCacheCount++;
+  }
+  ellipticCurveContextCacheEntries[ellipticCurveContextCacheNext] = created;
+  ellipticCurveContextCacheNext = (ellipticCurveContextCacheNext + 1) %
+                                  ELLIPTIC_CURVE_CONTEXT_CACHE_CAPACITY;
+  mutex_unlock(&ellipticCurveContextCacheMutex);
+
+  if (evicted) {
+    ellipticCurveContextCache_destroyEntry(evicted);
+  }
+
+  *result = &created->context;
+  return CRYPTID_SUCCESS;
+}
+
+void ellipticCurveContextCache_release(const EllipticCurveContext *context) {
+  EllipticCurveContextCacheEntry *entry =
+      (EllipticCurveContextCacheEntry *)context;
+
+  mutex_lock(&ellipticCurveContextCacheMutex);
+  const int isLastReference = ellipticCurveContextCache_unreference(entry);
+  mutex_unlock(&ellipticCurveContextCacheMutex);
+
+  if (isLastReference) {
+    ellipticCurveContextCache_destroyEntry(entry);
+  }
+}
+
+void ellipticCurveContextCache_flush(void) {
+  EllipticCurveContextCacheEntry
+      *evicted[ELLIPTIC_CURVE_CONTEXT_CACHE_CAPACITY];
+  size_t evictedCount = 0;
+
+  mutex_lock(&ellipticCurveContextCacheMutex);
+  for (size_t i = 0; i < ellipticCurveContextCacheCount; i++) {
+    EllipticCurveContextCacheEntry *entry = ellipticCurveContextCacheEntries[i];
+    if (ellipticCurveContextCache_unreference(entry)) {
+      evicted[evictedCount++] = entry;
+    }
+  }
+  ellipticCurveContextCacheCount = 0;
+  ellipticCurveContextCacheNext = 0;
+  mutex_unlock(&ellipticCurveContextCacheMutex);
+
+  for (size_t i = 0; i < evictedCount; i++) {
+    ellipticCurveContextCache_destroyEntry(evicted[i]);
+  }
+}
@@ -0,0 +1,162 @@
+#include "elliptic/FieldAffinePoint.h"
+
+FieldAffinePoint fieldAffine_view(mp_limb_t *limbs,
+                                  const MontgomeryContext *montgomeryContext) {
+  FieldAffinePoint point;
+
+  point.x = limbs;
+  point.y = limbs + montgomeryContext->limbCount;
+  point.isInfinity = 1;
+
+  return point;
+}
+
+void fieldAffine_fromAffinePoint(FieldAffinePoint *result,
+                                 const AffinePoint affinePoint,
+                                 const MontgomeryContext *montgomeryContext) {
+  if (affine_isInfinity(affinePoint)) {
+    result->isInfinity = 1;
+    return;
+  }
+
+  fieldElement_fromMpz(result->x, affinePoint.x, montgomeryContext);
+  fieldElement_fromMpz(result->y, affinePoint.y, montgomeryContext);
+  result->isInfinity = 0;
+}
+
+void fieldAffine_toAffinePoint(AffinePoint *result,
+                               const FieldAffinePoint *point,
+                               const MontgomeryContext *montgomeryContext) {
+  if (point->isInfinity) {
+    *result = affine_infinity();
+    return;
+  }
+
+  mpz_inits(result->x, result->y, NULL);
+  fieldElement_toMpz(result->x, point->x, montgomeryContext);
+  fieldElement_toMpz(result->y, point->y, montgomeryContext);
+  result->isInfinity = 0;
+}
+
+void fieldAffine_copy(FieldAffinePoint *result, const FieldAffinePoint *point,
+                      const MontgomeryContext *montgomeryContext) {
+  result->isInfinity = point->isInfinity;
+  if (!point->isInfinity) {
+    fieldElement_copy(result->x, point->x, montgomeryContext);
+    fieldElement_copy(result->y, point->y, montgomeryContext);
+  }
+}
+
+int fieldAffine_isEquals(const FieldAffinePoint *point1,
+                         const FieldAffinePoint *point2,
+                         const MontgomeryContext *montgomeryContext) {
+  if (point1->isInfinity || point2->isInfinity) {
+    return point1->isInfinity && point2->isInfinity;
+  }
+
+  return fieldElement_isEquals(point1->x, point2->x, montgomeryContext) &&
+         fieldElement_isEquals(point1->y, point2->y, montgomeryContext);
+}
+
+void fieldAffine_negate(FieldAffinePoint *result, const FieldAffinePoint *point,
+                        const MontgomeryContext *montgomeryContext) {
+  result->isInfinity = point->isInfinity;
+  if (!point->isInfinity) {
+    fieldElement_copy(result->x, point->x, montgomeryContext);
+    fieldElement_negate(result->y, point->y, montgomeryContext);
+  }
+}
+
+CryptidStatus fieldAffine_double(FieldAffinePoint *result,
+                                 const FieldAffinePoint *point,
+                                 const FieldElement *curveA,
+                                 const MontgomeryContext *montgomeryContext) {
+  // Doubling infinity or a point with zero \f$y\f$ coordinate yields infinity.
+  if (point->isInfinity || fieldElement_isZero(point->y, montgomeryContext)) {
+    result->isInfinity = 1;
+    return CRYPTID_SUCCESS;
+  }
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t m[n], tmp[n], x3[n];
+
+  // \f$\frac{3x^{2} + a}{2y}\f$
+  fieldElement_square(tmp, point->x, montgomeryContext);
+  fieldElement_add(m, tmp, tmp, montgomeryContext);
+  fieldElement_add(m, m, tmp, montgomeryContext);
+  fieldElement_add(m, m, curveA, montgomeryContext);
+
+  fieldElement_add(tmp, point->y, point->y, montgomeryContext);
+  CryptidStatus status = fieldElement_invert(tmp, tmp, montgomeryContext);
+  if (status) {
+    return status;
+  }
+  fieldElement_mul(m, m, tmp, montgomeryContext);
+
+  // \f$x_3 = m^{2}-2x_1\f$
+  fieldElement_square(x3, m, montgomeryContext);
+  fieldElement_sub(x3, x3, point->x, montgomeryContext);
+  fieldElement_sub(x3, x3, point->x, montgomeryContext);
+
+  // \f$y_3 = m(x - x_3) - y\f$
+  fieldElement_sub(tmp, point->x, x3, montgomeryContext);
+  fieldElement_mul(tmp, m, tmp, montgomeryContext);
+  fieldElement_sub(result->y, tmp, point->y, montgomeryContext);
+
+  fieldElement_copy(result->x, x3, montgomeryContext);
+  result->isInfinity = 0;
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus fieldAffine_add(FieldAffinePoint *result,
+                              const FieldAffinePoint *point1,
+                              const FieldAffinePoint *point2,
+                              const FieldElement *curveA,
+                              const MontgomeryContext *montgomeryContext) {
+  if (point1->isInfinity) {
+    fieldAffine_copy(result, point2, montgomeryContext);
+    return CRYPTID_SUCCESS;
+  }
+
+  if (point2->isInfinity) {
+    fieldAffine_copy(result, point1, montgomeryContext);
+    return CRYPTID_SUCCESS;
+  }
+
+  if (fieldElement_isEquals(point1->x, point2->x, montgomeryContext)) {
+    if (fieldElement_isEquals(point1->y, point2->y, montgomeryContext)) {
+      return fieldAffine_double(result, point1, curveA, montgomeryContext);
+    }
+
+    result->isInfinity = 1;
+    return CRYPTID_SUCCESS;
+  }
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t m[n], tmp[n], x3[n];
+
+  // \f$\frac{y_2 - y_1}{x_2 - x_1}\f$
+  fieldElement_sub(tmp, point2->x, point1->x, montgomeryContext);
+  CryptidStatus status = fieldElement_invert(tmp, tmp, montgomeryContext);
+  if (status) {
+    return status;
+  }
+  fieldElement_sub(m, point2->y, point1->y, montgomeryContext);
+  fieldElement_mul(m, m, tmp, montgomeryContext);
+
+  // \f$x_3 = m^{2}-x_1-x_2\f$
+  fieldElement_square(x3, m, montgomeryContext);
+  fieldElement_sub(x3, x3, point1->x, montgomeryContext);
+  fieldElement_sub(x3, x3, point2->x, montgomeryContext);
+
+  // \f$y_3 = m(x_1 - x_3) - y_1\f$
+  fieldElement_sub(tmp, point1->x, x3, montgomeryContext);
+  fieldElement_mul(tmp, m, tmp, montgomeryContext);
+  fieldElement_sub(result->y, tmp, point1->y, montgomeryContext);
+
+  fieldElement_copy(result->x, x3, montgomeryContext);
+  result->isInfinity = 0;
+
+  return CRYPTID_SUCCESS;
+}
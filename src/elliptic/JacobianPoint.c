@@ -0,0 +1,340 @@
+#include <stdlib.h>
+
+#include "elliptic/JacobianPoint.h"
+
+// References:
+//   * [Guide-to-ECC] Darrel Hankerson, Alfred J. Menezes, and Scott Vanstone.
+//   2010. Guide to Elliptic Curve Cryptography (1st ed.). Springer Publishing
+//   Company, Incorporated.
+//   * [EFD] Daniel J. Bernstein and Tanja Lange. Explicit-Formulas Database.
+//   https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html
+
+JacobianPoint jacobian_view(mp_limb_t *limbs,
+                            const MontgomeryContext *montgomeryContext) {
+  JacobianPoint point;
+
+  point.x = limbs;
+  point.y = limbs + montgomeryContext->limbCount;
+  point.z = limbs + 2 * montgomeryContext->limbCount;
+
+  return point;
+}
+
+void jacobian_copy(JacobianPoint *result, const JacobianPoint *point,
+                   const MontgomeryContext *montgomeryContext) {
+  fieldElement_copy(result->x, point->x, montgomeryContext);
+  fieldElement_copy(result->y, point->y, montgomeryContext);
+  fieldElement_copy(result->z, point->z, montgomeryContext);
+}
+
+void jacobian_setInfinity(JacobianPoint *result,
+                          const MontgomeryContext *montgomeryContext) {
+  fieldElement_setOne(result->x, montgomeryContext);
+  fieldElement_setOne(result->y, montgomeryContext);
+  fieldElement_setZero(result->z, montgomeryContext);
+}
+
+int jacobian_isInfinity(const JacobianPoint *point,
+                        const MontgomeryContext *montgomeryContext) {
+  return fieldElement_isZero(point->z, montgomeryContext);
+}
+
+void jacobian_fromFieldAffinePoint(JacobianPoint *result,
+                                   const FieldAffinePoint *point,
+                                   const MontgomeryContext *montgomeryContext) {
+  if (point->isInfinity) {
+    jacobian_setInfinity(result, montgomeryContext);
+    return;
+  }
+
+  fieldElement_copy(result->x, point->x, montgomeryContext);
+  fieldElement_copy(result->y, point->y, montgomeryContext);
+  fieldElement_setOne(result->z, montgomeryContext);
+}
+
+CryptidStatus
+jacobian_toFieldAffinePoint(FieldAffinePoint *result,
+                            const JacobianPoint *point,
+                            const MontgomeryContext *montgomeryContext) {
+  if (jacobian_isInfinity(point, montgomeryContext)) {
+    result->isInfinity = 1;
+    return CRYPTID_SUCCESS;
+  }
+
+  // \f$(x, y) = (X \cdot Z^{-2}, Y \cdot Z^{-3})\f$
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t zInverse[n], zInverseSquared[n];
+  CryptidStatus status =
+      fieldElement_invert(zInverse, point->z, montgomeryContext);
+  if (status) {
+    return status;
+  }
+
+  fieldElement_square(zInverseSquared, zInverse, montgomeryContext);
+  fieldElement_mul(result->x, point->x, zInverseSquared, montgomeryContext);
+  fieldElement_mul(zInverse, zInverse, zInverseSquared, montgomeryContext);
+  fieldElement_mul(result->y, point->y, zInverse, montgomeryContext);
+  result->isInfinity = 0;
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus
+jacobian_toFieldAffinePoints(FieldAffinePoint *results,
+                             const JacobianPoint *points, const size_t count,
+                             const MontgomeryContext *montgomeryContext) {
+  if (count == 0) {
+    return CRYPTID_SUCCESS;
+  }
+
+  // Simultaneous inversion, see Algorithm 2.26 in [Guide-to-ECC]. The prefix
+  // products of the \f$Z\f$ coordinates are inverted at once, then the
+  // individual inverses are peeled off backwards. Points at infinity are
+  // skipped.
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t *prefixProducts =
+      (mp_limb_t *)malloc(count * n * sizeof(mp_limb_t));
+
+  mp_limb_t accumulator[n];
+  fieldElement_setOne(accumulator, montgomeryContext);
+  for (size_t i = 0; i < count; ++i) {
+    fieldElement_copy(prefixProducts + i * n, accumulator, montgomeryContext);
+    if (!jacobian_isInfinity(&points[i], montgomeryContext)) {
+      fieldElement_mul(accumulator, accumulator, points[i].z,
+                       montgomeryContext);
+    }
+  }
+
+  CryptidStatus status =
+      fieldElement_invert(accumulator, accumulator, montgomeryContext);
+  if (status) {
+    free(prefixProducts);
+    return status;
+  }
+
+  mp_limb_t zInverse[n], zInverseSquared[n];
+  for (size_t i = count; i-- > 0;) {
+    const JacobianPoint *point = &points[i];
+    if (jacobian_isInfinity(point, montgomeryContext)) {
+      results[i].isInfinity = 1;
+      continue;
+    }
+
+    // \f$Z_i^{-1} = (Z_0 \cdots Z_i)^{-1} \cdot (Z_0 \cdots Z_{i-1})\f$
+    fieldElement_mul(zInverse, accumulator, prefixProducts + i * n,
+                     montgomeryContext);
+    fieldElement_mul(accumulator, accumulator, point->z, montgomeryContext);
+
+    fieldElement_square(zInverseSquared, zInverse, montgomeryContext);
+    fieldElement_mul(results[i].x, point->x, zInverseSquared,
+                     montgomeryContext);
+    fieldElement_mul(zInverse, zInverse, zInverseSquared,
+                     montgomeryContext);
+    fieldElement_mul(results[i].y, point->y, zInverse, montgomeryContext);
+    results[i].isInfinity = 0;
+  }
+
+  free(prefixProducts);
+
+  return CRYPTID_SUCCESS;
+}
+
+void jacobian_double(JacobianPoint *result, const JacobianPoint *point,
+                     const FieldElement *curveA,
+                     const MontgomeryContext *montgomeryContext) {
+  // Formulas dbl-2009-l (for \f$a = 0\f$) and dbl-2007-bl from [EFD].
+  if (jacobian_isInfinity(point, montgomeryContext) ||
+      fieldElement_isZero(point->y, montgomeryContext)) {
+    jacobian_setInfinity(result, montgomeryContext);
+    return;
+  }
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t xx[n], yy[n], yyyy[n], s[n], m[n], tmp[n];
+
+  fieldElement_square(xx, point->x, montgomeryContext);
+  fieldElement_square(yy, point->y, montgomeryContext);
+  fieldElement_square(yyyy, yy, montgomeryContext);
+
+  // \f$S = 2((X + YY)^2 - XX - YYYY)\f$
+  fieldElement_add(s, point->x, yy, montgomeryContext);
+  fieldElement_square(s, s, montgomeryContext);
+  fieldElement_sub(s, s, xx, montgomeryContext);
+  fieldElement_sub(s, s, yyyy, montgomeryContext);
+  fieldElement_add(s, s, s, montgomeryContext);
+
+  // \f$M = 3XX + aZ^4\f$
+  fieldElement_add(m, xx, xx, montgomeryContext);
+  fieldElement_add(m, m, xx, montgomeryContext);
+  if (!fieldElement_isZero(curveA, montgomeryContext)) {
+    fieldElement_square(tmp, point->z, montgomeryContext);
+    fieldElement_square(tmp, tmp, montgomeryContext);
+    fieldElement_mul(tmp, tmp, curveA, montgomeryContext);
+    fieldElement_add(m, m, tmp, montgomeryContext);
+  }
+
+  // \f$Z_3 = 2YZ\f$
+  fieldElement_mul(result->z, point->y, point->z, montgomeryContext);
+  fieldElement_add(result->z, result->z, result->z, montgomeryContext);
+
+  // \f$X_3 = M^2 - 2S\f$
+  fieldElement_square(result->x, m, montgomeryContext);
+  fieldElement_sub(result->x, result->x, s, montgomeryContext);
+  fieldElement_sub(result->x, result->x, s, montgomeryContext);
+
+  // \f$Y_3 = M(S - X_3) - 8YYYY\f$
+  fieldElement_sub(s, s, result->x, montgomeryContext);
+  fieldElement_mul(s, m, s, montgomeryContext);
+  fieldElement_add(yyyy, yyyy, yyyy, montgomeryContext);
+  fieldElement_add(yyyy, yyyy, yyyy, montgomeryContext);
+  fieldElement_add(yyyy, yyyy, yyyy, montgomeryContext);
+  fieldElement_sub(result->y, s, yyyy, montgomeryContext);
+}
+
+void jacobian_addMixed(JacobianPoint *result, const JacobianPoint *point1,
+                       const FieldAffinePoint *point2,
+                       const FieldElement *curveA,
+                       const MontgomeryContext *montgomeryContext) {
+  // Formula madd-2007-bl from [EFD].
+  if (point2->isInfinity) {
+    if (result != point1) {
+      jacobian_copy(result, point1, montgomeryContext);
+    }
+    return;
+  }
+
+  if (jacobian_isInfinity(point1, montgomeryContext)) {
+    jacobian_fromFieldAffinePoint(result, point2, montgomeryContext);
+    return;
+  }
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t z1z1[n], u2[n], s2[n], h[n], hh[n], i[n], j[n], r[n], v[n];
+
+  // \f$U_2 = X_2 Z_1^2\f$, \f$S_2 = Y_2 Z_1^3\f$
+  fieldElement_square(z1z1, point1->z, montgomeryContext);
+  fieldElement_mul(u2, point2->x, z1z1, montgomeryContext);
+  fieldElement_mul(s2, point1->z, z1z1, montgomeryContext);
+  fieldElement_mul(s2, point2->y, s2, montgomeryContext);
+
+  // \f$H = U_2 - X_1\f$, \f$r = 2(S_2 - Y_1)\f$
+  fieldElement_sub(h, u2, point1->x, montgomeryContext);
+  fieldElement_sub(r, s2, point1->y, montgomeryContext);
+
+  if (fieldElement_isZero(h, montgomeryContext)) {
+    // Same \f$x\f$ coordinates: either a doubling or opposite points.
+    if (fieldElement_isZero(r, montgomeryContext)) {
+      jacobian_double(result, point1, curveA, montgomeryContext);
+    } else {
+      jacobian_setInfinity(result, montgomeryContext);
+    }
+    return;
+  }
+
+  fieldElement_add(r, r, r, montgomeryContext);
+
+  // \f$I = 4H^2\f$, \f$J = HI\f$, \f$V = X_1 I\f$
+  fieldElement_square(hh, h, montgomeryContext);
+  fieldElement_add(i, hh, hh, montgomeryContext);
+  fieldElement_add(i, i, i, montgomeryContext);
+  fieldElement_mul(j, h, i, montgomeryContext);
+  fieldElement_mul(v, point1->x, i, montgomeryContext);
+
+  // \f$Z_3 = (Z_1 + H)^2 - Z_1Z_1 - HH\f$
+  fieldElement_add(result->z, point1->z, h, montgomeryContext);
+  fieldElement_square(result->z, result->z, montgomeryContext);
+  fieldElement_sub(result->z, result->z, z1z1, montgomeryContext);
+  fieldElement_sub(result->z, result->z, hh, montgomeryContext);
+
+  // \f$Y_1 J\f$ has to be computed before \f$Y_1\f$ might be overwritten.
+  fieldElement_mul(j, point1->y, j, montgomeryContext);
+  fieldElement_add(j, j, j, montgomeryContext);
+  fieldElement_mul(i, h, i, montgomeryContext);
+
+  // \f$X_3 = r^2 - J - 2V\f$
+  fieldElement_square(result->x, r, montgomeryContext);
+  fieldElement_sub(result->x, result->x, i, montgomeryContext);
+  fieldElement_sub(result->x, result->x, v, montgomeryContext);
+  fieldElement_sub(result->x, result->x, v, montgomeryContext);
+
+  // \f$Y_3 = r(V - X_3) - 2Y_1J\f$
+  fieldElement_sub(v, v, result->x, montgomeryContext);
+  fieldElement_mul(v, r, v, montgomeryContext);
+  fieldElement_sub(result->y, v, j, montgomeryContext);
+}
+
+void jacobian_add(JacobianPoint *result, const JacobianPoint *point1,
+                  const JacobianPoint *point2, const FieldElement *curveA,
+                  const MontgomeryContext *montgomeryContext) {
+  // Formula add-2007-bl from [EFD].
+  if (jacobian_isInfinity(point1, montgomeryContext)) {
+    if (result != point2) {
+      jacobian_copy(result, point2, montgomeryContext);
+    }
+    return;
+  }
+
+  if (jacobian_isInfinity(point2, montgomeryContext)) {
+    if (result != point1) {
+      jacobian_copy(result, point1, montgomeryContext);
+    }
+    return;
+  }
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t z1z1[n], z2z2[n], u1[n], u2[n], s1[n], s2[n], h[n], i[n], j[n],
+      r[n], v[n];
+
+  // \f$U_1 = X_1 Z_2^2\f$, \f$U_2 = X_2 Z_1^2\f$, \f$S_1 = Y_1 Z_2^3\f$,
+  // \f$S_2 = Y_2 Z_1^3\f$
+  fieldElement_square(z1z1, point1->z, montgomeryContext);
+  fieldElement_square(z2z2, point2->z, montgomeryContext);
+  fieldElement_mul(u1, point1->x, z2z2, montgomeryContext);
+  fieldElement_mul(u2, point2->x, z1z1, montgomeryContext);
+  fieldElement_mul(s1, point2->z, z2z2, montgomeryContext);
+  fieldElement_mul(s1, point1->y, s1, montgomeryContext);
+  fieldElement_mul(s2, point1->z, z1z1, montgomeryContext);
+  fieldElement_mul(s2, point2->y, s2, montgomeryContext);
+
+  // \f$H = U_2 - U_1\f$, \f$r = 2(S_2 - S_1)\f$
+  fieldElement_sub(h, u2, u1, montgomeryContext);
+  fieldElement_sub(r, s2, s1, montgomeryContext);
+
+  if (fieldElement_isZero(h, montgomeryContext)) {
+    // Same affine \f$x\f$ coordinates: either a doubling or opposite points.
+    if (fieldElement_isZero(r, montgomeryContext)) {
+      jacobian_double(result, point1, curveA, montgomeryContext);
+    } else {
+      jacobian_setInfinity(result, montgomeryContext);
+    }
+    return;
+  }
+
+  fieldElement_add(r, r, r, montgomeryContext);
+
+  // \f$I = (2H)^2\f$, \f$J = HI\f$, \f$V = U_1 I\f$
+  fieldElement_add(i, h, h, montgomeryContext);
+  fieldElement_square(i, i, montgomeryContext);
+  fieldElement_mul(j, h, i, montgomeryContext);
+  fieldElement_mul(v, u1, i, montgomeryContext);
+
+  // \f$Z_3 = ((Z_1 + Z_2)^2 - Z_1Z_1 - Z_2Z_2) H\f$
+  fieldElement_add(result->z, point1->z, point2->z, montgomeryContext);
+  fieldElement_square(result->z, result->z, montgomeryContext);
+  fieldElement_sub(result->z, result->z, z1z1, montgomeryContext);
+  fieldElement_sub(result->z, result->z, z2z2, montgomeryContext);
+  fieldElement_mul(result->z, result->z, h, montgomeryContext);
+
+  // \f$X_3 = r^2 - J - 2V\f$
+  fieldElement_square(result->x, r, montgomeryContext);
+  fieldElement_sub(result->x, result->x, j, montgomeryContext);
+  fieldElement_sub(result->x, result->x, v, montgomeryContext);
+  fieldElement_sub(result->x, result->x, v, montgomeryContext);
+
+  // \f$Y_3 = r(V - X_3) - 2 S_1 J\f$
+  fieldElement_mul(s1, s1, j, montgomeryContext);
+  fieldElement_add(s1, s1, s1, montgomeryContext);
+  fieldElement_sub(v, v, result->x, montgomeryContext);
+  fieldElement_mul(v, r, v, montgomeryContext);
+  fieldElement_sub(result->y, v, s1, montgomeryContext);
+}
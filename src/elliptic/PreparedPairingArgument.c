@@ -0,0 +1,135 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "elliptic/FieldAffinePoint.h"
+#include "elliptic/PreparedPairingArgument.h"
+
+// Every step stores the three coefficients of its line and the \f$x\f$
+// coordinate of its vertical line.
+#define COEFFICIENTS_PER_STEP 4
+
+static void
+preparedPairingArgument_storeStep(PreparedPairingArgument *argument,
+                                  const size_t step, const DivisorLine *line,
+                                  const FieldAffinePoint *vertical) {
+  const size_t n = argument->limbCount;
+  mp_limb_t *coefficients =
+      argument->coefficients + step * COEFFICIENTS_PER_STEP * n;
+
+  memcpy(coefficients, line->a, n * sizeof(mp_limb_t));
+  memcpy(coefficients + n, line->b, n * sizeof(mp_limb_t));
+  memcpy(coefficients + 2 * n, line->c, n * sizeof(mp_limb_t));
+
+  argument->hasVertical[step] = !vertical->isInfinity;
+  if (!vertical->isInfinity) {
+    memcpy(coefficients + 3 * n, vertical->x, n * sizeof(mp_limb_t));
+  }
+}
+
+CryptidStatus
+preparedPairingArgument_init(PreparedPairingArgument *argumentOutput,
+                             const AffinePoint p,
+                             const EllipticCurveContext *context) {
+  // The same steps as in {@code tate_performPairing}, recording the lines
+  // instead of evaluating them.
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+  const signed char *digits = context->subgroupOrderDigits;
+  const size_t topDigit = context->subgroupOrderDigitCount - 1;
+  const size_t n = montgomeryContext->limbCount;
+
+  size_t stepCount = 0;
+  for (size_t i = topDigit; i-- > 0;) {
+    stepCount += digits[i] ? 2 : 1;
+  }
+
+  mp_limb_t pointLimbs[8 * n];
+  FieldAffinePoint fieldP = fieldAffine_view(pointLimbs, montgomeryContext);
+  FieldAffinePoint negativeP =
+      fieldAffine_view(pointLimbs + 2 * n, montgomeryContext);
+  FieldAffinePoint v = fieldAffine_view(pointLimbs + 4 * n, montgomeryContext);
+  FieldAffinePoint nextV =
+      fieldAffine_view(pointLimbs + 6 * n, montgomeryContext);
+  fieldAffine_fromAffinePoint(&fieldP, p, montgomeryContext);
+  fieldAffine_negate(&negativeP, &fieldP, montgomeryContext);
+  fieldAffine_copy(&v, &fieldP, montgomeryContext);
+
+  argumentOutput->stepCount = stepCount;
+  argumentOutput->limbCount = n;
+  argumentOutput->coefficients = (mp_limb_t *)calloc(
+      stepCount * COEFFICIENTS_PER_STEP * n, sizeof(mp_limb_t));
+  argumentOutput->hasVertical =
+      (unsigned char *)calloc(stepCount, sizeof(unsigned char));
+  argumentOutput->pointX = NULL;
+  if (!fieldP.isInfinity) {
+    argumentOutput->pointX = (mp_limb_t *)malloc(n * sizeof(mp_limb_t));
+    memcpy(argumentOutput->pointX, fieldP.x, n * sizeof(mp_limb_t));
+  }
+
+  mp_limb_t lineLimbs[3 * n];
+  DivisorLine line = divisor_viewLine(lineLimbs, montgomeryContext);
+  size_t step = 0;
+  for (size_t i = topDigit; i-- > 0;) {
+    // Double step
+    CryptidStatus status =
+        fieldAffine_double(&nextV, &v, context->curveA, montgomeryContext);
+    if (status) {
+      preparedPairingArgument_destroy(*argumentOutput);
+      return status;
+    }
+    divisor_montgomeryTangentLine(&line, &v, montgomeryContext);
+    preparedPairingArgument_storeStep(argumentOutput, step++, &line, &nextV);
+    fieldAffine_copy(&v, &nextV, montgomeryContext);
+
+    if (digits[i]) {
+      // Add step, adding \f$-p\f$ for a negative digit
+      const FieldAffinePoint *addend = digits[i] > 0 ? &fieldP : &negativeP;
+      status = fieldAffine_add(&nextV, &v, addend, context->curveA,
+                               montgomeryContext);
+      if (status) {
+        preparedPairingArgument_destroy(*argumentOutput);
+        return status;
+      }
+      divisor_montgomeryChordLine(&line, &v, addend, montgomeryContext);
+      preparedPairingArgument_storeStep(argumentOutput, step++, &line,
+                                        &nextV);
+      fieldAffine_copy(&v, &nextV, montgomeryContext);
+    }
+  }
+
+  return CRYPTID_SUCCESS;
+}
+
+void preparedPairingArgument_destroy(PreparedPairingArgument argument) {
+  free(argument.coefficients);
+  free(argument.hasVertical);
+  free(argument.pointX);
+}
+
+int preparedPairingArgument_loadStep(DivisorLine *line, FieldElement *verticalX,
+                                     const PreparedPairingArgument *argument,
+                                     const size_t step) {
+  const size_t n = argument->limbCount;
+  const mp_limb_t *coefficients =
+      argument->coefficients + step * COEFFICIENTS_PER_STEP * n;
+
+  memcpy(line->a, coefficients, n * sizeof(mp_limb_t));
+  memcpy(line->b, coefficients + n, n * sizeof(mp_limb_t));
+  memcpy(line->c, coefficients + 2 * n, n * sizeof(mp_limb_t));
+
+  if (!argument->hasVertical[step]) {
+    return 0;
+  }
+
+  memcpy(verticalX, coefficients + 3 * n, n * sizeof(mp_limb_t));
+  return 1;
+}
+
+int preparedPairingArgument_loadPointX(
+    FieldElement *x, const PreparedPairingArgument *argument) {
+  if (!argument->pointX) {
+    return 0;
+  }
+
+  memcpy(x, argument->pointX, argument->limbCount * sizeof(mp_limb_t));
+  return 1;
+}
@@ -1,19 +1,31 @@
+#include <stdlib.h>
+
 #include "elliptic/TatePairing.h"
+#include "complex/ComplexFieldElement.h"
+#include "complex/GtElement.h"
 #include "elliptic/Divisor.h"
+#include "elliptic/FieldAffinePoint.h"
+#include "elliptic/JacobianPoint.h"
+#include "elliptic/PreparedPairingArgument.h"
+#include "field/FieldElement.h"
+#include "field/MontgomeryContext.h"
 
 // References:
 //   * [Intro-to-IBE] Luther Martin. 2008. Introduction to Identity-Based
 //   Encryption (Information Security and Privacy Series) (1 ed.). Artech House,
 //   Inc., Norwood, MA, USA.
+//   * [Guide-to-ECC] Darrel Hankerson, Alfred J. Menezes, and Scott Vanstone.
+//   2010. Guide to Elliptic Curve Cryptography (1st ed.). Springer Publishing
+//   Company, Incorporated.
 
-CryptidStatus tate_performPairing(Complex *result, const AffinePoint p,
-                                  const AffinePoint b,
-                                  const int embeddingDegree,
-                                  const mpz_t subgroupOrder,
-                                  const EllipticCurve ellipticCurve) {
-  // Implementation of Miller's algorithm as it's written on this page:
-  // https://crypto.stanford.edu/pbc/notes/ep/miller.html
-  ComplexAffinePoint q;
+static void tate_distort(ComplexFieldElement *qX, FieldElement *qY,
+                         ComplexFieldElement *qXConjugate, const AffinePoint b,
+                         const EllipticCurveContext *context) {
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+
+  mp_limb_t fieldBLimbs[2 * montgomeryContext->limbCount];
+  FieldAffinePoint fieldB = fieldAffine_view(fieldBLimbs, montgomeryContext);
+  fieldAffine_fromAffinePoint(&fieldB, b, montgomeryContext);
 
   // Distortion map - Creates linearly independent points
   // For examples on distortion maps, see [Intro-to-IBE p63.].
@@ -21,169 +33,449 @@ CryptidStatus tate_performPairing(Complex *result, const AffinePoint p,
   // Here we use a Xi distortion map, which involves calculating a \f$\xi\f$
   // value. For Type-1 elliptic curves, this is calculated as follows: \f$\xi =
   // \frac{p - 1}{2}(1 + 3^{\frac{p + 1}{4}}i)\f$ where \f$p\f$ is the field
-  // order of the elliptic curve field.
-  if (affine_isInfinity(b)) {
-    q = complexAffine_infinity();
-  } else {
-    mpz_t axi, bxi, three, one, addition, quotient, difference;
-    mpz_inits(axi, bxi, three, one, addition, quotient, difference, NULL);
-    Complex xi, tmp, xprime;
+  // order of the elliptic curve field. The value is part of the context.
+  //
+  // \f$x^{\prime} = x \cdot xi\f$
+  // \f$x \in \f$F_p\f$ | \f$xi\f$ \in \f$F_p^2\f$
+  //
+  // \f$y^{\prime} = y\f$ stays in \f$F_p\f$, which makes the line values
+  // sparse.
+  complexFieldElement_mulFieldElement(qX, fieldB.x, &context->xi,
+                                      montgomeryContext);
+  fieldElement_copy(qY, fieldB.y, montgomeryContext);
+
+  // Denominator elimination. With \f$k = 2\f$, the final exponent is a
+  // multiple of \f$p - 1\f$, so it maps every element of \f$F_p\f$ to 1.
+  // Instead of dividing by the value \f$d\f$ of a vertical line, we multiply
+  // by its conjugate \f$\bar{d} = \frac{N(d)}{d}\f$, as the norm \f$N(d)\f$
+  // is in \f$F_p\f$. As \f$x_V\f$ is in \f$F_p\f$, \f$\bar{d}\f$ is the
+  // vertical line evaluated at \f$\bar{x}^{\prime}\f$, which saves an
+  // \f$F_p^2\f$ inversion in every step.
+  complexFieldElement_conjugate(qXConjugate, qX, montgomeryContext);
+}
+
+static void tate_cofactorExponentiation(Complex *result, GtElement *g,
+                                        const EllipticCurveContext *context) {
+  // The hard part raises an element of the cyclotomic subgroup to the
+  // cofactor \f$\frac{p + 1}{q}\f$ with the signed digits precomputed in the
+  // context.
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
 
-    mpz_sub_ui(difference, ellipticCurve.fieldOrder, 1);
-    mpz_cdiv_q_ui(axi, difference, 2);
+  gtElement_powDigits(g, g, context->cofactorDigits,
+                      context->cofactorDigitCount, context->cofactorWindowSize,
+                      montgomeryContext);
+  gtElement_toComplex(result, g, montgomeryContext);
+}
+
+static CryptidStatus
+tate_finalExponentiation(Complex *result, ComplexFieldElement *f,
+                         const EllipticCurveContext *context) {
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+
+  // The final exponent is \f$\frac{p^2 - 1}{q} = (p - 1)\frac{p + 1}{q}\f$.
+  // The Frobenius map \f$f \mapsto f^p\f$ is the conjugation in \f$F_p^2\f$,
+  // so the easy part is \f$f^{p - 1} = \frac{\bar{f}}{f}\f$, which costs a
+  // single inversion.
+  mp_limb_t inverseLimbs[2 * montgomeryContext->limbCount];
+  ComplexFieldElement inverse =
+      complexFieldElement_view(inverseLimbs, montgomeryContext);
+  CryptidStatus status =
+      complexFieldElement_invert(&inverse, f, montgomeryContext);
+  if (status) {
+    return status;
+  }
+  complexFieldElement_conjugate(f, f, montgomeryContext);
+  complexFieldElement_mul(f, f, &inverse, montgomeryContext);
 
-    mpz_set_ui(three, 3);
-    mpz_add_ui(addition, ellipticCurve.fieldOrder, 1);
-    mpz_cdiv_q_ui(quotient, addition, 4);
-    mpz_powm(bxi, three, quotient, ellipticCurve.fieldOrder);
+  // After the easy part, \f$f\f$ has norm 1, so it is in the cyclotomic
+  // subgroup, and it is exponentiated in place.
+  GtElement g;
+  g.value = *f;
+  tate_cofactorExponentiation(result, &g, context);
+
+  return CRYPTID_SUCCESS;
+}
 
-    mpz_set_ui(one, 1);
-    complex_initMpz(&tmp, one, bxi);
-    complex_modMulInteger(&xi, axi, tmp, ellipticCurve.fieldOrder);
+// The state of Miller's algorithm for a single pair of arguments.
+typedef struct MillerState {
+  // The first argument \f$p\f$ and its negative.
+  FieldAffinePoint p, negativeP;
 
-    // \f$x^{\prime} = x \cdot xi\f$
-    // \f$x \in \f$F_p\f$ | \f$xi\f$ \in \f$F_p^2\f$
-    //
-    // Here we assume, that we have to convert \f$x\f$ to \f$F_p^2\f$ and then
-    // perform the multiplication according to the complex multiplication rules.
-    complex_modMulInteger(&xprime, b.x, xi, ellipticCurve.fieldOrder);
+  // The current multiple \f$v\f$ of the first argument. Jacobian coordinates
+  // avoid an inversion in every step, as the lines only have to be known up
+  // to a factor in \f$F_p\f$.
+  JacobianPoint v;
 
-    mpz_t zero;
-    mpz_init_set_ui(zero, 0);
-    Complex bY;
-    complex_initMpz(&bY, b.y, zero);
+  // The distorted second argument, and the conjugate of its \f$x\f$
+  // coordinate.
+  ComplexFieldElement qX, qXConjugate;
+  FieldElement *qY;
 
-    complexAffine_init(&q, xprime, bY);
+  // The vertical line through \f$p\f$, evaluated at the conjugate.
+  ComplexFieldElement pVertical;
+} MillerState;
 
-    complex_destroy(bY);
-    mpz_clear(zero);
+// The number of field elements viewed by a MillerState.
+#define MILLER_STATE_ELEMENTS 14
 
-    mpz_clears(axi, bxi, three, one, addition, quotient, difference, NULL);
-    complex_destroyMany(3, xi, tmp, xprime);
+static MillerState
+tate_viewMillerState(mp_limb_t *limbs,
+                     const MontgomeryContext *montgomeryContext) {
+  const size_t n = montgomeryContext->limbCount;
+  MillerState state;
+
+  state.p = fieldAffine_view(limbs, montgomeryContext);
+  state.negativeP = fieldAffine_view(limbs + 2 * n, montgomeryContext);
+  state.v = jacobian_view(limbs + 4 * n, montgomeryContext);
+  state.qX = complexFieldElement_view(limbs + 7 * n, montgomeryContext);
+  state.qXConjugate =
+      complexFieldElement_view(limbs + 9 * n, montgomeryContext);
+  state.qY = limbs + 11 * n;
+  state.pVertical = complexFieldElement_view(limbs + 12 * n, montgomeryContext);
+
+  return state;
+}
+
+static void tate_initMillerState(MillerState *state, const AffinePoint p,
+                                 const AffinePoint b,
+                                 const EllipticCurveContext *context) {
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+
+  fieldAffine_fromAffinePoint(&state->p, p, montgomeryContext);
+  fieldAffine_negate(&state->negativeP, &state->p, montgomeryContext);
+  jacobian_fromFieldAffinePoint(&state->v, &state->p, montgomeryContext);
+  tate_distort(&state->qX, state->qY, &state->qXConjugate, b, context);
+  divisor_montgomeryEvaluateVertical(&state->pVertical, &state->p,
+                                     &state->qXConjugate, montgomeryContext);
+}
+
+static void tate_doubleStep(ComplexFieldElement *f, MillerState *state,
+                            const EllipticCurveContext *context) {
+  // \f$f = f \frac{g_{v, v}(q)}{g_{2v, -2v}(q)}\f$, the division being
+  // replaced by a multiplication with the conjugate. The doubling and the
+  // tangent are computed in one pass.
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t denominatorLimbs[2 * n], lineLimbs[3 * n];
+  ComplexFieldElement denominator =
+      complexFieldElement_view(denominatorLimbs, montgomeryContext);
+  DivisorLine line = divisor_viewLine(lineLimbs, montgomeryContext);
+
+  // \f$v = 2v\f$
+  divisor_jacobianDoubleAndTangent(&state->v, &line, &state->v,
+                                   context->curveA, montgomeryContext);
+
+  divisor_montgomeryMulDivisorLine(f, &line, &state->qX, state->qY,
+                                   montgomeryContext);
+  divisor_jacobianEvaluateVertical(&denominator, &state->v,
+                                   &state->qXConjugate, montgomeryContext);
+  complexFieldElement_mul(f, f, &denominator, montgomeryContext);
+}
+
+static void tate_addStep(ComplexFieldElement *f, MillerState *state,
+                         const signed char digit,
+                         const EllipticCurveContext *context) {
+  // With \f$d = \pm p\f$ depending on the sign of the digit,
+  // \f$f = f \frac{g_{v, d}(q)}{g_{v + d, -(v + d)}(q)}\f$
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+  const FieldAffinePoint *addend = digit > 0 ? &state->p : &state->negativeP;
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t denominatorLimbs[2 * n], lineLimbs[3 * n];
+  ComplexFieldElement denominator =
+      complexFieldElement_view(denominatorLimbs, montgomeryContext);
+  DivisorLine line = divisor_viewLine(lineLimbs, montgomeryContext);
+
+  // \f$v = v + d\f$
+  divisor_jacobianAddAndChord(&state->v, &line, &state->v, addend,
+                              context->curveA, montgomeryContext);
+
+  divisor_montgomeryMulDivisorLine(f, &line, &state->qX, state->qY,
+                                   montgomeryContext);
+  divisor_jacobianEvaluateVertical(&denominator, &state->v,
+                                   &state->qXConjugate, montgomeryContext);
+  complexFieldElement_mul(f, f, &denominator, montgomeryContext);
+
+  if (digit < 0) {
+    // The Miller function of \f$-p\f$ is \f$\frac{1}{g_{p, -p}}\f$, which
+    // is replaced by the conjugate as well.
+    complexFieldElement_mul(f, f, &state->pVertical, montgomeryContext);
   }
+}
+
+static void tate_millerLoop(ComplexFieldElement *f, MillerState *state,
+                            const EllipticCurveContext *context) {
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+  const signed char *digits = context->subgroupOrderDigits;
 
-  if (complexAffine_isInfinity(q)) {
-    complexAffine_destroy(q);
+  // 1. Set \f$f\f$ = 1 and \f$v\f$ = \f$p\f$
+  complexFieldElement_setOne(f, montgomeryContext);
+
+  // 2. {@code for i = t - 1 to 0 do:}
+  // where \f$t\f$ is the number of digits in the NAF of the subgroup order.
+  // The NAF has no adjacent nonzero digits, and the NAF of a Solinas prime
+  // has at most three, so almost every add step is skipped. A digit of -1
+  // adds \f$-p\f$ instead of \f$p\f$.
+  for (size_t i = context->subgroupOrderDigitCount - 1; i-- > 0;) {
+    // Double step
+    complexFieldElement_square(f, f, montgomeryContext);
+    tate_doubleStep(f, state, context);
+
+    if (digits[i]) {
+      // Add step
+      tate_addStep(f, state, digits[i], context);
+    }
+  }
+}
+
+CryptidStatus tate_performPairing(Complex *result, const AffinePoint p,
+                                  const AffinePoint b,
+                                  const EllipticCurveContext *context) {
+  // Implementation of Miller's algorithm as it's written on this page:
+  // https://crypto.stanford.edu/pbc/notes/ep/miller.html
+  if (affine_isInfinity(b)) {
     complex_initLong(result, 1, 0);
     return CRYPTID_SUCCESS;
   }
 
+  // The loop and the final exponentiation operate on fixed-width Montgomery
+  // form values, so neither field multiplications nor intermediate results
+  // touch the heap. With the full GMP, nothing is allocated on the heap until
+  // the result is converted back.
   // Now p and q are linearly indenependent.
   // Here we start the actual Miller's algorithm.
-  Complex f, gVVQ, g2VMinus2VQ, g2VMinus2VQInv, frac, tmpF, gVPQ, gVPlusQ,
-      gVPlusQInv;
-  AffinePoint v, doubleV, vPlusP;
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t stateLimbs[MILLER_STATE_ELEMENTS * n], fLimbs[2 * n];
+  MillerState state = tate_viewMillerState(stateLimbs, montgomeryContext);
+  tate_initMillerState(&state, p, b, context);
 
-  // 1. Set \f$f\f$ = 1 and \f$v\f$ = \f$p\f$
-  complex_initLong(&f, 1, 0);
-  affine_init(&v, p.x, p.y);
+  ComplexFieldElement f = complexFieldElement_view(fLimbs, montgomeryContext);
+  tate_millerLoop(&f, &state, context);
 
-  // 2. {@code for i = t - 1 to 0 do:}
-  // where \f$t\f$ is the bitcount of the subgroup order.
-  // Note, that we have to subtract 2 because of the allocation behavior
-  // of GMP (please refer to
-  // https://gmplib.org/manual/Miscellaneous-Integer-Functions.html).
-  for (int i = mpz_sizeinbase(subgroupOrder, 2) - 2; i >= 0; --i) {
-    // Double step
-    // \f$f = f^{2} \frac{g_{v, v}(q)}{g_{2v, -2v}(q)}\f$
-    CryptidStatus status = affine_add(&doubleV, v, v, ellipticCurve);
-    if (status) {
-      complexAffine_destroy(q);
-      complex_destroy(f);
-      affine_destroy(v);
-      return status;
+  // Final Exponentiation
+  return tate_finalExponentiation(result, &f, context);
+}
+
+CryptidStatus tate_performMultiPairing(Complex *result, const AffinePoint *ps,
+                                       const AffinePoint *bs,
+                                       const size_t count,
+                                       const EllipticCurveContext *context) {
+  // The Miller loops of the pairs run side by side, sharing the accumulator
+  // \f$f\f$. Its squarings and the final exponentiation are done once for the
+  // whole product. Pairs with the point at infinity contribute 1.
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+  const signed char *digits = context->subgroupOrderDigits;
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t *stateLimbs = (mp_limb_t *)malloc(
+      count * MILLER_STATE_ELEMENTS * n * sizeof(mp_limb_t));
+  MillerState *states = (MillerState *)malloc(count * sizeof(MillerState));
+  size_t stateCount = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (!affine_isInfinity(bs[i])) {
+      states[stateCount] = tate_viewMillerState(
+          stateLimbs + stateCount * MILLER_STATE_ELEMENTS * n,
+          montgomeryContext);
+      tate_initMillerState(&states[stateCount++], ps[i], bs[i], context);
     }
-    status = divisor_evaluateTangent(&gVVQ, v, q, ellipticCurve);
-    if (status) {
-      complexAffine_destroy(q);
-      complex_destroy(f);
-      affine_destroy(v);
-      affine_destroy(doubleV);
-      return status;
+  }
+
+  mp_limb_t fLimbs[2 * n];
+  ComplexFieldElement f = complexFieldElement_view(fLimbs, montgomeryContext);
+  complexFieldElement_setOne(&f, montgomeryContext);
+
+  for (size_t i = context->subgroupOrderDigitCount - 1; i-- > 0;) {
+    complexFieldElement_square(&f, &f, montgomeryContext);
+
+    for (size_t j = 0; j < stateCount; ++j) {
+      tate_doubleStep(&f, &states[j], context);
     }
-    divisor_evaluateVertical(&g2VMinus2VQ, doubleV, q, ellipticCurve);
-    status = complex_multiplicativeInverse(&g2VMinus2VQInv, g2VMinus2VQ,
-                                           ellipticCurve.fieldOrder);
-    if (status) {
-      complexAffine_destroy(q);
-      affine_destroy(v);
-      affine_destroy(doubleV);
-      complex_destroyMany(3, f, gVVQ, g2VMinus2VQ);
-      return status;
+
+    if (digits[i]) {
+      for (size_t j = 0; j < stateCount; ++j) {
+        tate_addStep(&f, &states[j], digits[i], context);
+      }
     }
-    complex_modMul(&frac, gVVQ, g2VMinus2VQInv, ellipticCurve.fieldOrder);
-    complex_modMul(&tmpF, f, f, ellipticCurve.fieldOrder);
+  }
 
-    complex_destroy(f);
-    complex_modMul(&f, tmpF, frac, ellipticCurve.fieldOrder);
+  free(states);
+  free(stateLimbs);
 
-    affine_destroy(v);
-    // \f$v = 2v\f$
-    affine_init(&v, doubleV.x, doubleV.y);
+  return tate_finalExponentiation(result, &f, context);
+}
 
-    complex_destroyMany(5, gVVQ, g2VMinus2VQ, g2VMinus2VQInv, frac, tmpF);
-    affine_destroy(doubleV);
+CryptidStatus tate_performPairingBatch(Complex *results, const AffinePoint *ps,
+                                       const AffinePoint *bs,
+                                       const size_t count,
+                                       const EllipticCurveContext *context) {
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
 
-    if (mpz_tstbit(subgroupOrder, i)) {
-      // Add step
-      // \f$f = f \frac{g_{v, p}(q)}{g_{v + p, -(b + p)}(q)}\f$
-      status = affine_add(&vPlusP, v, p, ellipticCurve);
-      if (status) {
-        complexAffine_destroy(q);
-        complex_destroy(f);
-        affine_destroy(v);
-        return status;
-      }
+  if (count == 0) {
+    return CRYPTID_SUCCESS;
+  }
 
-      status = divisor_evaluateLine(&gVPQ, v, p, q, ellipticCurve);
-      if (status) {
-        complexAffine_destroy(q);
-        complex_destroy(f);
-        affine_destroy(v);
-        affine_destroy(vPlusP);
-        return status;
-      }
+  // The steps of the Miller loops do not invert, so running them in lockstep
+  // would not share anything, while the states of all the loops would not fit
+  // into the cache. The loops run one after the other, and only their final
+  // exponentiations are batched. Pairs with the point at infinity are left
+  // out, their result is 1.
+  const size_t n = montgomeryContext->limbCount;
+  size_t *indices = (size_t *)malloc(count * sizeof(size_t));
+  mp_limb_t *fLimbs =
+      (mp_limb_t *)malloc(count * 2 * n * sizeof(mp_limb_t));
+  ComplexFieldElement *fs = (ComplexFieldElement *)malloc(
+      count * sizeof(ComplexFieldElement));
+  mp_limb_t stateLimbs[MILLER_STATE_ELEMENTS * n];
+  MillerState state = tate_viewMillerState(stateLimbs, montgomeryContext);
+  size_t stateCount = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (!affine_isInfinity(bs[i])) {
+      fs[stateCount] = complexFieldElement_view(
+          fLimbs + stateCount * 2 * n, montgomeryContext);
+      tate_initMillerState(&state, ps[i], bs[i], context);
+      tate_millerLoop(&fs[stateCount], &state, context);
+      indices[stateCount++] = i;
+    }
+  }
 
-      divisor_evaluateVertical(&gVPlusQ, vPlusP, q, ellipticCurve);
+  // The easy part of every final exponentiation is
+  // \f$f^{p - 1} = \frac{\bar{f}}{f} = \frac{\bar{f}^2}{N(f)}\f$. The norms
+  // are inverted at once, see Algorithm 2.26 in [Guide-to-ECC]: the prefix
+  // products are inverted, then the individual inverses are peeled off
+  // backwards.
+  mp_limb_t *prefixProducts =
+      (mp_limb_t *)malloc(count * n * sizeof(mp_limb_t));
+  mp_limb_t *norms =
+      (mp_limb_t *)malloc(count * n * sizeof(mp_limb_t));
 
-      status = complex_multiplicativeInverse(&gVPlusQInv, gVPlusQ,
-                                             ellipticCurve.fieldOrder);
-      if (status) {
-        complexAffine_destroy(q);
-        affine_destroy(v);
-        affine_destroy(vPlusP);
-        complex_destroyMany(3, f, gVPQ, gVPlusQ);
-        return status;
-      }
-      complex_modMul(&frac, gVPQ, gVPlusQInv, ellipticCurve.fieldOrder);
-      complex_modMul(&tmpF, f, frac, ellipticCurve.fieldOrder);
+  mp_limb_t accumulator[n], tmp[n];
+  fieldElement_setOne(accumulator, montgomeryContext);
+  for (size_t j = 0; j < stateCount; ++j) {
+    FieldElement *norm = norms + j * n;
+    fieldElement_square(norm, fs[j].real, montgomeryContext);
+    fieldElement_square(tmp, fs[j].imaginary, montgomeryContext);
+    fieldElement_add(norm, norm, tmp, montgomeryContext);
 
-      complex_destroy(f);
-      complex_initMpz(&f, tmpF.real, tmpF.imaginary);
+    fieldElement_copy(prefixProducts + j * n, accumulator, montgomeryContext);
+    fieldElement_mul(accumulator, accumulator, norm, montgomeryContext);
+  }
 
-      affine_destroy(v);
-      // \f$v = v + p\f$
-      affine_init(&v, vPlusP.x, vPlusP.y);
+  CryptidStatus status =
+      fieldElement_invert(accumulator, accumulator, montgomeryContext);
+  if (status) {
+    free(indices);
+    free(fs);
+    free(fLimbs);
+    free(prefixProducts);
+    free(norms);
+    return status;
+  }
 
-      complex_destroyMany(5, gVPQ, gVPlusQ, gVPlusQInv, frac, tmpF);
-      affine_destroy(vPlusP);
+  for (size_t i = 0, j = 0; i < count; ++i) {
+    if (j < stateCount && indices[j] == i) {
+      ++j;
+    } else {
+      complex_initLong(&results[i], 1, 0);
     }
   }
-  affine_destroy(v);
-  complexAffine_destroy(q);
 
-  // Final Exponentiation
-  mpz_t exponent, pPow, exponentPart;
-  mpz_inits(exponent, pPow, exponentPart, NULL);
+  mp_limb_t gLimbs[2 * n];
+  GtElement g = gtElement_view(gLimbs, montgomeryContext);
+  for (size_t j = stateCount; j-- > 0;) {
+    // \f$N(f_j)^{-1} = (N(f_0) \cdots N(f_j))^{-1} \cdot
+    // (N(f_0) \cdots N(f_{j-1}))\f$
+    fieldElement_mul(tmp, accumulator, prefixProducts + j * n,
+                     montgomeryContext);
+    fieldElement_mul(accumulator, accumulator, norms + j * n,
+                     montgomeryContext);
 
-  mpz_pow_ui(pPow, ellipticCurve.fieldOrder, embeddingDegree);
-  mpz_sub_ui(exponentPart, pPow, 1);
-  mpz_cdiv_q(exponent, exponentPart, subgroupOrder);
+    complexFieldElement_conjugate(&g.value, &fs[j], montgomeryContext);
+    complexFieldElement_square(&g.value, &g.value, montgomeryContext);
+    fieldElement_mul(g.value.real, g.value.real, tmp, montgomeryContext);
+    fieldElement_mul(g.value.imaginary, g.value.imaginary, tmp,
+                     montgomeryContext);
 
-  complex_modPow(result, f, exponent, ellipticCurve.fieldOrder);
+    tate_cofactorExponentiation(&results[indices[j]], &g, context);
+  }
 
-  mpz_clears(exponent, pPow, exponentPart, NULL);
-  complex_destroy(f);
+  free(indices);
+  free(fs);
+  free(fLimbs);
+  free(prefixProducts);
+  free(norms);
 
   return CRYPTID_SUCCESS;
 }
+
+CryptidStatus tate_performPreparedPairing(Complex *result,
+                                          const PreparedPairingArgument *p,
+                                          const AffinePoint b,
+                                          const EllipticCurveContext *context) {
+  // Same as {@code tate_performPairing}, with the lines of the steps read
+  // from the prepared argument instead of being computed.
+  if (affine_isInfinity(b)) {
+    complex_initLong(result, 1, 0);
+    return CRYPTID_SUCCESS;
+  }
+
+  const MontgomeryContext *montgomeryContext = &context->montgomeryContext;
+  const signed char *digits = context->subgroupOrderDigits;
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[13 * n], qY[n], verticalX[n];
+  ComplexFieldElement qX = complexFieldElement_view(limbs, montgomeryContext);
+  ComplexFieldElement qXConjugate =
+      complexFieldElement_view(limbs + 2 * n, montgomeryContext);
+  tate_distort(&qX, qY, &qXConjugate, b, context);
+
+  ComplexFieldElement f =
+      complexFieldElement_view(limbs + 4 * n, montgomeryContext);
+  ComplexFieldElement denominator =
+      complexFieldElement_view(limbs + 6 * n, montgomeryContext);
+  ComplexFieldElement pVertical =
+      complexFieldElement_view(limbs + 8 * n, montgomeryContext);
+  DivisorLine line = divisor_viewLine(limbs + 10 * n, montgomeryContext);
+
+  // The vertical line through \f$p\f$ for the steps of negative digits.
+  if (preparedPairingArgument_loadPointX(verticalX, p)) {
+    fieldElement_sub(pVertical.real, qXConjugate.real, verticalX,
+                     montgomeryContext);
+    fieldElement_copy(pVertical.imaginary, qXConjugate.imaginary,
+                      montgomeryContext);
+  } else {
+    complexFieldElement_setOne(&pVertical, montgomeryContext);
+  }
+
+  complexFieldElement_setOne(&f, montgomeryContext);
+
+  size_t step = 0;
+  for (size_t i = context->subgroupOrderDigitCount - 1; i-- > 0;) {
+    complexFieldElement_square(&f, &f, montgomeryContext);
+
+    // A doubling step, followed by an addition step if the digit is nonzero.
+    const int stepsOfDigit = digits[i] ? 2 : 1;
+    for (int j = 0; j < stepsOfDigit; ++j, ++step) {
+      const int hasVertical =
+          preparedPairingArgument_loadStep(&line, verticalX, p, step);
+
+      divisor_montgomeryMulDivisorLine(&f, &line, &qX, qY,
+                                       montgomeryContext);
+
+      if (hasVertical) {
+        // \f$\bar{x}^{\prime} - x_V\f$
+        fieldElement_sub(denominator.real, qXConjugate.real, verticalX,
+                         montgomeryContext);
+        fieldElement_copy(denominator.imaginary, qXConjugate.imaginary,
+                          montgomeryContext);
+        complexFieldElement_mul(&f, &f, &denominator, montgomeryContext);
+      }
+    }
+
+    if (digits[i] < 0) {
+      complexFieldElement_mul(&f, &f, &pVertical, montgomeryContext);
+    }
+  }
+
+  // Final Exponentiation
+  return tate_finalExponentiation(result, &f, context);
+}
@@ -0,0 +1,325 @@
+#include <stdint.h>
+
+#include "field/FieldElement.h"
+
+// References:
+//   * [Koc-Acar-Kaliski] Cetin Kaya Koc, Tolga Acar, and Burton S. Kaliski.
+//   1996. Analyzing and comparing Montgomery multiplication algorithms. IEEE
+//   Micro 16, 3 (1996), 26-33.
+
+#define LIMB_BITS (sizeof(mp_limb_t) * CHAR_BIT)
+
+// With the full GMP, the assembly mpn kernels are faster than anything
+// portable, hence multiplication is delegated to them and followed by a
+// separate reduction. mini-gmp only has plain C loops, so in that case we use
+// our own fused kernels, specialized for the field sizes of the supported
+// security levels.
+#if !defined(__CRYPTID_GMP) && defined(__SIZEOF_INT128__) &&                   \
+    ULONG_MAX > 0xffffffffUL
+#define FIELDELEMENT_PORTABLE_KERNELS
+typedef unsigned __int128 DoubleLimb;
+#elif !defined(__CRYPTID_GMP) && ULONG_MAX == 0xffffffffUL
+#define FIELDELEMENT_PORTABLE_KERNELS
+typedef uint64_t DoubleLimb;
+#endif
+
+static void fieldElement_load(FieldElement *result, const mpz_t value,
+                              const size_t limbCount) {
+  const size_t valueSize = mpz_size(value);
+
+  mpn_copyi(result, mpz_limbs_read(value), valueSize);
+  mpn_zero(result + valueSize, limbCount - valueSize);
+}
+
+#ifdef FIELDELEMENT_PORTABLE_KERNELS
+
+static inline void
+fieldElement_mulKernel(mp_limb_t *result, const mp_limb_t *multiplier,
+                       const mp_limb_t *multiplicand,
+                       const MontgomeryContext *montgomeryContext,
+                       const size_t n) {
+  // Coarsely Integrated Operand Scanning (CIOS) method from
+  // [Koc-Acar-Kaliski].
+  const mp_limb_t *modulusLimbs = mpz_limbs_read(montgomeryContext->modulus);
+  const mp_limb_t modulusInverse = montgomeryContext->modulusInverse;
+  mp_limb_t t[n + 2];
+
+  for (size_t i = 0; i < n + 2; ++i) {
+    t[i] = 0;
+  }
+
+  for (size_t i = 0; i < n; ++i) {
+    // \f$T = T + a \cdot b_i\f$
+    DoubleLimb cs;
+    mp_limb_t carry = 0;
+    for (size_t j = 0; j < n; ++j) {
+      cs = (DoubleLimb)multiplier[j] * multiplicand[i] + t[j] + carry;
+      t[j] = (mp_limb_t)cs;
+      carry = (mp_limb_t)(cs >> LIMB_BITS);
+    }
+    cs = (DoubleLimb)t[n] + carry;
+    t[n] = (mp_limb_t)cs;
+    t[n + 1] = (mp_limb_t)(cs >> LIMB_BITS);
+
+    // \f$T = (T + mp) / 2^w\f$
+    const mp_limb_t m = t[0] * modulusInverse;
+    cs = (DoubleLimb)m * modulusLimbs[0] + t[0];
+    carry = (mp_limb_t)(cs >> LIMB_BITS);
+    for (size_t j = 1; j < n; ++j) {
+      cs = (DoubleLimb)m * modulusLimbs[j] + t[j] + carry;
+      t[j - 1] = (mp_limb_t)cs;
+      carry = (mp_limb_t)(cs >> LIMB_BITS);
+    }
+    cs = (DoubleLimb)t[n] + carry;
+    t[n - 1] = (mp_limb_t)cs;
+    t[n] = t[n + 1] + (mp_limb_t)(cs >> LIMB_BITS);
+  }
+
+  // \f$T < 2p\f$, a single conditional subtraction suffices.
+  if (t[n] || mpn_cmp(t, modulusLimbs, n) >= 0) {
+    mpn_sub_n(result, t, modulusLimbs, n);
+  } else {
+    mpn_copyi(result, t, n);
+  }
+}
+
+#define FIELDELEMENT_DEFINE_MUL_KERNEL(bits)                                   \
+  static void fieldElement_mulKernel##bits(                                    \
+      mp_limb_t *result, const mp_limb_t *multiplier,                          \
+      const mp_limb_t *multiplicand,                                           \
+      const MontgomeryContext *montgomeryContext) {                            \
+    fieldElement_mulKernel(result, multiplier, multiplicand,                   \
+                           montgomeryContext, (bits) / LIMB_BITS);             \
+  }
+
+FIELDELEMENT_DEFINE_MUL_KERNEL(512)
+FIELDELEMENT_DEFINE_MUL_KERNEL(1024)
+FIELDELEMENT_DEFINE_MUL_KERNEL(1536)
+FIELDELEMENT_DEFINE_MUL_KERNEL(3840)
+FIELDELEMENT_DEFINE_MUL_KERNEL(7680)
+
+static void
+fieldElement_dispatchMul(mp_limb_t *result, const mp_limb_t *multiplier,
+                         const mp_limb_t *multiplicand,
+                         const MontgomeryContext *montgomeryContext) {
+  switch (montgomeryContext->limbCount) {
+  case 512 / LIMB_BITS:
+    fieldElement_mulKernel512(result, multiplier, multiplicand,
+                              montgomeryContext);
+    break;
+  case 1024 / LIMB_BITS:
+    fieldElement_mulKernel1024(result, multiplier, multiplicand,
+                               montgomeryContext);
+    break;
+  case 1536 / LIMB_BITS:
+    fieldElement_mulKernel1536(result, multiplier, multiplicand,
+                               montgomeryContext);
+    break;
+  case 3840 / LIMB_BITS:
+    fieldElement_mulKernel3840(result, multiplier, multiplicand,
+                               montgomeryContext);
+    break;
+  case 7680 / LIMB_BITS:
+    fieldElement_mulKernel7680(result, multiplier, multiplicand,
+                               montgomeryContext);
+    break;
+  default:
+    fieldElement_mulKernel(result, multiplier, multiplicand,
+                           montgomeryContext, montgomeryContext->limbCount);
+  }
+}
+
+#endif
+
+CryptidStatus
+fieldElement_checkSupported(const MontgomeryContext *montgomeryContext) {
+  if (montgomeryContext->limbCount > FIELDELEMENT_MAX_LIMBS) {
+    return CRYPTID_FIELD_SIZE_NOT_SUPPORTED_ERROR;
+  }
+
+  return CRYPTID_SUCCESS;
+}
+
+void fieldElement_fromMpz(FieldElement *result, const mpz_t value,
+                          const MontgomeryContext *montgomeryContext) {
+  const size_t n = montgomeryContext->limbCount;
+
+  if (mpz_sgn(value) >= 0 && mpz_cmp(value, montgomeryContext->modulus) < 0) {
+    fieldElement_load(result, value, n);
+  } else {
+    mpz_t reduced;
+    mpz_init(reduced);
+    mpz_mod(reduced, value, montgomeryContext->modulus);
+    fieldElement_load(result, reduced, n);
+    mpz_clear(reduced);
+  }
+
+  // \f$aR = \mathrm{REDC}(a \cdot R^2)\f$
+  mp_limb_t rSquared[n];
+  fieldElement_load(rSquared, montgomeryContext->rSquared, n);
+  fieldElement_mul(result, result, rSquared, montgomeryContext);
+}
+
+void fieldElement_toMpz(mpz_t result, const FieldElement *element,
+                        const MontgomeryContext *montgomeryContext) {
+  // \f$a = \mathrm{REDC}(aR)\f$
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t t[2 * n];
+
+  mpn_copyi(t, element, n);
+  mpn_zero(t + n, n);
+
+  montgomery_reduce(mpz_limbs_write(result, n), t, montgomeryContext);
+  mpz_limbs_finish(result, n);
+}
+
+void fieldElement_setZero(FieldElement *result,
+                          const MontgomeryContext *montgomeryContext) {
+  mpn_zero(result, montgomeryContext->limbCount);
+}
+
+void fieldElement_setOne(FieldElement *result,
+                         const MontgomeryContext *montgomeryContext) {
+  fieldElement_load(result, montgomeryContext->r,
+                    montgomeryContext->limbCount);
+}
+
+void fieldElement_copy(FieldElement *result, const FieldElement *element,
+                       const MontgomeryContext *montgomeryContext) {
+  if (result != element) {
+    mpn_copyi(result, element, montgomeryContext->limbCount);
+  }
+}
+
+int fieldElement_isZero(const FieldElement *element,
+                        const MontgomeryContext *montgomeryContext) {
+  for (size_t i = 0; i < montgomeryContext->limbCount; ++i) {
+    if (element[i]) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+int fieldElement_isEquals(const FieldElement *element1,
+                          const FieldElement *element2,
+                          const MontgomeryContext *montgomeryContext) {
+  return !mpn_cmp(element1, element2, montgomeryContext->limbCount);
+}
+
+void fieldElement_add(FieldElement *sum, const FieldElement *augend,
+                      const FieldElement *addend,
+                      const MontgomeryContext *montgomeryContext) {
+  const size_t n = montgomeryContext->limbCount;
+  const mp_limb_t *modulusLimbs = mpz_limbs_read(montgomeryContext->modulus);
+
+  mp_limb_t carry = mpn_add_n(sum, augend, addend, n);
+  if (carry || mpn_cmp(sum, modulusLimbs, n) >= 0) {
+    mpn_sub_n(sum, sum, modulusLimbs, n);
+  }
+}
+
+void fieldElement_sub(FieldElement *difference, const FieldElement *minuend,
+                      const FieldElement *subtrahend,
+                      const MontgomeryContext *montgomeryContext) {
+  const size_t n = montgomeryContext->limbCount;
+
+  if (mpn_sub_n(difference, minuend, subtrahend, n)) {
+    mpn_add_n(difference, difference,
+              mpz_limbs_read(montgomeryContext->modulus), n);
+  }
+}
+
+void fieldElement_negate(FieldElement *negation, const FieldElement *operand,
+                         const MontgomeryContext *montgomeryContext) {
+  if (fieldElement_isZero(operand, montgomeryContext)) {
+    fieldElement_setZero(negation, montgomeryContext);
+    return;
+  }
+
+  mpn_sub_n(negation, mpz_limbs_read(montgomeryContext->modulus), operand,
+            montgomeryContext->limbCount);
+}
+
+void fieldElement_mul(FieldElement *product, const FieldElement *multiplier,
+                      const FieldElement *multiplicand,
+                      const MontgomeryContext *montgomeryContext) {
+#ifdef FIELDELEMENT_PORTABLE_KERNELS
+  fieldElement_dispatchMul(product, multiplier, multiplicand,
+                           montgomeryContext);
+#else
+  mp_limb_t t[2 * montgomeryContext->limbCount];
+
+  mpn_mul_n(t, multiplier, multiplicand, montgomeryContext->limbCount);
+  montgomery_reduce(product, t, montgomeryContext);
+#endif
+}
+
+void fieldElement_square(FieldElement *square, const FieldElement *operand,
+                         const MontgomeryContext *montgomeryContext) {
+#ifdef FIELDELEMENT_PORTABLE_KERNELS
+  // Skipping the symmetric partial products does not pay off with the
+  // interleaved reduction of the portable kernels.
+  fieldElement_dispatchMul(square, operand, operand, montgomeryContext);
+#else
+  mp_limb_t t[2 * montgomeryContext->limbCount];
+
+  mpn_sqr(t, operand, montgomeryContext->limbCount);
+  montgomery_reduce(square, t, montgomeryContext);
+#endif
+}
+
+CryptidStatus fieldElement_invert(FieldElement *inverse,
+                                  const FieldElement *operand,
+                                  const MontgomeryContext *montgomeryContext) {
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t rCubed[n];
+
+  // GMP yields \f$(aR)^{-1} = a^{-1}R^{-1}\f$, a Montgomery multiplication by
+  // \f$R^3\f$ brings it to \f$a^{-1}R\f$.
+#ifdef __CRYPTID_GMP
+  // The extended Euclidean algorithm of the mpn layer works on stack buffers,
+  // so the inversion does not touch the heap. With \f$U = a\f$ and \f$V =
+  // p\f$ it yields \f$G = Ua^{-1} + Vt\f$, where \f$|a^{-1}| < p\f$ might be
+  // negative.
+  const mp_limb_t *modulusLimbs = mpz_limbs_read(montgomeryContext->modulus);
+  mp_limb_t u[n], v[n], g[n], s[n + 1];
+  mp_size_t sSize;
+
+  if (fieldElement_isZero(operand, montgomeryContext)) {
+    return CRYPTID_HAS_NO_MUL_INV_ERROR;
+  }
+
+  mpn_copyi(u, operand, n);
+  mpn_copyi(v, modulusLimbs, n);
+  mp_size_t gSize = mpn_gcdext(g, s, &sSize, u, n, v, n);
+  if (gSize != 1 || g[0] != 1) {
+    return CRYPTID_HAS_NO_MUL_INV_ERROR;
+  }
+
+  const size_t sLimbs = sSize < 0 ? -sSize : sSize;
+  mpn_zero(s + sLimbs, n - sLimbs);
+  if (sSize < 0) {
+    mpn_sub_n(inverse, modulusLimbs, s, n);
+  } else {
+    mpn_copyi(inverse, s, n);
+  }
+#else
+  mpz_t operandView, result;
+  mpz_init(result);
+  mpz_roinit_n(operandView, operand, n);
+  if (!mpz_invert(result, operandView, montgomeryContext->modulus)) {
+    mpz_clear(result);
+    return CRYPTID_HAS_NO_MUL_INV_ERROR;
+  }
+
+  fieldElement_load(inverse, result, n);
+  mpz_clear(result);
+#endif
+
+  fieldElement_load(rCubed, montgomeryContext->rCubed, n);
+  fieldElement_mul(inverse, inverse, rCubed, montgomeryContext);
+
+  return CRYPTID_SUCCESS;
+}
@@ -0,0 +1,86 @@
+#include <limits.h>
+
+#include "field/MontgomeryContext.h"
+
+// References:
+//   * [Montgomery] Peter L. Montgomery. 1985. Modular multiplication without
+//   trial division. Math. Comp. 44, 170 (1985), 519-521.
+//   * [Guide-to-ECC] Darrel Hankerson, Alfred J. Menezes, and Scott Vanstone.
+//   2010. Guide to Elliptic Curve Cryptography (1st ed.). Springer Publishing
+//   Company, Incorporated.
+
+// Note, that the bundled GMP header does not necessarily describe the limb
+// size of the linked library, hence we do not rely on GMP_LIMB_BITS.
+#define LIMB_BITS (sizeof(mp_limb_t) * CHAR_BIT)
+
+void montgomeryContext_init(MontgomeryContext *montgomeryContextOutput,
+                            const mpz_t modulus) {
+  mpz_inits(montgomeryContextOutput->modulus, montgomeryContextOutput->r,
+            montgomeryContextOutput->rSquared, montgomeryContextOutput->rCubed,
+            NULL);
+
+  mpz_set(montgomeryContextOutput->modulus, modulus);
+  montgomeryContextOutput->limbCount = mpz_size(modulus);
+
+  // \f$p^{-1} \mod 2^w\f$ by Newton iteration. Every odd \f$p\f$ is its own
+  // inverse modulo \f$2^3\f$, and each step doubles the number of correct
+  // bits.
+  mp_limb_t lowLimb = mpz_getlimbn(modulus, 0);
+  mp_limb_t inverse = lowLimb;
+  for (size_t correctBits = 3; correctBits < LIMB_BITS; correctBits *= 2) {
+    inverse *= 2 - lowLimb * inverse;
+  }
+  montgomeryContextOutput->modulusInverse = (mp_limb_t)0 - inverse;
+
+  // \f$R = 2^{wn}\f$
+  mpz_setbit(montgomeryContextOutput->r,
+             LIMB_BITS * montgomeryContextOutput->limbCount);
+  mpz_mod(montgomeryContextOutput->r, montgomeryContextOutput->r, modulus);
+
+  mpz_mul(montgomeryContextOutput->rSquared, montgomeryContextOutput->r,
+          montgomeryContextOutput->r);
+  mpz_mod(montgomeryContextOutput->rSquared, montgomeryContextOutput->rSquared,
+          modulus);
+
+  mpz_mul(montgomeryContextOutput->rCubed, montgomeryContextOutput->rSquared,
+          montgomeryContextOutput->r);
+  mpz_mod(montgomeryContextOutput->rCubed, montgomeryContextOutput->rCubed,
+          modulus);
+}
+
+void montgomeryContext_destroy(MontgomeryContext montgomeryContext) {
+  mpz_clears(montgomeryContext.modulus, montgomeryContext.r,
+             montgomeryContext.rSquared, montgomeryContext.rCubed, NULL);
+}
+
+void montgomery_reduce(mp_limb_t *result, mp_limb_t *t,
+                       const MontgomeryContext *montgomeryContext) {
+  // Implementation of Montgomery reduction (REDC) in [Montgomery] operating
+  // word by word as in Algorithm 2.36 (Montgomery multiplication) in
+  // [Guide-to-ECC].
+  const size_t n = montgomeryContext->limbCount;
+  const mp_limb_t *modulusLimbs = mpz_limbs_read(montgomeryContext->modulus);
+
+  // The carry out of the top limb, which is at most one.
+  mp_limb_t topCarry = 0;
+  for (size_t i = 0; i < n; ++i) {
+    // \f$u = t_i \cdot (-p^{-1}) \mod 2^w\f$, then \f$T = T + up2^{wi}\f$,
+    // which clears limb \f$i\f$.
+    mp_limb_t u = t[i] * montgomeryContext->modulusInverse;
+    mp_limb_t carry = mpn_addmul_1(t + i, modulusLimbs, n, u);
+
+    mp_limb_t limb = t[i + n] + carry;
+    mp_limb_t carryOut = limb < carry;
+    limb += topCarry;
+    carryOut += limb < topCarry;
+    t[i + n] = limb;
+    topCarry = carryOut;
+  }
+
+  // Now \f$T / R < 2p\f$, hence a single conditional subtraction suffices.
+  if (topCarry || mpn_cmp(t + n, modulusLimbs, n) >= 0) {
+    mpn_sub_n(result, t + n, modulusLimbs, n);
+  } else {
+    mpn_copyi(result, t + n, n);
+  }
+}
@@ -1,8 +1,8 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "elliptic/TatePairing.h"
 #include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryption.h"
+#include "pairing/PairingGroup.h"
 #include "util/PrimalityTest.h"
 #include "util/RandBytes.h"
 #include "util/Random.h"
@@ -14,28 +14,20 @@
 //  BF and BB1 Cryptosystems
 
 static const unsigned int SOLINAS_GENERATION_ATTEMPT_LIMIT = 100;
-static const unsigned int POINT_GENERATION_ATTEMPT_LIMIT = 100;
 
 static const unsigned int Q_LENGTH_MAPPING[] = {160, 224, 256, 384, 512};
 static const unsigned int P_LENGTH_MAPPING[] = {512, 1024, 1536, 3840, 7680};
 
-CryptidStatus cryptid_ibe_bonehFranklin_setup(
-    BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary
-        *masterSecretAsBinary,
-    BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
-        *publicParametersAsBinary,
-    const SecurityLevel securityLevel) {
-  // Implementation of Algorithm 5.1.2 (BFsetup1) in [RFC-5091].
+// Sets up the pairingGroup_TYPE_1 group of Algorithm 5.1.2 (BFsetup1) in
+// [RFC-5091]. On CRYPTID_SUCCESS, the group should be released by the caller.
+static CryptidStatus
+bonehFranklin_setUpType1PairingGroup(PairingGroup *group,
+                                     const SecurityLevel securityLevel) {
   // Note, that instead of taking the bitlengts of p and q as arguments, this
   // function takes a security level which is in turn translated to bitlengths
   // using {@code P_LENGTH_MAPPING} and
   // {@code Q_LENGTH_MAPPING}.
 
-  /*if (!publicParametersAsBinary)
-  {
-      return CRYPTID_PUBLIC_PARAMETERS_NULL_ERROR;
-  }*/
-
   // Construct the elliptic curve and its subgroup of interest
   // Select a random \f$n_q\f$-bit Solinas prime \f$q\f$.
   mpz_t q;
@@ -72,35 +64,76 @@ CryptidStatus cryptid_ibe_bonehFranklin_setup(
 
   mpz_clears(zero, one, NULL);
 
-  // Select a point \f$P\f$ of order \f$q\f$ in \f$E(F_p)\f$.
-  AffinePoint pointP;
-  do {
-    AffinePoint pointPprime;
-    status =
-        random_affinePoint(&pointPprime, ec, POINT_GENERATION_ATTEMPT_LIMIT);
+  status = pairingGroup_acquireType1(group, ec, q);
 
-    if (status) {
-      mpz_clears(p, q, r, NULL);
-      ellipticCurve_destroy(ec);
-      return status;
-    }
+  mpz_clears(p, q, r, NULL);
+  ellipticCurve_destroy(ec);
+
+  return status;
+}
+
+CryptidStatus cryptid_ibe_bonehFranklin_setup(
+    BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary
+        *masterSecretAsBinary,
+    BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
+        *publicParametersAsBinary,
+    const SecurityLevel securityLevel) {
+  return cryptid_ibe_bonehFranklin_setupForPairingGroup(
+      masterSecretAsBinary, publicParametersAsBinary, securityLevel,
+      pairingGroup_TYPE_1);
+}
 
-    mpz_t rMul;
-    mpz_init_set(rMul, r);
-    mpz_mul_ui(rMul, rMul, 12);
+CryptidStatus cryptid_ibe_bonehFranklin_setupForPairingGroup(
+    BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary
+        *masterSecretAsBinary,
+    BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
+        *publicParametersAsBinary,
+    const SecurityLevel securityLevel,
+    const PairingGroupType pairingGroupType) {
+  // Implementation of Algorithm 5.1.2 (BFsetup1) in [RFC-5091], on a pairing
+  // \f$e : G_1 \times G_2 \rightarrow G_T\f$, with \f$P\f$ and \f$P_{pub}\f$
+  // in \f$G_2\f$.
 
-    status = affine_wNAFMultiply(&pointP, pointPprime, rMul, ec);
+  /*if (!publicParametersAsBinary)
+  {
+      return CRYPTID_PUBLIC_PARAMETERS_NULL_ERROR;
+  }*/
 
-    if (status) {
-      mpz_clears(p, q, r, rMul, NULL);
-      ellipticCurve_destroy(ec);
-      affine_destroy(pointPprime);
-      return status;
+  PairingGroup group;
+  CryptidStatus status;
+  switch (pairingGroupType) {
+  case pairingGroup_TYPE_1:
+    status = bonehFranklin_setUpType1PairingGroup(&group, securityLevel);
+    break;
+  case pairingGroup_BLS12_381:
+    // The subgroups of BLS12-381 are of 255 bits.
+    if (securityLevel > MEDIUM) {
+      return CRYPTID_SECURITY_LEVEL_NOT_SUPPORTED_ERROR;
     }
+    status = pairingGroup_acquireBls12381(&group);
+    break;
+  default:
+    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+  }
+
+  if (status) {
+    return status;
+  }
 
-    mpz_clear(rMul);
-    affine_destroy(pointPprime);
-  } while (affine_isInfinity(pointP));
+  EllipticCurve ec;
+  mpz_t q;
+  mpz_init(q);
+  pairingGroup_describe(&ec, q, &group);
+
+  // Select a point \f$P\f$ of order \f$q\f$ in \f$G_2\f$.
+  PairingGroupElement pointP;
+  status = pairingGroup_random(&pointP, pairingGroup_G2, &group);
+  if (status) {
+    mpz_clear(q);
+    ellipticCurve_destroy(ec);
+    pairingGroup_release(group);
+    return status;
+  }
 
   // Determine the master secret.
   mpz_t qMinusTwo, s;
@@ -113,14 +146,14 @@ CryptidStatus cryptid_ibe_bonehFranklin_setup(
   mpz_clear(qMinusTwo);
 
   // Determine the public parameters.
-  AffinePoint pointPpublic;
-
-  status = affine_wNAFMultiply(&pointPpublic, pointP, s, ec);
+  PairingGroupElement pointPpublic;
+  status = pairingGroup_multiply(&pointPpublic, &pointP, s, &group);
 
   if (status) {
-    mpz_clears(p, q, s, NULL);
-    affine_destroy(pointP);
+    mpz_clears(q, s, NULL);
+    pairingGroupElement_destroy(pointP);
     ellipticCurve_destroy(ec);
+    pairingGroup_release(group);
     return status;
   }
 
@@ -129,96 +162,100 @@ CryptidStatus cryptid_ibe_bonehFranklin_setup(
 
   BonehFranklinIdentityBasedEncryptionPublicParameters publicParameters;
   bonehFranklinIdentityBasedEncryptionPublicParameters_init(
-      &publicParameters, ec, q, pointP, pointPpublic, hashFunction);
+      &publicParameters, pairingGroupType, ec, q, pointP, pointPpublic,
+      hashFunction);
 
   bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_fromBonehFranklinIdentityBasedEncryptionPublicParameters(
-      publicParametersAsBinary, publicParameters);
+      publicParametersAsBinary, publicParameters, &group);
 
   masterSecretAsBinary->masterSecret = mpz_export(
       NULL, &masterSecretAsBinary->masterSecretLength, 1, 1, 0, 0, s);
 
-  mpz_clears(p, q, s, r, NULL);
+  mpz_clears(q, s, NULL);
   bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
       publicParameters);
-  affine_destroy(pointP);
-  affine_destroy(pointPpublic);
   ellipticCurve_destroy(ec);
+  pairingGroup_release(group);
 
   return CRYPTID_SUCCESS;
 }
 
-CryptidStatus cryptid_ibe_bonehFranklin_extract(
-    AffinePointAsBinary *result, const char *const identity,
-    const size_t identityLength,
-    const BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary
-        masterSecretAsBinary,
+// Sets up the pairing group the public parameters record, validating their
+// curve and order. On CRYPTID_SUCCESS, the group should be released by the
+// caller.
+static CryptidStatus bonehFranklin_acquirePairingGroup(
+    PairingGroup *group,
     const BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
         publicParametersAsBinary) {
-  // Implementation of Algorithm 5.3.1 (BFextractPriv) in [RFC-5091].
+  EllipticCurve ellipticCurve;
+  ellipticCurveAsBinary_toEllipticCurve(&ellipticCurve,
+                                        publicParametersAsBinary.ellipticCurve);
 
-  /*if (!result)
-  {
-      return CRYPTID_RESULT_POINTER_NULL_ERROR;
-  }*/
+  mpz_t q;
+  mpz_init(q);
+  mpz_import(q, publicParametersAsBinary.qLength, 1, 1, 0, 0,
+             publicParametersAsBinary.q);
 
-  if (identityLength == 0) {
-    return CRYPTID_IDENTITY_LENGTH_ERROR;
-  }
+  CryptidStatus status = pairingGroup_acquire(
+      group, publicParametersAsBinary.pairingGroupType, ellipticCurve, q);
 
-  BonehFranklinIdentityBasedEncryptionPublicParameters publicParameters;
-  bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_toBonehFranklinIdentityBasedEncryptionPublicParameters(
-      &publicParameters, publicParametersAsBinary);
+  ellipticCurve_destroy(ellipticCurve);
+  mpz_clear(q);
 
-  if (!bonehFranklinIdentityBasedEncryptionPublicParameters_isValid(
-          publicParameters)) {
-    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-        publicParameters);
-    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
-  }
-
-  AffinePoint qId;
-
-  // Let \f$Q_{id} = \mathrm{HashToPoint}(E, p, q, id, \mathrm{hashfcn})\f$.
-  CryptidStatus status = hashToPoint(
-      &qId, identity, identityLength, publicParameters.q,
-      publicParameters.ellipticCurve, publicParameters.hashFunction);
+  return status;
+}
 
+// Imports and validates the public parameters, looking up the constants of
+// their group in the context caches, so that they are only derived the first
+// time the parameters are loaded. On CRYPTID_SUCCESS, the parameters should be
+// destroyed and the group released by the caller.
+static CryptidStatus bonehFranklin_loadPublicParameters(
+    BonehFranklinIdentityBasedEncryptionPublicParameters *publicParameters,
+    PairingGroup *group,
+    const BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
+        publicParametersAsBinary) {
+  CryptidStatus status =
+      bonehFranklin_acquirePairingGroup(group, publicParametersAsBinary);
   if (status) {
-    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-        publicParameters);
     return status;
   }
 
-  mpz_t masterSecret;
-  mpz_init(masterSecret);
-  mpz_import(masterSecret, masterSecretAsBinary.masterSecretLength, 1, 1, 0, 0,
-             masterSecretAsBinary.masterSecret);
-
-  AffinePoint affineResult;
+  status =
+      bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_toBonehFranklinIdentityBasedEncryptionPublicParameters(
+          publicParameters, publicParametersAsBinary, group);
+  if (status) {
+    pairingGroup_release(*group);
+    return status;
+  }
 
-  // Let \f$S_{id} = [s]Q_{id}\f$.
-  status = affine_wNAFMultiply(&affineResult, qId, masterSecret,
-                               publicParameters.ellipticCurve);
+  if (!bonehFranklinIdentityBasedEncryptionPublicParameters_isValid(
+          *publicParameters, group)) {
+    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
+        *publicParameters);
+    pairingGroup_release(*group);
+    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+  }
 
-  affineAsBinary_fromAffine(result, affineResult);
+  return CRYPTID_SUCCESS;
+}
 
-  bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-      publicParameters);
-  affine_destroy(qId);
-  affine_destroy(affineResult);
-  mpz_clear(masterSecret);
+// Reads a private key as an element of \f$G_1\f$. On CRYPTID_SUCCESS, the key
+// should be destroyed by the caller.
+static CryptidStatus bonehFranklin_readPrivateKey(
+    PairingGroupElement *privateKey,
+    const PairingGroupElementAsBinary privateKeyAsBinary,
+    const PairingGroup *group) {
+  if (pairingGroupElementAsBinary_toPairingGroupElement(
+          privateKey, pairingGroup_G1, privateKeyAsBinary, group)) {
+    return CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR;
+  }
 
-  return status;
+  return CRYPTID_SUCCESS;
 }
 
-CryptidStatus cryptid_ibe_bonehFranklin_encrypt(
-    BonehFranklinIdentityBasedEncryptionCiphertextAsBinary *result,
+static CryptidStatus bonehFranklin_checkEncryptArguments(
     const char *const message, const size_t messageLength,
-    const char *const identity, const size_t identityLength,
-    const BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
-        publicParametersAsBinary) {
-  // Implementation of Algorithm 5.4.1 (BFencrypt) in [RFC-5091].
-
+    const char *const identity, const size_t identityLength) {
   if (!message) {
     return CRYPTID_MESSAGE_NULL_ERROR;
   }
@@ -235,38 +272,112 @@ CryptidStatus cryptid_ibe_bonehFranklin_encrypt(
     return CRYPTID_IDENTITY_LENGTH_ERROR;
   }
 
-  BonehFranklinIdentityBasedEncryptionPublicParameters publicParameters;
-  bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_toBonehFranklinIdentityBasedEncryptionPublicParameters(
-      &publicParameters, publicParametersAsBinary);
+  return CRYPTID_SUCCESS;
+}
 
-  if (!bonehFranklinIdentityBasedEncryptionPublicParameters_isValid(
-          publicParameters)) {
-    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-        publicParameters);
-    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+static CryptidStatus bonehFranklin_extract(
+    PairingGroupElementAsBinary *result, const char *const identity,
+    const size_t identityLength,
+    const BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary
+        masterSecretAsBinary,
+    const BonehFranklinIdentityBasedEncryptionPublicParameters
+        *publicParameters,
+    const PairingGroup *group) {
+  // Implementation of Algorithm 5.3.1 (BFextractPriv) in [RFC-5091].
+
+  PairingGroupElement qId;
+
+  // Let \f$Q_{id} = \mathrm{HashToPoint}(E, p, q, id, \mathrm{hashfcn})\f$.
+  CryptidStatus status =
+      pairingGroup_hashToG1(&qId, identity, identityLength,
+                            publicParameters->hashFunction, group);
+
+  if (status) {
+    return status;
   }
 
-  mpz_t l;
-  mpz_init(l);
+  mpz_t masterSecret;
+  mpz_init(masterSecret);
+  mpz_import(masterSecret, masterSecretAsBinary.masterSecretLength, 1, 1, 0, 0,
+             masterSecretAsBinary.masterSecret);
 
-  // Let {@code hashlen} be the length of the output of the cryptographic hash
-  // function hashfcn from the public parameters.
-  int hashLen;
-  hashFunction_getHashSize(&hashLen, publicParameters.hashFunction);
+  PairingGroupElement sId;
 
+  // Let \f$S_{id} = [s]Q_{id}\f$.
+  status = pairingGroup_multiply(&sId, &qId, masterSecret, group);
+
+  if (!status) {
+    pairingGroupElementAsBinary_fromPairingGroupElement(result, &sId, group);
+    pairingGroupElement_destroy(sId);
+  }
+
+  pairingGroupElement_destroy(qId);
+  mpz_clear(masterSecret);
+
+  return status;
+}
+
+// Computes the pairing value of a recipient, which only depends on the public
+// parameters and the identity. \f$P_{pub}\f$ may be prepared as a pairing
+// argument.
+static CryptidStatus bonehFranklin_computeTheta(
+    PairingGroupElement *theta, const char *const identity,
+    const size_t identityLength,
+    const BonehFranklinIdentityBasedEncryptionPublicParameters
+        *publicParameters,
+    const PairingGroupElement *pointPpublic, const PairingGroup *group) {
   // \f$Q_{id} = \mathrm{HashToPoint}(E, p, q, id, \mathrm{hashfcn})\f$
-  // which results in a point of order \f$q\f$ in \f$E(F_p)\f$.
-  AffinePoint pointQId;
-  CryptidStatus status = hashToPoint(
-      &pointQId, identity, identityLength, publicParameters.q,
-      publicParameters.ellipticCurve, publicParameters.hashFunction);
+  // which results in an element of \f$G_1\f$.
+  PairingGroupElement pointQId;
+  CryptidStatus status =
+      pairingGroup_hashToG1(&pointQId, identity, identityLength,
+                            publicParameters->hashFunction, group);
   if (status) {
-    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-        publicParameters);
-    mpz_clear(l);
     return status;
   }
 
+  // Let \f$\mathrm{theta} = \mathrm{Pairing}(E, p, q, Q_{id}, P_{pub})\f$,
+  // which is an element of \f$G_T\f$. The arguments are swapped compared to
+  // [RFC-5091], as \f$Q_{id}\f$ is in \f$G_1\f$.
+  status = pairingGroup_pair(theta, &pointQId, pointPpublic, group);
+
+  pairingGroupElement_destroy(pointQId);
+
+  return status;
+}
+
+// \f$P\f$ and \f$P_{pub}\f$ may be prepared. If theta is given, the identity
+// is not used and no pairing is computed.
+static CryptidStatus bonehFranklin_encrypt(
+    BonehFranklinIdentityBasedEncryptionCiphertextAsBinary *result,
+    const char *const message, const size_t messageLength,
+    const char *const identity, const size_t identityLength,
+    const BonehFranklinIdentityBasedEncryptionPublicParameters
+        *publicParameters,
+    const PairingGroupElement *pointP, const PairingGroupElement *pointPpublic,
+    const PairingGroupElement *preparedTheta, const PairingGroup *group) {
+  // Implementation of Algorithm 5.4.1 (BFencrypt) in [RFC-5091].
+
+  // Let {@code hashlen} be the length of the output of the cryptographic hash
+  // function hashfcn from the public parameters.
+  int hashLen;
+  hashFunction_getHashSize(&hashLen, publicParameters->hashFunction);
+
+  PairingGroupElement computedTheta;
+  const PairingGroupElement *theta = preparedTheta;
+  if (!preparedTheta) {
+    CryptidStatus status =
+        bonehFranklin_computeTheta(&computedTheta, identity, identityLength,
+                                   publicParameters, pointPpublic, group);
+    if (status) {
+      return status;
+    }
+    theta = &computedTheta;
+  }
+
+  mpz_t l;
+  mpz_init(l);
+
   // Select a random {@code hashlen}-bit vector {@code rho}, represented as
   // (\f$\frac{\mathrm{hashlen}}{8}\f$)-octet string in big-endian convention.
   unsigned char *rho =
@@ -278,7 +389,7 @@ CryptidStatus cryptid_ibe_bonehFranklin_encrypt(
   // from applying the {@code hashfcn} algorithm to the input \f$m\f$.
   unsigned char *t = (unsigned char *)calloc(hashLen, sizeof(unsigned char));
   hashFunction_hash(t, (unsigned char *)message, messageLength,
-                    publicParameters.hashFunction);
+                    publicParameters->hashFunction);
 
   // Let \f$l = \mathrm{HashToRange}(rho || t, q, \mathrm{hashfcn})\f$, an
   // integer in the range \f$0\f$ to \f$q - 1\f$ resulting from applying {@code
@@ -294,60 +405,41 @@ CryptidStatus cryptid_ibe_bonehFranklin_encrypt(
   }
   concat[2 * hashLen] = '\0';
 
-  hashToRange(l, concat, 2 * hashLen, publicParameters.q,
-              publicParameters.hashFunction);
+  hashToRange(l, concat, 2 * hashLen, publicParameters->q,
+              publicParameters->hashFunction);
 
-  // Let \f$U = [l]P\f$, which is a point of order \f$q\f$ in \f$E(F_p)\f$.
-  AffinePoint cipherPointU;
-  status = affine_wNAFMultiply(&cipherPointU, publicParameters.pointP, l,
-                               publicParameters.ellipticCurve);
+  // Let \f$U = [l]P\f$, which is an element of \f$G_2\f$.
+  PairingGroupElement cipherPointU;
+  CryptidStatus status = pairingGroup_multiply(&cipherPointU, pointP, l, group);
   if (status) {
-    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-        publicParameters);
     mpz_clear(l);
-    affine_destroy(pointQId);
-    free(rho);
-    free(t);
-    free(concat);
-    return status;
-  }
-
-  // Let \f$\mathrm{theta} = \mathrm{Pairing}(E, p, q, P_{pub}, Q_{id})\f$,
-  // which is an element of the extension field \f$F_p^2\f$ obtained using the
-  // modified Tate pairing.
-  Complex theta;
-  status =
-      tate_performPairing(&theta, publicParameters.pointPpublic, pointQId, 2,
-                          publicParameters.q, publicParameters.ellipticCurve);
-  if (status) {
-    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-        publicParameters);
-    mpz_clear(l);
-    affine_destroy(pointQId);
+    if (!preparedTheta) {
+      pairingGroupElement_destroy(computedTheta);
+    }
     free(rho);
     free(t);
     free(concat);
-    affine_destroy(cipherPointU);
     return status;
   }
 
   // Let \f$\mathrm{theta}^{\prime} = \mathrm{theta}^l\f$, which is theta raised
-  // to the power of \f$l\f$ in \f$F_p^2\f$.
-  Complex thetaPrime;
-  complex_modPow(&thetaPrime, theta, l,
-                 publicParameters.ellipticCurve.fieldOrder);
+  // to the power of \f$l\f$ in \f$G_T\f$.
+  PairingGroupElement thetaPrime;
+  pairingGroup_pow(&thetaPrime, theta, l, group);
+  if (!preparedTheta) {
+    pairingGroupElement_destroy(computedTheta);
+  }
 
   // Let \f$z = \mathrm{Canonical}(p, k, 0, \mathrm{theta}^{\prime})\f$, a
   // canonical string representation of {@code theta'}.
   int zLength;
   unsigned char *z;
-  canonical(&z, &zLength, thetaPrime, publicParameters.ellipticCurve.fieldOrder,
-            1);
+  pairingGroup_toBinary(&z, &zLength, &thetaPrime, group);
 
   // Let \f$w = \mathrm{hashfcn}(z)\f$ using the {@code hashfcn} hashing
   // algorithm, the result of which is a {@code hashlen}-octet string.
   unsigned char *w = (unsigned char *)calloc(hashLen, sizeof(unsigned char));
-  hashFunction_hash(w, z, zLength, publicParameters.hashFunction);
+  hashFunction_hash(w, z, zLength, publicParameters->hashFunction);
 
   // Let \f$V = w \oplus rho\f$, which is the {@code hashlen}-octet long
   // bit-wise XOR of \f$w\f$ and {@code rho}.
@@ -365,7 +457,7 @@ CryptidStatus cryptid_ibe_bonehFranklin_encrypt(
       (unsigned char *)calloc(messageLength + 1, sizeof(unsigned char));
   unsigned char *hashedBytes;
   hashBytes(&hashedBytes, messageLength, rho, hashLen,
-            publicParameters.hashFunction);
+            publicParameters->hashFunction);
   for (size_t i = 0; i < messageLength; i++) {
     cipherW[i] = hashedBytes[i] ^ message[i];
   }
@@ -377,15 +469,11 @@ CryptidStatus cryptid_ibe_bonehFranklin_encrypt(
       &ciphertext, cipherPointU, cipherV, hashLen, cipherW, messageLength);
 
   bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_fromBonehFranklinIdentityBasedEncryptionCiphertext(
-      result, ciphertext);
+      result, ciphertext, group);
 
   bonehFranklinIdentityBasedEncryptionCiphertext_destroy(ciphertext);
-  bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-      publicParameters);
   mpz_clear(l);
-  affine_destroy(pointQId);
-  affine_destroy(cipherPointU);
-  complex_destroyMany(2, theta, thetaPrime);
+  pairingGroupElement_destroy(thetaPrime);
   free(rho);
   free(concat);
   free(z);
@@ -398,45 +486,26 @@ CryptidStatus cryptid_ibe_bonehFranklin_encrypt(
   return CRYPTID_SUCCESS;
 }
 
-CryptidStatus cryptid_ibe_bonehFranklin_decrypt(
+// The private key and \f$P\f$ may be prepared.
+static CryptidStatus bonehFranklin_decrypt(
     char **result,
     const BonehFranklinIdentityBasedEncryptionCiphertextAsBinary
         ciphertextAsBinary,
-    const AffinePointAsBinary privateKeyAsBinary,
-    const BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
-        publicParametersAsBinary) {
+    const PairingGroupElement *privateKey,
+    const BonehFranklinIdentityBasedEncryptionPublicParameters
+        *publicParameters,
+    const PairingGroupElement *pointP, const PairingGroup *group) {
   // Implementation of Algorithm 5.5.1 (BFdecrypt) in [RFC-5091].
 
-  BonehFranklinIdentityBasedEncryptionPublicParameters publicParameters;
-  bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_toBonehFranklinIdentityBasedEncryptionPublicParameters(
-      &publicParameters, publicParametersAsBinary);
-
-  if (!bonehFranklinIdentityBasedEncryptionPublicParameters_isValid(
-          publicParameters)) {
-    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-        publicParameters);
-    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
-  }
-
-  AffinePoint privateKey;
-  affineAsBinary_toAffine(&privateKey, privateKeyAsBinary);
-
-  if (!affine_isValid(privateKey, publicParameters.ellipticCurve)) {
-    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-        publicParameters);
-    affine_destroy(privateKey);
-    return CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR;
-  }
-
   BonehFranklinIdentityBasedEncryptionCiphertext ciphertext;
-  bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_toBonehFranklinIdentityBasedEncryptionCiphertext(
-      &ciphertext, ciphertextAsBinary);
+  CryptidStatus status =
+      bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_toBonehFranklinIdentityBasedEncryptionCiphertext(
+          &ciphertext, ciphertextAsBinary, group);
+  if (status) {
+    return status;
+  }
 
-  if (!bonehFranklinIdentityBasedEncryptionCiphertext_isValid(
-          ciphertext, publicParameters.ellipticCurve)) {
-    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-        publicParameters);
-    affine_destroy(privateKey);
+  if (!bonehFranklinIdentityBasedEncryptionCiphertext_isValid(ciphertext)) {
     bonehFranklinIdentityBasedEncryptionCiphertext_destroy(ciphertext);
     return CRYPTID_ILLEGAL_CIPHERTEXT_ERROR;
   }
@@ -447,18 +516,14 @@ CryptidStatus cryptid_ibe_bonehFranklin_decrypt(
   // Let {@code hashlen} be the length of the output of the hash function
   // {@code hashfcn} measured in octets.
   int hashLen;
-  hashFunction_getHashSize(&hashLen, publicParameters.hashFunction);
+  hashFunction_getHashSize(&hashLen, publicParameters->hashFunction);
 
-  // Let \f$theta = \mathrm{Pairing}(E, p ,q, U, S_{id})\f$ by applying the
-  // modified Tate pairing.
-  Complex theta;
-  CryptidStatus status =
-      tate_performPairing(&theta, ciphertext.cipherU, privateKey, 2,
-                          publicParameters.q, publicParameters.ellipticCurve);
+  // Let \f$theta = \mathrm{Pairing}(E, p ,q, S_{id}, U)\f$, with the
+  // arguments swapped compared to [RFC-5091], as \f$S_{id}\f$ is in
+  // \f$G_1\f$.
+  PairingGroupElement theta;
+  status = pairingGroup_pair(&theta, privateKey, &ciphertext.cipherU, group);
   if (status) {
-    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-        publicParameters);
-    affine_destroy(privateKey);
     bonehFranklinIdentityBasedEncryptionCiphertext_destroy(ciphertext);
     mpz_clear(l);
     return status;
@@ -468,12 +533,12 @@ CryptidStatus cryptid_ibe_bonehFranklin_decrypt(
   // representation of {@code theta}.
   int zLength;
   unsigned char *z;
-  canonical(&z, &zLength, theta, publicParameters.ellipticCurve.fieldOrder, 1);
+  pairingGroup_toBinary(&z, &zLength, &theta, group);
 
   // Let \f$w = \mathrm{hashfcn}(z)$ using the {@code hashfcn} hashing
   // algorithm, the result of which is a {@code hashlen}-octet string.
   unsigned char *w = (unsigned char *)calloc(hashLen, sizeof(unsigned char));
-  hashFunction_hash(w, z, zLength, publicParameters.hashFunction);
+  hashFunction_hash(w, z, zLength, publicParameters->hashFunction);
 
   // Let \f$rho = w \oplus V\f$, the bit-wise XOR of \f$w\f$ and \f$V\f$.
   unsigned char *rho =
@@ -489,7 +554,7 @@ CryptidStatus cryptid_ibe_bonehFranklin_decrypt(
   char *m = (char *)calloc(ciphertext.cipherWLength + 1, sizeof(char));
   unsigned char *hashedBytes;
   hashBytes(&hashedBytes, ciphertext.cipherWLength, rho, hashLen,
-            publicParameters.hashFunction);
+            publicParameters->hashFunction);
   for (size_t i = 0; i < ciphertext.cipherWLength; i++) {
     m[i] = hashedBytes[i] ^ ciphertext.cipherW[i];
   }
@@ -498,7 +563,7 @@ CryptidStatus cryptid_ibe_bonehFranklin_decrypt(
   // Let \f$t = \mathrm{hashfcn}(m)\f$ using the \f$hashfcn\f$ algorithm.
   unsigned char *t = (unsigned char *)calloc(hashLen, sizeof(unsigned char));
   hashFunction_hash(t, (unsigned char *)m, ciphertext.cipherWLength,
-                    publicParameters.hashFunction);
+                    publicParameters->hashFunction);
 
   // Let \f$l = \mathrm{HashToRange}(rho || t, q, \mathrm{hashfcn}) using
   // HashToRange on the \f$(2 * \mathrm{hashlen})\f$-octet concatenation of
@@ -513,10 +578,10 @@ CryptidStatus cryptid_ibe_bonehFranklin_decrypt(
   }
   concat[2 * hashLen] = '\0';
 
-  hashToRange(l, concat, 2 * hashLen, publicParameters.q,
-              publicParameters.hashFunction);
+  hashToRange(l, concat, 2 * hashLen, publicParameters->q,
+              publicParameters->hashFunction);
 
-  complex_destroy(theta);
+  pairingGroupElement_destroy(theta);
   free(z);
   free(t);
   free(w);
@@ -525,13 +590,9 @@ CryptidStatus cryptid_ibe_bonehFranklin_decrypt(
   free(concat);
 
   // Verify that \f$U = [l]P\f$.
-  AffinePoint testPoint;
-  status = affine_wNAFMultiply(&testPoint, publicParameters.pointP, l,
-                               publicParameters.ellipticCurve);
+  PairingGroupElement testPoint;
+  status = pairingGroup_multiply(&testPoint, pointP, l, group);
   if (status) {
-    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-        publicParameters);
-    affine_destroy(privateKey);
     bonehFranklinIdentityBasedEncryptionCiphertext_destroy(ciphertext);
     mpz_clear(l);
     free(m);
@@ -539,24 +600,278 @@ CryptidStatus cryptid_ibe_bonehFranklin_decrypt(
   }
 
   // If this is the case, then the decrypted plaintext \f$m\f$ is returned.
-  if (affine_isEquals(ciphertext.cipherU, testPoint)) {
-    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-        publicParameters);
-    affine_destroy(privateKey);
+  if (pairingGroup_isEquals(&ciphertext.cipherU, &testPoint, group)) {
     bonehFranklinIdentityBasedEncryptionCiphertext_destroy(ciphertext);
-    affine_destroy(testPoint);
+    pairingGroupElement_destroy(testPoint);
     mpz_clear(l);
     *result = m;
     return CRYPTID_SUCCESS;
   }
 
   // Otherwise, the ciphertext is rejected and no plaintext is returned.
-  bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
-      publicParameters);
-  affine_destroy(privateKey);
   bonehFranklinIdentityBasedEncryptionCiphertext_destroy(ciphertext);
-  affine_destroy(testPoint);
+  pairingGroupElement_destroy(testPoint);
   mpz_clear(l);
   free(m);
   return CRYPTID_DECRYPTION_FAILED_ERROR;
 }
+
+CryptidStatus cryptid_ibe_bonehFranklin_extract(
+    PairingGroupElementAsBinary *result, const char *const identity,
+    const size_t identityLength,
+    const BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary
+        masterSecretAsBinary,
+    const BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
+        publicParametersAsBinary) {
+  /*if (!result)
+  {
+      return CRYPTID_RESULT_POINTER_NULL_ERROR;
+  }*/
+
+  if (identityLength == 0) {
+    return CRYPTID_IDENTITY_LENGTH_ERROR;
+  }
+
+  BonehFranklinIdentityBasedEncryptionPublicParameters publicParameters;
+  PairingGroup group;
+  CryptidStatus status = bonehFranklin_loadPublicParameters(
+      &publicParameters, &group, publicParametersAsBinary);
+  if (status) {
+    return status;
+  }
+
+  status = bonehFranklin_extract(result, identity, identityLength,
+                                 masterSecretAsBinary, &publicParameters,
+                                 &group);
+
+  bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
+      publicParameters);
+  pairingGroup_release(group);
+
+  return status;
+}
+
+CryptidStatus cryptid_ibe_bonehFranklin_encrypt(
+    BonehFranklinIdentityBasedEncryptionCiphertextAsBinary *result,
+    const char *const message, const size_t messageLength,
+    const char *const identity, const size_t identityLength,
+    const BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
+        publicParametersAsBinary) {
+  CryptidStatus status = bonehFranklin_checkEncryptArguments(
+      message, messageLength, identity, identityLength);
+  if (status) {
+    return status;
+  }
+
+  BonehFranklinIdentityBasedEncryptionPublicParameters publicParameters;
+  PairingGroup group;
+  status = bonehFranklin_loadPublicParameters(&publicParameters, &group,
+                                              publicParametersAsBinary);
+  if (status) {
+    return status;
+  }
+
+  status = bonehFranklin_encrypt(
+      result, message, messageLength, identity, identityLength,
+      &publicParameters, &publicParameters.pointP,
+      &publicParameters.pointPpublic, NULL, &group);
+
+  bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
+      publicParameters);
+  pairingGroup_release(group);
+
+  return status;
+}
+
+CryptidStatus cryptid_ibe_bonehFranklin_decrypt(
+    char **result,
+    const BonehFranklinIdentityBasedEncryptionCiphertextAsBinary
+        ciphertextAsBinary,
+    const PairingGroupElementAsBinary privateKeyAsBinary,
+    const BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
+        publicParametersAsBinary) {
+  BonehFranklinIdentityBasedEncryptionPublicParameters publicParameters;
+  PairingGroup group;
+  CryptidStatus status = bonehFranklin_loadPublicParameters(
+      &publicParameters, &group, publicParametersAsBinary);
+  if (status) {
+    return status;
+  }
+
+  PairingGroupElement privateKey;
+  status = bonehFranklin_readPrivateKey(&privateKey, privateKeyAsBinary,
+                                        &group);
+  if (status) {
+    bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
+        publicParameters);
+    pairingGroup_release(group);
+    return status;
+  }
+
+  status = bonehFranklin_decrypt(result, ciphertextAsBinary, &privateKey,
+                                 &publicParameters, &publicParameters.pointP,
+                                 &group);
+
+  pairingGroupElement_destroy(privateKey);
+  bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
+      publicParameters);
+  pairingGroup_release(group);
+
+  return status;
+}
+
+CryptidStatus cryptid_ibe_bonehFranklin_prepare(
+    BonehFranklinIdentityBasedEncryptionPreparedPublicParameters *result,
+    const BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
+        publicParametersAsBinary) {
+  CryptidStatus status = bonehFranklin_loadPublicParameters(
+      &result->publicParameters, &result->group, publicParametersAsBinary);
+  if (status) {
+    return status;
+  }
+
+  status = pairingGroup_prepareFixedBase(&result->publicParameters.pointP,
+                                         &result->group);
+  if (!status) {
+    status = pairingGroup_preparePairingArgument(
+        &result->publicParameters.pointPpublic, &result->group);
+  }
+  if (status) {
+    bonehFranklinIdentityBasedEncryptionPreparedPublicParameters_destroy(
+        *result);
+    return status;
+  }
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus cryptid_ibe_bonehFranklin_preparePrivateKey(
+    BonehFranklinIdentityBasedEncryptionPreparedPrivateKey *result,
+    const PairingGroupElementAsBinary privateKeyAsBinary,
+    const BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        *preparedPublicParameters) {
+  CryptidStatus status =
+      bonehFranklin_readPrivateKey(&result->privateKey, privateKeyAsBinary,
+                                   &preparedPublicParameters->group);
+  if (status) {
+    return status;
+  }
+
+  status = pairingGroup_preparePairingArgument(
+      &result->privateKey, &preparedPublicParameters->group);
+  if (status) {
+    pairingGroupElement_destroy(result->privateKey);
+  }
+
+  return status;
+}
+
+CryptidStatus cryptid_ibe_bonehFranklin_prepareIdentity(
+    BonehFranklinIdentityBasedEncryptionPreparedIdentity *result,
+    const char *const identity, const size_t identityLength,
+    const BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        *preparedPublicParameters) {
+  if (!identity) {
+    return CRYPTID_IDENTITY_NULL_ERROR;
+  }
+
+  if (identityLength == 0) {
+    return CRYPTID_IDENTITY_LENGTH_ERROR;
+  }
+
+  const PairingGroup *group = &preparedPublicParameters->group;
+
+  CryptidStatus status = bonehFranklin_computeTheta(
+      &result->theta, identity, identityLength,
+      &preparedPublicParameters->publicParameters,
+      &preparedPublicParameters->publicParameters.pointPpublic, group);
+  if (status) {
+    return status;
+  }
+
+  // theta is a pairing value of elements of order q, so its order is q.
+  status = pairingGroup_prepareFixedBase(&result->theta, group);
+  if (status) {
+    pairingGroupElement_destroy(result->theta);
+  }
+
+  return status;
+}
+
+CryptidStatus cryptid_ibe_bonehFranklin_extractPrepared(
+    PairingGroupElementAsBinary *result, const char *const identity,
+    const size_t identityLength,
+    const BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary
+        masterSecretAsBinary,
+    const BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        *preparedPublicParameters) {
+  if (identityLength == 0) {
+    return CRYPTID_IDENTITY_LENGTH_ERROR;
+  }
+
+  return bonehFranklin_extract(result, identity, identityLength,
+                               masterSecretAsBinary,
+                               &preparedPublicParameters->publicParameters,
+                               &preparedPublicParameters->group);
+}
+
+CryptidStatus cryptid_ibe_bonehFranklin_encryptPrepared(
+    BonehFranklinIdentityBasedEncryptionCiphertextAsBinary *result,
+    const char *const message, const size_t messageLength,
+    const char *const identity, const size_t identityLength,
+    const BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        *preparedPublicParameters) {
+  CryptidStatus status = bonehFranklin_checkEncryptArguments(
+      message, messageLength, identity, identityLength);
+  if (status) {
+    return status;
+  }
+
+  const BonehFranklinIdentityBasedEncryptionPublicParameters *publicParameters =
+      &preparedPublicParameters->publicParameters;
+
+  return bonehFranklin_encrypt(result, message, messageLength, identity,
+                               identityLength, publicParameters,
+                               &publicParameters->pointP,
+                               &publicParameters->pointPpublic, NULL,
+                               &preparedPublicParameters->group);
+}
+
+CryptidStatus cryptid_ibe_bonehFranklin_encryptToPreparedIdentity(
+    BonehFranklinIdentityBasedEncryptionCiphertextAsBinary *result,
+    const char *const message, const size_t messageLength,
+    const BonehFranklinIdentityBasedEncryptionPreparedIdentity
+        *preparedIdentity,
+    const BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        *preparedPublicParameters) {
+  if (!message) {
+    return CRYPTID_MESSAGE_NULL_ERROR;
+  }
+
+  if (messageLength == 0) {
+    return CRYPTID_MESSAGE_LENGTH_ERROR;
+  }
+
+  const BonehFranklinIdentityBasedEncryptionPublicParameters *publicParameters =
+      &preparedPublicParameters->publicParameters;
+
+  return bonehFranklin_encrypt(
+      result, message, messageLength, NULL, 0, publicParameters,
+      &publicParameters->pointP, &publicParameters->pointPpublic,
+      &preparedIdentity->theta, &preparedPublicParameters->group);
+}
+
+CryptidStatus cryptid_ibe_bonehFranklin_decryptPrepared(
+    char **result,
+    const BonehFranklinIdentityBasedEncryptionCiphertextAsBinary
+        ciphertextAsBinary,
+    const BonehFranklinIdentityBasedEncryptionPreparedPrivateKey
+        *preparedPrivateKey,
+    const BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        *preparedPublicParameters) {
+  return bonehFranklin_decrypt(
+      result, ciphertextAsBinary, &preparedPrivateKey->privateKey,
+      &preparedPublicParameters->publicParameters,
+      &preparedPublicParameters->publicParameters.pointP,
+      &preparedPublicParameters->group);
+}
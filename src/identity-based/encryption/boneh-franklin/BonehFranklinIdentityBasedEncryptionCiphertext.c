@@ -5,10 +5,10 @@
 
 void bonehFranklinIdentityBasedEncryptionCiphertext_init(
     BonehFranklinIdentityBasedEncryptionCiphertext *ciphertextOutput,
-    const AffinePoint cipherU, const unsigned char *const cipherV,
+    const PairingGroupElement cipherU, const unsigned char *const cipherV,
     const int cipherVLength, const unsigned char *const cipherW,
     const int cipherWLength) {
-  affine_init(&ciphertextOutput->cipherU, cipherU.x, cipherU.y);
+  ciphertextOutput->cipherU = cipherU;
 
   ciphertextOutput->cipherV =
       (unsigned char *)malloc(cipherVLength * sizeof(unsigned char) + 1);
@@ -25,18 +25,15 @@ void bonehFranklinIdentityBasedEncryptionCiphertext_init(
 
 void bonehFranklinIdentityBasedEncryptionCiphertext_destroy(
     BonehFranklinIdentityBasedEncryptionCiphertext ciphertext) {
-  affine_destroy(ciphertext.cipherU);
+  pairingGroupElement_destroy(ciphertext.cipherU);
   free(ciphertext.cipherV);
   free(ciphertext.cipherW);
 }
 
 CryptidValidationResult bonehFranklinIdentityBasedEncryptionCiphertext_isValid(
     const BonehFranklinIdentityBasedEncryptionCiphertext
-        bonehFranklinIdentityBasedEncryptionCiphertext,
-    const EllipticCurve ellipticCurve) {
-  if (affine_isValid(bonehFranklinIdentityBasedEncryptionCiphertext.cipherU,
-                     ellipticCurve) &&
-      bonehFranklinIdentityBasedEncryptionCiphertext.cipherV &&
+        bonehFranklinIdentityBasedEncryptionCiphertext) {
+  if (bonehFranklinIdentityBasedEncryptionCiphertext.cipherV &&
       bonehFranklinIdentityBasedEncryptionCiphertext.cipherVLength != 0 &&
       bonehFranklinIdentityBasedEncryptionCiphertext.cipherW &&
       bonehFranklinIdentityBasedEncryptionCiphertext.cipherWLength != 0) {
@@ -6,11 +6,11 @@
 void bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_init(
     BonehFranklinIdentityBasedEncryptionCiphertextAsBinary
         *ciphertextAsBinaryOutput,
-    const AffinePointAsBinary cipherU, const void *const cipherV,
+    const PairingGroupElementAsBinary cipherU, const void *const cipherV,
     const size_t cipherVLength, const void *const cipherW,
     const size_t cipherWLength) {
-  affineAsBinary_init(&ciphertextAsBinaryOutput->cipherU, cipherU.x,
-                      cipherU.xLength, cipherU.y, cipherU.yLength);
+  pairingGroupElementAsBinary_init(&ciphertextAsBinaryOutput->cipherU,
+                                   cipherU.element, cipherU.elementLength);
 
   ciphertextAsBinaryOutput->cipherV = malloc(cipherVLength + 1);
   memcpy(ciphertextAsBinaryOutput->cipherV, cipherV, cipherVLength + 1);
@@ -26,18 +26,22 @@ void bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_init(
 void bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_destroy(
     BonehFranklinIdentityBasedEncryptionCiphertextAsBinary
         bonehFranklinIdentityBasedEncryptionCiphertextAsBinary) {
-  affineAsBinary_destroy(
+  pairingGroupElementAsBinary_destroy(
       bonehFranklinIdentityBasedEncryptionCiphertextAsBinary.cipherU);
   free(bonehFranklinIdentityBasedEncryptionCiphertextAsBinary.cipherV);
   free(bonehFranklinIdentityBasedEncryptionCiphertextAsBinary.cipherW);
 }
 
-void bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_toBonehFranklinIdentityBasedEncryptionCiphertext(
+CryptidStatus bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_toBonehFranklinIdentityBasedEncryptionCiphertext(
     BonehFranklinIdentityBasedEncryptionCiphertext *ciphertextOutput,
     const BonehFranklinIdentityBasedEncryptionCiphertextAsBinary
-        ciphertextAsBinary) {
-  affineAsBinary_toAffine(&ciphertextOutput->cipherU,
-                          ciphertextAsBinary.cipherU);
+        ciphertextAsBinary,
+    const PairingGroup *group) {
+  if (pairingGroupElementAsBinary_toPairingGroupElement(
+          &ciphertextOutput->cipherU, pairingGroup_G2,
+          ciphertextAsBinary.cipherU, group)) {
+    return CRYPTID_ILLEGAL_CIPHERTEXT_ERROR;
+  }
 
   ciphertextOutput->cipherV = malloc(ciphertextAsBinary.cipherVLength + 1);
   memcpy(ciphertextOutput->cipherV, ciphertextAsBinary.cipherV,
@@ -50,14 +54,17 @@ void bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_toBonehFranklinIdent
          ciphertextAsBinary.cipherWLength + 1);
 
   ciphertextOutput->cipherWLength = ciphertextAsBinary.cipherWLength;
+
+  return CRYPTID_SUCCESS;
 }
 
 void bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_fromBonehFranklinIdentityBasedEncryptionCiphertext(
     BonehFranklinIdentityBasedEncryptionCiphertextAsBinary
         *ciphertextAsBinaryOutput,
-    const BonehFranklinIdentityBasedEncryptionCiphertext ciphertext) {
-  affineAsBinary_fromAffine(&ciphertextAsBinaryOutput->cipherU,
-                            ciphertext.cipherU);
+    const BonehFranklinIdentityBasedEncryptionCiphertext ciphertext,
+    const PairingGroup *group) {
+  pairingGroupElementAsBinary_fromPairingGroupElement(
+      &ciphertextAsBinaryOutput->cipherU, &ciphertext.cipherU, group);
 
   ciphertextAsBinaryOutput->cipherV = malloc(ciphertext.cipherVLength + 1);
   memcpy(ciphertextAsBinaryOutput->cipherV, ciphertext.cipherV,
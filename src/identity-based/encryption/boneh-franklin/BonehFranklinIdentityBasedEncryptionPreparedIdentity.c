@@ -0,0 +1,6 @@
+#include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPreparedIdentity.h"
+
+void bonehFranklinIdentityBasedEncryptionPreparedIdentity_destroy(
+    BonehFranklinIdentityBasedEncryptionPreparedIdentity preparedIdentity) {
+  pairingGroupElement_destroy(preparedIdentity.theta);
+}
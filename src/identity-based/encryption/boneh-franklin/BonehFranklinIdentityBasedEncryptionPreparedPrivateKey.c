@@ -0,0 +1,6 @@
+#include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPreparedPrivateKey.h"
+
+void bonehFranklinIdentityBasedEncryptionPreparedPrivateKey_destroy(
+    BonehFranklinIdentityBasedEncryptionPreparedPrivateKey preparedPrivateKey) {
+  pairingGroupElement_destroy(preparedPrivateKey.privateKey);
+}
@@ -0,0 +1,9 @@
+#include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPreparedPublicParameters.h"
+
+void bonehFranklinIdentityBasedEncryptionPreparedPublicParameters_destroy(
+    BonehFranklinIdentityBasedEncryptionPreparedPublicParameters
+        preparedPublicParameters) {
+  bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
+      preparedPublicParameters.publicParameters);
+  pairingGroup_release(preparedPublicParameters.group);
+}
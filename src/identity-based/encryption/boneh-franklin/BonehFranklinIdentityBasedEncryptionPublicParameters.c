@@ -2,19 +2,19 @@
 #include <string.h>
 
 #include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryptionPublicParameters.h"
-#include "util/PrimalityTest.h"
 
 void bonehFranklinIdentityBasedEncryptionPublicParameters_init(
     BonehFranklinIdentityBasedEncryptionPublicParameters
         *publicParametersOutput,
-    const EllipticCurve ellipticCurve, const mpz_t q, const AffinePoint pointP,
-    const AffinePoint pointPpublic, const HashFunction hashFunction) {
+    const PairingGroupType pairingGroupType, const EllipticCurve ellipticCurve,
+    const mpz_t q, const PairingGroupElement pointP,
+    const PairingGroupElement pointPpublic, const HashFunction hashFunction) {
+  publicParametersOutput->pairingGroupType = pairingGroupType;
   ellipticCurve_init(&publicParametersOutput->ellipticCurve, ellipticCurve.a,
                      ellipticCurve.b, ellipticCurve.fieldOrder);
   mpz_init_set(publicParametersOutput->q, q);
-  affine_init(&publicParametersOutput->pointP, pointP.x, pointP.y);
-  affine_init(&publicParametersOutput->pointPpublic, pointPpublic.x,
-              pointPpublic.y);
+  publicParametersOutput->pointP = pointP;
+  publicParametersOutput->pointPpublic = pointPpublic;
   publicParametersOutput->hashFunction = hashFunction;
 }
 
@@ -22,22 +22,23 @@ void bonehFranklinIdentityBasedEncryptionPublicParameters_destroy(
     BonehFranklinIdentityBasedEncryptionPublicParameters publicParameters) {
   ellipticCurve_destroy(publicParameters.ellipticCurve);
   mpz_clear(publicParameters.q);
-  affine_destroy(publicParameters.pointP);
-  affine_destroy(publicParameters.pointPpublic);
+  pairingGroupElement_destroy(publicParameters.pointP);
+  pairingGroupElement_destroy(publicParameters.pointPpublic);
 }
 
 CryptidValidationResult
 bonehFranklinIdentityBasedEncryptionPublicParameters_isValid(
     const BonehFranklinIdentityBasedEncryptionPublicParameters
-        publicParameters) {
-  if (ellipticCurve_isTypeOne(publicParameters.ellipticCurve) &&
-      primalityTest_isProbablePrime(publicParameters.q) &&
-      affine_isValid(publicParameters.pointP, publicParameters.ellipticCurve) &&
-      affine_isValid(publicParameters.pointPpublic,
-                     publicParameters.ellipticCurve) &&
-      hashFunction_isValid(publicParameters.hashFunction)) {
+        publicParameters,
+    const PairingGroup *group) {
+  if (hashFunction_isValid(publicParameters.hashFunction) &&
+      publicParameters.pairingGroupType == group->type &&
+      publicParameters.pointP.type == group->type &&
+      publicParameters.pointP.subgroup == pairingGroup_G2 &&
+      publicParameters.pointPpublic.type == group->type &&
+      publicParameters.pointPpublic.subgroup == pairingGroup_G2) {
     return CRYPTID_VALIDATION_SUCCESS;
   }
 
   return CRYPTID_VALIDATION_FAILURE;
-}
\ No newline at end of file
+}
@@ -6,9 +6,13 @@
 void bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_init(
     BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
         *publicParametersAsBinaryOutput,
+    const PairingGroupType pairingGroupType,
     const EllipticCurveAsBinary ellipticCurve, const void *const q,
-    const size_t qLength, const AffinePointAsBinary pointP,
-    const AffinePointAsBinary pointPpublic, const HashFunction hashFunction) {
+    const size_t qLength, const PairingGroupElementAsBinary pointP,
+    const PairingGroupElementAsBinary pointPpublic,
+    const HashFunction hashFunction) {
+  publicParametersAsBinaryOutput->pairingGroupType = pairingGroupType;
+
   ellipticCurveAsBinary_init(
       &publicParametersAsBinaryOutput->ellipticCurve, ellipticCurve.a,
       ellipticCurve.aLength, ellipticCurve.b, ellipticCurve.bLength,
@@ -19,12 +23,12 @@ void bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_init(
 
   publicParametersAsBinaryOutput->qLength = qLength;
 
-  affineAsBinary_init(&publicParametersAsBinaryOutput->pointP, pointP.x,
-                      pointP.xLength, pointP.y, pointP.yLength);
+  pairingGroupElementAsBinary_init(&publicParametersAsBinaryOutput->pointP,
+                                   pointP.element, pointP.elementLength);
 
-  affineAsBinary_init(&publicParametersAsBinaryOutput->pointPpublic,
-                      pointPpublic.x, pointPpublic.xLength, pointPpublic.y,
-                      pointPpublic.yLength);
+  pairingGroupElementAsBinary_init(
+      &publicParametersAsBinaryOutput->pointPpublic, pointPpublic.element,
+      pointPpublic.elementLength);
 
   publicParametersAsBinaryOutput->hashFunction = hashFunction;
 }
@@ -34,15 +38,34 @@ void bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_destroy(
         publicParametersAsBinary) {
   ellipticCurveAsBinary_destroy(publicParametersAsBinary.ellipticCurve);
   free(publicParametersAsBinary.q);
-  affineAsBinary_destroy(publicParametersAsBinary.pointP);
-  affineAsBinary_destroy(publicParametersAsBinary.pointPpublic);
+  pairingGroupElementAsBinary_destroy(publicParametersAsBinary.pointP);
+  pairingGroupElementAsBinary_destroy(publicParametersAsBinary.pointPpublic);
 }
 
-void bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_toBonehFranklinIdentityBasedEncryptionPublicParameters(
+CryptidStatus bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_toBonehFranklinIdentityBasedEncryptionPublicParameters(
     BonehFranklinIdentityBasedEncryptionPublicParameters
         *publicParametersOutput,
     const BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
-        publicParametersAsBinary) {
+        publicParametersAsBinary,
+    const PairingGroup *group) {
+  CryptidStatus status = pairingGroupElementAsBinary_toPairingGroupElement(
+      &publicParametersOutput->pointP, pairingGroup_G2,
+      publicParametersAsBinary.pointP, group);
+  if (status) {
+    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+  }
+
+  status = pairingGroupElementAsBinary_toPairingGroupElement(
+      &publicParametersOutput->pointPpublic, pairingGroup_G2,
+      publicParametersAsBinary.pointPpublic, group);
+  if (status) {
+    pairingGroupElement_destroy(publicParametersOutput->pointP);
+    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+  }
+
+  publicParametersOutput->pairingGroupType =
+      publicParametersAsBinary.pairingGroupType;
+
   ellipticCurveAsBinary_toEllipticCurve(&publicParametersOutput->ellipticCurve,
                                         publicParametersAsBinary.ellipticCurve);
 
@@ -50,20 +73,20 @@ void bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_toBonehFrankli
   mpz_import(publicParametersOutput->q, publicParametersAsBinary.qLength, 1, 1,
              0, 0, publicParametersAsBinary.q);
 
-  affineAsBinary_toAffine(&publicParametersOutput->pointP,
-                          publicParametersAsBinary.pointP);
-
-  affineAsBinary_toAffine(&publicParametersOutput->pointPpublic,
-                          publicParametersAsBinary.pointPpublic);
-
   publicParametersOutput->hashFunction = publicParametersAsBinary.hashFunction;
+
+  return CRYPTID_SUCCESS;
 }
 
 void bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_fromBonehFranklinIdentityBasedEncryptionPublicParameters(
     BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
         *publicParametersAsBinaryOutput,
     const BonehFranklinIdentityBasedEncryptionPublicParameters
-        publicParameters) {
+        publicParameters,
+    const PairingGroup *group) {
+  publicParametersAsBinaryOutput->pairingGroupType =
+      publicParameters.pairingGroupType;
+
   ellipticCurveAsBinary_fromEllipticCurve(
       &publicParametersAsBinaryOutput->ellipticCurve,
       publicParameters.ellipticCurve);
@@ -72,11 +95,12 @@ void bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_fromBonehFrank
       mpz_export(NULL, &publicParametersAsBinaryOutput->qLength, 1, 1, 0, 0,
                  publicParameters.q);
 
-  affineAsBinary_fromAffine(&publicParametersAsBinaryOutput->pointP,
-                            publicParameters.pointP);
+  pairingGroupElementAsBinary_fromPairingGroupElement(
+      &publicParametersAsBinaryOutput->pointP, &publicParameters.pointP, group);
 
-  affineAsBinary_fromAffine(&publicParametersAsBinaryOutput->pointPpublic,
-                            publicParameters.pointPpublic);
+  pairingGroupElementAsBinary_fromPairingGroupElement(
+      &publicParametersAsBinaryOutput->pointPpublic,
+      &publicParameters.pointPpublic, group);
 
   publicParametersAsBinaryOutput->hashFunction = publicParameters.hashFunction;
-}
\ No newline at end of file
+}
@@ -1,8 +1,8 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "elliptic/TatePairing.h"
 #include "identity-based/signature/hess/HessIdentityBasedSignature.h"
+#include "pairing/PairingGroup.h"
 #include "util/PrimalityTest.h"
 #include "util/RandBytes.h"
 #include "util/Random.h"
@@ -16,29 +16,21 @@
 //  BF and BB1 Cryptosystems
 
 static const unsigned int SOLINAS_GENERATION_ATTEMPT_LIMIT = 100;
-static const unsigned int POINT_GENERATION_ATTEMPT_LIMIT = 100;
 
 static const unsigned int Q_LENGTH_MAPPING[] = {160, 224, 256, 384, 512};
 static const unsigned int P_LENGTH_MAPPING[] = {512, 1024, 1536, 3840, 7680};
 
-CryptidStatus cryptid_ibs_hess_setup(
-    HessIdentityBasedSignatureMasterSecretAsBinary *masterSecretAsBinary,
-    HessIdentityBasedSignaturePublicParametersAsBinary
-        *publicParametersAsBinary,
-    const SecurityLevel securityLevel) {
-  // Implementation of Algorithm 5.1.2 (BFsetup1) in [RFC-5091].
+// Sets up the pairingGroup_TYPE_1 group of Algorithm 5.1.2 (BFsetup1) in
+// [RFC-5091]. On CRYPTID_SUCCESS, the group should be released by the caller.
+static CryptidStatus hess_setUpType1PairingGroup(
+    PairingGroup *group, const SecurityLevel securityLevel) {
   // Note, that instead of taking the bitlengts of p and q as arguments, this
   // function takes a security level which is in turn translated to bitlengths
   // using {@code P_LENGTH_MAPPING} and
   // {@code Q_LENGTH_MAPPING}.
 
-  /*if (!publicParameters)
-  {
-      return CRYPTID_PUBLIC_PARAMETERS_NULL_ERROR;
-  }*/
-
   // Construct the elliptic curve and its subgroup of interest
-  // Select a random n_q-bit Solinas prime q
+  // Select a random \f$n_q\f$-bit Solinas prime \f$q\f$.
   mpz_t q;
   mpz_init(q);
 
@@ -73,35 +65,74 @@ CryptidStatus cryptid_ibs_hess_setup(
 
   mpz_clears(zero, one, NULL);
 
-  // Select a point \f$P\f$ of order \f$q\f$ in \f$E(F_p)\f$.
-  AffinePoint pointP;
-  do {
-    AffinePoint pointPprime;
-    status =
-        random_affinePoint(&pointPprime, ec, POINT_GENERATION_ATTEMPT_LIMIT);
+  status = pairingGroup_acquireType1(group, ec, q);
 
-    if (status) {
-      mpz_clears(p, q, r, NULL);
-      ellipticCurve_destroy(ec);
-      return status;
-    }
+  mpz_clears(p, q, r, NULL);
+  ellipticCurve_destroy(ec);
 
-    mpz_t rMul;
-    mpz_init_set(rMul, r);
-    mpz_mul_ui(rMul, rMul, 12);
+  return status;
+}
 
-    status = affine_wNAFMultiply(&pointP, pointPprime, rMul, ec);
+CryptidStatus cryptid_ibs_hess_setup(
+    HessIdentityBasedSignatureMasterSecretAsBinary *masterSecretAsBinary,
+    HessIdentityBasedSignaturePublicParametersAsBinary
+        *publicParametersAsBinary,
+    const SecurityLevel securityLevel) {
+  return cryptid_ibs_hess_setupForPairingGroup(
+      masterSecretAsBinary, publicParametersAsBinary, securityLevel,
+      pairingGroup_TYPE_1);
+}
 
-    if (status) {
-      mpz_clears(p, q, r, rMul, NULL);
-      ellipticCurve_destroy(ec);
-      affine_destroy(pointPprime);
-      return status;
+CryptidStatus cryptid_ibs_hess_setupForPairingGroup(
+    HessIdentityBasedSignatureMasterSecretAsBinary *masterSecretAsBinary,
+    HessIdentityBasedSignaturePublicParametersAsBinary
+        *publicParametersAsBinary,
+    const SecurityLevel securityLevel,
+    const PairingGroupType pairingGroupType) {
+  // Implementation of Algorithm 5.1.2 (BFsetup1) in [RFC-5091], on a pairing
+  // \f$e : G_1 \times G_2 \rightarrow G_T\f$, with \f$P\f$ and \f$P_{pub}\f$
+  // in \f$G_2\f$.
+
+  /*if (!publicParameters)
+  {
+      return CRYPTID_PUBLIC_PARAMETERS_NULL_ERROR;
+  }*/
+
+  PairingGroup group;
+  CryptidStatus status;
+  switch (pairingGroupType) {
+  case pairingGroup_TYPE_1:
+    status = hess_setUpType1PairingGroup(&group, securityLevel);
+    break;
+  case pairingGroup_BLS12_381:
+    // The subgroups of BLS12-381 are of 255 bits.
+    if (securityLevel > MEDIUM) {
+      return CRYPTID_SECURITY_LEVEL_NOT_SUPPORTED_ERROR;
     }
+    status = pairingGroup_acquireBls12381(&group);
+    break;
+  default:
+    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+  }
 
-    mpz_clear(rMul);
-    affine_destroy(pointPprime);
-  } while (affine_isInfinity(pointP));
+  if (status) {
+    return status;
+  }
+
+  EllipticCurve ec;
+  mpz_t q;
+  mpz_init(q);
+  pairingGroup_describe(&ec, q, &group);
+
+  // Select a point \f$P\f$ of order \f$q\f$ in \f$G_2\f$.
+  PairingGroupElement pointP;
+  status = pairingGroup_random(&pointP, pairingGroup_G2, &group);
+  if (status) {
+    mpz_clear(q);
+    ellipticCurve_destroy(ec);
+    pairingGroup_release(group);
+    return status;
+  }
 
   // Determine the master secret
   mpz_t qMinusTwo, s;
@@ -114,14 +145,14 @@ CryptidStatus cryptid_ibs_hess_setup(
   mpz_clear(qMinusTwo);
 
   // Determine the public parameters
-  AffinePoint pointPpublic;
-
-  status = affine_wNAFMultiply(&pointPpublic, pointP, s, ec);
+  PairingGroupElement pointPpublic;
+  status = pairingGroup_multiply(&pointPpublic, &pointP, s, &group);
 
   if (status) {
-    mpz_clears(p, q, s, NULL);
-    affine_destroy(pointP);
+    mpz_clears(q, s, NULL);
+    pairingGroupElement_destroy(pointP);
     ellipticCurve_destroy(ec);
+    pairingGroup_release(group);
     return status;
   }
 
@@ -130,91 +161,99 @@ CryptidStatus cryptid_ibs_hess_setup(
 
   HessIdentityBasedSignaturePublicParameters publicParameters;
   hessIdentityBasedSignaturePublicParameters_init(
-      &publicParameters, ec, q, pointP, pointPpublic, hashFunction);
+      &publicParameters, pairingGroupType, ec, q, pointP, pointPpublic,
+      hashFunction);
 
   hessIdentityBasedSignaturePublicParametersAsBinary_fromHessIdentityBasedSignaturePublicParameters(
-      publicParametersAsBinary, publicParameters);
+      publicParametersAsBinary, publicParameters, &group);
 
   masterSecretAsBinary->masterSecret = mpz_export(
       NULL, &masterSecretAsBinary->masterSecretLength, 1, 1, 0, 0, s);
 
-  mpz_clears(p, q, s, r, NULL);
+  mpz_clears(q, s, NULL);
   hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-  affine_destroy(pointP);
-  affine_destroy(pointPpublic);
   ellipticCurve_destroy(ec);
+  pairingGroup_release(group);
 
   return CRYPTID_SUCCESS;
 }
 
-CryptidStatus cryptid_ibs_hess_extract(
-    AffinePointAsBinary *result, const char *const identity,
-    const size_t identityLength,
-    const HessIdentityBasedSignatureMasterSecretAsBinary masterSecretAsBinary,
+// Sets up the pairing group the public parameters record, validating their
+// curve and order. On CRYPTID_SUCCESS, the group should be released by the
+// caller.
+static CryptidStatus hess_acquirePairingGroup(
+    PairingGroup *group,
     const HessIdentityBasedSignaturePublicParametersAsBinary
         publicParametersAsBinary) {
-  // Implementation of Algorithm 5.3.1 (BFextractPriv) in [RFC-5091].
-
-  /*if (!result)
-  {
-      return CRYPTID_RESULT_POINTER_NULL_ERROR;
-  }*/
+  EllipticCurve ellipticCurve;
+  ellipticCurveAsBinary_toEllipticCurve(&ellipticCurve,
+                                        publicParametersAsBinary.ellipticCurve);
 
-  if (identityLength == 0) {
-    return CRYPTID_IDENTITY_LENGTH_ERROR;
-  }
+  mpz_t q;
+  mpz_init(q);
+  mpz_import(q, publicParametersAsBinary.qLength, 1, 1, 0, 0,
+             publicParametersAsBinary.q);
 
-  HessIdentityBasedSignaturePublicParameters publicParameters;
-  hessIdentityBasedSignaturePublicParametersAsBinary_toHessIdentityBasedSignaturePublicParameters(
-      &publicParameters, publicParametersAsBinary);
+  CryptidStatus status = pairingGroup_acquire(
+      group, publicParametersAsBinary.pairingGroupType, ellipticCurve, q);
 
-  if (!hessIdentityBasedSignaturePublicParameters_isValid(publicParameters)) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
-  }
+  ellipticCurve_destroy(ellipticCurve);
+  mpz_clear(q);
 
-  AffinePoint qId;
-
-  // Let \f$Q_{id} = \mathrm{HashToPoint}(E, p, q, id, \mathrm{hashfcn})\f$.
-  CryptidStatus status = hashToPoint(
-      &qId, identity, identityLength, publicParameters.q,
-      publicParameters.ellipticCurve, publicParameters.hashFunction);
+  return status;
+}
 
+// Imports and validates the public parameters, looking up the constants of
+// their group in the context caches, so that they are only derived the first
+// time the parameters are loaded. On CRYPTID_SUCCESS, the parameters should be
+// destroyed and the group released by the caller.
+static CryptidStatus hess_loadPublicParameters(
+    HessIdentityBasedSignaturePublicParameters *publicParameters,
+    PairingGroup *group,
+    const HessIdentityBasedSignaturePublicParametersAsBinary
+        publicParametersAsBinary) {
+  CryptidStatus status =
+      hess_acquirePairingGroup(group, publicParametersAsBinary);
   if (status) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
     return status;
   }
 
-  mpz_t masterSecret;
-  mpz_init(masterSecret);
-  mpz_import(masterSecret, masterSecretAsBinary.masterSecretLength, 1, 1, 0, 0,
-             masterSecretAsBinary.masterSecret);
-
-  AffinePoint affineResult;
+  status =
+      hessIdentityBasedSignaturePublicParametersAsBinary_toHessIdentityBasedSignaturePublicParameters(
+          publicParameters, publicParametersAsBinary, group);
+  if (status) {
+    pairingGroup_release(*group);
+    return status;
+  }
 
-  // Let \f$S_{id} = [s]Q_{id}\f$.
-  status = affine_wNAFMultiply(&affineResult, qId, masterSecret,
-                               publicParameters.ellipticCurve);
+  if (!hessIdentityBasedSignaturePublicParameters_isValid(*publicParameters,
+                                                          group)) {
+    hessIdentityBasedSignaturePublicParameters_destroy(*publicParameters);
+    pairingGroup_release(*group);
+    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+  }
 
-  affineAsBinary_fromAffine(result, affineResult);
+  return CRYPTID_SUCCESS;
+}
 
-  hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-  affine_destroy(qId);
-  affine_destroy(affineResult);
-  mpz_clear(masterSecret);
+// Reads a private key as an element of \f$G_1\f$. On CRYPTID_SUCCESS, the key
+// should be destroyed by the caller.
+static CryptidStatus
+hess_readPrivateKey(PairingGroupElement *privateKey,
+                    const PairingGroupElementAsBinary privateKeyAsBinary,
+                    const PairingGroup *group) {
+  if (pairingGroupElementAsBinary_toPairingGroupElement(
+          privateKey, pairingGroup_G1, privateKeyAsBinary, group)) {
+    return CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR;
+  }
 
-  return status;
+  return CRYPTID_SUCCESS;
 }
 
-CryptidStatus
-cryptid_ibs_hess_sign(HessIdentityBasedSignatureSignatureAsBinary *result,
-                      const char *const message, const size_t messageLength,
-                      const char *const identity, const size_t identityLength,
-                      const AffinePointAsBinary privateKeyAsBinary,
-                      const HessIdentityBasedSignaturePublicParametersAsBinary
-                          publicParametersAsBinary) {
-  // Implementation of Scheme 1. Sign in [HESS-IBS].
-
+static CryptidStatus hess_checkSignArguments(const char *const message,
+                                             const size_t messageLength,
+                                             const char *const identity,
+                                             const size_t identityLength) {
   if (!message) {
     return CRYPTID_MESSAGE_NULL_ERROR;
   }
@@ -231,71 +270,126 @@ cryptid_ibs_hess_sign(HessIdentityBasedSignatureSignatureAsBinary *result,
     return CRYPTID_IDENTITY_LENGTH_ERROR;
   }
 
-  HessIdentityBasedSignaturePublicParameters publicParameters;
-  hessIdentityBasedSignaturePublicParametersAsBinary_toHessIdentityBasedSignaturePublicParameters(
-      &publicParameters, publicParametersAsBinary);
+  return CRYPTID_SUCCESS;
+}
 
-  if (!hessIdentityBasedSignaturePublicParameters_isValid(publicParameters)) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+static CryptidStatus
+hess_extract(PairingGroupElementAsBinary *result, const char *const identity,
+             const size_t identityLength,
+             const HessIdentityBasedSignatureMasterSecretAsBinary
+                 masterSecretAsBinary,
+             const HessIdentityBasedSignaturePublicParameters *publicParameters,
+             const PairingGroup *group) {
+  // Implementation of Algorithm 5.3.1 (BFextractPriv) in [RFC-5091].
+
+  PairingGroupElement qId;
+
+  // Let \f$Q_{id} = \mathrm{HashToPoint}(E, p, q, id, \mathrm{hashfcn})\f$.
+  CryptidStatus status =
+      pairingGroup_hashToG1(&qId, identity, identityLength,
+                            publicParameters->hashFunction, group);
+
+  if (status) {
+    return status;
   }
 
+  mpz_t masterSecret;
+  mpz_init(masterSecret);
+  mpz_import(masterSecret, masterSecretAsBinary.masterSecretLength, 1, 1, 0, 0,
+             masterSecretAsBinary.masterSecret);
+
+  PairingGroupElement sId;
+
+  // Let \f$S_{id} = [s]Q_{id}\f$.
+  status = pairingGroup_multiply(&sId, &qId, masterSecret, group);
+
+  if (!status) {
+    pairingGroupElementAsBinary_fromPairingGroupElement(result, &sId, group);
+    pairingGroupElement_destroy(sId);
+  }
+
+  pairingGroupElement_destroy(qId);
+  mpz_clear(masterSecret);
+
+  return status;
+}
+
+// \f$P\f$ may be prepared as a pairing argument. If the prepared signer is
+// given, neither the identity nor \f$P\f$ is used, the private key has to be
+// the one of the signer, and no pairing is computed.
+static CryptidStatus
+hess_sign(HessIdentityBasedSignatureSignatureAsBinary *result,
+          const char *const message, const size_t messageLength,
+          const char *const identity, const size_t identityLength,
+          const PairingGroupElement *privateKey,
+          const HessIdentityBasedSignaturePublicParameters *publicParameters,
+          const PairingGroupElement *pointP,
+          const HessIdentityBasedSignaturePreparedSigner *preparedSigner,
+          const PairingGroup *group) {
+  // Implementation of Scheme 1. Sign in [HESS-IBS].
+
   mpz_t k;
   mpz_init(k);
   // Let (@code k) be a random number in range of (@code publicParameters.q).
-  random_mpzInRange(k, publicParameters.q);
+  random_mpzInRange(k, publicParameters->q);
 
   // Let {@code hashlen} be the length of the output of the cryptographic hash
   // function hashfcn from the public parameters.
   int hashLen;
-  hashFunction_getHashSize(&hashLen, publicParameters.hashFunction);
+  hashFunction_getHashSize(&hashLen, publicParameters->hashFunction);
+
+  PairingGroupElement computedPointQId;
+  const PairingGroupElement *pointQId;
+  PairingGroupElement r;
+  if (preparedSigner) {
+    pointQId = &preparedSigner->pointQId;
+
+    // Let \f$\mathrm{r} = \mathrm{theta}^k\f$, from the fixed-base table of
+    // theta.
+    pairingGroup_pow(&r, &preparedSigner->theta, k, group);
+  } else {
+    // \f$Q_{id} = \mathrm{HashToPoint}(E, p, q, id, \mathrm{hashfcn})\f$
+    // which results in an element of \f$G_1\f$.
+    CryptidStatus status =
+        pairingGroup_hashToG1(&computedPointQId, identity, identityLength,
+                              publicParameters->hashFunction, group);
+    if (status) {
+      mpz_clear(k);
+      return status;
+    }
+    pointQId = &computedPointQId;
 
-  // \f$Q_{id} = \mathrm{HashToPoint}(E, p, q, id, \mathrm{hashfcn})\f$
-  // which results in a point of order \f$q\f$ in \f$E(F_p)\f$.
-  AffinePoint pointQId;
-  CryptidStatus status = hashToPoint(
-      &pointQId, identity, identityLength, publicParameters.q,
-      publicParameters.ellipticCurve, publicParameters.hashFunction);
-  if (status) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-    mpz_clear(k);
-    return status;
-  }
+    // Let \f$\mathrm{theta} = \mathrm{Pairing}(E, p, q, Q_{id}, P)\f$, which
+    // is an element of \f$G_T\f$.
+    PairingGroupElement theta;
+    status = pairingGroup_pair(&theta, pointQId, pointP, group);
+    if (status) {
+      mpz_clear(k);
+      pairingGroupElement_destroy(computedPointQId);
+      return status;
+    }
 
-  // Let \f$\mathrm{theta} = \mathrm{Pairing}(E, p, q, Q_{id}, P_{pub})\f$,
-  // which is an element of the extension field \f$F_p^2\f$ obtained using the
-  // modified Tate pairing.
-  Complex theta;
-  status =
-      tate_performPairing(&theta, pointQId, publicParameters.pointP, 2,
-                          publicParameters.q, publicParameters.ellipticCurve);
-  if (status) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-    mpz_clear(k);
-    affine_destroy(pointQId);
-    return status;
+    // Let \f$\mathrm{r} = \mathrm{theta}^k\f$, which is theta raised to the
+    // power of \f$k\f$ in \f$G_T\f$.
+    pairingGroup_pow(&r, &theta, k, group);
+    pairingGroupElement_destroy(theta);
   }
 
-  // Let \f$\mathrm{r} = \mathrm{theta}^k\f$, which is theta raised to the power
-  // of \f$k\f$ in \f$F_p^2\f$.
-  Complex r;
-  complex_modPow(&r, theta, k, publicParameters.ellipticCurve.fieldOrder);
-
   // Let \f$z = \mathrm{Canonical}(p, k, 0, \mathrm{r})\f$, a canonical string
   // representation of {@code r}.
   int zLength;
   unsigned char *z;
-  canonical(&z, &zLength, r, publicParameters.ellipticCurve.fieldOrder, 1);
+  pairingGroup_toBinary(&z, &zLength, &r, group);
 
   // Let \f$w = \mathrm{hashfcn}(z)\f$ using the {@code hashfcn} hashing
   // algorithm, the result of which is a {@code hashlen}-octet string.
   unsigned char *w = (unsigned char *)calloc(hashLen, sizeof(unsigned char));
-  hashFunction_hash(w, z, zLength, publicParameters.hashFunction);
+  hashFunction_hash(w, z, zLength, publicParameters->hashFunction);
 
   // Let \f$t = \mathrm{hashfcn}(message)\f$ using the \f$hashfcn\f$ algorithm.
   unsigned char *t = (unsigned char *)calloc(hashLen, sizeof(unsigned char));
   hashFunction_hash(t, (unsigned char *)message, messageLength,
-                    publicParameters.hashFunction);
+                    publicParameters->hashFunction);
 
   // Let \f$v = \mathrm{HashToRange}(w || t, q, \mathrm{hashfcn}) using
   // HashToRange on the \f$(2 \cdot \mathrm{hashlen})\f$-octet concatenation of
@@ -311,54 +405,23 @@ cryptid_ibs_hess_sign(HessIdentityBasedSignatureSignatureAsBinary *result,
 
   mpz_t v;
   mpz_init(v);
-  hashToRange(v, concat, 2 * hashLen, publicParameters.q,
-              publicParameters.hashFunction);
-
-  // Let \f$u = v \cdot \mathrm{privateKey} + k \cdot Q_{id}\f$ be a point on
-  // the elliptic-curve, part of the signature.
-  AffinePoint privateKey, u, kMulPointQId, vMulPrivateKey;
-
-  affineAsBinary_toAffine(&privateKey, privateKeyAsBinary);
-
-  status = affine_wNAFMultiply(&vMulPrivateKey, privateKey, v,
-                               publicParameters.ellipticCurve);
-  if (status) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-    affine_destroy(privateKey);
-    mpz_clears(k, v, NULL);
-    affine_destroy(pointQId);
-    complex_destroyMany(2, theta, r);
-    free(z);
-    free(w);
-    free(t);
-    free(concat);
-    return status;
-  }
-  status = affine_wNAFMultiply(&kMulPointQId, pointQId, k,
-                               publicParameters.ellipticCurve);
-  if (status) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-    affine_destroy(privateKey);
-    mpz_clears(k, v, NULL);
-    affine_destroy(pointQId);
-    affine_destroy(vMulPrivateKey);
-    complex_destroyMany(2, theta, r);
-    free(z);
-    free(w);
-    free(t);
-    free(concat);
-    return status;
+  hashToRange(v, concat, 2 * hashLen, publicParameters->q,
+              publicParameters->hashFunction);
+
+  // Let \f$u = v \cdot \mathrm{privateKey} + k \cdot Q_{id}\f$ be an element
+  // of \f$G_1\f$, part of the signature. The two products share a single
+  // doubling chain, or come from the fixed-base tables of a prepared signer.
+  const PairingGroupElement points[] = {*privateKey, *pointQId};
+  const mpz_srcptr scalars[] = {v, k};
+  PairingGroupElement u;
+  CryptidStatus status =
+      pairingGroup_multiScalarMultiply(&u, points, scalars, 2, group);
+  if (!preparedSigner) {
+    pairingGroupElement_destroy(computedPointQId);
   }
-  status = affine_add(&u, vMulPrivateKey, kMulPointQId,
-                      publicParameters.ellipticCurve);
   if (status) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-    affine_destroy(privateKey);
     mpz_clears(k, v, NULL);
-    affine_destroy(pointQId);
-    affine_destroy(vMulPrivateKey);
-    affine_destroy(kMulPointQId);
-    complex_destroyMany(2, theta, r);
+    pairingGroupElement_destroy(r);
     free(z);
     free(w);
     free(t);
@@ -370,17 +433,11 @@ cryptid_ibs_hess_sign(HessIdentityBasedSignatureSignatureAsBinary *result,
   hessIdentityBasedSignatureSignature_init(&signature, u, v);
 
   hessIdentityBasedSignatureSignatureAsBinary_fromHessIdentityBasedSignatureSignature(
-      result, signature);
+      result, signature, group);
 
-  hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-  affine_destroy(privateKey);
   hessIdentityBasedSignatureSignature_destroy(signature);
   mpz_clears(k, v, NULL);
-  affine_destroy(pointQId);
-  affine_destroy(vMulPrivateKey);
-  affine_destroy(kMulPointQId);
-  affine_destroy(u);
-  complex_destroyMany(2, theta, r);
+  pairingGroupElement_destroy(r);
   free(z);
   free(w);
   free(t);
@@ -389,135 +446,138 @@ cryptid_ibs_hess_sign(HessIdentityBasedSignatureSignatureAsBinary *result,
   return CRYPTID_SUCCESS;
 }
 
-CryptidStatus cryptid_ibs_hess_verify(
-    const char *const message, const size_t messageLength,
-    const HessIdentityBasedSignatureSignatureAsBinary signatureAsBinary,
+// Computes the value \f$r\f$ of a signature from the identity of the signer.
+static CryptidStatus hess_computeR(
+    PairingGroupElement *r,
+    const HessIdentityBasedSignatureSignature *signature,
     const char *const identity, const size_t identityLength,
-    const HessIdentityBasedSignaturePublicParametersAsBinary
-        publicParametersAsBinary) {
-  // Implementation of Scheme 1. Verify in [HESS-IBS].
-
-  if (!message) {
-    return CRYPTID_MESSAGE_NULL_ERROR;
+    const HessIdentityBasedSignaturePublicParameters *publicParameters,
+    const PairingGroupElement *negativePointPpublic,
+    const PairingGroup *group) {
+  if (!identity) {
+    return CRYPTID_IDENTITY_NULL_ERROR;
   }
 
-  if (messageLength == 0) {
-    return CRYPTID_MESSAGE_LENGTH_ERROR;
+  if (identityLength == 0) {
+    return CRYPTID_IDENTITY_LENGTH_ERROR;
   }
 
-  HessIdentityBasedSignaturePublicParameters publicParameters;
-  hessIdentityBasedSignaturePublicParametersAsBinary_toHessIdentityBasedSignaturePublicParameters(
-      &publicParameters, publicParametersAsBinary);
+  // \f$Q_{id} = \mathrm{HashToPoint}(E, p, q, id, \mathrm{hashfcn})\f$
+  // which results in an element of \f$G_1\f$.
+  PairingGroupElement pointQId;
+  CryptidStatus status =
+      pairingGroup_hashToG1(&pointQId, identity, identityLength,
+                            publicParameters->hashFunction, group);
+  if (status) {
+    return status;
+  }
 
-  if (!hessIdentityBasedSignaturePublicParameters_isValid(publicParameters)) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+  // Let \f$\mathrm{theta1} = \mathrm{Pairing}(E, p ,q, u, P)\f$,
+  // \f$\mathrm{theta2} = \mathrm{Pairing}(E, p , q, Q_{id}, -P_{pub})\f$
+  // and \f$r = \mathrm{theta1} \cdot \mathrm{theta2}^v\f$. By bilinearity,
+  // \f$\mathrm{theta2}^v = \mathrm{Pairing}(E, p, q, [v]Q_{id}, -P_{pub})\f$,
+  // so \f$r\f$ is a product of two pairings, computed with a single final
+  // exponentiation.
+  PairingGroupElement pointVQId;
+  status = pairingGroup_multiply(&pointVQId, &pointQId, signature->v, group);
+  pairingGroupElement_destroy(pointQId);
+  if (status) {
+    return status;
   }
 
-  HessIdentityBasedSignatureSignature signature;
-  hessIdentityBasedSignatureSignatureAsBinary_toHessIdentityBasedSignatureSignature(
-      &signature, signatureAsBinary);
+  const PairingGroupElement ps[] = {signature->u, pointVQId};
+  const PairingGroupElement qs[] = {publicParameters->pointP,
+                                    *negativePointPpublic};
+  status = pairingGroup_pairProduct(r, ps, qs, 2, group);
 
-  if (!hessIdentityBasedSignatureSignature_isValid(
-          signature, publicParameters.ellipticCurve)) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-    hessIdentityBasedSignatureSignature_destroy(signature);
-    return CRYPTID_ILLEGAL_SIGNATURE_ERROR;
-  }
+  pairingGroupElement_destroy(pointVQId);
 
-  if (!identity) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-    hessIdentityBasedSignatureSignature_destroy(signature);
-    return CRYPTID_IDENTITY_NULL_ERROR;
-  }
+  return status;
+}
 
-  if (identityLength == 0) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-    hessIdentityBasedSignatureSignature_destroy(signature);
-    return CRYPTID_IDENTITY_LENGTH_ERROR;
+// Computes the value \f$r\f$ of a signature from
+// \f$\mathrm{theta2} = \mathrm{Pairing}(E, p , q, Q_{id}, -P_{pub})\f$ with its
+// fixed-base table. \f$P\f$ may be prepared as a pairing argument.
+static CryptidStatus
+hess_computeRFromTheta2(PairingGroupElement *r,
+                        const HessIdentityBasedSignatureSignature *signature,
+                        const PairingGroupElement *pointP,
+                        const PairingGroupElement *theta2,
+                        const PairingGroup *group) {
+  // Let \f$\mathrm{theta1} = \mathrm{Pairing}(E, p ,q, u, P)\f$.
+  PairingGroupElement theta1;
+  CryptidStatus status = pairingGroup_pair(&theta1, &signature->u, pointP,
+                                           group);
+  if (status) {
+    return status;
   }
 
-  CryptidStatus status;
+  // Let \f$r = \mathrm{theta1} \cdot \mathrm{theta2}^v\f$.
+  PairingGroupElement theta2Power;
+  pairingGroup_pow(&theta2Power, theta2, signature->v, group);
+  pairingGroup_mul(r, &theta1, &theta2Power, group);
 
-  // Let {@code hashlen} be the length of the output of the hash function
-  // {@code hashfcn} measured in octets.
-  int hashLen;
-  hashFunction_getHashSize(&hashLen, publicParameters.hashFunction);
+  pairingGroupElement_destroy(theta1);
+  pairingGroupElement_destroy(theta2Power);
 
-  // Let \f$theta1 = \mathrm{Pairing}(E, p ,q, u, P_{pub})\f$ by applying the
-  // modified Tate pairing.
-  Complex theta1;
-  status =
-      tate_performPairing(&theta1, signature.u, publicParameters.pointP, 2,
-                          publicParameters.q, publicParameters.ellipticCurve);
+  return CRYPTID_SUCCESS;
+}
+
+// If theta2 is given, neither the identity nor \f$-P_{pub}\f$ is used, and
+// \f$P\f$, which may be prepared as a pairing argument, computes the remaining
+// pairing. Otherwise \f$P\f$ is not used.
+static CryptidStatus
+hess_verify(const char *const message, const size_t messageLength,
+            const HessIdentityBasedSignatureSignatureAsBinary signatureAsBinary,
+            const char *const identity, const size_t identityLength,
+            const HessIdentityBasedSignaturePublicParameters *publicParameters,
+            const PairingGroupElement *negativePointPpublic,
+            const PairingGroupElement *pointP,
+            const PairingGroupElement *theta2, const PairingGroup *group) {
+  // Implementation of Scheme 1. Verify in [HESS-IBS].
+
+  HessIdentityBasedSignatureSignature signature;
+  CryptidStatus status =
+      hessIdentityBasedSignatureSignatureAsBinary_toHessIdentityBasedSignatureSignature(
+          &signature, signatureAsBinary, group);
   if (status) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-    hessIdentityBasedSignatureSignature_destroy(signature);
     return status;
   }
 
-  // \f$Q_{id} = \mathrm{HashToPoint}(E, p, q, id, \mathrm{hashfcn})\f$
-  // which results in a point of order \f$q\f$ in \f$E(F_p)\f$.
-  AffinePoint pointQId;
-  status = hashToPoint(&pointQId, identity, identityLength, publicParameters.q,
-                       publicParameters.ellipticCurve,
-                       publicParameters.hashFunction);
-  if (status) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
+  if (!hessIdentityBasedSignatureSignature_isValid(signature)) {
     hessIdentityBasedSignatureSignature_destroy(signature);
-    complex_destroy(theta1);
-    return status;
+    return CRYPTID_ILLEGAL_SIGNATURE_ERROR;
   }
 
-  // Let (@code negativePointPpublic) be \f$-P_{pub}\f$.
-  AffinePoint negativePointPpublic;
-  mpz_t yNegate, yNegateModP;
-  mpz_inits(yNegate, yNegateModP, NULL);
-  mpz_neg(yNegate, publicParameters.pointPpublic.y);
-  mpz_mod(yNegateModP, yNegate, publicParameters.ellipticCurve.fieldOrder);
-
-  affine_init(&negativePointPpublic, publicParameters.pointPpublic.x,
-              yNegateModP);
-
-  // Let \f$theta2 = \mathrm{Pairing}(E, p , q, Q_{id}, \f$-P_{pub}\f$)\f$ by
-  // applying the modified Tate pairing.
-  Complex theta2;
-  status =
-      tate_performPairing(&theta2, pointQId, negativePointPpublic, 2,
-                          publicParameters.q, publicParameters.ellipticCurve);
+  PairingGroupElement r;
+  if (theta2) {
+    status = hess_computeRFromTheta2(&r, &signature, pointP, theta2, group);
+  } else {
+    status = hess_computeR(&r, &signature, identity, identityLength,
+                           publicParameters, negativePointPpublic, group);
+  }
   if (status) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
     hessIdentityBasedSignatureSignature_destroy(signature);
-    complex_destroy(theta1);
-    affine_destroy(pointQId);
-    affine_destroy(negativePointPpublic);
-    mpz_clears(yNegate, yNegateModP, NULL);
     return status;
   }
 
-  // Let \f$\mathrm{theta2}^{\prime} = \mathrm{theta2}^v\f$, which is theta
-  // raised to the power of \f$v\f$ in \f$F_p^2\f$.
-  Complex theta2Prime;
-  complex_modPow(&theta2Prime, theta2, signature.v,
-                 publicParameters.ellipticCurve.fieldOrder);
-
-  // Let \f$ r = \mathrm{theta1} \cdot \mathrm{theta2}^{\prime} \f$
-  Complex r;
-  complex_modMul(&r, theta1, theta2Prime,
-                 publicParameters.ellipticCurve.fieldOrder);
+  // Let {@code hashlen} be the length of the output of the hash function
+  // {@code hashfcn} measured in octets.
+  int hashLen;
+  hashFunction_getHashSize(&hashLen, publicParameters->hashFunction);
 
   // Verify that the signature (@code v) equals with the now computed value.
   // The code is the same as in the sign method.
   int zLength;
   unsigned char *z;
-  canonical(&z, &zLength, r, publicParameters.ellipticCurve.fieldOrder, 1);
+  pairingGroup_toBinary(&z, &zLength, &r, group);
 
   unsigned char *w = (unsigned char *)calloc(hashLen, sizeof(unsigned char));
-  hashFunction_hash(w, z, zLength, publicParameters.hashFunction);
+  hashFunction_hash(w, z, zLength, publicParameters->hashFunction);
 
   unsigned char *t = (unsigned char *)calloc(hashLen, sizeof(unsigned char));
   hashFunction_hash(t, (unsigned char *)message, messageLength,
-                    publicParameters.hashFunction);
+                    publicParameters->hashFunction);
 
   unsigned char *concat =
       (unsigned char *)calloc(2 * hashLen + 1, sizeof(unsigned char));
@@ -531,35 +591,387 @@ CryptidStatus cryptid_ibs_hess_verify(
 
   mpz_t v;
   mpz_init(v);
-  hashToRange(v, concat, 2 * hashLen, publicParameters.q,
-              publicParameters.hashFunction);
+  hashToRange(v, concat, 2 * hashLen, publicParameters->q,
+              publicParameters->hashFunction);
 
   // If the values were the same, the verification returns succes.
-  if (mpz_cmp(signature.v, v) == 0) {
-    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
-    hessIdentityBasedSignatureSignature_destroy(signature);
-    complex_destroyMany(4, theta1, theta2, theta2Prime, r);
-    affine_destroy(pointQId);
-    affine_destroy(negativePointPpublic);
-    mpz_clears(yNegate, yNegateModP, v, NULL);
-    free(z);
-    free(w);
-    free(t);
-    free(concat);
-    return CRYPTID_SUCCESS;
-  }
+  status = mpz_cmp(signature.v, v) == 0 ? CRYPTID_SUCCESS
+                                        : CRYPTID_VERIFICATION_FAILED_ERROR;
 
-  // Otherwise, failure.
-  hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
   hessIdentityBasedSignatureSignature_destroy(signature);
-  complex_destroyMany(4, theta1, theta2, theta2Prime, r);
-  affine_destroy(pointQId);
-  affine_destroy(negativePointPpublic);
-  mpz_clears(yNegate, yNegateModP, v, NULL);
+  pairingGroupElement_destroy(r);
+  mpz_clear(v);
   free(z);
   free(w);
   free(t);
   free(concat);
 
-  return CRYPTID_VERIFICATION_FAILED_ERROR;
+  return status;
+}
+
+CryptidStatus cryptid_ibs_hess_extract(
+    PairingGroupElementAsBinary *result, const char *const identity,
+    const size_t identityLength,
+    const HessIdentityBasedSignatureMasterSecretAsBinary masterSecretAsBinary,
+    const HessIdentityBasedSignaturePublicParametersAsBinary
+        publicParametersAsBinary) {
+  /*if (!result)
+  {
+      return CRYPTID_RESULT_POINTER_NULL_ERROR;
+  }*/
+
+  if (identityLength == 0) {
+    return CRYPTID_IDENTITY_LENGTH_ERROR;
+  }
+
+  HessIdentityBasedSignaturePublicParameters publicParameters;
+  PairingGroup group;
+  CryptidStatus status = hess_loadPublicParameters(&publicParameters, &group,
+                                                   publicParametersAsBinary);
+  if (status) {
+    return status;
+  }
+
+  status = hess_extract(result, identity, identityLength, masterSecretAsBinary,
+                        &publicParameters, &group);
+
+  hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
+  pairingGroup_release(group);
+
+  return status;
+}
+
+CryptidStatus
+cryptid_ibs_hess_sign(HessIdentityBasedSignatureSignatureAsBinary *result,
+                      const char *const message, const size_t messageLength,
+                      const char *const identity, const size_t identityLength,
+                      const PairingGroupElementAsBinary privateKeyAsBinary,
+                      const HessIdentityBasedSignaturePublicParametersAsBinary
+                          publicParametersAsBinary) {
+  CryptidStatus status =
+      hess_checkSignArguments(message, messageLength, identity, identityLength);
+  if (status) {
+    return status;
+  }
+
+  HessIdentityBasedSignaturePublicParameters publicParameters;
+  PairingGroup group;
+  status = hess_loadPublicParameters(&publicParameters, &group,
+                                     publicParametersAsBinary);
+  if (status) {
+    return status;
+  }
+
+  PairingGroupElement privateKey;
+  status = hess_readPrivateKey(&privateKey, privateKeyAsBinary, &group);
+  if (status) {
+    hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
+    pairingGroup_release(group);
+    return status;
+  }
+
+  status = hess_sign(result, message, messageLength, identity, identityLength,
+                     &privateKey, &publicParameters, &publicParameters.pointP,
+                     NULL, &group);
+
+  pairingGroupElement_destroy(privateKey);
+  hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
+  pairingGroup_release(group);
+
+  return status;
+}
+
+CryptidStatus cryptid_ibs_hess_verify(
+    const char *const message, const size_t messageLength,
+    const HessIdentityBasedSignatureSignatureAsBinary signatureAsBinary,
+    const char *const identity, const size_t identityLength,
+    const HessIdentityBasedSignaturePublicParametersAsBinary
+        publicParametersAsBinary) {
+  if (!message) {
+    return CRYPTID_MESSAGE_NULL_ERROR;
+  }
+
+  if (messageLength == 0) {
+    return CRYPTID_MESSAGE_LENGTH_ERROR;
+  }
+
+  HessIdentityBasedSignaturePublicParameters publicParameters;
+  PairingGroup group;
+  CryptidStatus status = hess_loadPublicParameters(&publicParameters, &group,
+                                                   publicParametersAsBinary);
+  if (status) {
+    return status;
+  }
+
+  // Let (@code negativePointPpublic) be \f$-P_{pub}\f$.
+  PairingGroupElement negativePointPpublic;
+  pairingGroup_negate(&negativePointPpublic, &publicParameters.pointPpublic,
+                      &group);
+
+  status = hess_verify(message, messageLength, signatureAsBinary, identity,
+                       identityLength, &publicParameters,
+                       &negativePointPpublic, NULL, NULL, &group);
+
+  pairingGroupElement_destroy(negativePointPpublic);
+  hessIdentityBasedSignaturePublicParameters_destroy(publicParameters);
+  pairingGroup_release(group);
+
+  return status;
+}
+
+CryptidStatus cryptid_ibs_hess_prepare(
+    HessIdentityBasedSignaturePreparedPublicParameters *result,
+    const HessIdentityBasedSignaturePublicParametersAsBinary
+        publicParametersAsBinary) {
+  CryptidStatus status = hess_loadPublicParameters(
+      &result->publicParameters, &result->group, publicParametersAsBinary);
+  if (status) {
+    return status;
+  }
+
+  const PairingGroup *group = &result->group;
+
+  // The point was read once already, so it is a valid element of \f$G_2\f$.
+  pairingGroupElementAsBinary_toPairingGroupElement(
+      &result->preparedPointP, pairingGroup_G2, publicParametersAsBinary.pointP,
+      group);
+
+  status = pairingGroup_preparePairingArgument(&result->preparedPointP, group);
+  if (status) {
+    pairingGroupElement_destroy(result->preparedPointP);
+    hessIdentityBasedSignaturePublicParameters_destroy(
+        result->publicParameters);
+    pairingGroup_release(result->group);
+    return status;
+  }
+
+  pairingGroup_negate(&result->negativePointPpublic,
+                      &result->publicParameters.pointPpublic, group);
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus cryptid_ibs_hess_preparePrivateKey(
+    HessIdentityBasedSignaturePreparedPrivateKey *result,
+    const PairingGroupElementAsBinary privateKeyAsBinary,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters) {
+  return hess_readPrivateKey(&result->privateKey, privateKeyAsBinary,
+                             &preparedPublicParameters->group);
+}
+
+CryptidStatus cryptid_ibs_hess_prepareSigner(
+    HessIdentityBasedSignaturePreparedSigner *result,
+    const char *const identity, const size_t identityLength,
+    const PairingGroupElementAsBinary privateKeyAsBinary,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters) {
+  if (!identity) {
+    return CRYPTID_IDENTITY_NULL_ERROR;
+  }
+
+  if (identityLength == 0) {
+    return CRYPTID_IDENTITY_LENGTH_ERROR;
+  }
+
+  const PairingGroup *group = &preparedPublicParameters->group;
+
+  CryptidStatus status =
+      hess_readPrivateKey(&result->privateKey, privateKeyAsBinary, group);
+  if (status) {
+    return status;
+  }
+
+  status = pairingGroup_hashToG1(
+      &result->pointQId, identity, identityLength,
+      preparedPublicParameters->publicParameters.hashFunction, group);
+  if (status) {
+    pairingGroupElement_destroy(result->privateKey);
+    return status;
+  }
+
+  // Let \f$\mathrm{theta} = \mathrm{Pairing}(E, p, q, Q_{id}, P)\f$.
+  status = pairingGroup_pair(&result->theta, &result->pointQId,
+                             &preparedPublicParameters->preparedPointP, group);
+  if (status) {
+    pairingGroupElement_destroy(result->privateKey);
+    pairingGroupElement_destroy(result->pointQId);
+    return status;
+  }
+
+  // theta is a pairing value of elements of order q, so its order is q.
+  status = pairingGroup_prepareFixedBase(&result->theta, group);
+  if (status) {
+    pairingGroupElement_destroy(result->privateKey);
+    pairingGroupElement_destroy(result->pointQId);
+    pairingGroupElement_destroy(result->theta);
+    return status;
+  }
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus cryptid_ibs_hess_prepareSignerTables(
+    HessIdentityBasedSignaturePreparedSigner *preparedSigner,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters) {
+  const PairingGroup *group = &preparedPublicParameters->group;
+
+  if (!preparedSigner->pointQId.affineFixedBaseTable) {
+    // Q_id is an element of order q.
+    CryptidStatus status =
+        pairingGroup_prepareFixedBase(&preparedSigner->pointQId, group);
+    if (status) {
+      return status;
+    }
+  }
+
+  if (!preparedSigner->privateKey.affineFixedBaseTable) {
+    // S_id = [s]Q_id is an element of order q as well.
+    CryptidStatus status =
+        pairingGroup_prepareFixedBase(&preparedSigner->privateKey, group);
+    if (status) {
+      return status;
+    }
+  }
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus cryptid_ibs_hess_prepareIdentity(
+    HessIdentityBasedSignaturePreparedIdentity *result,
+    const char *const identity, const size_t identityLength,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters) {
+  if (!identity) {
+    return CRYPTID_IDENTITY_NULL_ERROR;
+  }
+
+  if (identityLength == 0) {
+    return CRYPTID_IDENTITY_LENGTH_ERROR;
+  }
+
+  const PairingGroup *group = &preparedPublicParameters->group;
+
+  PairingGroupElement pointQId;
+  CryptidStatus status = pairingGroup_hashToG1(
+      &pointQId, identity, identityLength,
+      preparedPublicParameters->publicParameters.hashFunction, group);
+  if (status) {
+    return status;
+  }
+
+  // Let \f$\mathrm{theta2} = \mathrm{Pairing}(E, p , q, Q_{id}, -P_{pub})\f$.
+  status = pairingGroup_pair(&result->theta2, &pointQId,
+                             &preparedPublicParameters->negativePointPpublic,
+                             group);
+  pairingGroupElement_destroy(pointQId);
+  if (status) {
+    return status;
+  }
+
+  // theta2 is a pairing value of elements of order q, so its order is q.
+  status = pairingGroup_prepareFixedBase(&result->theta2, group);
+  if (status) {
+    pairingGroupElement_destroy(result->theta2);
+  }
+
+  return status;
+}
+
+CryptidStatus cryptid_ibs_hess_extractPrepared(
+    PairingGroupElementAsBinary *result, const char *const identity,
+    const size_t identityLength,
+    const HessIdentityBasedSignatureMasterSecretAsBinary masterSecretAsBinary,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters) {
+  if (identityLength == 0) {
+    return CRYPTID_IDENTITY_LENGTH_ERROR;
+  }
+
+  return hess_extract(result, identity, identityLength, masterSecretAsBinary,
+                      &preparedPublicParameters->publicParameters,
+                      &preparedPublicParameters->group);
+}
+
+CryptidStatus cryptid_ibs_hess_signPrepared(
+    HessIdentityBasedSignatureSignatureAsBinary *result,
+    const char *const message, const size_t messageLength,
+    const char *const identity, const size_t identityLength,
+    const HessIdentityBasedSignaturePreparedPrivateKey *preparedPrivateKey,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters) {
+  CryptidStatus status =
+      hess_checkSignArguments(message, messageLength, identity, identityLength);
+  if (status) {
+    return status;
+  }
+
+  return hess_sign(result, message, messageLength, identity, identityLength,
+                   &preparedPrivateKey->privateKey,
+                   &preparedPublicParameters->publicParameters,
+                   &preparedPublicParameters->preparedPointP, NULL,
+                   &preparedPublicParameters->group);
+}
+
+CryptidStatus cryptid_ibs_hess_signWithPreparedSigner(
+    HessIdentityBasedSignatureSignatureAsBinary *result,
+    const char *const message, const size_t messageLength,
+    const HessIdentityBasedSignaturePreparedSigner *preparedSigner,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters) {
+  if (!message) {
+    return CRYPTID_MESSAGE_NULL_ERROR;
+  }
+
+  if (messageLength == 0) {
+    return CRYPTID_MESSAGE_LENGTH_ERROR;
+  }
+
+  return hess_sign(result, message, messageLength, NULL, 0,
+                   &preparedSigner->privateKey,
+                   &preparedPublicParameters->publicParameters, NULL,
+                   preparedSigner, &preparedPublicParameters->group);
+}
+
+CryptidStatus cryptid_ibs_hess_verifyPrepared(
+    const char *const message, const size_t messageLength,
+    const HessIdentityBasedSignatureSignatureAsBinary signatureAsBinary,
+    const char *const identity, const size_t identityLength,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters) {
+  if (!message) {
+    return CRYPTID_MESSAGE_NULL_ERROR;
+  }
+
+  if (messageLength == 0) {
+    return CRYPTID_MESSAGE_LENGTH_ERROR;
+  }
+
+  return hess_verify(message, messageLength, signatureAsBinary, identity,
+                     identityLength,
+                     &preparedPublicParameters->publicParameters,
+                     &preparedPublicParameters->negativePointPpublic, NULL,
+                     NULL, &preparedPublicParameters->group);
+}
+
+CryptidStatus cryptid_ibs_hess_verifyWithPreparedIdentity(
+    const char *const message, const size_t messageLength,
+    const HessIdentityBasedSignatureSignatureAsBinary signatureAsBinary,
+    const HessIdentityBasedSignaturePreparedIdentity *preparedIdentity,
+    const HessIdentityBasedSignaturePreparedPublicParameters
+        *preparedPublicParameters) {
+  if (!message) {
+    return CRYPTID_MESSAGE_NULL_ERROR;
+  }
+
+  if (messageLength == 0) {
+    return CRYPTID_MESSAGE_LENGTH_ERROR;
+  }
+
+  return hess_verify(message, messageLength, signatureAsBinary, NULL, 0,
+                     &preparedPublicParameters->publicParameters, NULL,
+                     &preparedPublicParameters->preparedPointP,
+                     &preparedIdentity->theta2,
+                     &preparedPublicParameters->group);
 }
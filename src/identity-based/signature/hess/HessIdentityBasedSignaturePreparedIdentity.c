@@ -0,0 +1,6 @@
+#include "identity-based/signature/hess/HessIdentityBasedSignaturePreparedIdentity.h"
+
+void hessIdentityBasedSignaturePreparedIdentity_destroy(
+    HessIdentityBasedSignaturePreparedIdentity preparedIdentity) {
+  pairingGroupElement_destroy(preparedIdentity.theta2);
+}
@@ -0,0 +1,6 @@
+#include "identity-based/signature/hess/HessIdentityBasedSignaturePreparedPrivateKey.h"
+
+void hessIdentityBasedSignaturePreparedPrivateKey_destroy(
+    HessIdentityBasedSignaturePreparedPrivateKey preparedPrivateKey) {
+  pairingGroupElement_destroy(preparedPrivateKey.privateKey);
+}
@@ -0,0 +1,11 @@
+#include "identity-based/signature/hess/HessIdentityBasedSignaturePreparedPublicParameters.h"
+
+void hessIdentityBasedSignaturePreparedPublicParameters_destroy(
+    HessIdentityBasedSignaturePreparedPublicParameters
+        preparedPublicParameters) {
+  hessIdentityBasedSignaturePublicParameters_destroy(
+      preparedPublicParameters.publicParameters);
+  pairingGroupElement_destroy(preparedPublicParameters.preparedPointP);
+  pairingGroupElement_destroy(preparedPublicParameters.negativePointPpublic);
+  pairingGroup_release(preparedPublicParameters.group);
+}
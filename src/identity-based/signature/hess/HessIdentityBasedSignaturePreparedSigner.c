@@ -0,0 +1,8 @@
+#include "identity-based/signature/hess/HessIdentityBasedSignaturePreparedSigner.h"
+
+void hessIdentityBasedSignaturePreparedSigner_destroy(
+    HessIdentityBasedSignaturePreparedSigner preparedSigner) {
+  pairingGroupElement_destroy(preparedSigner.pointQId);
+  pairingGroupElement_destroy(preparedSigner.privateKey);
+  pairingGroupElement_destroy(preparedSigner.theta);
+}
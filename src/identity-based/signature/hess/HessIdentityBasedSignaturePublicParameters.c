@@ -1,16 +1,16 @@
 #include "identity-based/signature/hess/HessIdentityBasedSignaturePublicParameters.h"
-#include "util/PrimalityTest.h"
 
 void hessIdentityBasedSignaturePublicParameters_init(
     HessIdentityBasedSignaturePublicParameters *publicParametersOutput,
-    const EllipticCurve ellipticCurve, const mpz_t q, const AffinePoint pointP,
-    const AffinePoint pointPpublic, const HashFunction hashFunction) {
+    const PairingGroupType pairingGroupType, const EllipticCurve ellipticCurve,
+    const mpz_t q, const PairingGroupElement pointP,
+    const PairingGroupElement pointPpublic, const HashFunction hashFunction) {
+  publicParametersOutput->pairingGroupType = pairingGroupType;
   ellipticCurve_init(&publicParametersOutput->ellipticCurve, ellipticCurve.a,
                      ellipticCurve.b, ellipticCurve.fieldOrder);
   mpz_init_set(publicParametersOutput->q, q);
-  affine_init(&publicParametersOutput->pointP, pointP.x, pointP.y);
-  affine_init(&publicParametersOutput->pointPpublic, pointPpublic.x,
-              pointPpublic.y);
+  publicParametersOutput->pointP = pointP;
+  publicParametersOutput->pointPpublic = pointPpublic;
   publicParametersOutput->hashFunction = hashFunction;
 }
 
@@ -18,18 +18,19 @@ void hessIdentityBasedSignaturePublicParameters_destroy(
     HessIdentityBasedSignaturePublicParameters publicParameters) {
   ellipticCurve_destroy(publicParameters.ellipticCurve);
   mpz_clear(publicParameters.q);
-  affine_destroy(publicParameters.pointP);
-  affine_destroy(publicParameters.pointPpublic);
+  pairingGroupElement_destroy(publicParameters.pointP);
+  pairingGroupElement_destroy(publicParameters.pointPpublic);
 }
 
 CryptidValidationResult hessIdentityBasedSignaturePublicParameters_isValid(
-    const HessIdentityBasedSignaturePublicParameters publicParameters) {
-  if (ellipticCurve_isTypeOne(publicParameters.ellipticCurve) &&
-      primalityTest_isProbablePrime(publicParameters.q) &&
-      affine_isValid(publicParameters.pointP, publicParameters.ellipticCurve) &&
-      affine_isValid(publicParameters.pointPpublic,
-                     publicParameters.ellipticCurve) &&
-      hashFunction_isValid(publicParameters.hashFunction)) {
+    const HessIdentityBasedSignaturePublicParameters publicParameters,
+    const PairingGroup *group) {
+  if (hashFunction_isValid(publicParameters.hashFunction) &&
+      publicParameters.pairingGroupType == group->type &&
+      publicParameters.pointP.type == group->type &&
+      publicParameters.pointP.subgroup == pairingGroup_G2 &&
+      publicParameters.pointPpublic.type == group->type &&
+      publicParameters.pointPpublic.subgroup == pairingGroup_G2) {
     return CRYPTID_VALIDATION_SUCCESS;
   }
 
@@ -6,9 +6,13 @@
 void hessIdentityBasedSignaturePublicParametersAsBinary_init(
     HessIdentityBasedSignaturePublicParametersAsBinary
         *publicParametersAsBinaryOutput,
+    const PairingGroupType pairingGroupType,
     const EllipticCurveAsBinary ellipticCurve, const void *const q,
-    const size_t qLength, const AffinePointAsBinary pointP,
-    const AffinePointAsBinary pointPpublic, const HashFunction hashFunction) {
+    const size_t qLength, const PairingGroupElementAsBinary pointP,
+    const PairingGroupElementAsBinary pointPpublic,
+    const HashFunction hashFunction) {
+  publicParametersAsBinaryOutput->pairingGroupType = pairingGroupType;
+
   ellipticCurveAsBinary_init(
       &publicParametersAsBinaryOutput->ellipticCurve, ellipticCurve.a,
       ellipticCurve.aLength, ellipticCurve.b, ellipticCurve.bLength,
@@ -19,12 +23,12 @@ void hessIdentityBasedSignaturePublicParametersAsBinary_init(
 
   publicParametersAsBinaryOutput->qLength = qLength;
 
-  affineAsBinary_init(&publicParametersAsBinaryOutput->pointP, pointP.x,
-                      pointP.xLength, pointP.y, pointP.yLength);
+  pairingGroupElementAsBinary_init(&publicParametersAsBinaryOutput->pointP,
+                                   pointP.element, pointP.elementLength);
 
-  affineAsBinary_init(&publicParametersAsBinaryOutput->pointPpublic,
-                      pointPpublic.x, pointPpublic.xLength, pointPpublic.y,
-                      pointPpublic.yLength);
+  pairingGroupElementAsBinary_init(
+      &publicParametersAsBinaryOutput->pointPpublic, pointPpublic.element,
+      pointPpublic.elementLength);
 
   publicParametersAsBinaryOutput->hashFunction = hashFunction;
 }
@@ -34,14 +38,33 @@ void hessIdentityBasedSignaturePublicParametersAsBinary_destroy(
         publicParametersAsBinary) {
   ellipticCurveAsBinary_destroy(publicParametersAsBinary.ellipticCurve);
   free(publicParametersAsBinary.q);
-  affineAsBinary_destroy(publicParametersAsBinary.pointP);
-  affineAsBinary_destroy(publicParametersAsBinary.pointPpublic);
+  pairingGroupElementAsBinary_destroy(publicParametersAsBinary.pointP);
+  pairingGroupElementAsBinary_destroy(publicParametersAsBinary.pointPpublic);
 }
 
-void hessIdentityBasedSignaturePublicParametersAsBinary_toHessIdentityBasedSignaturePublicParameters(
+CryptidStatus hessIdentityBasedSignaturePublicParametersAsBinary_toHessIdentityBasedSignaturePublicParameters(
     HessIdentityBasedSignaturePublicParameters *publicParametersOutput,
     const HessIdentityBasedSignaturePublicParametersAsBinary
-        publicParametersAsBinary) {
+        publicParametersAsBinary,
+    const PairingGroup *group) {
+  CryptidStatus status = pairingGroupElementAsBinary_toPairingGroupElement(
+      &publicParametersOutput->pointP, pairingGroup_G2,
+      publicParametersAsBinary.pointP, group);
+  if (status) {
+    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+  }
+
+  status = pairingGroupElementAsBinary_toPairingGroupElement(
+      &publicParametersOutput->pointPpublic, pairingGroup_G2,
+      publicParametersAsBinary.pointPpublic, group);
+  if (status) {
+    pairingGroupElement_destroy(publicParametersOutput->pointP);
+    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+  }
+
+  publicParametersOutput->pairingGroupType =
+      publicParametersAsBinary.pairingGroupType;
+
   ellipticCurveAsBinary_toEllipticCurve(&publicParametersOutput->ellipticCurve,
                                         publicParametersAsBinary.ellipticCurve);
 
@@ -49,19 +72,19 @@ void hessIdentityBasedSignaturePublicParametersAsBinary_toHessIdentityBasedSigna
   mpz_import(publicParametersOutput->q, publicParametersAsBinary.qLength, 1, 1,
              0, 0, publicParametersAsBinary.q);
 
-  affineAsBinary_toAffine(&publicParametersOutput->pointP,
-                          publicParametersAsBinary.pointP);
-
-  affineAsBinary_toAffine(&publicParametersOutput->pointPpublic,
-                          publicParametersAsBinary.pointPpublic);
-
   publicParametersOutput->hashFunction = publicParametersAsBinary.hashFunction;
+
+  return CRYPTID_SUCCESS;
 }
 
 void hessIdentityBasedSignaturePublicParametersAsBinary_fromHessIdentityBasedSignaturePublicParameters(
     HessIdentityBasedSignaturePublicParametersAsBinary
         *publicParametersAsBinaryOutput,
-    const HessIdentityBasedSignaturePublicParameters publicParameters) {
+    const HessIdentityBasedSignaturePublicParameters publicParameters,
+    const PairingGroup *group) {
+  publicParametersAsBinaryOutput->pairingGroupType =
+      publicParameters.pairingGroupType;
+
   ellipticCurveAsBinary_fromEllipticCurve(
       &publicParametersAsBinaryOutput->ellipticCurve,
       publicParameters.ellipticCurve);
@@ -70,11 +93,12 @@ void hessIdentityBasedSignaturePublicParametersAsBinary_fromHessIdentityBasedSig
       mpz_export(NULL, &publicParametersAsBinaryOutput->qLength, 1, 1, 0, 0,
                  publicParameters.q);
 
-  affineAsBinary_fromAffine(&publicParametersAsBinaryOutput->pointP,
-                            publicParameters.pointP);
+  pairingGroupElementAsBinary_fromPairingGroupElement(
+      &publicParametersAsBinaryOutput->pointP, &publicParameters.pointP, group);
 
-  affineAsBinary_fromAffine(&publicParametersAsBinaryOutput->pointPpublic,
-                            publicParameters.pointPpublic);
+  pairingGroupElementAsBinary_fromPairingGroupElement(
+      &publicParametersAsBinaryOutput->pointPpublic,
+      &publicParameters.pointPpublic, group);
 
   publicParametersAsBinaryOutput->hashFunction = publicParameters.hashFunction;
 }
@@ -1,23 +1,22 @@
 #include "identity-based/signature/hess/HessIdentityBasedSignatureSignature.h"
 
 void hessIdentityBasedSignatureSignature_init(
-    HessIdentityBasedSignatureSignature *signatureOutput, const AffinePoint u,
-    const mpz_t v) {
-  affine_init(&signatureOutput->u, u.x, u.y);
+    HessIdentityBasedSignatureSignature *signatureOutput,
+    const PairingGroupElement u, const mpz_t v) {
+  signatureOutput->u = u;
 
   mpz_init_set(signatureOutput->v, v);
 }
 
 void hessIdentityBasedSignatureSignature_destroy(
     HessIdentityBasedSignatureSignature signature) {
-  affine_destroy(signature.u);
+  pairingGroupElement_destroy(signature.u);
   mpz_clear(signature.v);
 }
 
 CryptidValidationResult hessIdentityBasedSignatureSignature_isValid(
-    const HessIdentityBasedSignatureSignature signature,
-    const EllipticCurve ellipticCurve) {
-  if (affine_isValid(signature.u, ellipticCurve) && signature.v != NULL) {
+    const HessIdentityBasedSignatureSignature signature) {
+  if (signature.v != NULL) {
     return CRYPTID_VALIDATION_SUCCESS;
   }
 
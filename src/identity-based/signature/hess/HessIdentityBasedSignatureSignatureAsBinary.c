@@ -5,9 +5,10 @@
 
 void hessIdentityBasedSignatureSignatureAsBinary_init(
     HessIdentityBasedSignatureSignatureAsBinary *signatureAsBinaryOutput,
-    const AffinePointAsBinary u, const void *const v, const size_t vLength) {
-  affineAsBinary_init(&signatureAsBinaryOutput->u, u.x, u.xLength, u.y,
-                      u.yLength);
+    const PairingGroupElementAsBinary u, const void *const v,
+    const size_t vLength) {
+  pairingGroupElementAsBinary_init(&signatureAsBinaryOutput->u, u.element,
+                                   u.elementLength);
 
   signatureAsBinaryOutput->v = malloc(vLength + 1);
   memcpy(signatureAsBinaryOutput->v, v, vLength + 1);
@@ -17,24 +18,32 @@ void hessIdentityBasedSignatureSignatureAsBinary_init(
 
 void hessIdentityBasedSignatureSignatureAsBinary_destroy(
     HessIdentityBasedSignatureSignatureAsBinary signatureAsBinary) {
-  affineAsBinary_destroy(signatureAsBinary.u);
+  pairingGroupElementAsBinary_destroy(signatureAsBinary.u);
   free(signatureAsBinary.v);
 }
 
-void hessIdentityBasedSignatureSignatureAsBinary_toHessIdentityBasedSignatureSignature(
+CryptidStatus hessIdentityBasedSignatureSignatureAsBinary_toHessIdentityBasedSignatureSignature(
     HessIdentityBasedSignatureSignature *signatureOutput,
-    const HessIdentityBasedSignatureSignatureAsBinary signatureAsBinary) {
-  affineAsBinary_toAffine(&signatureOutput->u, signatureAsBinary.u);
+    const HessIdentityBasedSignatureSignatureAsBinary signatureAsBinary,
+    const PairingGroup *group) {
+  if (pairingGroupElementAsBinary_toPairingGroupElement(
+          &signatureOutput->u, pairingGroup_G1, signatureAsBinary.u, group)) {
+    return CRYPTID_ILLEGAL_SIGNATURE_ERROR;
+  }
 
   mpz_init(signatureOutput->v);
   mpz_import(signatureOutput->v, signatureAsBinary.vLength, 1, 1, 0, 0,
              signatureAsBinary.v);
+
+  return CRYPTID_SUCCESS;
 }
 
 void hessIdentityBasedSignatureSignatureAsBinary_fromHessIdentityBasedSignatureSignature(
     HessIdentityBasedSignatureSignatureAsBinary *signatureAsBinaryOutput,
-    const HessIdentityBasedSignatureSignature signature) {
-  affineAsBinary_fromAffine(&signatureAsBinaryOutput->u, signature.u);
+    const HessIdentityBasedSignatureSignature signature,
+    const PairingGroup *group) {
+  pairingGroupElementAsBinary_fromPairingGroupElement(
+      &signatureAsBinaryOutput->u, &signature.u, group);
 
   signatureAsBinaryOutput->v = mpz_export(
       NULL, &signatureAsBinaryOutput->vLength, 1, 1, 0, 0, signature.v);
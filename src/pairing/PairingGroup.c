@@ -0,0 +1,931 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "bls12-381/Bls12381.h"
+#include "bls12-381/Bls12381ContextCache.h"
+#include "complex/GtElement.h"
+#include "elliptic/EllipticCurveContextCache.h"
+#include "elliptic/TatePairing.h"
+#include "pairing/PairingGroup.h"
+#include "util/PrimalityTest.h"
+#include "util/Random.h"
+#include "util/Utils.h"
+#include "util/ValidationMemo.h"
+
+static const unsigned int POINT_GENERATION_ATTEMPT_LIMIT = 100;
+
+void pairingGroup_initType1(PairingGroup *groupOutput,
+                            const EllipticCurveContext *curveContext) {
+  groupOutput->type = pairingGroup_TYPE_1;
+  groupOutput->curveContext = curveContext;
+  groupOutput->bls12381Context = NULL;
+}
+
+void pairingGroup_initBls12381(PairingGroup *groupOutput,
+                               const Bls12381Context *bls12381Context) {
+  groupOutput->type = pairingGroup_BLS12_381;
+  groupOutput->curveContext = NULL;
+  groupOutput->bls12381Context = bls12381Context;
+}
+
+CryptidStatus pairingGroup_acquireType1(PairingGroup *groupOutput,
+                                        const EllipticCurve ellipticCurve,
+                                        const mpz_t subgroupOrder) {
+  const EllipticCurveContext *curveContext;
+  CryptidStatus status = ellipticCurveContextCache_acquire(
+      &curveContext, ellipticCurve, subgroupOrder);
+  if (status) {
+    return status;
+  }
+
+  pairingGroup_initType1(groupOutput, curveContext);
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus pairingGroup_acquireBls12381(PairingGroup *groupOutput) {
+  const Bls12381Context *bls12381Context;
+  CryptidStatus status = bls12381ContextCache_acquire(&bls12381Context);
+  if (status) {
+    return status;
+  }
+
+  pairingGroup_initBls12381(groupOutput, bls12381Context);
+
+  return CRYPTID_SUCCESS;
+}
+
+// Checks a description of a pairingGroup_TYPE_1 group before its context is
+// derived, which takes it to be valid.
+static CryptidValidationResult
+pairingGroup_isValidType1(const EllipticCurve ellipticCurve,
+                          const mpz_t subgroupOrder) {
+  const mpz_srcptr values[] = {ellipticCurve.a, ellipticCurve.b,
+                               ellipticCurve.fieldOrder, subgroupOrder};
+  ValidationMemoKey key;
+  validationMemo_computeKey(&key, "PairingGroupType1", values, 4);
+  if (validationMemo_isKnownValid(&key)) {
+    return CRYPTID_VALIDATION_SUCCESS;
+  }
+
+  if (!ellipticCurve_isTypeOne(ellipticCurve) ||
+      !primalityTest_isProbablePrime(subgroupOrder)) {
+    return CRYPTID_VALIDATION_FAILURE;
+  }
+
+  mpz_t cofactor;
+  mpz_init(cofactor);
+  mpz_add_ui(cofactor, ellipticCurve.fieldOrder, 1);
+  const int isDivisor = mpz_divisible_p(cofactor, subgroupOrder);
+  mpz_clear(cofactor);
+  if (!isDivisor) {
+    return CRYPTID_VALIDATION_FAILURE;
+  }
+
+  validationMemo_rememberValid(&key);
+  return CRYPTID_VALIDATION_SUCCESS;
+}
+
+CryptidStatus pairingGroup_acquire(PairingGroup *groupOutput,
+                                   const PairingGroupType type,
+                                   const EllipticCurve ellipticCurve,
+                                   const mpz_t subgroupOrder) {
+  if (type == pairingGroup_TYPE_1) {
+    if (!pairingGroup_isValidType1(ellipticCurve, subgroupOrder)) {
+      return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+    }
+
+    return pairingGroup_acquireType1(groupOutput, ellipticCurve,
+                                     subgroupOrder);
+  }
+
+  if (type != pairingGroup_BLS12_381) {
+    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+  }
+
+  CryptidStatus status = pairingGroup_acquireBls12381(groupOutput);
+  if (status) {
+    return status;
+  }
+
+  EllipticCurve expectedCurve;
+  mpz_t expectedOrder;
+  mpz_init(expectedOrder);
+  pairingGroup_describe(&expectedCurve, expectedOrder, groupOutput);
+
+  const int isMatching =
+      !mpz_cmp(ellipticCurve.a, expectedCurve.a) &&
+      !mpz_cmp(ellipticCurve.b, expectedCurve.b) &&
+      !mpz_cmp(ellipticCurve.fieldOrder, expectedCurve.fieldOrder) &&
+      !mpz_cmp(subgroupOrder, expectedOrder);
+
+  ellipticCurve_destroy(expectedCurve);
+  mpz_clear(expectedOrder);
+
+  if (!isMatching) {
+    pairingGroup_release(*groupOutput);
+    return CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR;
+  }
+
+  return CRYPTID_SUCCESS;
+}
+
+void pairingGroup_release(const PairingGroup group) {
+  if (group.type == pairingGroup_BLS12_381) {
+    bls12381ContextCache_release(group.bls12381Context);
+  } else {
+    ellipticCurveContextCache_release(group.curveContext);
+  }
+}
+
+void pairingGroup_describe(EllipticCurve *ellipticCurveOutput,
+                           mpz_t subgroupOrder, const PairingGroup *group) {
+  if (group->type == pairingGroup_BLS12_381) {
+    const Bls12381Context *context = group->bls12381Context;
+    mpz_t a, b;
+    mpz_init_set_ui(a, 0);
+    mpz_init_set_ui(b, 4);
+    ellipticCurve_init(ellipticCurveOutput, a, b, context->fieldOrder);
+    mpz_set(subgroupOrder, context->groupOrder);
+    mpz_clears(a, b, NULL);
+    return;
+  }
+
+  const EllipticCurve *ellipticCurve = &group->curveContext->ellipticCurve;
+  ellipticCurve_init(ellipticCurveOutput, ellipticCurve->a, ellipticCurve->b,
+                     ellipticCurve->fieldOrder);
+  mpz_set(subgroupOrder, group->curveContext->subgroupOrder);
+}
+
+// The number of octets of a coordinate of pairingGroup_TYPE_1.
+static size_t pairingGroup_type1CoordinateLength(const PairingGroup *group) {
+  const EllipticCurve *ellipticCurve = &group->curveContext->ellipticCurve;
+
+  return (mpz_sizeinbase(ellipticCurve->fieldOrder, 2) + 7) / 8;
+}
+
+static void
+pairingGroup_initBls12381Element(PairingGroupElement *result,
+                                 const PairingGroupSubgroup subgroup,
+                                 const PairingGroup *group) {
+  pairingGroupElement_initBls12381(result, subgroup,
+                                   &group->bls12381Context->montgomeryContext);
+}
+
+// A random point of order \f$q\f$, obtained as
+// \f$[\frac{p + 1}{q}]P^{\prime}\f$ for a random point \f$P^{\prime}\f$ of the
+// curve.
+static CryptidStatus pairingGroup_type1Random(AffinePoint *result,
+                                              const PairingGroup *group) {
+  const EllipticCurveContext *curveContext = group->curveContext;
+
+  mpz_t cofactor;
+  mpz_init(cofactor);
+  mpz_add_ui(cofactor, curveContext->ellipticCurve.fieldOrder, 1);
+  mpz_divexact(cofactor, cofactor, curveContext->subgroupOrder);
+
+  CryptidStatus status;
+  do {
+    AffinePoint pointPrime;
+    status = random_affinePoint(&pointPrime, curveContext->ellipticCurve,
+                                POINT_GENERATION_ATTEMPT_LIMIT);
+    if (status) {
+      break;
+    }
+
+    status = affine_wNAFMultiply(result, pointPrime, cofactor, curveContext);
+    affine_destroy(pointPrime);
+    if (status) {
+      break;
+    }
+
+    if (!affine_isInfinity(*result)) {
+      break;
+    }
+    affine_destroy(*result);
+  } while (1);
+
+  mpz_clear(cofactor);
+
+  return status;
+}
+
+CryptidStatus pairingGroup_random(PairingGroupElement *result,
+                                  const PairingGroupSubgroup subgroup,
+                                  const PairingGroup *group) {
+  if (subgroup == pairingGroup_GT) {
+    return CRYPTID_ILLEGAL_SUBGROUP_ERROR;
+  }
+
+  CryptidStatus status;
+
+  if (group->type == pairingGroup_BLS12_381) {
+    const Bls12381Context *context = group->bls12381Context;
+
+    // \f$[k]G\f$ for the generator \f$G\f$ and a random \f$k\f$ in
+    // \f$[1, r - 1]\f$.
+    mpz_t scalar, range;
+    mpz_inits(scalar, range, NULL);
+    mpz_sub_ui(range, context->groupOrder, 2);
+    random_mpzInRange(scalar, range);
+    mpz_add_ui(scalar, scalar, 1);
+
+    pairingGroup_initBls12381Element(result, subgroup, group);
+    if (subgroup == pairingGroup_G1) {
+      status = bls12381_g1Multiply(&result->fieldAffinePoint,
+                                   &context->g1Generator, scalar, context);
+    } else {
+      status = twistAffine_multiply(&result->twistAffinePoint,
+                                    &context->g2Generator, scalar,
+                                    &context->montgomeryContext);
+    }
+    mpz_clears(scalar, range, NULL);
+    if (status) {
+      pairingGroupElement_destroy(*result);
+    }
+    return status;
+  }
+
+  AffinePoint point;
+  status = pairingGroup_type1Random(&point, group);
+  if (status) {
+    return status;
+  }
+
+  pairingGroupElement_fromAffinePoint(result, point, subgroup);
+  affine_destroy(point);
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus pairingGroup_hashToG1(PairingGroupElement *result,
+                                    const char *const message,
+                                    const size_t messageLength,
+                                    const HashFunction hashFunction,
+                                    const PairingGroup *group) {
+  CryptidStatus status;
+
+  if (group->type == pairingGroup_BLS12_381) {
+    pairingGroup_initBls12381Element(result, pairingGroup_G1, group);
+    status = bls12381_hashToG1(
+        &result->fieldAffinePoint, (const unsigned char *)message,
+        messageLength, hashFunction, group->bls12381Context);
+    if (status) {
+      pairingGroupElement_destroy(*result);
+    }
+    return status;
+  }
+
+  AffinePoint point;
+  status = hashToPoint(&point, message, (int)messageLength, group->curveContext,
+                       hashFunction);
+  if (status) {
+    return status;
+  }
+
+  pairingGroupElement_fromAffinePoint(result, point, pairingGroup_G1);
+  affine_destroy(point);
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus pairingGroup_multiply(PairingGroupElement *result,
+                                    const PairingGroupElement *element,
+                                    const mpz_t scalar,
+                                    const PairingGroup *group) {
+  if (element->subgroup == pairingGroup_GT) {
+    return CRYPTID_ILLEGAL_SUBGROUP_ERROR;
+  }
+
+  CryptidStatus status;
+
+  if (group->type == pairingGroup_BLS12_381) {
+    pairingGroup_initBls12381Element(result, element->subgroup, group);
+    if (element->subgroup == pairingGroup_G1) {
+      status = bls12381_g1Multiply(&result->fieldAffinePoint,
+                                   &element->fieldAffinePoint, scalar,
+                                   group->bls12381Context);
+    } else {
+      status = twistAffine_multiply(
+          &result->twistAffinePoint, &element->twistAffinePoint, scalar,
+          &group->bls12381Context->montgomeryContext);
+    }
+    if (status) {
+      pairingGroupElement_destroy(*result);
+    }
+    return status;
+  }
+
+  AffinePoint product;
+  if (element->affineFixedBaseTable) {
+    status = affine_fixedBaseMultiply(&product, element->affineFixedBaseTable,
+                                      scalar);
+  } else {
+    status = affine_wNAFMultiply(&product, element->affinePoint, scalar,
+                                 group->curveContext);
+  }
+  if (status) {
+    return status;
+  }
+
+  pairingGroupElement_fromAffinePoint(result, product, element->subgroup);
+  affine_destroy(product);
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus pairingGroup_multiScalarMultiply(
+    PairingGroupElement *result, const PairingGroupElement *elements,
+    const mpz_srcptr *scalars, const size_t count, const PairingGroup *group) {
+  const PairingGroupSubgroup subgroup = elements[0].subgroup;
+  if (subgroup == pairingGroup_GT) {
+    return CRYPTID_ILLEGAL_SUBGROUP_ERROR;
+  }
+
+  int isEveryElementPrepared = 1;
+  for (size_t i = 0; i < count; i++) {
+    if (elements[i].subgroup != subgroup) {
+      return CRYPTID_ILLEGAL_SUBGROUP_ERROR;
+    }
+    isEveryElementPrepared &= elements[i].affineFixedBaseTable != NULL;
+  }
+
+  CryptidStatus status;
+
+  if (group->type == pairingGroup_TYPE_1 && !isEveryElementPrepared) {
+    AffinePoint points[count];
+    for (size_t i = 0; i < count; i++) {
+      points[i] = elements[i].affinePoint;
+    }
+
+    AffinePoint sum;
+    status = affine_multiScalarMultiply(&sum, points, scalars, count,
+                                        group->curveContext);
+    if (status) {
+      return status;
+    }
+
+    pairingGroupElement_fromAffinePoint(result, sum, subgroup);
+    affine_destroy(sum);
+
+    return CRYPTID_SUCCESS;
+  }
+
+  status = pairingGroup_multiply(result, &elements[0], scalars[0], group);
+  if (status) {
+    return status;
+  }
+
+  for (size_t i = 1; i < count; i++) {
+    PairingGroupElement term, sum;
+    status = pairingGroup_multiply(&term, &elements[i], scalars[i], group);
+    if (status) {
+      pairingGroupElement_destroy(*result);
+      return status;
+    }
+
+    status = pairingGroup_add(&sum, result, &term, group);
+    pairingGroupElement_destroy(term);
+    pairingGroupElement_destroy(*result);
+    if (status) {
+      return status;
+    }
+    *result = sum;
+  }
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus pairingGroup_add(PairingGroupElement *result,
+                               const PairingGroupElement *element1,
+                               const PairingGroupElement *element2,
+                               const PairingGroup *group) {
+  const PairingGroupSubgroup subgroup = element1->subgroup;
+  if (subgroup == pairingGroup_GT || element2->subgroup != subgroup) {
+    return CRYPTID_ILLEGAL_SUBGROUP_ERROR;
+  }
+
+  CryptidStatus status;
+
+  if (group->type == pairingGroup_BLS12_381) {
+    const Bls12381Context *context = group->bls12381Context;
+    pairingGroup_initBls12381Element(result, subgroup, group);
+    if (subgroup == pairingGroup_G1) {
+      status = fieldAffine_add(
+          &result->fieldAffinePoint, &element1->fieldAffinePoint,
+          &element2->fieldAffinePoint, context->curveA,
+          &context->montgomeryContext);
+    } else {
+      status = twistAffine_add(
+          &result->twistAffinePoint, NULL, &element1->twistAffinePoint,
+          &element2->twistAffinePoint, &context->montgomeryContext);
+    }
+    if (status) {
+      pairingGroupElement_destroy(*result);
+    }
+    return status;
+  }
+
+  AffinePoint sum;
+  status = affine_add(&sum, element1->affinePoint, element2->affinePoint,
+                      group->curveContext->ellipticCurve);
+  if (status) {
+    return status;
+  }
+
+  pairingGroupElement_fromAffinePoint(result, sum, subgroup);
+  affine_destroy(sum);
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus pairingGroup_negate(PairingGroupElement *result,
+                                  const PairingGroupElement *element,
+                                  const PairingGroup *group) {
+  const PairingGroupSubgroup subgroup = element->subgroup;
+  if (subgroup == pairingGroup_GT) {
+    return CRYPTID_ILLEGAL_SUBGROUP_ERROR;
+  }
+
+  if (group->type == pairingGroup_BLS12_381) {
+    const MontgomeryContext *montgomeryContext =
+        &group->bls12381Context->montgomeryContext;
+    pairingGroup_initBls12381Element(result, subgroup, group);
+    if (subgroup == pairingGroup_G1) {
+      fieldAffine_negate(&result->fieldAffinePoint, &element->fieldAffinePoint,
+                         montgomeryContext);
+    } else {
+      twistAffine_negate(&result->twistAffinePoint,
+                         &element->twistAffinePoint, montgomeryContext);
+    }
+    return CRYPTID_SUCCESS;
+  }
+
+  AffinePoint negated;
+  affine_negate(&negated, element->affinePoint,
+                group->curveContext->ellipticCurve);
+  pairingGroupElement_fromAffinePoint(result, negated, subgroup);
+  affine_destroy(negated);
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus pairingGroup_mul(PairingGroupElement *result,
+                               const PairingGroupElement *element1,
+                               const PairingGroupElement *element2,
+                               const PairingGroup *group) {
+  if (element1->subgroup != pairingGroup_GT ||
+      element2->subgroup != pairingGroup_GT) {
+    return CRYPTID_ILLEGAL_SUBGROUP_ERROR;
+  }
+
+  if (group->type == pairingGroup_BLS12_381) {
+    pairingGroup_initBls12381Element(result, pairingGroup_GT, group);
+    fp12Element_mul(&result->fp12Element, &element1->fp12Element,
+                    &element2->fp12Element,
+                    &group->bls12381Context->montgomeryContext);
+    return CRYPTID_SUCCESS;
+  }
+
+  Complex product;
+  complex_modMul(&product, element1->complex, element2->complex,
+                 group->curveContext->ellipticCurve.fieldOrder);
+  pairingGroupElement_fromComplex(result, product);
+  complex_destroy(product);
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus pairingGroup_pow(PairingGroupElement *result,
+                               const PairingGroupElement *element,
+                               const mpz_t exponent,
+                               const PairingGroup *group) {
+  if (element->subgroup != pairingGroup_GT) {
+    return CRYPTID_ILLEGAL_SUBGROUP_ERROR;
+  }
+
+  if (group->type == pairingGroup_BLS12_381) {
+    pairingGroup_initBls12381Element(result, pairingGroup_GT, group);
+    bls12381_gtPow(&result->fp12Element, &element->fp12Element, exponent,
+                   group->bls12381Context);
+    return CRYPTID_SUCCESS;
+  }
+
+  Complex power;
+  if (element->gtFixedBaseTable) {
+    gtElement_fixedBasePow(&power, element->gtFixedBaseTable, exponent);
+  } else {
+    // The pairing values have norm 1, so the exponentiation runs in the
+    // cyclotomic subgroup.
+    const MontgomeryContext *montgomeryContext =
+        &group->curveContext->montgomeryContext;
+    mp_limb_t limbs[2 * montgomeryContext->limbCount];
+    GtElement base = gtElement_view(limbs, montgomeryContext);
+    gtElement_fromComplex(&base, element->complex, montgomeryContext);
+    gtElement_pow(&base, &base, exponent, montgomeryContext);
+    gtElement_toComplex(&power, &base, montgomeryContext);
+  }
+
+  pairingGroupElement_fromComplex(result, power);
+  complex_destroy(power);
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus pairingGroup_pair(PairingGroupElement *result,
+                                const PairingGroupElement *p,
+                                const PairingGroupElement *q,
+                                const PairingGroup *group) {
+  if (p->subgroup == pairingGroup_GT || q->subgroup == pairingGroup_GT) {
+    return CRYPTID_ILLEGAL_SUBGROUP_ERROR;
+  }
+
+  CryptidStatus status;
+
+  if (group->type == pairingGroup_BLS12_381) {
+    if (p->subgroup != pairingGroup_G1 || q->subgroup != pairingGroup_G2) {
+      return CRYPTID_ILLEGAL_SUBGROUP_ERROR;
+    }
+
+    pairingGroup_initBls12381Element(result, pairingGroup_GT, group);
+    status = bls12381_performPairing(&result->fp12Element,
+                                     &p->fieldAffinePoint,
+                                     &q->twistAffinePoint,
+                                     group->bls12381Context);
+    if (status) {
+      pairingGroupElement_destroy(*result);
+    }
+    return status;
+  }
+
+  // \f$G_1 = G_2\f$ and the modified Tate pairing is symmetric.
+  Complex value;
+  if (p->preparedPairingArgument) {
+    status = tate_performPreparedPairing(&value, p->preparedPairingArgument,
+                                         q->affinePoint, group->curveContext);
+  } else if (q->preparedPairingArgument) {
+    status = tate_performPreparedPairing(&value, q->preparedPairingArgument,
+                                         p->affinePoint, group->curveContext);
+  } else {
+    status = tate_performPairing(&value, p->affinePoint, q->affinePoint,
+                                 group->curveContext);
+  }
+  if (status) {
+    return status;
+  }
+
+  pairingGroupElement_fromComplex(result, value);
+  complex_destroy(value);
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus pairingGroup_pairProduct(PairingGroupElement *result,
+                                       const PairingGroupElement *ps,
+                                       const PairingGroupElement *qs,
+                                       const size_t count,
+                                       const PairingGroup *group) {
+  int isAnyArgumentPrepared = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (ps[i].subgroup == pairingGroup_GT ||
+        qs[i].subgroup == pairingGroup_GT) {
+      return CRYPTID_ILLEGAL_SUBGROUP_ERROR;
+    }
+    isAnyArgumentPrepared |= ps[i].preparedPairingArgument != NULL ||
+                             qs[i].preparedPairingArgument != NULL;
+  }
+
+  CryptidStatus status;
+
+  if (group->type == pairingGroup_TYPE_1 && !isAnyArgumentPrepared) {
+    AffinePoint pPoints[count], qPoints[count];
+    for (size_t i = 0; i < count; i++) {
+      pPoints[i] = ps[i].affinePoint;
+      qPoints[i] = qs[i].affinePoint;
+    }
+
+    Complex value;
+    status = tate_performMultiPairing(&value, pPoints, qPoints, count,
+                                      group->curveContext);
+    if (status) {
+      return status;
+    }
+
+    pairingGroupElement_fromComplex(result, value);
+    complex_destroy(value);
+
+    return CRYPTID_SUCCESS;
+  }
+
+  status = pairingGroup_pair(result, &ps[0], &qs[0], group);
+  if (status) {
+    return status;
+  }
+
+  for (size_t i = 1; i < count; i++) {
+    PairingGroupElement value, product;
+    status = pairingGroup_pair(&value, &ps[i], &qs[i], group);
+    if (status) {
+      pairingGroupElement_destroy(*result);
+      return status;
+    }
+
+    pairingGroup_mul(&product, result, &value, group);
+    pairingGroupElement_destroy(value);
+    pairingGroupElement_destroy(*result);
+    *result = product;
+  }
+
+  return CRYPTID_SUCCESS;
+}
+
+int pairingGroup_isEquals(const PairingGroupElement *element1,
+                          const PairingGroupElement *element2,
+                          const PairingGroup *group) {
+  if (element1->subgroup != element2->subgroup) {
+    return 0;
+  }
+
+  if (group->type == pairingGroup_BLS12_381) {
+    const MontgomeryContext *montgomeryContext =
+        &group->bls12381Context->montgomeryContext;
+    switch (element1->subgroup) {
+    case pairingGroup_G1:
+      return fieldAffine_isEquals(&element1->fieldAffinePoint,
+                                  &element2->fieldAffinePoint,
+                                  montgomeryContext);
+    case pairingGroup_G2:
+      return twistAffine_isEquals(&element1->twistAffinePoint,
+                                  &element2->twistAffinePoint,
+                                  montgomeryContext);
+    case pairingGroup_GT:
+      return fp12Element_isEquals(&element1->fp12Element,
+                                  &element2->fp12Element, montgomeryContext);
+    }
+  }
+
+  if (element1->subgroup == pairingGroup_GT) {
+    return complex_isEquals(element1->complex, element2->complex) ==
+           CRYPTID_EQUAL;
+  }
+
+  return affine_isEquals(element1->affinePoint, element2->affinePoint);
+}
+
+void pairingGroup_toBinary(unsigned char **result, int *const resultLength,
+                           const PairingGroupElement *element,
+                           const PairingGroup *group) {
+  if (group->type == pairingGroup_BLS12_381) {
+    const Bls12381Context *context = group->bls12381Context;
+    switch (element->subgroup) {
+    case pairingGroup_G1:
+      *resultLength = BLS12381_G1_BINARY_LENGTH;
+      *result = (unsigned char *)malloc(*resultLength);
+      bls12381_g1ToBinary(*result, &element->fieldAffinePoint, context);
+      return;
+    case pairingGroup_G2:
+      *resultLength = BLS12381_G2_BINARY_LENGTH;
+      *result = (unsigned char *)malloc(*resultLength);
+      bls12381_g2ToBinary(*result, &element->twistAffinePoint, context);
+      return;
+    case pairingGroup_GT:
+      *resultLength = BLS12381_GT_BINARY_LENGTH;
+      *result = (unsigned char *)malloc(*resultLength);
+      bls12381_gtToBinary(*result, &element->fp12Element, context);
+      return;
+    }
+  }
+
+  if (element->subgroup == pairingGroup_GT) {
+    canonical(result, resultLength, element->complex,
+              group->curveContext->ellipticCurve.fieldOrder, 1);
+    return;
+  }
+
+  const size_t coordinateLength = pairingGroup_type1CoordinateLength(group);
+  *resultLength = 2 * coordinateLength;
+  *result = (unsigned char *)calloc(*resultLength, sizeof(unsigned char));
+  if (affine_isInfinity(element->affinePoint)) {
+    return;
+  }
+
+  mpz_srcptr coordinates[] = {element->affinePoint.x, element->affinePoint.y};
+  for (int i = 0; i < 2; i++) {
+    const size_t length = (mpz_sizeinbase(coordinates[i], 2) + 7) / 8;
+    mpz_export(*result + (i + 1) * coordinateLength - length, NULL, 1, 1, 1, 0,
+               coordinates[i]);
+  }
+}
+
+static CryptidStatus
+pairingGroup_type1FromBinary(AffinePoint *result,
+                             const unsigned char *const input,
+                             const int inputLength, const PairingGroup *group) {
+  const size_t coordinateLength = pairingGroup_type1CoordinateLength(group);
+  if (inputLength < 0 || (size_t)inputLength != 2 * coordinateLength) {
+    return CRYPTID_ILLEGAL_POINT_ENCODING_ERROR;
+  }
+
+  int isZero = 1;
+  for (int i = 0; i < inputLength; i++) {
+    isZero &= input[i] == 0;
+  }
+  if (isZero) {
+    *result = affine_infinity();
+    return CRYPTID_SUCCESS;
+  }
+
+  mpz_inits(result->x, result->y, NULL);
+  mpz_import(result->x, coordinateLength, 1, 1, 1, 0, input);
+  mpz_import(result->y, coordinateLength, 1, 1, 1, 0, input + coordinateLength);
+  result->isInfinity = 0;
+
+  const EllipticCurve *ellipticCurve = &group->curveContext->ellipticCurve;
+  if (mpz_cmp(result->x, ellipticCurve->fieldOrder) >= 0 ||
+      mpz_cmp(result->y, ellipticCurve->fieldOrder) >= 0 ||
+      !affine_isValid(*result, *ellipticCurve)) {
+    affine_destroy(*result);
+    return CRYPTID_ILLEGAL_POINT_ENCODING_ERROR;
+  }
+
+  return CRYPTID_SUCCESS;
+}
+
+// Reads the output of {@code canonical}: the imaginary and the real part, each
+// padded to as many hexadecimal digits as \f$p\f$ has.
+static CryptidStatus
+pairingGroup_type1GtFromBinary(Complex *result,
+                               const unsigned char *const input,
+                               const int inputLength,
+                               const PairingGroup *group) {
+  const EllipticCurveContext *curveContext = group->curveContext;
+  const mpz_srcptr fieldOrder = curveContext->ellipticCurve.fieldOrder;
+  const size_t digitCount = mpz_sizeinbase(fieldOrder, 16);
+  if (inputLength < 0 || (size_t)inputLength != digitCount) {
+    return CRYPTID_ILLEGAL_POINT_ENCODING_ERROR;
+  }
+
+  mpz_t value, norm;
+  mpz_inits(value, norm, NULL);
+  mpz_import(value, digitCount, 1, 1, 1, 0, input);
+  complex_init(result);
+  mpz_tdiv_r_2exp(result->real, value, 4 * digitCount);
+  mpz_tdiv_q_2exp(result->imaginary, value, 4 * digitCount);
+
+  // The values of the pairing have norm \f$a^2 + b^2 = 1\f$, and then the
+  // exponentiation may run in the cyclotomic subgroup.
+  mpz_mul(norm, result->real, result->real);
+  mpz_addmul(norm, result->imaginary, result->imaginary);
+  mpz_mod(norm, norm, fieldOrder);
+  int isValid = mpz_cmp(result->real, fieldOrder) < 0 &&
+                mpz_cmp(result->imaginary, fieldOrder) < 0 &&
+                mpz_cmp_ui(norm, 1) == 0;
+
+  if (isValid) {
+    const MontgomeryContext *montgomeryContext =
+        &curveContext->montgomeryContext;
+    mp_limb_t limbs[2 * montgomeryContext->limbCount];
+    GtElement power = gtElement_view(limbs, montgomeryContext);
+    gtElement_fromComplex(&power, *result, montgomeryContext);
+    gtElement_pow(&power, &power, curveContext->subgroupOrder,
+                  montgomeryContext);
+
+    Complex one;
+    gtElement_toComplex(&one, &power, montgomeryContext);
+    isValid = mpz_cmp_ui(one.real, 1) == 0 && mpz_sgn(one.imaginary) == 0;
+    complex_destroy(one);
+  }
+
+  mpz_clears(value, norm, NULL);
+
+  if (!isValid) {
+    complex_destroy(*result);
+    return CRYPTID_ILLEGAL_POINT_ENCODING_ERROR;
+  }
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus pairingGroup_fromBinary(PairingGroupElement *result,
+                                      const PairingGroupSubgroup subgroup,
+                                      const unsigned char *const input,
+                                      const int inputLength,
+                                      const PairingGroup *group) {
+  CryptidStatus status;
+
+  if (group->type == pairingGroup_BLS12_381) {
+    const Bls12381Context *context = group->bls12381Context;
+    const int expectedLengths[] = {BLS12381_G1_BINARY_LENGTH,
+                                   BLS12381_G2_BINARY_LENGTH,
+                                   BLS12381_GT_BINARY_LENGTH};
+    if (inputLength != expectedLengths[subgroup]) {
+      return CRYPTID_ILLEGAL_POINT_ENCODING_ERROR;
+    }
+
+    pairingGroup_initBls12381Element(result, subgroup, group);
+    switch (subgroup) {
+    case pairingGroup_G1:
+      status =
+          bls12381_g1FromBinary(&result->fieldAffinePoint, input, context);
+      break;
+    case pairingGroup_G2:
+      status =
+          bls12381_g2FromBinary(&result->twistAffinePoint, input, context);
+      break;
+    default:
+      status = bls12381_gtFromBinary(&result->fp12Element, input, context);
+      break;
+    }
+    if (status) {
+      pairingGroupElement_destroy(*result);
+    }
+    return status;
+  }
+
+  if (subgroup == pairingGroup_GT) {
+    Complex complex;
+    status =
+        pairingGroup_type1GtFromBinary(&complex, input, inputLength, group);
+    if (status) {
+      return status;
+    }
+
+    pairingGroupElement_fromComplex(result, complex);
+    complex_destroy(complex);
+
+    return CRYPTID_SUCCESS;
+  }
+
+  AffinePoint point;
+  status = pairingGroup_type1FromBinary(&point, input, inputLength, group);
+  if (status) {
+    return status;
+  }
+
+  pairingGroupElement_fromAffinePoint(result, point, subgroup);
+  affine_destroy(point);
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus pairingGroup_prepareFixedBase(PairingGroupElement *element,
+                                            const PairingGroup *group) {
+  if (group->type == pairingGroup_BLS12_381) {
+    return CRYPTID_SUCCESS;
+  }
+
+  const EllipticCurveContext *curveContext = group->curveContext;
+  CryptidStatus status;
+
+  if (element->subgroup == pairingGroup_GT) {
+    GtFixedBaseTable *table =
+        (GtFixedBaseTable *)malloc(sizeof(GtFixedBaseTable));
+    status = gtFixedBaseTable_init(table, element->complex,
+                                   curveContext->subgroupOrder,
+                                   GT_FIXED_BASE_DEFAULT_WINDOW_SIZE,
+                                   curveContext->ellipticCurve.fieldOrder);
+    if (status) {
+      free(table);
+      return status;
+    }
+    element->gtFixedBaseTable = table;
+    return CRYPTID_SUCCESS;
+  }
+
+  AffineFixedBaseTable *table =
+      (AffineFixedBaseTable *)malloc(sizeof(AffineFixedBaseTable));
+  status = affineFixedBaseTable_init(table, element->affinePoint,
+                                     curveContext->subgroupOrder,
+                                     AFFINE_FIXED_BASE_DEFAULT_WINDOW_SIZE,
+                                     curveContext->ellipticCurve);
+  if (status) {
+    free(table);
+    return status;
+  }
+  element->affineFixedBaseTable = table;
+
+  return CRYPTID_SUCCESS;
+}
+
+CryptidStatus pairingGroup_preparePairingArgument(PairingGroupElement *element,
+                                                  const PairingGroup *group) {
+  if (element->subgroup == pairingGroup_GT) {
+    return CRYPTID_ILLEGAL_SUBGROUP_ERROR;
+  }
+
+  if (group->type == pairingGroup_BLS12_381) {
+    return CRYPTID_SUCCESS;
+  }
+
+  PreparedPairingArgument *argument =
+      (PreparedPairingArgument *)malloc(sizeof(PreparedPairingArgument));
+  CryptidStatus status = preparedPairingArgument_init(
+      argument, element->affinePoint, group->curveContext);
+  if (status) {
+    free(argument);
+    return status;
+  }
+  element->preparedPairingArgument = argument;
+
+  return CRYPTID_SUCCESS;
+}
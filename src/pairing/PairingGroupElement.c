@@ -0,0 +1,85 @@
+#include <stdlib.h>
+
+#include "pairing/PairingGroupElement.h"
+
+static void pairingGroupElement_initEmpty(PairingGroupElement *elementOutput,
+                                          const PairingGroupType type,
+                                          const PairingGroupSubgroup subgroup) {
+  elementOutput->type = type;
+  elementOutput->subgroup = subgroup;
+  elementOutput->limbs = NULL;
+  elementOutput->affineFixedBaseTable = NULL;
+  elementOutput->gtFixedBaseTable = NULL;
+  elementOutput->preparedPairingArgument = NULL;
+}
+
+void pairingGroupElement_fromAffinePoint(PairingGroupElement *elementOutput,
+                                         const AffinePoint point,
+                                         const PairingGroupSubgroup subgroup) {
+  pairingGroupElement_initEmpty(elementOutput, pairingGroup_TYPE_1, subgroup);
+  affine_init(&elementOutput->affinePoint, point.x, point.y);
+}
+
+void pairingGroupElement_fromComplex(PairingGroupElement *elementOutput,
+                                     const Complex complex) {
+  pairingGroupElement_initEmpty(elementOutput, pairingGroup_TYPE_1,
+                                pairingGroup_GT);
+  complex_initMpz(&elementOutput->complex, complex.real, complex.imaginary);
+}
+
+void pairingGroupElement_initBls12381(
+    PairingGroupElement *elementOutput, const PairingGroupSubgroup subgroup,
+    const MontgomeryContext *montgomeryContext) {
+  pairingGroupElement_initEmpty(elementOutput, pairingGroup_BLS12_381,
+                                subgroup);
+
+  // \f$F_p^2\f$ for \f$G_1\f$, \f$F_{p^2}^2\f$ for \f$G_2\f$ and
+  // \f$F_{p^{12}}\f$ for \f$G_T\f$.
+  static const size_t limbCountMultipliers[] = {2, 4, 12};
+  elementOutput->limbs = (mp_limb_t *)malloc(
+      limbCountMultipliers[subgroup] * montgomeryContext->limbCount *
+      sizeof(mp_limb_t));
+
+  switch (subgroup) {
+  case pairingGroup_G1:
+    elementOutput->fieldAffinePoint =
+        fieldAffine_view(elementOutput->limbs, montgomeryContext);
+    break;
+  case pairingGroup_G2:
+    elementOutput->twistAffinePoint =
+        twistAffine_view(elementOutput->limbs, montgomeryContext);
+    break;
+  case pairingGroup_GT:
+    elementOutput->fp12Element =
+        fp12Element_view(elementOutput->limbs, montgomeryContext);
+    break;
+  }
+}
+
+void pairingGroupElement_destroy(PairingGroupElement element) {
+  if (element.type == pairingGroup_BLS12_381) {
+    free(element.limbs);
+    return;
+  }
+
+  if (element.subgroup == pairingGroup_GT) {
+    complex_destroy(element.complex);
+  } else {
+    affine_destroy(element.affinePoint);
+  }
+
+  if (element.affineFixedBaseTable) {
+    affineFixedBaseTable_destroy(*element.affineFixedBaseTable);
+    free(element.affineFixedBaseTable);
+  }
+
+  if (element.gtFixedBaseTable) {
+    gtFixedBaseTable_destroy(*element.gtFixedBaseTable);
+    free(element.gtFixedBaseTable);
+  }
+
+  if (element.preparedPairingArgument) {
+    preparedPairingArgument_destroy(*element.preparedPairingArgument);
+    free(element.preparedPairingArgument);
+  }
+}
@@ -0,0 +1,43 @@
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pairing/PairingGroupElementAsBinary.h"
+
+void pairingGroupElementAsBinary_init(
+    PairingGroupElementAsBinary *elementAsBinaryOutput,
+    const void *const element, const size_t elementLength) {
+  elementAsBinaryOutput->element = malloc(elementLength);
+  memcpy(elementAsBinaryOutput->element, element, elementLength);
+
+  elementAsBinaryOutput->elementLength = elementLength;
+}
+
+void pairingGroupElementAsBinary_destroy(
+    PairingGroupElementAsBinary elementAsBinary) {
+  free(elementAsBinary.element);
+}
+
+CryptidStatus pairingGroupElementAsBinary_toPairingGroupElement(
+    PairingGroupElement *elementOutput, const PairingGroupSubgroup subgroup,
+    const PairingGroupElementAsBinary elementAsBinary,
+    const PairingGroup *group) {
+  if (elementAsBinary.elementLength > INT_MAX) {
+    return CRYPTID_ILLEGAL_POINT_ENCODING_ERROR;
+  }
+
+  return pairingGroup_fromBinary(elementOutput, subgroup,
+                                 (const unsigned char *)elementAsBinary.element,
+                                 (int)elementAsBinary.elementLength, group);
+}
+
+void pairingGroupElementAsBinary_fromPairingGroupElement(
+    PairingGroupElementAsBinary *elementAsBinaryOutput,
+    const PairingGroupElement *element, const PairingGroup *group) {
+  unsigned char *binary;
+  int binaryLength;
+  pairingGroup_toBinary(&binary, &binaryLength, element, group);
+
+  elementAsBinaryOutput->element = binary;
+  elementAsBinaryOutput->elementLength = (size_t)binaryLength;
+}
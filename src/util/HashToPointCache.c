@@ -0,0 +1,309 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "elliptic/EllipticCurveContext.h"
+#include "util/HashToPointCache.h"
+#include "util/Mutex.h"
+
+typedef struct HashToPointCacheEntry {
+  // Neighbours in the recency list of the shard.
+  struct HashToPointCacheEntry *newer;
+  struct HashToPointCacheEntry *older;
+
+  // Next entry in the same bucket.
+  struct HashToPointCacheEntry *next;
+
+  uint64_t hash;
+  unsigned char fingerprint[VALIDATION_MEMO_KEY_LENGTH];
+  HashFunction hashFunction;
+  char *id;
+  int idLength;
+  AffinePoint point;
+} HashToPointCacheEntry;
+
+typedef struct HashToPointCacheShard {
+  CryptidMutex mutex;
+
+  // {@code capacity} buckets, allocated on the first insertion.
+  HashToPointCacheEntry **buckets;
+  size_t capacity;
+  size_t size;
+
+  HashToPointCacheEntry *newest;
+  HashToPointCacheEntry *oldest;
+
+  size_t hitCount;
+  size_t missCount;
+} HashToPointCacheShard;
+
+#define HASH_TO_POINT_CACHE_SHARD_CAPACITY                                     \
+  ((HASH_TO_POINT_CACHE_DEFAULT_CAPACITY + HASH_TO_POINT_CACHE_SHARD_COUNT -  \
+    1) /                                                                       \
+   HASH_TO_POINT_CACHE_SHARD_COUNT)
+
+#define HASH_TO_POINT_CACHE_SHARD_INITIALIZER                                  \
+  {                                                                            \
+    CRYPTID_MUTEX_INITIALIZER, NULL, HASH_TO_POINT_CACHE_SHARD_CAPACITY, 0,    \
+        NULL, NULL, 0, 0                                                       \
+  }
+
+static HashToPointCacheShard
+    hashToPointCacheShards[HASH_TO_POINT_CACHE_SHARD_COUNT] = {
+        HASH_TO_POINT_CACHE_SHARD_INITIALIZER,
+        HASH_TO_POINT_CACHE_SHARD_INITIALIZER,
+        HASH_TO_POINT_CACHE_SHARD_INITIALIZER,
+        HASH_TO_POINT_CACHE_SHARD_INITIALIZER,
+        HASH_TO_POINT_CACHE_SHARD_INITIALIZER,
+        HASH_TO_POINT_CACHE_SHARD_INITIALIZER,
+        HASH_TO_POINT_CACHE_SHARD_INITIALIZER,
+        HASH_TO_POINT_CACHE_SHARD_INITIALIZER};
+
+// 64-bit FNV-1a of the key, selecting the shard and the bucket. Entries are
+// compared in full, so collisions only cost time.
+static uint64_t hashToPointCache_hash(const unsigned char *fingerprint,
+                                      const HashFunction hashFunction,
+                                      const char *const id,
+                                      const int idLength) {
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (int i = 0; i < VALIDATION_MEMO_KEY_LENGTH; i++) {
+    hash = (hash ^ fingerprint[i]) * 1099511628211ULL;
+  }
+
+  hash = (hash ^ (unsigned char)hashFunction) * 1099511628211ULL;
+
+  for (int i = 0; i < idLength; i++) {
+    hash = (hash ^ (unsigned char)id[i]) * 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+static HashToPointCacheShard *hashToPointCache_shard(const uint64_t hash) {
+  return &hashToPointCacheShards[hash % HASH_TO_POINT_CACHE_SHARD_COUNT];
+}
+
+static HashToPointCacheEntry **
+hashToPointCache_bucket(const HashToPointCacheShard *shard,
+                        const uint64_t hash) {
+  return &shard->buckets[(hash / HASH_TO_POINT_CACHE_SHARD_COUNT) %
+                         shard->capacity];
+}
+
+static HashToPointCacheEntry *
+hashToPointCache_find(const HashToPointCacheShard *shard, const uint64_t hash,
+                      const unsigned char *fingerprint,
+                      const HashFunction hashFunction, const char *const id,
+                      const int idLength) {
+  if (!shard->buckets) {
+    return NULL;
+  }
+
+  for (HashToPointCacheEntry *entry = *hashToPointCache_bucket(shard, hash);
+       entry; entry = entry->next) {
+    if (entry->hash == hash && entry->hashFunction == hashFunction &&
+        entry->idLength == idLength &&
+        !memcmp(entry->fingerprint, fingerprint, VALIDATION_MEMO_KEY_LENGTH) &&
+        !memcmp(entry->id, id, idLength)) {
+      return entry;
+    }
+  }
+
+  return NULL;
+}
+
+static void hashToPointCache_unlinkRecency(HashToPointCacheShard *shard,
+                                           HashToPointCacheEntry *entry) {
+  if (entry->newer) {
+    entry->newer->older = entry->older;
+  } else {
+    shard->newest = entry->older;
+  }
+
+  if (entry->older) {
+    entry->older->newer = entry->newer;
+  } else {
+    shard->oldest = entry->newer;
+  }
+}
+
+static void hashToPointCache_linkNewest(HashToPointCacheShard *shard,
+                                        HashToPointCacheEntry *entry) {
+  entry->newer = NULL;
+  entry->older = shard->newest;
+
+  if (shard->newest) {
+    shard->newest->newer = entry;
+  } else {
+    shard->oldest = entry;
+  }
+
+  shard->newest = entry;
+}
+
+static void hashToPointCache_destroyEntry(HashToPointCacheEntry *entry) {
+  affine_destroy(entry->point);
+  free(entry->id);
+  free(entry);
+}
+
+static void hashToPointCache_evictOldest(HashToPointCacheShard *shard) {
+  HashToPointCacheEntry *oldest = shard->oldest;
+
+  HashToPointCacheEntry **link = hashToPointCache_bucket(shard, oldest->hash);
+  while (*link != oldest) {
+    link = &(*link)->next;
+  }
+  *link = oldest->next;
+
+  hashToPointCache_unlinkRecency(shard, oldest);
+  hashToPointCache_destroyEntry(oldest);
+  shard->size--;
+}
+
+// Removes every entry and frees the buckets. Should be called with the mutex
+// of the shard held.
+static void hashToPointCache_clearShard(HashToPointCacheShard *shard) {
+  HashToPointCacheEntry *entry = shard->newest;
+  while (entry) {
+    HashToPointCacheEntry *older = entry->older;
+    hashToPointCache_destroyEntry(entry);
+    entry = older;
+  }
+
+  free(shard->buckets);
+  shard->buckets = NULL;
+  shard->size = 0;
+  shard->newest = NULL;
+  shard->oldest = NULL;
+}
+
+void hashToPointCache_setCapacity(const size_t capacity) {
+  const size_t shardCapacity =
+      (capacity + HASH_TO_POINT_CACHE_SHARD_COUNT - 1) /
+      HASH_TO_POINT_CACHE_SHARD_COUNT;
+
+  for (int i = 0; i < HASH_TO_POINT_CACHE_SHARD_COUNT; i++) {
+    HashToPointCacheShard *shard = &hashToPointCacheShards[i];
+
+    mutex_lock(&shard->mutex);
+    hashToPointCache_clearShard(shard);
+    shard->capacity = shardCapacity;
+    mutex_unlock(&shard->mutex);
+  }
+}
+
+int hashToPointCache_get(AffinePoint *result, const unsigned char *fingerprint,
+                         const HashFunction hashFunction,
+                         const char *const id, const int idLength) {
+  const uint64_t hash =
+      hashToPointCache_hash(fingerprint, hashFunction, id, idLength);
+  HashToPointCacheShard *shard = hashToPointCache_shard(hash);
+  int isFound = 0;
+
+  mutex_lock(&shard->mutex);
+  if (shard->capacity) {
+    HashToPointCacheEntry *entry = hashToPointCache_find(
+        shard, hash, fingerprint, hashFunction, id, idLength);
+
+    if (entry) {
+      hashToPointCache_unlinkRecency(shard, entry);
+      hashToPointCache_linkNewest(shard, entry);
+      affine_init(result, entry->point.x, entry->point.y);
+      shard->hitCount++;
+      isFound = 1;
+    } else {
+      shard->missCount++;
+    }
+  }
+  mutex_unlock(&shard->mutex);
+
+  return isFound;
+}
+
+void hashToPointCache_put(const AffinePoint point,
+                          const unsigned char *fingerprint,
+                          const HashFunction hashFunction,
+                          const char *const id, const int idLength) {
+  const uint64_t hash =
+      hashToPointCache_hash(fingerprint, hashFunction, id, idLength);
+  HashToPointCacheShard *shard = hashToPointCache_shard(hash);
+
+  mutex_lock(&shard->mutex);
+  if (!shard->capacity) {
+    mutex_unlock(&shard->mutex);
+    return;
+  }
+
+  if (!shard->buckets) {
+    shard->buckets = (HashToPointCacheEntry **)calloc(
+        shard->capacity, sizeof(HashToPointCacheEntry *));
+  }
+
+  // Another thread may have stored the same point meanwhile.
+  if (!shard->buckets || hashToPointCache_find(shard, hash, fingerprint,
+                                               hashFunction, id, idLength)) {
+    mutex_unlock(&shard->mutex);
+    return;
+  }
+
+  HashToPointCacheEntry *entry =
+      (HashToPointCacheEntry *)malloc(sizeof(HashToPointCacheEntry));
+  char *idCopy = (char *)malloc(idLength > 0 ? idLength : 1);
+  if (!entry || !idCopy) {
+    free(entry);
+    free(idCopy);
+    mutex_unlock(&shard->mutex);
+    return;
+  }
+
+  if (shard->size == shard->capacity) {
+    hashToPointCache_evictOldest(shard);
+  }
+
+  memcpy(idCopy, id, idLength);
+  entry->hash = hash;
+  memcpy(entry->fingerprint, fingerprint, VALIDATION_MEMO_KEY_LENGTH);
+  entry->hashFunction = hashFunction;
+  entry->id = idCopy;
+  entry->idLength = idLength;
+  affine_init(&entry->point, point.x, point.y);
+
+  HashToPointCacheEntry **bucket = hashToPointCache_bucket(shard, hash);
+  entry->next = *bucket;
+  *bucket = entry;
+  hashToPointCache_linkNewest(shard, entry);
+  shard->size++;
+
+  mutex_unlock(&shard->mutex);
+}
+
+void hashToPointCache_getStatistics(size_t *hitCount, size_t *missCount,
+                                    size_t *size) {
+  *hitCount = 0;
+  *missCount = 0;
+  *size = 0;
+
+  for (int i = 0; i < HASH_TO_POINT_CACHE_SHARD_COUNT; i++) {
+    HashToPointCacheShard *shard = &hashToPointCacheShards[i];
+
+    mutex_lock(&shard->mutex);
+    *hitCount += shard->hitCount;
+    *missCount += shard->missCount;
+    *size += shard->size;
+    mutex_unlock(&shard->mutex);
+  }
+}
+
+void hashToPointCache_flush(void) {
+  for (int i = 0; i < HASH_TO_POINT_CACHE_SHARD_COUNT; i++) {
+    HashToPointCacheShard *shard = &hashToPointCacheShards[i];
+
+    mutex_lock(&shard->mutex);
+    hashToPointCache_clearShard(shard);
+    shard->hitCount = 0;
+    shard->missCount = 0;
+    mutex_unlock(&shard->mutex);
+  }
+}
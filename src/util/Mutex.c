@@ -0,0 +1,21 @@
+#include "util/Mutex.h"
+
+#if defined(__wasi__)
+
+void mutex_lock(CryptidMutex *mutex) { (void)mutex; }
+
+void mutex_unlock(CryptidMutex *mutex) { (void)mutex; }
+
+#elif defined(_WIN32)
+
+void mutex_lock(CryptidMutex *mutex) { AcquireSRWLockExclusive(mutex); }
+
+void mutex_unlock(CryptidMutex *mutex) { ReleaseSRWLockExclusive(mutex); }
+
+#else
+
+void mutex_lock(CryptidMutex *mutex) { pthread_mutex_lock(mutex); }
+
+void mutex_unlock(CryptidMutex *mutex) { pthread_mutex_unlock(mutex); }
+
+#endif
@@ -3,6 +3,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "util/HashToPointCache.h"
 #include "util/Utils.h"
 
 // References
@@ -86,52 +87,50 @@ void hashToRange(mpz_t result, const unsigned char *const s, const int sLength,
 }
 
 CryptidStatus hashToPoint(AffinePoint *result, const char *const id,
-                          const int idLength, const mpz_t q,
-                          const EllipticCurve ellipticCurve,
+                          const int idLength,
+                          const EllipticCurveContext *context,
                           const HashFunction hashFunction) {
   // Implementation of Algorithm 4.4.2 (HashToPoint1) in [RFC-5091].
 
-  mpz_t y, x, pxTwo, pxTwoSub, pxTwoSubQ3, yPowTwo, yPowTwoSub, pAddOne,
-      pAddOneQq;
-  mpz_inits(y, x, pxTwo, pxTwoSub, pxTwoSubQ3, yPowTwo, yPowTwoSub, pAddOne,
-            pAddOneQq, NULL);
+  if (hashToPointCache_get(result, context->fingerprint, hashFunction, id,
+                           idLength)) {
+    return CRYPTID_SUCCESS;
+  }
+
+  const mpz_srcptr fieldOrder = context->ellipticCurve.fieldOrder;
+
+  mpz_t y, x, yPowTwo;
+  mpz_inits(y, x, yPowTwo, NULL);
 
   // Let \f$y = \mathrm{HashToRange}(id, p, \mathrm{hashfcn})\f$, using {@code
   // HashToRange}, an element of \f$F_p\f$.
-  hashToRange(y, (unsigned char *)id, idLength, ellipticCurve.fieldOrder,
-              hashFunction);
+  hashToRange(y, (unsigned char *)id, idLength, fieldOrder, hashFunction);
 
   // Let \f$x = (y^2 - 1)^{\frac{2 \cdot p - 1}{3}} \mod p\f$, an element of
   // \f$F_p\f$.
   mpz_pow_ui(yPowTwo, y, 2);
   mpz_sub_ui(yPowTwo, yPowTwo, 1);
 
-  mpz_mul_ui(pxTwo, ellipticCurve.fieldOrder, 2);
-  mpz_sub_ui(pxTwoSub, pxTwo, 1);
-  mpz_cdiv_q_ui(pxTwoSubQ3, pxTwoSub, 3);
-
-  mpz_powm(x, yPowTwo, pxTwoSubQ3, ellipticCurve.fieldOrder);
+  mpz_powm(x, yPowTwo, context->cubeRootExponent, fieldOrder);
 
   // Let \f$Q^{\prime} = (x, y)\f$, a non-zero point in \f$E(F_p)\f$.
   AffinePoint qPrime;
   affine_init(&qPrime, x, y);
 
-  mpz_add_ui(pAddOne, ellipticCurve.fieldOrder, 1);
-  mpz_cdiv_q(pAddOneQq, pAddOne, q);
-
   // Let \f$Q = [(p + 1) / q ]Q^{\prime}\f$, a point of order \f$q\f$ in
   // \f$E(F_p)\f$.
   CryptidStatus status =
-      affine_wNAFMultiply(result, qPrime, pAddOneQq, ellipticCurve);
+      affine_wNAFMultiply(result, qPrime, context->cofactor, context);
   if (status) {
-    mpz_clears(y, x, pxTwo, pxTwoSub, pxTwoSubQ3, yPowTwo, yPowTwoSub, pAddOne,
-               pAddOneQq, NULL);
+    mpz_clears(y, x, yPowTwo, NULL);
     affine_destroy(qPrime);
     return status;
   }
 
-  mpz_clears(y, x, pxTwo, pxTwoSub, pxTwoSubQ3, yPowTwo, yPowTwoSub, pAddOne,
-             pAddOneQq, NULL);
+  hashToPointCache_put(*result, context->fingerprint, hashFunction, id,
+                       idLength);
+
+  mpz_clears(y, x, yPowTwo, NULL);
   affine_destroy(qPrime);
   return CRYPTID_SUCCESS;
 }
@@ -164,7 +163,7 @@ void canonical(unsigned char **result, int *const resultLength, const Complex v,
   if (order == 0) {
     for (size_t i = 0; i < outputSize; i++) {
       if (strlen(realPartHexString) + i < outputSize) {
-        resultHexString[i] = 0;
+        resultHexString[i] = '0';
         index++;
       } else {
         resultHexString[i] = realPartHexString[i - index];
@@ -173,7 +172,7 @@ void canonical(unsigned char **result, int *const resultLength, const Complex v,
     index = 0;
     for (size_t i = 0; i < outputSize; i++) {
       if (strlen(imagPartHexString) + i < outputSize) {
-        resultHexString[outputSize + i] = 0;
+        resultHexString[outputSize + i] = '0';
         index++;
       } else {
         resultHexString[outputSize + i] = imagPartHexString[i - index];
@@ -186,7 +185,7 @@ void canonical(unsigned char **result, int *const resultLength, const Complex v,
   else {
     for (size_t i = 0; i < outputSize; i++) {
       if (strlen(imagPartHexString) + i < outputSize) {
-        resultHexString[i] = 0;
+        resultHexString[i] = '0';
         index++;
       } else {
         resultHexString[i] = imagPartHexString[i - index];
@@ -195,7 +194,7 @@ void canonical(unsigned char **result, int *const resultLength, const Complex v,
     index = 0;
     for (size_t i = 0; i < outputSize; i++) {
       if (strlen(realPartHexString) + i < outputSize) {
-        resultHexString[outputSize + i] = 0;
+        resultHexString[outputSize + i] = '0';
         index++;
       } else {
         resultHexString[outputSize + i] = realPartHexString[i - index];
@@ -0,0 +1,95 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "sha.h"
+
+#include "util/Mutex.h"
+#include "util/ValidationMemo.h"
+
+static CryptidMutex validationMemoMutex = CRYPTID_MUTEX_INITIALIZER;
+
+// The keys form a ring, {@code validationMemoNext} is the slot the next key
+// is written to, evicting the oldest one once the ring is full.
+static ValidationMemoKey validationMemoKeys[VALIDATION_MEMO_CAPACITY];
+static size_t validationMemoCount = 0;
+static size_t validationMemoNext = 0;
+
+static void validationMemo_inputLength(SHA256Context *context,
+                                       const size_t length) {
+  uint8_t bytes[8];
+  for (int i = 0; i < 8; i++) {
+    bytes[i] = (uint8_t)(length >> (8 * (7 - i)));
+  }
+
+  SHA256Input(context, bytes, 8);
+}
+
+void validationMemo_computeKey(ValidationMemoKey *key, const char *const domain,
+                               const mpz_srcptr *values,
+                               const size_t valueCount) {
+  SHA256Context context;
+  SHA256Reset(&context);
+
+  const size_t domainLength = strlen(domain);
+  validationMemo_inputLength(&context, domainLength);
+  SHA256Input(&context, (const uint8_t *)domain, (unsigned int)domainLength);
+
+  for (size_t i = 0; i < valueCount; i++) {
+    size_t length;
+    unsigned char *bytes = mpz_export(NULL, &length, 1, 1, 0, 0, values[i]);
+
+    const uint8_t sign = (uint8_t)(mpz_sgn(values[i]) + 1);
+    SHA256Input(&context, &sign, 1);
+    validationMemo_inputLength(&context, length);
+    if (bytes) {
+      SHA256Input(&context, bytes, (unsigned int)length);
+    }
+
+    free(bytes);
+  }
+
+  SHA256Result(&context, key->digest);
+}
+
+CryptidValidationResult
+validationMemo_isKnownValid(const ValidationMemoKey *key) {
+  CryptidValidationResult result = CRYPTID_VALIDATION_FAILURE;
+
+  mutex_lock(&validationMemoMutex);
+  for (size_t i = 0; i < validationMemoCount; i++) {
+    if (!memcmp(validationMemoKeys[i].digest, key->digest,
+                VALIDATION_MEMO_KEY_LENGTH)) {
+      result = CRYPTID_VALIDATION_SUCCESS;
+      break;
+    }
+  }
+  mutex_unlock(&validationMemoMutex);
+
+  return result;
+}
+
+void validationMemo_rememberValid(const ValidationMemoKey *key) {
+  mutex_lock(&validationMemoMutex);
+  // Another thread may have validated the same values meanwhile.
+  for (size_t i = 0; i < validationMemoCount; i++) {
+    if (!memcmp(validationMemoKeys[i].digest, key->digest,
+                VALIDATION_MEMO_KEY_LENGTH)) {
+      mutex_unlock(&validationMemoMutex);
+      return;
+    }
+  }
+
+  validationMemoKeys[validationMemoNext] = *key;
+  validationMemoNext = (validationMemoNext + 1) % VALIDATION_MEMO_CAPACITY;
+  if (validationMemoCount < VALIDATION_MEMO_CAPACITY) {
+    validationMemoCount++;
+  }
+  mutex_unlock(&validationMemoMutex);
+}
+
+void validationMemo_flush(void) {
+  mutex_lock(&validationMemoMutex);
+  validationMemoCount = 0;
+  validationMemoNext = 0;
+  mutex_unlock(&validationMemoMutex);
+}
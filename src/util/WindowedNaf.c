@@ -0,0 +1,94 @@
+#include <limits.h>
+#include <stdlib.h>
+
+#include "util/WindowedNaf.h"
+
+// References:
+//   * [Guide-to-ECC] Darrel Hankerson, Alfred J. Menezes, and Scott Vanstone.
+//   2010. Guide to Elliptic Curve Cryptography (1st ed.). Springer Publishing
+//   Company, Incorporated.
+
+#define LIMB_BITS (sizeof(mp_limb_t) * CHAR_BIT)
+
+size_t windowedNaf_maxLength(const mpz_t s) {
+  // The width-\f$w\f$ NAF of a number is at most one digit longer than the
+  // number itself.
+  return (mpz_size(s) + 1) * LIMB_BITS;
+}
+
+size_t windowedNaf_recode(signed char *digits, const mpz_t s,
+                          const int windowSize) {
+  // Implementation of Algorithm 3.35 in [Guide-to-ECC], working on a copy of
+  // the limbs of the number. Instead of subtracting the digit and halving the
+  // number in every step, the current bit position moves forward, and the
+  // subtraction of a digit clears (or carries over) the window at that
+  // position.
+  const size_t limbCount = mpz_size(s);
+  mp_limb_t *k = (mp_limb_t *)calloc(limbCount + 1, sizeof(mp_limb_t));
+  for (size_t i = 0; i < limbCount; i++) {
+    k[i] = mpz_getlimbn(s, i);
+  }
+
+  const mp_limb_t twoPowW = (mp_limb_t)1 << windowSize;
+  const mp_limb_t windowMask = twoPowW - 1;
+  const size_t bitCount = (limbCount + 1) * LIMB_BITS;
+
+  size_t digitCount = 0;
+  size_t position = 0;
+  while (position < bitCount) {
+    const size_t limbIndex = position / LIMB_BITS;
+    const size_t bitIndex = position % LIMB_BITS;
+
+    if (!((k[limbIndex] >> bitIndex) & 1)) {
+      digits[digitCount++] = 0;
+      position++;
+      continue;
+    }
+
+    // \f$u = k \bmod 2^w\f$, read from the bits at the current position.
+    mp_limb_t window = k[limbIndex] >> bitIndex;
+    if (bitIndex + windowSize > LIMB_BITS && limbIndex + 1 <= limbCount) {
+      window |= k[limbIndex + 1] << (LIMB_BITS - bitIndex);
+    }
+    window &= windowMask;
+
+    // Clear the window, as \f$k - u\f$ is divisible by \f$2^w\f$.
+    for (int i = 0; i < windowSize; i++) {
+      const size_t bit = position + i;
+      if (bit < bitCount) {
+        k[bit / LIMB_BITS] &= ~((mp_limb_t)1 << (bit % LIMB_BITS));
+      }
+    }
+
+    if (window >= twoPowW / 2) {
+      // \f$u = (k \bmod 2^w) - 2^w\f$, so \f$k - u\f$ carries a one right
+      // above the window.
+      digits[digitCount++] = (signed char)((long)window - (long)twoPowW);
+
+      size_t carryPosition = position + windowSize;
+      for (size_t i = carryPosition / LIMB_BITS; i <= limbCount; i++) {
+        const mp_limb_t addend =
+            i == carryPosition / LIMB_BITS
+                ? (mp_limb_t)1 << (carryPosition % LIMB_BITS)
+                : 1;
+        k[i] += addend;
+        if (k[i] >= addend) {
+          break;
+        }
+      }
+    } else {
+      digits[digitCount++] = (signed char)window;
+    }
+
+    position++;
+  }
+
+  free(k);
+
+  // Strip the leading zero digits.
+  while (digitCount > 0 && digits[digitCount - 1] == 0) {
+    digitCount--;
+  }
+
+  return digitCount;
+}
@@ -0,0 +1,86 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+
+#include "elliptic/AffineFixedBaseTable.h"
+#include "elliptic/AffinePoint.h"
+#include "elliptic/EllipticCurve.h"
+#include "elliptic/EllipticCurveContext.h"
+
+TEST fixedBaseMultiply_should_agree_with_wNAFMultiply(const long x,
+                                                      const long y,
+                                                      const long order,
+                                                      const int windowSize) {
+  // Given
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 131);
+
+  // The order of \f$y^2 = x^3 + 1\f$ over \f$F_{131}\f$ is \f$12 \cdot 11\f$.
+  mpz_t subgroupOrder;
+  mpz_init_set_ui(subgroupOrder, 11);
+  EllipticCurveContext context;
+  ASSERT_EQ(ellipticCurveContext_init(&context, ec, subgroupOrder),
+            CRYPTID_SUCCESS);
+
+  AffinePoint basePoint;
+  affine_initLong(&basePoint, x, y);
+
+  mpz_t pointOrder, scalar;
+  mpz_init_set_si(pointOrder, order);
+  mpz_init(scalar);
+
+  AffineFixedBaseTable table;
+  ASSERT_EQ(affineFixedBaseTable_init(&table, basePoint, pointOrder,
+                                      windowSize, ec),
+            CRYPTID_SUCCESS);
+
+  for (long s = 0; s < 3 * order; ++s) {
+    mpz_set_si(scalar, s);
+
+    // When
+    AffinePoint result;
+    ASSERT_EQ(affine_fixedBaseMultiply(&result, &table, scalar),
+              CRYPTID_SUCCESS);
+
+    // Then
+    AffinePoint expected;
+    ASSERT_EQ(affine_wNAFMultiply(&expected, basePoint, scalar, &context),
+              CRYPTID_SUCCESS);
+    ASSERT(affine_isEquals(result, expected));
+
+    affine_destroy(result);
+    affine_destroy(expected);
+  }
+
+  affineFixedBaseTable_destroy(table);
+  ellipticCurveContext_destroy(context);
+  mpz_clears(pointOrder, scalar, subgroupOrder, NULL);
+  affine_destroy(basePoint);
+  ellipticCurve_destroy(ec);
+
+  PASS();
+}
+
+SUITE(fixed_base_multiplication_suite) {
+  // \f$(98, 58)\f$ has order 11 and \f$(9, 59)\f$ has order 132 on
+  // \f$y^2 = x^3 + 1\f$ over \f$F_{131}\f$.
+  for (int windowSize = 0; windowSize <= AFFINE_FIXED_BASE_MAX_WINDOW_SIZE + 1;
+       ++windowSize) {
+    RUN_TESTp(fixedBaseMultiply_should_agree_with_wNAFMultiply, 98, 58, 11,
+              windowSize);
+    RUN_TESTp(fixedBaseMultiply_should_agree_with_wNAFMultiply, 9, 59, 132,
+              windowSize);
+  }
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(fixed_base_multiplication_suite);
+
+  GREATEST_MAIN_END();
+}
@@ -6,6 +6,7 @@
 
 #include "elliptic/AffinePoint.h"
 #include "elliptic/EllipticCurve.h"
+#include "elliptic/EllipticCurveContext.h"
 
 TEST wnafmultiplication_should_just_work(const AffinePoint p, const long s,
                                          const AffinePoint expected) {
@@ -14,14 +15,21 @@ TEST wnafmultiplication_should_just_work(const AffinePoint p, const long s,
   mpz_init_set_ui(scalar, s);
   EllipticCurve ec;
   ellipticCurve_initLong(&ec, 0, 1, 5);
+  // The order of \f$y^2 = x^3 + 1\f$ over \f$F_5\f$ is \f$2 \cdot 3\f$.
+  mpz_t subgroupOrder;
+  mpz_init_set_ui(subgroupOrder, 3);
+  EllipticCurveContext context;
+  ASSERT_EQ(ellipticCurveContext_init(&context, ec, subgroupOrder),
+            CRYPTID_SUCCESS);
 
   // When
   AffinePoint result;
-  int err = affine_wNAFMultiply(&result, p, scalar, ec);
+  int err = affine_wNAFMultiply(&result, p, scalar, &context);
 
   if (err) {
+    ellipticCurveContext_destroy(context);
     ellipticCurve_destroy(ec);
-    mpz_clear(scalar);
+    mpz_clears(scalar, subgroupOrder, NULL);
 
     FAIL();
   }
@@ -30,8 +38,61 @@ TEST wnafmultiplication_should_just_work(const AffinePoint p, const long s,
   ASSERT(affine_isEquals(result, expected));
 
   affine_destroy(result);
+  ellipticCurveContext_destroy(context);
+  ellipticCurve_destroy(ec);
+  mpz_clears(scalar, subgroupOrder, NULL);
+
+  PASS();
+}
+
+TEST wnafmultiplication_should_agree_with_repeated_addition(
+    const unsigned long bitLength) {
+  // Given
+  // \f$(9, 59)\f$ has order 132 on \f$y^2 = x^3 + 1\f$ over \f$F_{131}\f$.
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 131);
+  mpz_t subgroupOrder;
+  mpz_init_set_ui(subgroupOrder, 11);
+  EllipticCurveContext context;
+  ASSERT_EQ(ellipticCurveContext_init(&context, ec, subgroupOrder),
+            CRYPTID_SUCCESS);
+  AffinePoint p;
+  affine_initLong(&p, 9, 59);
+
+  // Scalars of the given length with varied bit patterns, so that every
+  // window size and the carries across limbs are exercised.
+  mpz_t scalar;
+  mpz_init(scalar);
+
+  for (unsigned long pattern = 0; pattern < 16; pattern++) {
+    mpz_set_ui(scalar, 0);
+    mpz_setbit(scalar, bitLength - 1);
+    for (unsigned long bit = 0; bit + 1 < bitLength; bit++) {
+      if (((bit * 7 + pattern * 13) / (pattern % 5 + 1)) % 3 == 0) {
+        mpz_setbit(scalar, bit);
+      }
+    }
+
+    // When
+    AffinePoint result;
+    ASSERT_EQ(affine_wNAFMultiply(&result, p, scalar, &context),
+              CRYPTID_SUCCESS);
+
+    // Then
+    AffinePoint expected = affine_infinity();
+    for (unsigned long i = mpz_fdiv_ui(scalar, 132); i > 0; i--) {
+      ASSERT_EQ(affine_addInto(&expected, &expected, &p, ec), CRYPTID_SUCCESS);
+    }
+    ASSERT(affine_isEquals(result, expected));
+
+    affine_destroy(result);
+    affine_destroy(expected);
+  }
+
+  mpz_clears(scalar, subgroupOrder, NULL);
+  affine_destroy(p);
+  ellipticCurveContext_destroy(context);
   ellipticCurve_destroy(ec);
-  mpz_clear(scalar);
 
   PASS();
 }
@@ -71,6 +132,101 @@ SUITE(wnafmultiplication_suite) {
     affine_destroy(p);
     affine_destroy(expected);
   }
+
+  const unsigned long bitLengths[] = {1,   5,   15,  40,   64,   65,   128,
+                                      160, 300, 512, 1000, 2000, 3000, 7168};
+  for (size_t i = 0; i < sizeof(bitLengths) / sizeof(bitLengths[0]); i++) {
+    RUN_TESTp(wnafmultiplication_should_agree_with_repeated_addition,
+              bitLengths[i]);
+  }
+}
+
+TEST multiscalarmultiplication_should_agree_with_the_sum_of_multiples(
+    const unsigned long count) {
+  // Given
+  // \f$(9, 59)\f$ has order 132 on \f$y^2 = x^3 + 1\f$ over \f$F_{131}\f$.
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 131);
+  mpz_t subgroupOrder;
+  mpz_init_set_ui(subgroupOrder, 11);
+  EllipticCurveContext context;
+  ASSERT_EQ(ellipticCurveContext_init(&context, ec, subgroupOrder),
+            CRYPTID_SUCCESS);
+  AffinePoint p;
+  affine_initLong(&p, 9, 59);
+
+  // Multiples of P as the points, with an infinity and a zero scalar mixed
+  // in, so that the skipped terms are exercised as well.
+  AffinePoint *points = malloc(count * sizeof(AffinePoint));
+  mpz_t *scalarValues = malloc(count * sizeof(mpz_t));
+  mpz_srcptr *scalars = malloc(count * sizeof(mpz_srcptr));
+
+  mpz_t multiplier;
+  mpz_init(multiplier);
+  for (unsigned long i = 0; i < count; i++) {
+    if (i % 7 == 3) {
+      points[i] = affine_infinity();
+    } else {
+      mpz_set_ui(multiplier, i + 1);
+      ASSERT_EQ(affine_wNAFMultiply(&points[i], p, multiplier, &context),
+                CRYPTID_SUCCESS);
+    }
+
+    mpz_init(scalarValues[i]);
+    if (i % 5 != 4) {
+      mpz_ui_pow_ui(scalarValues[i], 3, 40 + i * 11 % 150);
+      mpz_add_ui(scalarValues[i], scalarValues[i], i);
+    }
+    scalars[i] = scalarValues[i];
+  }
+
+  // When
+  AffinePoint result;
+  ASSERT_EQ(
+      affine_multiScalarMultiply(&result, points, scalars, count, &context),
+      CRYPTID_SUCCESS);
+
+  // Then
+  AffinePoint expected = affine_infinity();
+  for (unsigned long i = 0; i < count; i++) {
+    AffinePoint term;
+    ASSERT_EQ(affine_wNAFMultiply(&term, points[i], scalars[i], &context),
+              CRYPTID_SUCCESS);
+    ASSERT_EQ(affine_addInto(&expected, &expected, &term, ec),
+              CRYPTID_SUCCESS);
+    affine_destroy(term);
+  }
+  ASSERT(affine_isEquals(result, expected));
+
+  affine_destroy(result);
+  affine_destroy(expected);
+  for (unsigned long i = 0; i < count; i++) {
+    affine_destroy(points[i]);
+    mpz_clear(scalarValues[i]);
+  }
+  mpz_clears(multiplier, subgroupOrder, NULL);
+  free(points);
+  free(scalarValues);
+  free(scalars);
+  affine_destroy(p);
+  ellipticCurveContext_destroy(context);
+  ellipticCurve_destroy(ec);
+
+  PASS();
+}
+
+SUITE(multiscalarmultiplication_suite) {
+  // Both sides of the threshold between interleaving and the bucket method.
+  const unsigned long counts[] = {1,
+                                  2,
+                                  5,
+                                  AFFINE_MULTI_SCALAR_STRAUS_THRESHOLD,
+                                  2 * AFFINE_MULTI_SCALAR_STRAUS_THRESHOLD,
+                                  100};
+  for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+    RUN_TESTp(multiscalarmultiplication_should_agree_with_the_sum_of_multiples,
+              counts[i]);
+  }
 }
 
 TEST adding_a_point_to_itself_with_y_equals_to_zero_should_yield_infinity(
@@ -102,6 +258,52 @@ TEST adding_a_point_to_itself_with_y_equals_to_zero_should_yield_infinity(
   PASS();
 }
 
+TEST infinity_should_keep_the_sentinel_coordinates(void) {
+  // Given
+  AffinePoint infty = affine_infinity();
+  AffinePoint sentinel, point;
+  affine_initLong(&sentinel, -1, -1);
+  affine_initLong(&point, 0, 1);
+
+  // Then
+  ASSERT(affine_isInfinity(infty));
+  ASSERT(affine_isInfinity(sentinel));
+  ASSERT(!affine_isInfinity(point));
+  ASSERT_EQ(mpz_cmp_si(infty.x, -1), 0);
+  ASSERT_EQ(mpz_cmp_si(infty.y, -1), 0);
+
+  affine_destroy(infty);
+  affine_destroy(sentinel);
+  affine_destroy(point);
+
+  PASS();
+}
+
+TEST adding_the_negative_should_yield_infinity(const long x, const long y) {
+  // Given
+  AffinePoint p;
+  affine_initLong(&p, x, y);
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 131);
+
+  // When
+  AffinePoint negative;
+  affine_negate(&negative, p, ec);
+
+  // Then
+  AffinePoint result;
+  ASSERT_EQ(affine_add(&result, p, negative, ec), CRYPTID_SUCCESS);
+  ASSERT(affine_isInfinity(result));
+  ASSERT_EQ(affine_isInfinity(p), affine_isInfinity(negative));
+
+  affine_destroy(p);
+  affine_destroy(negative);
+  affine_destroy(result);
+  ellipticCurve_destroy(ec);
+
+  PASS();
+}
+
 TEST adding_infinity_to_infinity_should_result_in_infinity(void) {
   // Given
   AffinePoint infty = affine_infinity();
@@ -199,11 +401,72 @@ TEST addition_on_non_special_cases_should_work_correctly(
   PASS();
 }
 
+TEST addInto_should_allow_the_result_to_alias_an_operand(void) {
+  // Given
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 5);
+  AffinePoint p, q, expected;
+  affine_initLong(&p, 0, 4);
+  affine_initLong(&q, 2, 3);
+  affine_initLong(&expected, 2, 2);
+
+  // When
+  int err = affine_addInto(&p, &p, &q, ec);
+
+  // Then
+  ASSERT_FALSE(err);
+  ASSERT(affine_isEquals(p, expected));
+
+  affine_destroy(p);
+  affine_destroy(q);
+  affine_destroy(expected);
+  ellipticCurve_destroy(ec);
+
+  PASS();
+}
+
+TEST doubleInto_should_allow_the_result_to_alias_the_operand(void) {
+  // Given
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 5);
+  AffinePoint p, expected;
+  affine_initLong(&p, 0, 1);
+  affine_initLong(&expected, 0, 4);
+
+  // When
+  int err = affine_doubleInto(&p, &p, ec);
+
+  // Then
+  ASSERT_FALSE(err);
+  ASSERT(affine_isEquals(p, expected));
+
+  // When
+  err = affine_doubleInto(&p, &p, ec);
+
+  // Then
+  ASSERT_FALSE(err);
+  ASSERT(affine_isEquals(p, expected) == 0);
+  ASSERT_EQ(mpz_cmp_ui(p.x, 0), 0);
+  ASSERT_EQ(mpz_cmp_ui(p.y, 1), 0);
+
+  affine_destroy(p);
+  affine_destroy(expected);
+  ellipticCurve_destroy(ec);
+
+  PASS();
+}
+
 SUITE(addition_suite) {
   RUN_TEST(
       adding_a_point_to_itself_with_y_equals_to_zero_should_yield_infinity);
+  RUN_TEST(infinity_should_keep_the_sentinel_coordinates);
+  RUN_TESTp(adding_the_negative_should_yield_infinity, 98, 58);
+  RUN_TESTp(adding_the_negative_should_yield_infinity, 130, 0);
+  RUN_TESTp(adding_the_negative_should_yield_infinity, -1, -1);
   RUN_TEST(adding_infinity_to_infinity_should_result_in_infinity);
   RUN_TEST(infinity_should_act_as_the_identity_element_for_addition);
+  RUN_TEST(addInto_should_allow_the_result_to_alias_an_operand);
+  RUN_TEST(doubleInto_should_allow_the_result_to_alias_the_operand);
 
   {
     AffinePoint data[21];
@@ -251,6 +514,7 @@ int main(int argc, char **argv) {
   GREATEST_MAIN_BEGIN();
 
   RUN_SUITE(wnafmultiplication_suite);
+  RUN_SUITE(multiscalarmultiplication_suite);
   RUN_SUITE(addition_suite);
 
   GREATEST_MAIN_END();
@@ -9,7 +9,8 @@
 #include "attribute-based/ciphertext-policy/encryption/bsw/BSWCiphertextPolicyAttributeBasedEncryption.h"
 
 TEST basic_abe_test(
-    SecurityLevel securityLevel, char *message,
+    SecurityLevel securityLevel, PairingGroupType pairingGroupType,
+    char *message,
     bswCiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary
         *accessTreeAsBinary,
     char **attributes, int numAttributes, int expectedReponse) {
@@ -20,8 +21,8 @@ TEST basic_abe_test(
       malloc(
           sizeof(bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary));
 
-  CryptidStatus status =
-      cryptid_abe_bsw_setup(publickey, masterkey, securityLevel);
+  CryptidStatus status = cryptid_abe_bsw_setupForPairingGroup(
+      publickey, masterkey, securityLevel, pairingGroupType);
   ASSERT_EQ(status, CRYPTID_SUCCESS);
 
   bswCiphertextPolicyAttributeBasedEncryptionEncryptedMessageAsBinary
@@ -80,6 +81,17 @@ TEST basic_abe_test(
   PASS();
 }
 
+TEST bls12381_setup_should_reject_high_security_levels(void) {
+  bswCiphertextPolicyAttributeBasedEncryptionPublicKeyAsBinary publickey;
+  bswCiphertextPolicyAttributeBasedEncryptionMasterKeyAsBinary masterkey;
+
+  CryptidStatus status = cryptid_abe_bsw_setupForPairingGroup(
+      &publickey, &masterkey, HIGH, pairingGroup_BLS12_381);
+  ASSERT_EQ(status, CRYPTID_SECURITY_LEVEL_NOT_SUPPORTED_ERROR);
+
+  PASS();
+}
+
 static void generateRandomString(char **output, size_t outputLength,
                                  char *alphabet, size_t alphabetSize) {
   memset(*output, '\0', outputLength);
@@ -133,8 +145,10 @@ SUITE(cryptid_abe_suite) {
       strcpy(attributes[a], randomStr);
     }
 
-    RUN_TESTp(basic_abe_test, LOWEST, message, accessTreeAsBinary, attributes,
-              numAttributes, expectedReponse);
+    RUN_TESTp(basic_abe_test, LOWEST, pairingGroup_TYPE_1, message,
+              accessTreeAsBinary, attributes, numAttributes, expectedReponse);
+    RUN_TESTp(basic_abe_test, LOWEST, pairingGroup_BLS12_381, message,
+              accessTreeAsBinary, attributes, numAttributes, expectedReponse);
 
     free(message);
     bswChiphertextPolicyAttributeBasedEncryptionAccessTreeAsBinary_destroy(
@@ -189,10 +203,16 @@ SUITE(cryptid_abe_suite) {
   attributesBad[0] = "guest";
   attributesBad[1] = attribute2;
 
-  RUN_TESTp(basic_abe_test, LOWEST, message, accessTreeAsBinary, attributesGood,
-            numAttributes, 1);
-  RUN_TESTp(basic_abe_test, LOWEST, message, accessTreeAsBinary, attributesBad,
-            numAttributes, 0);
+  RUN_TESTp(basic_abe_test, LOWEST, pairingGroup_TYPE_1, message,
+            accessTreeAsBinary, attributesGood, numAttributes, 1);
+  RUN_TESTp(basic_abe_test, LOWEST, pairingGroup_TYPE_1, message,
+            accessTreeAsBinary, attributesBad, numAttributes, 0);
+  RUN_TESTp(basic_abe_test, LOWEST, pairingGroup_BLS12_381, message,
+            accessTreeAsBinary, attributesGood, numAttributes, 1);
+  RUN_TESTp(basic_abe_test, LOWEST, pairingGroup_BLS12_381, message,
+            accessTreeAsBinary, attributesBad, numAttributes, 0);
+
+  RUN_TEST(bls12381_setup_should_reject_high_security_levels);
 
   free(attributesGood);
   free(attributesBad);
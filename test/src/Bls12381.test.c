@@ -0,0 +1,386 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "greatest.h"
+
+#include "bls12-381/Bls12381.h"
+#include "bls12-381/Bls12381Context.h"
+#include "util/WindowedNaf.h"
+
+static const char *const FIELD_ORDER_HEX =
+    "1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb1"
+    "53ffffb9feffffffffaaab";
+static const char *const GROUP_ORDER_HEX =
+    "73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000001";
+
+// The uncompressed encodings of the generators, as given in the serialization
+// format of the ZCash BLS12-381 specification.
+static const char *const G1_GENERATOR_HEX =
+    "17f1d3a73197d7942695638c4fa9ac0fc3688c4f9774b905a14e3a3f171bac586c55e83f"
+    "f97a1aeffb3af00adb22c6bb08b3f481e3aaa0f1a09e30ed741d8ae4fcf5e095d5d00af6"
+    "00db18cb2c04b3edd03cc744a2888ae40caa232946c5e7e1";
+static const char *const G2_GENERATOR_HEX =
+    "13e02b6052719f607dacd3a088274f65596bd0d09920b61ab5da61bbdc7f5049334cf112"
+    "13945d57e5ac7d055d042b7e024aa2b2f08f0a91260805272dc51051c6e47ad4fa403b02"
+    "b4510b647ae3d1770bac0326a805bbefd48056c8c121bdb80606c4a02ea734cc32acd2b0"
+    "2bc28b99cb3e287e85a763af267492ab572e99ab3f370d275cec1da1aaa9075ff05f79be"
+    "0ce5d527727d6e118cc9cdc6da2e351aadfd9baa8cbdd3a76d429a695160d12c923ac9cc"
+    "3baca289e193548608b82801";
+
+// e(G1, G2) as written by bls12381_gtToBinary, computed with py_ecc 8.0.0 as
+// pairing(neg(G2), G1) and mapped from its Fp12 = Fp[w] / (w^12 - 2w^6 + 2)
+// to the tower through i = w^6 - 1. Like blst and zkcrypto, the Miller loop
+// here is conjugated because x is negative, while py_ecc runs it on |x|, hence
+// the negated G2.
+static const char *const GENERATOR_PAIRING_HEX =
+    "153ce14a76a53e205ba8f275ef1137c56a566f638b52d34ba3bf3bf22f277d70f7631621"
+    "8c0dfd583a394b8448d2be7f11619b45f61edfe3b47a15fac19442526ff489dcda25e591"
+    "21d9931438907dfd448299a87dde3a649bdba96e84d5455816deedaa683124fe72600851"
+    "84d88f7d036b86f53bb5b7f1fc5e248814782065413e7d958d17960109ea006b2afdeb5f"
+    "095668fb4a02fe930ed44767834c915b283b1c6ca98c047bd4c272e9ac3f3ba6ff0b05a9"
+    "3e59c71fba77bce995f04692111061f398efc2a97ff825b04d21089e24fd8b93a47e41e6"
+    "0eae7e9b2a38d54fa4dedced0811c34ce528781ab9e929c709c92cf02f3cd3d2f9d34bc4"
+    "4eee0dd50314ed44ca5d30ce6a9ec0539be7a86b121edc61839ccc908c4bdde256cd6048"
+    "08890726743a1f94a8193a166800b7787744a8ad8e2f9365db76863e894b7a11d83f90d8"
+    "73567e9d645ccf725b32d26f01ecfcf31c86257ab00b4709c33f1c9c4e007659dd5ffc4a"
+    "735192167ce197058cfb4c94225e7f1b6c26ad9ba68f63bc0fe63f185f56dd29150fc498"
+    "bbeea78969e7e783043620db33f75a05a0a2ce5c442beaff9da195ff15164c00ab66bdde"
+    "0e61c752414ca5dfd258e9606bac08daec29b3e2c57062669556954fb227d3f1260eedf2"
+    "5446a086b0844bcd43646c101454814f3085f0e6602247671bc408bbce2007201536818c"
+    "901dbd4d2095dd86c1ec8b888e59611f60a301af7776be3d10900338a92ed0b47af21163"
+    "6f7cfdec717b7ee43900eee9b5fc24f0000c5874d4801372db478987691c566a8c474978";
+
+static void fromHex(unsigned char *output, const char *const hex,
+                    const size_t outputLength) {
+  assert(strlen(hex) == 2 * outputLength);
+  for (size_t i = 0; i < outputLength; i++) {
+    unsigned int octet;
+    sscanf(hex + 2 * i, "%2x", &octet);
+    output[i] = (unsigned char)octet;
+  }
+}
+
+static void gtPow(Fp12Element *power, const Fp12Element *base,
+                  const mpz_t exponent, const Bls12381Context *context) {
+  signed char *digits = (signed char *)malloc(windowedNaf_maxLength(exponent));
+  const size_t digitCount = windowedNaf_recode(digits, exponent, 2);
+
+  fp12Element_powDigits(power, base, digits, digitCount, 2,
+                        &context->montgomeryContext);
+
+  free(digits);
+}
+
+TEST context_should_derive_the_standard_parameters(void) {
+  // Given
+  Bls12381Context context;
+  mpz_t fieldOrder, groupOrder;
+  mpz_init_set_str(fieldOrder, FIELD_ORDER_HEX, 16);
+  mpz_init_set_str(groupOrder, GROUP_ORDER_HEX, 16);
+
+  // When
+  ASSERT_EQ(bls12381Context_init(&context), CRYPTID_SUCCESS);
+
+  // Then
+  ASSERT_EQ(mpz_cmp(context.fieldOrder, fieldOrder), 0);
+  ASSERT_EQ(mpz_cmp(context.groupOrder, groupOrder), 0);
+
+  mpz_clears(fieldOrder, groupOrder, NULL);
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST generators_should_be_group_elements(void) {
+  // Given
+  Bls12381Context context;
+  ASSERT_EQ(bls12381Context_init(&context), CRYPTID_SUCCESS);
+
+  // When
+  int isG1Valid = bls12381_g1IsValid(&context.g1Generator, &context);
+  int isG2Valid = bls12381_g2IsValid(&context.g2Generator, &context);
+
+  // Then
+  ASSERT(isG1Valid);
+  ASSERT(isG2Valid);
+
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST generators_should_have_the_standard_encodings(void) {
+  // Given
+  Bls12381Context context;
+  ASSERT_EQ(bls12381Context_init(&context), CRYPTID_SUCCESS);
+
+  unsigned char expectedG1[BLS12381_G1_BINARY_LENGTH];
+  unsigned char expectedG2[BLS12381_G2_BINARY_LENGTH];
+  fromHex(expectedG1, G1_GENERATOR_HEX, BLS12381_G1_BINARY_LENGTH);
+  fromHex(expectedG2, G2_GENERATOR_HEX, BLS12381_G2_BINARY_LENGTH);
+
+  // When
+  unsigned char g1Binary[BLS12381_G1_BINARY_LENGTH];
+  unsigned char g2Binary[BLS12381_G2_BINARY_LENGTH];
+  bls12381_g1ToBinary(g1Binary, &context.g1Generator, &context);
+  bls12381_g2ToBinary(g2Binary, &context.g2Generator, &context);
+
+  // Then
+  ASSERT_MEM_EQ(expectedG1, g1Binary, BLS12381_G1_BINARY_LENGTH);
+  ASSERT_MEM_EQ(expectedG2, g2Binary, BLS12381_G2_BINARY_LENGTH);
+
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST pairing_of_the_generators_should_match_the_reference(void) {
+  // Given
+  Bls12381Context context;
+  ASSERT_EQ(bls12381Context_init(&context), CRYPTID_SUCCESS);
+  const MontgomeryContext *montgomeryContext = &context.montgomeryContext;
+
+  unsigned char expected[BLS12381_GT_BINARY_LENGTH];
+  fromHex(expected, GENERATOR_PAIRING_HEX, BLS12381_GT_BINARY_LENGTH);
+
+  mp_limb_t limbs[12 * montgomeryContext->limbCount];
+  Fp12Element result = fp12Element_view(limbs, montgomeryContext);
+
+  // When
+  ASSERT_EQ(bls12381_performPairing(&result, &context.g1Generator,
+                                    &context.g2Generator, &context),
+            CRYPTID_SUCCESS);
+
+  // Then
+  unsigned char binary[BLS12381_GT_BINARY_LENGTH];
+  bls12381_gtToBinary(binary, &result, &context);
+  ASSERT_MEM_EQ(expected, binary, BLS12381_GT_BINARY_LENGTH);
+
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST pairing_should_be_bilinear(const long a, const long b) {
+  // Given
+  Bls12381Context context;
+  ASSERT_EQ(bls12381Context_init(&context), CRYPTID_SUCCESS);
+  const MontgomeryContext *montgomeryContext = &context.montgomeryContext;
+
+  mpz_t aScalar, bScalar, product;
+  mpz_init_set_si(aScalar, a);
+  mpz_init_set_si(bScalar, b);
+  mpz_init(product);
+  mpz_mul(product, aScalar, bScalar);
+  mpz_mod(product, product, context.groupOrder);
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[6 * n + 3 * 12 * n];
+  FieldAffinePoint aP = fieldAffine_view(limbs, montgomeryContext);
+  TwistAffinePoint bQ = twistAffine_view(limbs + 2 * n, montgomeryContext);
+  ASSERT_EQ(
+      bls12381_g1Multiply(&aP, &context.g1Generator, aScalar, &context),
+      CRYPTID_SUCCESS);
+  ASSERT_EQ(twistAffine_multiply(&bQ, &context.g2Generator, bScalar,
+                                 montgomeryContext),
+            CRYPTID_SUCCESS);
+
+  // When
+  Fp12Element base = fp12Element_view(limbs + 6 * n, montgomeryContext);
+  Fp12Element result = fp12Element_view(limbs + 18 * n, montgomeryContext);
+  Fp12Element expected = fp12Element_view(limbs + 30 * n, montgomeryContext);
+  ASSERT_EQ(bls12381_performPairing(&base, &context.g1Generator,
+                                    &context.g2Generator, &context),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(bls12381_performPairing(&result, &aP, &bQ, &context),
+            CRYPTID_SUCCESS);
+
+  // Then
+  gtPow(&expected, &base, product, &context);
+  ASSERT(fp12Element_isEquals(&result, &expected, montgomeryContext));
+
+  mpz_clears(aScalar, bScalar, product, NULL);
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST pairing_should_be_non_degenerate(void) {
+  // Given
+  Bls12381Context context;
+  ASSERT_EQ(bls12381Context_init(&context), CRYPTID_SUCCESS);
+  const MontgomeryContext *montgomeryContext = &context.montgomeryContext;
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[3 * 12 * n];
+  Fp12Element one = fp12Element_view(limbs, montgomeryContext);
+  Fp12Element result = fp12Element_view(limbs + 12 * n, montgomeryContext);
+  Fp12Element power = fp12Element_view(limbs + 24 * n, montgomeryContext);
+  fp12Element_setOne(&one, montgomeryContext);
+
+  // When
+  ASSERT_EQ(bls12381_performPairing(&result, &context.g1Generator,
+                                    &context.g2Generator, &context),
+            CRYPTID_SUCCESS);
+
+  // Then
+  ASSERT_FALSE(fp12Element_isEquals(&result, &one, montgomeryContext));
+  gtPow(&power, &result, context.groupOrder, &context);
+  ASSERT(fp12Element_isEquals(&power, &one, montgomeryContext));
+
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST hash_to_g1_should_give_group_elements(void) {
+  // Given
+  Bls12381Context context;
+  ASSERT_EQ(bls12381Context_init(&context), CRYPTID_SUCCESS);
+  const MontgomeryContext *montgomeryContext = &context.montgomeryContext;
+
+  HashFunction hashFunction;
+  hashFunction_initForSecurityLevel(&hashFunction, MEDIUM);
+
+  const char *const message = "Darth Plagueis";
+  const char *const otherMessage = "Darth Sidious";
+
+  // When
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[3 * 2 * n];
+  FieldAffinePoint point = fieldAffine_view(limbs, montgomeryContext);
+  FieldAffinePoint samePoint =
+      fieldAffine_view(limbs + 2 * n, montgomeryContext);
+  FieldAffinePoint otherPoint =
+      fieldAffine_view(limbs + 4 * n, montgomeryContext);
+  ASSERT_EQ(bls12381_hashToG1(&point, (const unsigned char *)message,
+                              strlen(message), hashFunction, &context),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(bls12381_hashToG1(&samePoint, (const unsigned char *)message,
+                              strlen(message), hashFunction, &context),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(bls12381_hashToG1(&otherPoint,
+                              (const unsigned char *)otherMessage,
+                              strlen(otherMessage), hashFunction, &context),
+            CRYPTID_SUCCESS);
+
+  // Then
+  ASSERT(bls12381_g1IsValid(&point, &context));
+  ASSERT(fieldElement_isEquals(point.x, samePoint.x, montgomeryContext));
+  ASSERT(fieldElement_isEquals(point.y, samePoint.y, montgomeryContext));
+  ASSERT_FALSE(
+      fieldElement_isEquals(point.x, otherPoint.x, montgomeryContext));
+
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST serialization_should_round_trip(void) {
+  // Given
+  Bls12381Context context;
+  ASSERT_EQ(bls12381Context_init(&context), CRYPTID_SUCCESS);
+  const MontgomeryContext *montgomeryContext = &context.montgomeryContext;
+
+  unsigned char g1Binary[BLS12381_G1_BINARY_LENGTH];
+  unsigned char g2Binary[BLS12381_G2_BINARY_LENGTH];
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[8 * n];
+  FieldAffinePoint g1Point = fieldAffine_view(limbs, montgomeryContext);
+  FieldAffinePoint g1Infinity =
+      fieldAffine_view(limbs + 2 * n, montgomeryContext);
+  TwistAffinePoint g2Point = twistAffine_view(limbs + 4 * n, montgomeryContext);
+
+  // When
+  bls12381_g1ToBinary(g1Binary, &context.g1Generator, &context);
+  bls12381_g2ToBinary(g2Binary, &context.g2Generator, &context);
+
+  // Then
+  ASSERT_EQ(bls12381_g1FromBinary(&g1Point, g1Binary, &context),
+            CRYPTID_SUCCESS);
+  ASSERT(fieldElement_isEquals(g1Point.x, context.g1Generator.x,
+                               montgomeryContext));
+  ASSERT(fieldElement_isEquals(g1Point.y, context.g1Generator.y,
+                               montgomeryContext));
+  ASSERT_EQ(bls12381_g2FromBinary(&g2Point, g2Binary, &context),
+            CRYPTID_SUCCESS);
+  ASSERT(twistAffine_isEquals(&g2Point, &context.g2Generator,
+                              montgomeryContext));
+
+  // When
+  bls12381_g1ToBinary(g1Binary, &g1Infinity, &context);
+
+  // Then
+  ASSERT_EQ(g1Binary[0], 0x40);
+  ASSERT_EQ(bls12381_g1FromBinary(&g1Point, g1Binary, &context),
+            CRYPTID_SUCCESS);
+  ASSERT(g1Point.isInfinity);
+
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST deserialization_should_reject_invalid_encodings(void) {
+  // Given
+  Bls12381Context context;
+  ASSERT_EQ(bls12381Context_init(&context), CRYPTID_SUCCESS);
+
+  unsigned char binary[BLS12381_G1_BINARY_LENGTH];
+  mp_limb_t limbs[2 * context.montgomeryContext.limbCount];
+  FieldAffinePoint point = fieldAffine_view(limbs, &context.montgomeryContext);
+  bls12381_g1ToBinary(binary, &context.g1Generator, &context);
+
+  // When
+  binary[BLS12381_G1_BINARY_LENGTH - 1] ^= 1;
+
+  // Then
+  ASSERT_EQ(bls12381_g1FromBinary(&point, binary, &context),
+            CRYPTID_ILLEGAL_POINT_ENCODING_ERROR);
+
+  // When
+  memset(binary, 0xff, 48);
+  binary[0] = 0x1f;
+
+  // Then
+  ASSERT_EQ(bls12381_g1FromBinary(&point, binary, &context),
+            CRYPTID_ILLEGAL_POINT_ENCODING_ERROR);
+
+  // When
+  memset(binary, 0, BLS12381_G1_BINARY_LENGTH);
+  binary[0] = 0x80;
+
+  // Then
+  ASSERT_EQ(bls12381_g1FromBinary(&point, binary, &context),
+            CRYPTID_ILLEGAL_POINT_ENCODING_ERROR);
+
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+SUITE(bls12381_suite) {
+  RUN_TEST(context_should_derive_the_standard_parameters);
+  RUN_TEST(generators_should_be_group_elements);
+  RUN_TEST(generators_should_have_the_standard_encodings);
+  RUN_TEST(pairing_of_the_generators_should_match_the_reference);
+  RUN_TESTp(pairing_should_be_bilinear, 2, 3);
+  RUN_TESTp(pairing_should_be_bilinear, 1234567, 7654321);
+  RUN_TESTp(pairing_should_be_bilinear, -5, 11);
+  RUN_TEST(pairing_should_be_non_degenerate);
+  RUN_TEST(hash_to_g1_should_give_group_elements);
+  RUN_TEST(serialization_should_round_trip);
+  RUN_TEST(deserialization_should_reject_invalid_encodings);
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(bls12381_suite);
+
+  GREATEST_MAIN_END();
+}
@@ -5,9 +5,6 @@
 
 #include "greatest.h"
 
-#include "complex/Complex.h"
-#include "elliptic/AffinePoint.h"
-#include "elliptic/EllipticCurve.h"
 #include "identity-based/encryption/boneh-franklin/BonehFranklinIdentityBasedEncryption.h"
 
 const char *LOWEST_QUICK_CHECK_ARGUMENT = "--lowest-quick-check";
@@ -16,17 +13,17 @@ int isLowestQuickCheck = 0;
 int isVerbose = 0;
 
 TEST fresh_boneh_franklin_ibe_setup_matching_identities(
-    const SecurityLevel securityLevel, const char *const message,
-    const char *const identity) {
+    const PairingGroupType pairingGroupType, const SecurityLevel securityLevel,
+    const char *const message, const char *const identity) {
   BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary publicParameters;
   BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary masterSecret;
 
-  CryptidStatus status = cryptid_ibe_bonehFranklin_setup(
-      &masterSecret, &publicParameters, securityLevel);
+  CryptidStatus status = cryptid_ibe_bonehFranklin_setupForPairingGroup(
+      &masterSecret, &publicParameters, securityLevel, pairingGroupType);
 
   ASSERT_EQ(status, CRYPTID_SUCCESS);
 
-  AffinePointAsBinary privateKey;
+  PairingGroupElementAsBinary privateKey;
   status = cryptid_ibe_bonehFranklin_extract(
       &privateKey, identity, strlen(identity), masterSecret, publicParameters);
 
@@ -48,7 +45,7 @@ TEST fresh_boneh_franklin_ibe_setup_matching_identities(
 
   free(plaintext);
   bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_destroy(ciphertext);
-  affineAsBinary_destroy(privateKey);
+  pairingGroupElementAsBinary_destroy(privateKey);
   free(masterSecret.masterSecret);
   bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_destroy(
       publicParameters);
@@ -57,17 +54,18 @@ TEST fresh_boneh_franklin_ibe_setup_matching_identities(
 }
 
 TEST fresh_boneh_franklin_ibe_setup_different_identities(
-    const SecurityLevel securityLevel, const char *const message,
-    const char *const encryptIdentity, const char *const decryptIdentity) {
+    const PairingGroupType pairingGroupType, const SecurityLevel securityLevel,
+    const char *const message, const char *const encryptIdentity,
+    const char *const decryptIdentity) {
   BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary publicParameters;
   BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary masterSecret;
 
-  CryptidStatus status = cryptid_ibe_bonehFranklin_setup(
-      &masterSecret, &publicParameters, securityLevel);
+  CryptidStatus status = cryptid_ibe_bonehFranklin_setupForPairingGroup(
+      &masterSecret, &publicParameters, securityLevel, pairingGroupType);
 
   ASSERT_EQ(status, CRYPTID_SUCCESS);
 
-  AffinePointAsBinary privateKey;
+  PairingGroupElementAsBinary privateKey;
   status = cryptid_ibe_bonehFranklin_extract(&privateKey, decryptIdentity,
                                              strlen(decryptIdentity),
                                              masterSecret, publicParameters);
@@ -88,7 +86,7 @@ TEST fresh_boneh_franklin_ibe_setup_different_identities(
   ASSERT_EQ(status, CRYPTID_DECRYPTION_FAILED_ERROR);
 
   bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_destroy(ciphertext);
-  affineAsBinary_destroy(privateKey);
+  pairingGroupElementAsBinary_destroy(privateKey);
   free(masterSecret.masterSecret);
   bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_destroy(
       publicParameters);
@@ -96,6 +94,245 @@ TEST fresh_boneh_franklin_ibe_setup_different_identities(
   PASS();
 }
 
+TEST prepared_boneh_franklin_ibe_matching_identities(
+    const PairingGroupType pairingGroupType, const SecurityLevel securityLevel,
+    const char *const message, const char *const identity) {
+  // Given
+  BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary publicParameters;
+  BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary masterSecret;
+
+  CryptidStatus status = cryptid_ibe_bonehFranklin_setupForPairingGroup(
+      &masterSecret, &publicParameters, securityLevel, pairingGroupType);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  BonehFranklinIdentityBasedEncryptionPreparedPublicParameters prepared;
+  status = cryptid_ibe_bonehFranklin_prepare(&prepared, publicParameters);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  PairingGroupElementAsBinary privateKey;
+  status = cryptid_ibe_bonehFranklin_extractPrepared(
+      &privateKey, identity, strlen(identity), masterSecret, &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  BonehFranklinIdentityBasedEncryptionPreparedPrivateKey preparedPrivateKey;
+  status = cryptid_ibe_bonehFranklin_preparePrivateKey(&preparedPrivateKey,
+                                                       privateKey, &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  // When
+  BonehFranklinIdentityBasedEncryptionCiphertextAsBinary ciphertext;
+  status = cryptid_ibe_bonehFranklin_encryptPrepared(
+      &ciphertext, message, strlen(message), identity, strlen(identity),
+      &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  // Then
+  char *plaintext;
+  status = cryptid_ibe_bonehFranklin_decryptPrepared(
+      &plaintext, ciphertext, &preparedPrivateKey, &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+  ASSERT_EQ(strcmp(message, plaintext), 0);
+  free(plaintext);
+
+  status = cryptid_ibe_bonehFranklin_decrypt(&plaintext, ciphertext, privateKey,
+                                             publicParameters);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+  ASSERT_EQ(strcmp(message, plaintext), 0);
+  free(plaintext);
+
+  bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_destroy(ciphertext);
+  bonehFranklinIdentityBasedEncryptionPreparedPrivateKey_destroy(
+      preparedPrivateKey);
+  bonehFranklinIdentityBasedEncryptionPreparedPublicParameters_destroy(
+      prepared);
+  pairingGroupElementAsBinary_destroy(privateKey);
+  free(masterSecret.masterSecret);
+  bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_destroy(
+      publicParameters);
+
+  PASS();
+}
+
+TEST prepared_boneh_franklin_ibe_invalid_public_parameters(
+    const PairingGroupType pairingGroupType,
+    const SecurityLevel securityLevel) {
+  // Given
+  BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary publicParameters;
+  BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary masterSecret;
+
+  CryptidStatus status = cryptid_ibe_bonehFranklin_setupForPairingGroup(
+      &masterSecret, &publicParameters, securityLevel, pairingGroupType);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  // When
+  // An even q is not a prime.
+  ((unsigned char *)publicParameters.q)[publicParameters.qLength - 1] ^= 1;
+
+  // Then
+  BonehFranklinIdentityBasedEncryptionPreparedPublicParameters prepared;
+  status = cryptid_ibe_bonehFranklin_prepare(&prepared, publicParameters);
+
+  ASSERT_EQ(status, CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR);
+
+  free(masterSecret.masterSecret);
+  bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_destroy(
+      publicParameters);
+
+  PASS();
+}
+
+TEST prepared_identity_boneh_franklin_ibe_repeated_encryptions(
+    const PairingGroupType pairingGroupType, const SecurityLevel securityLevel,
+    const char *const message, const char *const identity) {
+  // Given
+  BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary publicParameters;
+  BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary masterSecret;
+
+  CryptidStatus status = cryptid_ibe_bonehFranklin_setupForPairingGroup(
+      &masterSecret, &publicParameters, securityLevel, pairingGroupType);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  BonehFranklinIdentityBasedEncryptionPreparedPublicParameters prepared;
+  status = cryptid_ibe_bonehFranklin_prepare(&prepared, publicParameters);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  PairingGroupElementAsBinary privateKey, otherPrivateKey;
+  status = cryptid_ibe_bonehFranklin_extractPrepared(
+      &privateKey, identity, strlen(identity), masterSecret, &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  status = cryptid_ibe_bonehFranklin_extractPrepared(
+      &otherPrivateKey, "Darth Plagueis", 14, masterSecret, &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  BonehFranklinIdentityBasedEncryptionPreparedIdentity preparedIdentity;
+  status = cryptid_ibe_bonehFranklin_prepareIdentity(
+      &preparedIdentity, identity, strlen(identity), &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  for (int i = 0; i < 2; i++) {
+    // When
+    BonehFranklinIdentityBasedEncryptionCiphertextAsBinary ciphertext;
+    status = cryptid_ibe_bonehFranklin_encryptToPreparedIdentity(
+        &ciphertext, message, strlen(message), &preparedIdentity, &prepared);
+
+    ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+    // Then
+    char *plaintext;
+    status = cryptid_ibe_bonehFranklin_decrypt(&plaintext, ciphertext,
+                                               privateKey, publicParameters);
+
+    ASSERT_EQ(status, CRYPTID_SUCCESS);
+    ASSERT_EQ(strcmp(message, plaintext), 0);
+    free(plaintext);
+
+    status = cryptid_ibe_bonehFranklin_decrypt(
+        &plaintext, ciphertext, otherPrivateKey, publicParameters);
+
+    ASSERT_EQ(status, CRYPTID_DECRYPTION_FAILED_ERROR);
+
+    bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_destroy(ciphertext);
+  }
+
+  bonehFranklinIdentityBasedEncryptionPreparedIdentity_destroy(
+      preparedIdentity);
+  bonehFranklinIdentityBasedEncryptionPreparedPublicParameters_destroy(
+      prepared);
+  pairingGroupElementAsBinary_destroy(privateKey);
+  pairingGroupElementAsBinary_destroy(otherPrivateKey);
+  free(masterSecret.masterSecret);
+  bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_destroy(
+      publicParameters);
+
+  PASS();
+}
+
+TEST bls12381_boneh_franklin_ibe_setup_unsupported_security_level(void) {
+  // Given
+  BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary publicParameters;
+  BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary masterSecret;
+
+  // When
+  CryptidStatus status = cryptid_ibe_bonehFranklin_setupForPairingGroup(
+      &masterSecret, &publicParameters, HIGH, pairingGroup_BLS12_381);
+
+  // Then
+  ASSERT_EQ(status, CRYPTID_SECURITY_LEVEL_NOT_SUPPORTED_ERROR);
+
+  PASS();
+}
+
+TEST boneh_franklin_ibe_private_key_of_other_group(const char *const message,
+                                                   const char *const identity) {
+  // Given
+  BonehFranklinIdentityBasedEncryptionPublicParametersAsBinary
+      publicParameters, otherPublicParameters;
+  BonehFranklinIdentityBasedEncryptionMasterSecretAsBinary masterSecret,
+      otherMasterSecret;
+
+  CryptidStatus status = cryptid_ibe_bonehFranklin_setupForPairingGroup(
+      &masterSecret, &publicParameters, LOWEST, pairingGroup_BLS12_381);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  status = cryptid_ibe_bonehFranklin_setup(&otherMasterSecret,
+                                           &otherPublicParameters, LOWEST);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  PairingGroupElementAsBinary otherPrivateKey;
+  status = cryptid_ibe_bonehFranklin_extract(
+      &otherPrivateKey, identity, strlen(identity), otherMasterSecret,
+      otherPublicParameters);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  BonehFranklinIdentityBasedEncryptionCiphertextAsBinary ciphertext;
+  status = cryptid_ibe_bonehFranklin_encrypt(
+      &ciphertext, message, strlen(message), identity, strlen(identity),
+      publicParameters);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  // When
+  char *plaintext;
+  status = cryptid_ibe_bonehFranklin_decrypt(&plaintext, ciphertext,
+                                             otherPrivateKey, publicParameters);
+
+  // Then
+  ASSERT_EQ(status, CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR);
+
+  status = cryptid_ibe_bonehFranklin_decrypt(
+      &plaintext, ciphertext, otherPrivateKey, otherPublicParameters);
+
+  ASSERT_EQ(status, CRYPTID_ILLEGAL_CIPHERTEXT_ERROR);
+
+  bonehFranklinIdentityBasedEncryptionCiphertextAsBinary_destroy(ciphertext);
+  pairingGroupElementAsBinary_destroy(otherPrivateKey);
+  free(masterSecret.masterSecret);
+  free(otherMasterSecret.masterSecret);
+  bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_destroy(
+      publicParameters);
+  bonehFranklinIdentityBasedEncryptionPublicParametersAsBinary_destroy(
+      otherPublicParameters);
+
+  PASS();
+}
+
 static void generateRandomString(char **output, const size_t outputLength,
                                  const char *const alphabet,
                                  const size_t alphabetSize) {
@@ -145,7 +382,7 @@ SUITE(cryptid_boneh_franklin_ibe_suite) {
                                strlen(defaultAlphabet));
 
           RUN_TESTp(fresh_boneh_franklin_ibe_setup_matching_identities,
-                    securityLevel, message, identity);
+                    pairingGroup_TYPE_1, securityLevel, message, identity);
 
           free(message);
           free(identity);
@@ -182,7 +419,8 @@ SUITE(cryptid_boneh_franklin_ibe_suite) {
           } while (strcmp(encryptIdentity, decryptIdentity) == 0);
 
           RUN_TESTp(fresh_boneh_franklin_ibe_setup_different_identities,
-                    securityLevel, message, encryptIdentity, decryptIdentity);
+                    pairingGroup_TYPE_1, securityLevel, message,
+                    encryptIdentity, decryptIdentity);
 
           free(message);
           free(encryptIdentity);
@@ -190,6 +428,68 @@ SUITE(cryptid_boneh_franklin_ibe_suite) {
         }
       }
     }
+
+    {
+      PairingGroupType pairingGroupTypes[] = {
+          pairingGroup_TYPE_1, pairingGroup_TYPE_1, pairingGroup_BLS12_381,
+          pairingGroup_BLS12_381};
+      SecurityLevel securityLevels[] = {LOWEST, LOW, LOWEST, MEDIUM};
+
+      for (int i = 0; i < 4; i++) {
+        if (isLowestQuickCheck && securityLevels[i] != LOWEST) {
+          continue;
+        }
+
+        char *message = malloc(101);
+        char *identity = malloc(101);
+        char *otherIdentity = malloc(101);
+
+        generateRandomString(&message, 101, defaultAlphabet,
+                             strlen(defaultAlphabet));
+        do {
+          generateRandomString(&identity, 101, defaultAlphabet,
+                               strlen(defaultAlphabet));
+          generateRandomString(&otherIdentity, 101, defaultAlphabet,
+                               strlen(defaultAlphabet));
+        } while (strcmp(identity, otherIdentity) == 0);
+
+        if (pairingGroupTypes[i] == pairingGroup_BLS12_381) {
+          RUN_TESTp(fresh_boneh_franklin_ibe_setup_matching_identities,
+                    pairingGroupTypes[i], securityLevels[i], message,
+                    identity);
+          RUN_TESTp(fresh_boneh_franklin_ibe_setup_different_identities,
+                    pairingGroupTypes[i], securityLevels[i], message,
+                    identity, otherIdentity);
+        }
+        RUN_TESTp(prepared_boneh_franklin_ibe_matching_identities,
+                  pairingGroupTypes[i], securityLevels[i], message, identity);
+        RUN_TESTp(prepared_boneh_franklin_ibe_invalid_public_parameters,
+                  pairingGroupTypes[i], securityLevels[i]);
+        RUN_TESTp(prepared_identity_boneh_franklin_ibe_repeated_encryptions,
+                  pairingGroupTypes[i], securityLevels[i], message, identity);
+
+        free(message);
+        free(identity);
+        free(otherIdentity);
+      }
+    }
+
+    {
+      char *message = malloc(101);
+      char *identity = malloc(101);
+
+      generateRandomString(&message, 101, defaultAlphabet,
+                           strlen(defaultAlphabet));
+      generateRandomString(&identity, 101, defaultAlphabet,
+                           strlen(defaultAlphabet));
+
+      RUN_TEST(bls12381_boneh_franklin_ibe_setup_unsupported_security_level);
+      RUN_TESTp(boneh_franklin_ibe_private_key_of_other_group, message,
+                identity);
+
+      free(message);
+      free(identity);
+    }
   }
 }
 
@@ -291,6 +291,130 @@ SUITE(modulo_multiplication_with_scalar_suite) {
   RUN_TESTp(GF_5_modMul_should_just_work, 4, 3, 2);
 }
 
+TEST modMul_should_match_the_schoolbook_product(const long p) {
+  // Given
+  mpz_t modulus;
+  mpz_init_set_si(modulus, p);
+
+  for (long a = -1; a < p; ++a) {
+    for (long b = 0; b < p; ++b) {
+      Complex x, y, result, expected;
+      complex_initLong(&x, a, b);
+      complex_initLong(&y, b + 2, a);
+      complex_initLong(&expected, (((a * (b + 2) - b * a) % p) + p) % p,
+                       (((b * (b + 2) + a * a) % p) + p) % p);
+
+      // When
+      complex_modMul(&result, x, y, modulus);
+
+      // Then
+      ASSERT(complex_isEquals(result, expected));
+
+      complex_destroyMany(4, x, y, result, expected);
+    }
+  }
+
+  mpz_clear(modulus);
+
+  PASS();
+}
+
+TEST modSquare_should_match_modMul(const long p) {
+  // Given
+  mpz_t modulus;
+  mpz_init_set_si(modulus, p);
+
+  for (long a = -1; a < p; ++a) {
+    for (long b = 0; b < p; ++b) {
+      Complex x, result, expected;
+      complex_initLong(&x, a, b);
+      complex_modMul(&expected, x, x, modulus);
+
+      // When
+      complex_modSquare(&result, x, modulus);
+
+      // Then
+      ASSERT(complex_isEquals(result, expected));
+
+      complex_destroyMany(3, x, result, expected);
+    }
+  }
+
+  mpz_clear(modulus);
+
+  PASS();
+}
+
+TEST into_variants_should_allow_the_result_to_alias_an_operand(
+    const long p) {
+  // Given
+  mpz_t modulus, exponent;
+  mpz_init_set_si(modulus, p);
+  mpz_init_set_si(exponent, p + 2);
+
+  for (long a = 0; a < p; ++a) {
+    for (long b = 0; b < p; ++b) {
+      Complex x, y, expected;
+      complex_initLong(&x, a, b);
+      complex_initLong(&y, b + 2, a);
+
+      // When
+      complex_modMul(&expected, x, y, modulus);
+      complex_modMulInto(&x, &x, &y, modulus);
+
+      // Then
+      ASSERT(complex_isEquals(x, expected));
+      complex_destroy(expected);
+
+      // When
+      complex_modSquare(&expected, y, modulus);
+      complex_modSquareInto(&y, &y, modulus);
+
+      // Then
+      ASSERT(complex_isEquals(y, expected));
+      complex_destroy(expected);
+
+      // When
+      complex_modAdd(&expected, x, y, modulus);
+      complex_modAddInto(&y, &x, &y, modulus);
+
+      // Then
+      ASSERT(complex_isEquals(y, expected));
+      complex_destroy(expected);
+
+      // When
+      complex_modMulInteger(&expected, exponent, x, modulus);
+      complex_modMulIntegerInto(&x, exponent, &x, modulus);
+
+      // Then
+      ASSERT(complex_isEquals(x, expected));
+      complex_destroy(expected);
+
+      // When
+      complex_modPow(&expected, x, exponent, modulus);
+      complex_modPowInto(&x, &x, exponent, modulus);
+
+      // Then
+      ASSERT(complex_isEquals(x, expected));
+
+      complex_destroyMany(3, x, y, expected);
+    }
+  }
+
+  mpz_clears(modulus, exponent, NULL);
+
+  PASS();
+}
+
+SUITE(modulo_multiplication_suite) {
+  RUN_TESTp(modMul_should_match_the_schoolbook_product, 7);
+  RUN_TESTp(modMul_should_match_the_schoolbook_product, 131);
+  RUN_TESTp(modSquare_should_match_modMul, 7);
+  RUN_TESTp(modSquare_should_match_modMul, 131);
+  RUN_TESTp(into_variants_should_allow_the_result_to_alias_an_operand, 7);
+  RUN_TESTp(into_variants_should_allow_the_result_to_alias_an_operand, 131);
+}
+
 TEST the_multiplicative_inverse_of_1_0_should_be_1_0_for_any_p(void) {
   // Given
   mpz_t p;
@@ -391,6 +515,7 @@ int main(int argc, char **argv) {
   RUN_SUITE(additive_inverse_suite);
   RUN_SUITE(modulo_power_suite);
   RUN_SUITE(modulo_multiplication_with_scalar_suite);
+  RUN_SUITE(modulo_multiplication_suite);
   RUN_SUITE(multiplicative_inverse_suite);
 
   GREATEST_MAIN_END();
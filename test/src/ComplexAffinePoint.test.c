@@ -103,6 +103,26 @@ TEST adding_a_point_to_itself_with_y_equals_to_zero_should_yield_infinity(
   PASS();
 }
 
+TEST infinity_should_keep_the_sentinel_coordinates(void) {
+  // Given
+  ComplexAffinePoint infty = complexAffine_infinity();
+  ComplexAffinePoint sentinel, point;
+  complexAffine_initLong(&sentinel, -1, 0, -1, 0);
+  complexAffine_initLong(&point, -1, 1, -1, 0);
+
+  // Then
+  ASSERT(complexAffine_isInfinity(infty));
+  ASSERT(complexAffine_isInfinity(sentinel));
+  ASSERT(!complexAffine_isInfinity(point));
+  ASSERT(complexAffine_isEquals(infty, sentinel));
+
+  complexAffine_destroy(infty);
+  complexAffine_destroy(sentinel);
+  complexAffine_destroy(point);
+
+  PASS();
+}
+
 TEST adding_infinity_to_infinity_should_result_in_infinity(void) {
   // Given
   ComplexAffinePoint infty = complexAffine_infinity();
@@ -204,6 +224,7 @@ TEST addition_on_non_special_cases_should_work_correctly(
 SUITE(addition_suite) {
   RUN_TEST(
       adding_a_point_to_itself_with_y_equals_to_zero_should_yield_infinity);
+  RUN_TEST(infinity_should_keep_the_sentinel_coordinates);
   RUN_TEST(adding_infinity_to_infinity_should_result_in_infinity);
   RUN_TEST(infinity_should_act_as_the_identity_element_for_addition);
 
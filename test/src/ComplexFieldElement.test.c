@@ -0,0 +1,109 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+
+#include "complex/Complex.h"
+#include "complex/ComplexFieldElement.h"
+#include "field/MontgomeryContext.h"
+
+TEST arithmetic_should_agree_with_the_canonical_one(const long p) {
+  // Given
+  mpz_t modulus, exponent;
+  mpz_init_set_si(modulus, p);
+  mpz_init_set_si(exponent, p + 2);
+
+  MontgomeryContext montgomeryContext;
+  montgomeryContext_init(&montgomeryContext, modulus);
+  const size_t n = montgomeryContext.limbCount;
+
+  for (long a = 0; a < p; ++a) {
+    for (long b = 0; b < p; ++b) {
+      Complex x, y, expected, result;
+      complex_initLong(&x, a, b);
+      complex_initLong(&y, b, a + 1);
+
+      mp_limb_t limbs[6 * n];
+      ComplexFieldElement xElement =
+          complexFieldElement_view(limbs, &montgomeryContext);
+      ComplexFieldElement yElement =
+          complexFieldElement_view(limbs + 2 * n, &montgomeryContext);
+      ComplexFieldElement resultElement =
+          complexFieldElement_view(limbs + 4 * n, &montgomeryContext);
+      complexFieldElement_fromComplex(&xElement, x, &montgomeryContext);
+      complexFieldElement_fromComplex(&yElement, y, &montgomeryContext);
+
+      // When
+      complexFieldElement_mul(&resultElement, &xElement, &yElement,
+                              &montgomeryContext);
+      complexFieldElement_toComplex(&result, &resultElement,
+                                    &montgomeryContext);
+
+      // Then
+      complex_modMul(&expected, x, y, modulus);
+      ASSERT_EQ(complex_isEquals(result, expected), CRYPTID_EQUAL);
+      complex_destroyMany(2, expected, result);
+
+      // When
+      complexFieldElement_square(&resultElement, &xElement,
+                                 &montgomeryContext);
+      complexFieldElement_toComplex(&result, &resultElement,
+                                    &montgomeryContext);
+
+      // Then
+      complex_modSquare(&expected, x, modulus);
+      ASSERT_EQ(complex_isEquals(result, expected), CRYPTID_EQUAL);
+      complex_destroyMany(2, expected, result);
+
+      // When
+      complexFieldElement_pow(&resultElement, &xElement, exponent,
+                              &montgomeryContext);
+      complexFieldElement_toComplex(&result, &resultElement,
+                                    &montgomeryContext);
+
+      // Then
+      complex_modPow(&expected, x, exponent, modulus);
+      ASSERT_EQ(complex_isEquals(result, expected), CRYPTID_EQUAL);
+      complex_destroyMany(2, expected, result);
+
+      // When
+      CryptidStatus status = complexFieldElement_invert(
+          &resultElement, &xElement, &montgomeryContext);
+
+      // Then
+      if (a || b) {
+        ASSERT_EQ(status, CRYPTID_SUCCESS);
+        complexFieldElement_toComplex(&result, &resultElement,
+                                      &montgomeryContext);
+        complex_multiplicativeInverse(&expected, x, modulus);
+        ASSERT_EQ(complex_isEquals(result, expected), CRYPTID_EQUAL);
+        complex_destroyMany(2, expected, result);
+      } else {
+        ASSERT_EQ(status, CRYPTID_HAS_NO_MUL_INV_ERROR);
+      }
+
+      complex_destroyMany(2, x, y);
+    }
+  }
+
+  montgomeryContext_destroy(montgomeryContext);
+  mpz_clears(modulus, exponent, NULL);
+
+  PASS();
+}
+
+SUITE(arithmetic_suite) {
+  RUN_TESTp(arithmetic_should_agree_with_the_canonical_one, 7);
+  RUN_TESTp(arithmetic_should_agree_with_the_canonical_one, 131);
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(arithmetic_suite);
+
+  GREATEST_MAIN_END();
+}
@@ -0,0 +1,142 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+
+#include "complex/ComplexFieldElement.h"
+#include "elliptic/EllipticCurve.h"
+#include "elliptic/EllipticCurveContext.h"
+
+TEST derived_constants_should_be_computed(void) {
+  // Given
+  mpz_t subgroupOrder, value;
+  mpz_init_set_ui(subgroupOrder, 11);
+  mpz_init(value);
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 131);
+
+  // When
+  EllipticCurveContext context;
+  CryptidStatus status =
+      ellipticCurveContext_init(&context, ec, subgroupOrder);
+
+  // Then
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  // \f$\frac{2 \cdot 131 - 1}{3} = 87\f$
+  ASSERT_EQ(mpz_cmp_ui(context.cubeRootExponent, 87), 0);
+  // \f$\frac{131 + 1}{11} = 12\f$
+  ASSERT_EQ(mpz_cmp_ui(context.cofactor, 12), 0);
+  ASSERT_EQ(mpz_cmp_ui(context.minusThree, 128), 0);
+
+  // The NAF of 11 is \f$(1, 0, -1, 0, -1)\f$.
+  ASSERT_EQ(context.subgroupOrderDigitCount, 5);
+  const signed char expectedDigits[] = {-1, 0, -1, 0, 1};
+  for (size_t i = 0; i < 5; ++i) {
+    ASSERT_EQ(context.subgroupOrderDigits[i], expectedDigits[i]);
+  }
+
+  // The digits of the cofactor add up to 12.
+  long cofactor = 0;
+  for (size_t i = context.cofactorDigitCount; i-- > 0;) {
+    cofactor = 2 * cofactor + context.cofactorDigits[i];
+  }
+  ASSERT_EQ(cofactor, 12);
+
+  // \f$\xi = 65 + 65 \cdot 3^{33}i = 65 + 112i\f$
+  fieldElement_toMpz(value, context.xi.real, &context.montgomeryContext);
+  ASSERT_EQ(mpz_cmp_ui(value, 65), 0);
+  fieldElement_toMpz(value, context.xi.imaginary, &context.montgomeryContext);
+  ASSERT_EQ(mpz_cmp_ui(value, 112), 0);
+
+  ellipticCurveContext_destroy(context);
+  ellipticCurve_destroy(ec);
+  mpz_clears(subgroupOrder, value, NULL);
+
+  PASS();
+}
+
+TEST xi_should_be_a_cube_root_of_unity(const char *const p,
+                                       const char *const q) {
+  // Given
+  mpz_t fieldOrder, subgroupOrder, zero, one;
+  mpz_init_set_str(fieldOrder, p, 16);
+  mpz_init_set_str(subgroupOrder, q, 16);
+  mpz_init_set_ui(zero, 0);
+  mpz_init_set_ui(one, 1);
+  EllipticCurve ec;
+  ellipticCurve_init(&ec, zero, one, fieldOrder);
+
+  EllipticCurveContext context;
+  ASSERT_EQ(ellipticCurveContext_init(&context, ec, subgroupOrder),
+            CRYPTID_SUCCESS);
+  const MontgomeryContext *montgomeryContext = &context.montgomeryContext;
+
+  // When
+  mp_limb_t limbs[4 * montgomeryContext->limbCount];
+  ComplexFieldElement cube = complexFieldElement_view(limbs, montgomeryContext);
+  ComplexFieldElement expected = complexFieldElement_view(
+      limbs + 2 * montgomeryContext->limbCount, montgomeryContext);
+  complexFieldElement_square(&cube, &context.xi, montgomeryContext);
+  complexFieldElement_mul(&cube, &cube, &context.xi, montgomeryContext);
+
+  // Then
+  // The distortion map \f$(x, y) \mapsto (\xi x, y)\f$ keeps the points on
+  // \f$y^2 = x^3 + 1\f$ if and only if \f$\xi^3 = 1\f$.
+  complexFieldElement_setOne(&expected, montgomeryContext);
+  ASSERT(fieldElement_isEquals(cube.real, expected.real, montgomeryContext));
+  ASSERT(fieldElement_isEquals(cube.imaginary, expected.imaginary,
+                               montgomeryContext));
+
+  ellipticCurveContext_destroy(context);
+  ellipticCurve_destroy(ec);
+  mpz_clears(fieldOrder, subgroupOrder, zero, one, NULL);
+
+  PASS();
+}
+
+TEST too_large_fields_should_not_be_supported(void) {
+  // Given
+  mpz_t fieldOrder, subgroupOrder, zero, one;
+  mpz_init(fieldOrder);
+  mpz_setbit(fieldOrder, FIELDELEMENT_MAX_BITS);
+  mpz_add_ui(fieldOrder, fieldOrder, 1);
+  mpz_init_set_ui(subgroupOrder, 11);
+  mpz_init_set_ui(zero, 0);
+  mpz_init_set_ui(one, 1);
+  EllipticCurve ec;
+  ellipticCurve_init(&ec, zero, one, fieldOrder);
+
+  // When
+  EllipticCurveContext context;
+  CryptidStatus status =
+      ellipticCurveContext_init(&context, ec, subgroupOrder);
+
+  // Then
+  ASSERT_EQ(status, CRYPTID_FIELD_SIZE_NOT_SUPPORTED_ERROR);
+
+  ellipticCurve_destroy(ec);
+  mpz_clears(fieldOrder, subgroupOrder, zero, one, NULL);
+
+  PASS();
+}
+
+SUITE(context_suite) {
+  RUN_TEST(derived_constants_should_be_computed);
+  RUN_TESTp(xi_should_be_a_cube_root_of_unity, "83", "b");
+  RUN_TESTp(xi_should_be_a_cube_root_of_unity,
+            "bffffffffffffffffffffffffffcffff3",
+            "fffffffffffffffffffffffffffbffff");
+  RUN_TEST(too_large_fields_should_not_be_supported);
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(context_suite);
+
+  GREATEST_MAIN_END();
+}
@@ -0,0 +1,109 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "greatest.h"
+
+#include "elliptic/EllipticCurve.h"
+#include "elliptic/EllipticCurveContextCache.h"
+
+// Acquires the context of \f$y^2 = x^3 + 1\f$ over \f$F_{131}\f$ with the
+// given subgroup order.
+static const EllipticCurveContext *
+acquireContext(const unsigned long subgroupOrder) {
+  mpz_t q;
+  mpz_init_set_ui(q, subgroupOrder);
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 131);
+
+  const EllipticCurveContext *context;
+  assert(ellipticCurveContextCache_acquire(&context, ec, q) ==
+         CRYPTID_SUCCESS);
+
+  ellipticCurve_destroy(ec);
+  mpz_clear(q);
+
+  return context;
+}
+
+TEST same_curve_should_share_the_context(void) {
+  // Given
+  ellipticCurveContextCache_flush();
+
+  // When
+  const EllipticCurveContext *context = acquireContext(11);
+  const EllipticCurveContext *sameContext = acquireContext(11);
+  const EllipticCurveContext *otherContext = acquireContext(12);
+
+  // Then
+  ASSERT_EQ(context, sameContext);
+  ASSERT(context != otherContext);
+  ASSERT_EQ(mpz_cmp_ui(context->subgroupOrder, 11), 0);
+  ASSERT_EQ(mpz_cmp_ui(otherContext->subgroupOrder, 12), 0);
+
+  ellipticCurveContextCache_release(context);
+  ellipticCurveContextCache_release(sameContext);
+  ellipticCurveContextCache_release(otherContext);
+
+  PASS();
+}
+
+TEST acquired_context_should_outlive_flush(void) {
+  // Given
+  ellipticCurveContextCache_flush();
+  const EllipticCurveContext *context = acquireContext(11);
+
+  // When
+  ellipticCurveContextCache_flush();
+  const EllipticCurveContext *newContext = acquireContext(11);
+
+  // Then
+  ASSERT(context != newContext);
+  ASSERT_EQ(mpz_cmp_ui(context->cofactor, 12), 0);
+  ASSERT_EQ(mpz_cmp_ui(newContext->cofactor, 12), 0);
+
+  ellipticCurveContextCache_release(context);
+  ellipticCurveContextCache_release(newContext);
+
+  PASS();
+}
+
+TEST acquired_context_should_outlive_eviction(void) {
+  // Given
+  ellipticCurveContextCache_flush();
+  const EllipticCurveContext *context = acquireContext(11);
+
+  // When
+  for (unsigned long i = 1; i <= ELLIPTIC_CURVE_CONTEXT_CACHE_CAPACITY; i++) {
+    ellipticCurveContextCache_release(acquireContext(11 + i));
+  }
+  const EllipticCurveContext *newContext = acquireContext(11);
+
+  // Then
+  ASSERT(context != newContext);
+  ASSERT_EQ(mpz_cmp_ui(context->cofactor, 12), 0);
+  ASSERT_EQ(mpz_cmp_ui(newContext->cofactor, 12), 0);
+
+  ellipticCurveContextCache_release(context);
+  ellipticCurveContextCache_release(newContext);
+  ellipticCurveContextCache_flush();
+
+  PASS();
+}
+
+SUITE(elliptic_curve_context_cache_suite) {
+  RUN_TEST(same_curve_should_share_the_context);
+  RUN_TEST(acquired_context_should_outlive_flush);
+  RUN_TEST(acquired_context_should_outlive_eviction);
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(elliptic_curve_context_cache_suite);
+
+  GREATEST_MAIN_END();
+}
@@ -0,0 +1,193 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+
+#include "field/FieldElement.h"
+#include "field/MontgomeryContext.h"
+
+TEST arithmetic_should_agree_with_the_canonical_one(const int bits) {
+  // Given
+  // \f$2^{bits} - 1\f$ is odd and spans exactly the specialized limb count.
+  mpz_t modulus, a, b, result, expected;
+  mpz_inits(modulus, a, b, result, expected, NULL);
+  mpz_setbit(modulus, bits);
+  mpz_sub_ui(modulus, modulus, 1);
+
+  MontgomeryContext montgomeryContext;
+  montgomeryContext_init(&montgomeryContext, modulus);
+  ASSERT_EQ(fieldElement_checkSupported(&montgomeryContext), CRYPTID_SUCCESS);
+
+  const size_t n = montgomeryContext.limbCount;
+  mp_limb_t aElement[n], bElement[n], resultElement[n];
+
+  // Pseudorandom operands from a simple quadratic recurrence.
+  mpz_set_ui(a, 2);
+  mpz_set_ui(b, 3);
+
+  for (int i = 0; i < 100; ++i) {
+    mpz_mul(a, a, a);
+    mpz_add_ui(a, a, 7);
+    mpz_mod(a, a, modulus);
+    mpz_mul(b, b, a);
+    mpz_add_ui(b, b, 11);
+    mpz_mod(b, b, modulus);
+    fieldElement_fromMpz(aElement, a, &montgomeryContext);
+    fieldElement_fromMpz(bElement, b, &montgomeryContext);
+
+    // When
+    fieldElement_mul(resultElement, aElement, bElement, &montgomeryContext);
+    fieldElement_toMpz(result, resultElement, &montgomeryContext);
+
+    // Then
+    mpz_mul(expected, a, b);
+    mpz_mod(expected, expected, modulus);
+    ASSERT_EQ(mpz_cmp(result, expected), 0);
+
+    // When
+    fieldElement_square(resultElement, aElement, &montgomeryContext);
+    fieldElement_toMpz(result, resultElement, &montgomeryContext);
+
+    // Then
+    mpz_mul(expected, a, a);
+    mpz_mod(expected, expected, modulus);
+    ASSERT_EQ(mpz_cmp(result, expected), 0);
+
+    // When
+    fieldElement_add(resultElement, aElement, bElement, &montgomeryContext);
+    fieldElement_toMpz(result, resultElement, &montgomeryContext);
+
+    // Then
+    mpz_add(expected, a, b);
+    mpz_mod(expected, expected, modulus);
+    ASSERT_EQ(mpz_cmp(result, expected), 0);
+
+    // When
+    fieldElement_sub(resultElement, aElement, bElement, &montgomeryContext);
+    fieldElement_toMpz(result, resultElement, &montgomeryContext);
+
+    // Then
+    mpz_sub(expected, a, b);
+    mpz_mod(expected, expected, modulus);
+    ASSERT_EQ(mpz_cmp(result, expected), 0);
+
+    // When
+    CryptidStatus status =
+        fieldElement_invert(resultElement, aElement, &montgomeryContext);
+
+    // Then
+    if (mpz_invert(expected, a, modulus)) {
+      ASSERT_EQ(status, CRYPTID_SUCCESS);
+      fieldElement_toMpz(result, resultElement, &montgomeryContext);
+      ASSERT_EQ(mpz_cmp(result, expected), 0);
+    } else {
+      ASSERT_EQ(status, CRYPTID_HAS_NO_MUL_INV_ERROR);
+    }
+  }
+
+  montgomeryContext_destroy(montgomeryContext);
+  mpz_clears(modulus, a, b, result, expected, NULL);
+
+  PASS();
+}
+
+TEST aliased_operands_should_be_handled(void) {
+  // Given
+  mpz_t modulus, value, result;
+  mpz_init_set_ui(modulus, 131);
+  mpz_init_set_ui(value, 100);
+  mpz_init(result);
+
+  MontgomeryContext montgomeryContext;
+  montgomeryContext_init(&montgomeryContext, modulus);
+
+  mp_limb_t element[montgomeryContext.limbCount];
+  fieldElement_fromMpz(element, value, &montgomeryContext);
+
+  // When
+  fieldElement_mul(element, element, element, &montgomeryContext);
+  fieldElement_add(element, element, element, &montgomeryContext);
+  fieldElement_negate(element, element, &montgomeryContext);
+  fieldElement_toMpz(result, element, &montgomeryContext);
+
+  // Then
+  // \f$-(2 \cdot 100^2) \mod 131 = 43\f$
+  ASSERT_EQ(mpz_cmp_ui(result, 43), 0);
+
+  montgomeryContext_destroy(montgomeryContext);
+  mpz_clears(modulus, value, result, NULL);
+
+  PASS();
+}
+
+TEST zero_does_not_have_a_multiplicative_inverse(void) {
+  // Given
+  mpz_t modulus;
+  mpz_init_set_ui(modulus, 131);
+
+  MontgomeryContext montgomeryContext;
+  montgomeryContext_init(&montgomeryContext, modulus);
+
+  const size_t n = montgomeryContext.limbCount;
+  mp_limb_t zero[n], result[n];
+  fieldElement_setZero(zero, &montgomeryContext);
+
+  // When
+  CryptidStatus status =
+      fieldElement_invert(result, zero, &montgomeryContext);
+
+  // Then
+  ASSERT_EQ(status, CRYPTID_HAS_NO_MUL_INV_ERROR);
+
+  montgomeryContext_destroy(montgomeryContext);
+  mpz_clear(modulus);
+
+  PASS();
+}
+
+TEST too_large_fields_should_not_be_supported(void) {
+  // Given
+  mpz_t modulus;
+  mpz_init(modulus);
+  mpz_setbit(modulus, FIELDELEMENT_MAX_BITS);
+  mpz_add_ui(modulus, modulus, 1);
+
+  MontgomeryContext montgomeryContext;
+  montgomeryContext_init(&montgomeryContext, modulus);
+
+  // When
+  CryptidStatus status = fieldElement_checkSupported(&montgomeryContext);
+
+  // Then
+  ASSERT_EQ(status, CRYPTID_FIELD_SIZE_NOT_SUPPORTED_ERROR);
+
+  montgomeryContext_destroy(montgomeryContext);
+  mpz_clear(modulus);
+
+  PASS();
+}
+
+SUITE(arithmetic_suite) {
+  RUN_TESTp(arithmetic_should_agree_with_the_canonical_one, 320);
+  RUN_TESTp(arithmetic_should_agree_with_the_canonical_one, 512);
+  RUN_TESTp(arithmetic_should_agree_with_the_canonical_one, 1024);
+  RUN_TESTp(arithmetic_should_agree_with_the_canonical_one, 1536);
+  RUN_TESTp(arithmetic_should_agree_with_the_canonical_one, 3840);
+  RUN_TESTp(arithmetic_should_agree_with_the_canonical_one, 7680);
+  RUN_TEST(aliased_operands_should_be_handled);
+  RUN_TEST(zero_does_not_have_a_multiplicative_inverse);
+}
+
+SUITE(support_suite) { RUN_TEST(too_large_fields_should_not_be_supported); }
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(arithmetic_suite);
+  RUN_SUITE(support_suite);
+
+  GREATEST_MAIN_END();
+}
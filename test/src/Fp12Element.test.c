@@ -0,0 +1,174 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+
+#include "bls12-381/Bls12381Context.h"
+#include "bls12-381/Fp12Element.h"
+#include "util/WindowedNaf.h"
+
+static void fp12FromSeed(Fp12Element *result, const long seed,
+                         const MontgomeryContext *montgomeryContext) {
+  ComplexFieldElement *coefficients[6] = {
+      &result->c0.c0, &result->c0.c1, &result->c0.c2,
+      &result->c1.c0, &result->c1.c1, &result->c1.c2};
+
+  mpz_t value;
+  mpz_init(value);
+
+  for (int i = 0; i < 6; ++i) {
+    mpz_set_si(value, seed * (2 * i + 1) + i * i);
+    fieldElement_fromMpz(coefficients[i]->real, value, montgomeryContext);
+    mpz_set_si(value, seed * (2 * i + 2) - i);
+    fieldElement_fromMpz(coefficients[i]->imaginary, value,
+                         montgomeryContext);
+  }
+
+  mpz_clear(value);
+}
+
+static void fp12Pow(Fp12Element *power, const Fp12Element *base,
+                    const mpz_t exponent,
+                    const MontgomeryContext *montgomeryContext) {
+  mp_limb_t limbs[12 * montgomeryContext->limbCount];
+  Fp12Element result = fp12Element_view(limbs, montgomeryContext);
+  fp12Element_setOne(&result, montgomeryContext);
+
+  for (size_t i = mpz_sizeinbase(exponent, 2); i-- > 0;) {
+    fp12Element_square(&result, &result, montgomeryContext);
+    if (mpz_tstbit(exponent, i)) {
+      fp12Element_mul(&result, &result, base, montgomeryContext);
+    }
+  }
+
+  fp12Element_copy(power, &result, montgomeryContext);
+}
+
+TEST arithmetic_should_satisfy_the_field_axioms(const long seed) {
+  // Given
+  Bls12381Context context;
+  ASSERT_EQ(bls12381Context_init(&context), CRYPTID_SUCCESS);
+  const MontgomeryContext *montgomeryContext = &context.montgomeryContext;
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[5 * 12 * n];
+  Fp12Element a = fp12Element_view(limbs, montgomeryContext);
+  Fp12Element b = fp12Element_view(limbs + 12 * n, montgomeryContext);
+  Fp12Element one = fp12Element_view(limbs + 24 * n, montgomeryContext);
+  Fp12Element left = fp12Element_view(limbs + 36 * n, montgomeryContext);
+  Fp12Element right = fp12Element_view(limbs + 48 * n, montgomeryContext);
+  fp12FromSeed(&a, seed, montgomeryContext);
+  fp12FromSeed(&b, seed + 5, montgomeryContext);
+  fp12Element_setOne(&one, montgomeryContext);
+
+  // When
+  fp12Element_square(&left, &a, montgomeryContext);
+  fp12Element_mul(&right, &a, &a, montgomeryContext);
+
+  // Then
+  ASSERT(fp12Element_isEquals(&left, &right, montgomeryContext));
+
+  // When
+  fp12Element_mul(&left, &a, &b, montgomeryContext);
+  fp12Element_mul(&right, &b, &a, montgomeryContext);
+
+  // Then
+  ASSERT(fp12Element_isEquals(&left, &right, montgomeryContext));
+
+  // When
+  ASSERT_EQ(fp12Element_invert(&left, &a, montgomeryContext),
+            CRYPTID_SUCCESS);
+  fp12Element_mul(&left, &left, &a, montgomeryContext);
+
+  // Then
+  ASSERT(fp12Element_isEquals(&left, &one, montgomeryContext));
+
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST frobenius_should_raise_to_the_field_order(const long seed) {
+  // Given
+  Bls12381Context context;
+  ASSERT_EQ(bls12381Context_init(&context), CRYPTID_SUCCESS);
+  const MontgomeryContext *montgomeryContext = &context.montgomeryContext;
+
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[3 * 12 * n];
+  Fp12Element a = fp12Element_view(limbs, montgomeryContext);
+  Fp12Element result = fp12Element_view(limbs + 12 * n, montgomeryContext);
+  Fp12Element expected = fp12Element_view(limbs + 24 * n, montgomeryContext);
+  fp12FromSeed(&a, seed, montgomeryContext);
+
+  // When
+  fp12Element_frobenius(&result, &a, context.frobeniusCoefficients,
+                        montgomeryContext);
+
+  // Then
+  fp12Pow(&expected, &a, context.fieldOrder, montgomeryContext);
+  ASSERT(fp12Element_isEquals(&result, &expected, montgomeryContext));
+
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST pow_digits_should_agree_with_square_and_multiply(const int windowSize) {
+  // Given
+  Bls12381Context context;
+  ASSERT_EQ(bls12381Context_init(&context), CRYPTID_SUCCESS);
+  const MontgomeryContext *montgomeryContext = &context.montgomeryContext;
+
+  // \f$\frac{\bar{a}}{a}\f$ lies in the cyclotomic subgroup.
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[4 * 12 * n];
+  Fp12Element a = fp12Element_view(limbs, montgomeryContext);
+  Fp12Element inverse = fp12Element_view(limbs + 12 * n, montgomeryContext);
+  Fp12Element result = fp12Element_view(limbs + 24 * n, montgomeryContext);
+  Fp12Element expected = fp12Element_view(limbs + 36 * n, montgomeryContext);
+  fp12FromSeed(&a, 3, montgomeryContext);
+  ASSERT_EQ(fp12Element_invert(&inverse, &a, montgomeryContext),
+            CRYPTID_SUCCESS);
+  fp12Element_conjugate(&a, &a, montgomeryContext);
+  fp12Element_mul(&a, &a, &inverse, montgomeryContext);
+
+  signed char *digits =
+      (signed char *)malloc(windowedNaf_maxLength(context.groupOrder));
+  const size_t digitCount =
+      windowedNaf_recode(digits, context.groupOrder, windowSize);
+
+  // When
+  fp12Element_powDigits(&result, &a, digits, digitCount, windowSize,
+                        montgomeryContext);
+
+  // Then
+  fp12Pow(&expected, &a, context.groupOrder, montgomeryContext);
+  ASSERT(fp12Element_isEquals(&result, &expected, montgomeryContext));
+
+  free(digits);
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+SUITE(fp12_element_suite) {
+  RUN_TESTp(arithmetic_should_satisfy_the_field_axioms, 1);
+  RUN_TESTp(arithmetic_should_satisfy_the_field_axioms, 7919);
+  RUN_TESTp(frobenius_should_raise_to_the_field_order, 1);
+  RUN_TESTp(frobenius_should_raise_to_the_field_order, 7919);
+  RUN_TESTp(pow_digits_should_agree_with_square_and_multiply, 2);
+  RUN_TESTp(pow_digits_should_agree_with_square_and_multiply,
+            FP12ELEMENT_MAX_WINDOW_SIZE);
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(fp12_element_suite);
+
+  GREATEST_MAIN_END();
+}
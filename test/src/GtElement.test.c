@@ -0,0 +1,128 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+
+#include "complex/ComplexFieldElement.h"
+#include "complex/GtElement.h"
+#include "field/MontgomeryContext.h"
+
+static int isEquals(const ComplexFieldElement *element1,
+                    const ComplexFieldElement *element2,
+                    const MontgomeryContext *montgomeryContext) {
+  return fieldElement_isEquals(element1->real, element2->real,
+                               montgomeryContext) &&
+         fieldElement_isEquals(element1->imaginary, element2->imaginary,
+                               montgomeryContext);
+}
+
+TEST arithmetic_should_agree_with_the_general_one(const long p) {
+  // Given
+  mpz_t modulus, exponent, absoluteExponent;
+  mpz_init_set_si(modulus, p);
+  mpz_inits(exponent, absoluteExponent, NULL);
+
+  MontgomeryContext montgomeryContext;
+  montgomeryContext_init(&montgomeryContext, modulus);
+  const size_t n = montgomeryContext.limbCount;
+
+  for (long a = 1; a < p; ++a) {
+    Complex x;
+    complex_initLong(&x, a, a + 1);
+
+    // \f$\frac{\bar{x}}{x}\f$ has norm 1.
+    mp_limb_t limbs[10 * n];
+    ComplexFieldElement inverse =
+        complexFieldElement_view(limbs, &montgomeryContext);
+    ComplexFieldElement expected =
+        complexFieldElement_view(limbs + 2 * n, &montgomeryContext);
+    ComplexFieldElement one =
+        complexFieldElement_view(limbs + 4 * n, &montgomeryContext);
+    GtElement element = gtElement_view(limbs + 6 * n, &montgomeryContext);
+    GtElement result = gtElement_view(limbs + 8 * n, &montgomeryContext);
+    complexFieldElement_fromComplex(&element.value, x, &montgomeryContext);
+    ASSERT_EQ(complexFieldElement_invert(&inverse, &element.value,
+                                         &montgomeryContext),
+              CRYPTID_SUCCESS);
+    complexFieldElement_conjugate(&element.value, &element.value,
+                                  &montgomeryContext);
+    complexFieldElement_mul(&element.value, &element.value, &inverse,
+                            &montgomeryContext);
+    complexFieldElement_setOne(&one, &montgomeryContext);
+
+    // When
+    gtElement_square(&result, &element, &montgomeryContext);
+
+    // Then
+    complexFieldElement_square(&expected, &element.value, &montgomeryContext);
+    ASSERT(isEquals(&result.value, &expected, &montgomeryContext));
+
+    // When
+    gtElement_inverse(&result, &element, &montgomeryContext);
+    gtElement_mul(&result, &result, &element, &montgomeryContext);
+
+    // Then
+    ASSERT(isEquals(&result.value, &one, &montgomeryContext));
+
+    for (long e = -200; e <= 200; e += 7) {
+      mpz_set_si(exponent, e);
+      mpz_abs(absoluteExponent, exponent);
+
+      // When
+      gtElement_pow(&result, &element, exponent, &montgomeryContext);
+
+      // Then
+      complexFieldElement_pow(&expected, &element.value, absoluteExponent,
+                              &montgomeryContext);
+      if (e < 0) {
+        ASSERT_EQ(complexFieldElement_invert(&expected, &expected,
+                                             &montgomeryContext),
+                  CRYPTID_SUCCESS);
+      }
+      ASSERT(isEquals(&result.value, &expected, &montgomeryContext));
+    }
+
+    complex_destroy(x);
+  }
+
+  montgomeryContext_destroy(montgomeryContext);
+  mpz_clears(modulus, exponent, absoluteExponent, NULL);
+
+  PASS();
+}
+
+TEST window_size_should_grow_with_the_exponent(void) {
+  // Given
+  mpz_t exponent;
+  mpz_init_set_ui(exponent, 12);
+
+  // When
+  int smallWindowSize = gtElement_windowSize(exponent);
+  mpz_setbit(exponent, 512);
+  int largeWindowSize = gtElement_windowSize(exponent);
+
+  // Then
+  ASSERT_EQ(smallWindowSize, 2);
+  ASSERT_EQ(largeWindowSize, GTELEMENT_MAX_WINDOW_SIZE);
+
+  mpz_clear(exponent);
+
+  PASS();
+}
+
+SUITE(gt_element_suite) {
+  RUN_TESTp(arithmetic_should_agree_with_the_general_one, 7);
+  RUN_TESTp(arithmetic_should_agree_with_the_general_one, 131);
+  RUN_TEST(window_size_should_grow_with_the_exponent);
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(gt_element_suite);
+
+  GREATEST_MAIN_END();
+}
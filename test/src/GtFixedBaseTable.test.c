@@ -0,0 +1,71 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+
+#include "complex/Complex.h"
+#include "complex/GtFixedBaseTable.h"
+
+TEST fixedBasePow_should_agree_with_modPow(const long real,
+                                           const long imaginary,
+                                           const long order,
+                                           const int windowSize) {
+  // Given
+  Complex base;
+  complex_initLong(&base, real, imaginary);
+
+  mpz_t fieldOrder, baseOrder, exponent, reducedExponent;
+  mpz_init_set_si(fieldOrder, 131);
+  mpz_init_set_si(baseOrder, order);
+  mpz_inits(exponent, reducedExponent, NULL);
+
+  GtFixedBaseTable table;
+  ASSERT_EQ(
+      gtFixedBaseTable_init(&table, base, baseOrder, windowSize, fieldOrder),
+      CRYPTID_SUCCESS);
+
+  for (long e = -order; e < 3 * order; ++e) {
+    mpz_set_si(exponent, e);
+
+    // When
+    Complex result;
+    gtElement_fixedBasePow(&result, &table, exponent);
+
+    // Then
+    Complex expected;
+    mpz_mod(reducedExponent, exponent, baseOrder);
+    complex_modPow(&expected, base, reducedExponent, fieldOrder);
+    ASSERT(complex_isEquals(result, expected));
+
+    complex_destroyMany(2, result, expected);
+  }
+
+  gtFixedBaseTable_destroy(table);
+  mpz_clears(fieldOrder, baseOrder, exponent, reducedExponent, NULL);
+  complex_destroy(base);
+
+  PASS();
+}
+
+SUITE(fixed_base_exponentiation_suite) {
+  // Over \f$F_{131}\f$, \f$28 + 93i\f$ is the pairing value
+  // \f$e((98, 58), (98, 58))\f$ of order 11, and \f$78 + 104i\f$ is
+  // \f$\frac{1 - 2i}{1 + 2i}\f$, whose order divides 132.
+  for (int windowSize = 0; windowSize <= GT_FIXED_BASE_MAX_WINDOW_SIZE + 1;
+       ++windowSize) {
+    RUN_TESTp(fixedBasePow_should_agree_with_modPow, 28, 93, 11, windowSize);
+    RUN_TESTp(fixedBasePow_should_agree_with_modPow, 78, 104, 132,
+              windowSize);
+  }
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(fixed_base_exponentiation_suite);
+
+  GREATEST_MAIN_END();
+}
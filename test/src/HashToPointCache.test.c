@@ -0,0 +1,165 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "greatest.h"
+
+#include "elliptic/EllipticCurve.h"
+#include "elliptic/EllipticCurveContext.h"
+#include "util/HashToPointCache.h"
+#include "util/Utils.h"
+
+static void initContext(EllipticCurveContext *context,
+                        const unsigned long subgroupOrder) {
+  mpz_t q;
+  mpz_init_set_ui(q, subgroupOrder);
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 131);
+
+  assert(ellipticCurveContext_init(context, ec, q) == CRYPTID_SUCCESS);
+
+  ellipticCurve_destroy(ec);
+  mpz_clear(q);
+}
+
+TEST cache_should_be_disabled_by_default(void) {
+  // Given
+  EllipticCurveContext context;
+  initContext(&context, 11);
+
+  // When
+  AffinePoint point, samePoint;
+  ASSERT_EQ(hashToPoint(&point, "Darth Plagueis", 14, &context,
+                        hashFunction_SHA1),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(hashToPoint(&samePoint, "Darth Plagueis", 14, &context,
+                        hashFunction_SHA1),
+            CRYPTID_SUCCESS);
+
+  // Then
+  size_t hitCount, missCount, size;
+  hashToPointCache_getStatistics(&hitCount, &missCount, &size);
+  ASSERT_EQ(hitCount, 0);
+  ASSERT_EQ(missCount, 0);
+  ASSERT_EQ(size, 0);
+
+  affine_destroy(point);
+  affine_destroy(samePoint);
+  ellipticCurveContext_destroy(context);
+
+  PASS();
+}
+
+TEST cached_points_should_match_computed_ones(void) {
+  // Given
+  EllipticCurveContext context, otherContext;
+  initContext(&context, 11);
+  initContext(&otherContext, 3);
+
+  AffinePoint expected;
+  ASSERT_EQ(hashToPoint(&expected, "Darth Plagueis", 14, &context,
+                        hashFunction_SHA1),
+            CRYPTID_SUCCESS);
+
+  hashToPointCache_setCapacity(64);
+
+  // When
+  AffinePoint point, cachedPoint, otherHashPoint, otherCurvePoint;
+  ASSERT_EQ(hashToPoint(&point, "Darth Plagueis", 14, &context,
+                        hashFunction_SHA1),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(hashToPoint(&cachedPoint, "Darth Plagueis", 14, &context,
+                        hashFunction_SHA1),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(hashToPoint(&otherHashPoint, "Darth Plagueis", 14, &context,
+                        hashFunction_SHA256),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(hashToPoint(&otherCurvePoint, "Darth Plagueis", 14,
+                        &otherContext, hashFunction_SHA1),
+            CRYPTID_SUCCESS);
+
+  // Then
+  size_t hitCount, missCount, size;
+  hashToPointCache_getStatistics(&hitCount, &missCount, &size);
+  ASSERT_EQ(hitCount, 1);
+  ASSERT_EQ(missCount, 3);
+  ASSERT_EQ(size, 3);
+  ASSERT(affine_isEquals(point, expected));
+  ASSERT(affine_isEquals(cachedPoint, expected));
+
+  affine_destroy(expected);
+  affine_destroy(point);
+  affine_destroy(cachedPoint);
+  affine_destroy(otherHashPoint);
+  affine_destroy(otherCurvePoint);
+  ellipticCurveContext_destroy(context);
+  ellipticCurveContext_destroy(otherContext);
+  hashToPointCache_setCapacity(0);
+  hashToPointCache_flush();
+
+  PASS();
+}
+
+TEST cache_should_stay_within_its_capacity(void) {
+  // Given
+  EllipticCurveContext context;
+  initContext(&context, 11);
+
+  hashToPointCache_setCapacity(HASH_TO_POINT_CACHE_SHARD_COUNT);
+
+  // When
+  char id[16];
+  AffinePoint point;
+  for (int i = 0; i < 64; i++) {
+    sprintf(id, "identity-%d", i);
+    ASSERT_EQ(hashToPoint(&point, id, strlen(id), &context, hashFunction_SHA1),
+              CRYPTID_SUCCESS);
+    affine_destroy(point);
+  }
+
+  // Then
+  size_t hitCount, missCount, size;
+  hashToPointCache_getStatistics(&hitCount, &missCount, &size);
+  ASSERT_EQ(missCount, 64);
+  ASSERT(size <= HASH_TO_POINT_CACHE_SHARD_COUNT);
+
+  // When
+  ASSERT_EQ(hashToPoint(&point, id, strlen(id), &context, hashFunction_SHA1),
+            CRYPTID_SUCCESS);
+  affine_destroy(point);
+
+  // Then
+  hashToPointCache_getStatistics(&hitCount, &missCount, &size);
+  ASSERT_EQ(hitCount, 1);
+
+  // When
+  hashToPointCache_flush();
+
+  // Then
+  hashToPointCache_getStatistics(&hitCount, &missCount, &size);
+  ASSERT_EQ(hitCount, 0);
+  ASSERT_EQ(missCount, 0);
+  ASSERT_EQ(size, 0);
+
+  ellipticCurveContext_destroy(context);
+  hashToPointCache_setCapacity(0);
+
+  PASS();
+}
+
+SUITE(hash_to_point_cache_suite) {
+  RUN_TEST(cache_should_be_disabled_by_default);
+  RUN_TEST(cached_points_should_match_computed_ones);
+  RUN_TEST(cache_should_stay_within_its_capacity);
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(hash_to_point_cache_suite);
+
+  GREATEST_MAIN_END();
+}
@@ -4,9 +4,6 @@
 
 #include "greatest.h"
 
-#include "complex/Complex.h"
-#include "elliptic/AffinePoint.h"
-#include "elliptic/EllipticCurve.h"
 #include "identity-based/signature/hess/HessIdentityBasedSignature.h"
 
 const char *LOWEST_QUICK_CHECK_ARGUMENT = "--lowest-quick-check";
@@ -14,18 +11,18 @@ const char *LOWEST_QUICK_CHECK_ARGUMENT = "--lowest-quick-check";
 int isLowestQuickCheck = 0;
 int isVerbose = 0;
 
-TEST fresh_hess_ibs_setup_matching_identities(const SecurityLevel securityLevel,
-                                              const char *const message,
-                                              const char *const identity) {
+TEST fresh_hess_ibs_setup_matching_identities(
+    const PairingGroupType pairingGroupType, const SecurityLevel securityLevel,
+    const char *const message, const char *const identity) {
   HessIdentityBasedSignaturePublicParametersAsBinary publicParameters;
   HessIdentityBasedSignatureMasterSecretAsBinary masterSecret;
 
-  CryptidStatus status =
-      cryptid_ibs_hess_setup(&masterSecret, &publicParameters, securityLevel);
+  CryptidStatus status = cryptid_ibs_hess_setupForPairingGroup(
+      &masterSecret, &publicParameters, securityLevel, pairingGroupType);
 
   ASSERT_EQ(status, CRYPTID_SUCCESS);
 
-  AffinePointAsBinary privateKey;
+  PairingGroupElementAsBinary privateKey;
   status = cryptid_ibs_hess_extract(&privateKey, identity, strlen(identity),
                                     masterSecret, publicParameters);
 
@@ -45,7 +42,7 @@ TEST fresh_hess_ibs_setup_matching_identities(const SecurityLevel securityLevel,
   ASSERT_EQ(status, CRYPTID_SUCCESS);
 
   hessIdentityBasedSignatureSignatureAsBinary_destroy(signature);
-  affineAsBinary_destroy(privateKey);
+  pairingGroupElementAsBinary_destroy(privateKey);
   free(masterSecret.masterSecret);
   hessIdentityBasedSignaturePublicParametersAsBinary_destroy(publicParameters);
 
@@ -53,17 +50,18 @@ TEST fresh_hess_ibs_setup_matching_identities(const SecurityLevel securityLevel,
 }
 
 TEST fresh_hess_ibs_setup_different_identities(
-    const SecurityLevel securityLevel, const char *const message,
-    const char *const signIdentity, const char *const verifyIdentity) {
+    const PairingGroupType pairingGroupType, const SecurityLevel securityLevel,
+    const char *const message, const char *const signIdentity,
+    const char *const verifyIdentity) {
   HessIdentityBasedSignaturePublicParametersAsBinary publicParameters;
   HessIdentityBasedSignatureMasterSecretAsBinary masterSecret;
 
-  CryptidStatus status =
-      cryptid_ibs_hess_setup(&masterSecret, &publicParameters, securityLevel);
+  CryptidStatus status = cryptid_ibs_hess_setupForPairingGroup(
+      &masterSecret, &publicParameters, securityLevel, pairingGroupType);
 
   ASSERT_EQ(status, CRYPTID_SUCCESS);
 
-  AffinePointAsBinary privateKey;
+  PairingGroupElementAsBinary privateKey;
   status =
       cryptid_ibs_hess_extract(&privateKey, signIdentity, strlen(signIdentity),
                                masterSecret, publicParameters);
@@ -84,26 +82,26 @@ TEST fresh_hess_ibs_setup_different_identities(
   ASSERT_EQ(status, CRYPTID_VERIFICATION_FAILED_ERROR);
 
   hessIdentityBasedSignatureSignatureAsBinary_destroy(signature);
-  affineAsBinary_destroy(privateKey);
+  pairingGroupElementAsBinary_destroy(privateKey);
   free(masterSecret.masterSecret);
   hessIdentityBasedSignaturePublicParametersAsBinary_destroy(publicParameters);
 
   PASS();
 }
 
-TEST fresh_hess_ibs_setup_wrong_signature(const SecurityLevel securityLevel,
-                                          const char *const message1,
-                                          const char *const message2,
-                                          const char *const identity) {
+TEST fresh_hess_ibs_setup_wrong_signature(
+    const PairingGroupType pairingGroupType, const SecurityLevel securityLevel,
+    const char *const message1, const char *const message2,
+    const char *const identity) {
   HessIdentityBasedSignaturePublicParametersAsBinary publicParameters;
   HessIdentityBasedSignatureMasterSecretAsBinary masterSecret;
 
-  CryptidStatus status =
-      cryptid_ibs_hess_setup(&masterSecret, &publicParameters, securityLevel);
+  CryptidStatus status = cryptid_ibs_hess_setupForPairingGroup(
+      &masterSecret, &publicParameters, securityLevel, pairingGroupType);
 
   ASSERT_EQ(status, CRYPTID_SUCCESS);
 
-  AffinePointAsBinary privateKey;
+  PairingGroupElementAsBinary privateKey;
   status = cryptid_ibs_hess_extract(&privateKey, identity, strlen(identity),
                                     masterSecret, publicParameters);
 
@@ -123,13 +121,322 @@ TEST fresh_hess_ibs_setup_wrong_signature(const SecurityLevel securityLevel,
   ASSERT_EQ(status, CRYPTID_VERIFICATION_FAILED_ERROR);
 
   hessIdentityBasedSignatureSignatureAsBinary_destroy(signature);
-  affineAsBinary_destroy(privateKey);
+  pairingGroupElementAsBinary_destroy(privateKey);
   free(masterSecret.masterSecret);
   hessIdentityBasedSignaturePublicParametersAsBinary_destroy(publicParameters);
 
   PASS();
 }
 
+TEST prepared_hess_ibs_matching_identities(
+    const PairingGroupType pairingGroupType, const SecurityLevel securityLevel,
+    const char *const message, const char *const identity) {
+  // Given
+  HessIdentityBasedSignaturePublicParametersAsBinary publicParameters;
+  HessIdentityBasedSignatureMasterSecretAsBinary masterSecret;
+
+  CryptidStatus status = cryptid_ibs_hess_setupForPairingGroup(
+      &masterSecret, &publicParameters, securityLevel, pairingGroupType);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  HessIdentityBasedSignaturePreparedPublicParameters prepared;
+  status = cryptid_ibs_hess_prepare(&prepared, publicParameters);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  PairingGroupElementAsBinary privateKey;
+  status = cryptid_ibs_hess_extractPrepared(
+      &privateKey, identity, strlen(identity), masterSecret, &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  HessIdentityBasedSignaturePreparedPrivateKey preparedPrivateKey;
+  status = cryptid_ibs_hess_preparePrivateKey(&preparedPrivateKey, privateKey,
+                                              &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  // When
+  HessIdentityBasedSignatureSignatureAsBinary signature;
+  status = cryptid_ibs_hess_signPrepared(&signature, message, strlen(message),
+                                         identity, strlen(identity),
+                                         &preparedPrivateKey, &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  // Then
+  status = cryptid_ibs_hess_verifyPrepared(message, strlen(message), signature,
+                                           identity, strlen(identity),
+                                           &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  status =
+      cryptid_ibs_hess_verify(message, strlen(message), signature, identity,
+                              strlen(identity), publicParameters);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  hessIdentityBasedSignatureSignatureAsBinary_destroy(signature);
+  hessIdentityBasedSignaturePreparedPrivateKey_destroy(preparedPrivateKey);
+  hessIdentityBasedSignaturePreparedPublicParameters_destroy(prepared);
+  pairingGroupElementAsBinary_destroy(privateKey);
+  free(masterSecret.masterSecret);
+  hessIdentityBasedSignaturePublicParametersAsBinary_destroy(publicParameters);
+
+  PASS();
+}
+
+TEST prepared_hess_ibs_invalid_public_parameters(
+    const PairingGroupType pairingGroupType,
+    const SecurityLevel securityLevel) {
+  // Given
+  HessIdentityBasedSignaturePublicParametersAsBinary publicParameters;
+  HessIdentityBasedSignatureMasterSecretAsBinary masterSecret;
+
+  CryptidStatus status = cryptid_ibs_hess_setupForPairingGroup(
+      &masterSecret, &publicParameters, securityLevel, pairingGroupType);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  // When
+  // An even q is not a prime.
+  ((unsigned char *)publicParameters.q)[publicParameters.qLength - 1] ^= 1;
+
+  // Then
+  HessIdentityBasedSignaturePreparedPublicParameters prepared;
+  status = cryptid_ibs_hess_prepare(&prepared, publicParameters);
+
+  ASSERT_EQ(status, CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR);
+
+  free(masterSecret.masterSecret);
+  hessIdentityBasedSignaturePublicParametersAsBinary_destroy(publicParameters);
+
+  PASS();
+}
+
+TEST prepared_identity_hess_ibs_repeated_verifications(
+    const PairingGroupType pairingGroupType, const SecurityLevel securityLevel,
+    const char *const message, const char *const identity) {
+  // Given
+  HessIdentityBasedSignaturePublicParametersAsBinary publicParameters;
+  HessIdentityBasedSignatureMasterSecretAsBinary masterSecret;
+
+  CryptidStatus status = cryptid_ibs_hess_setupForPairingGroup(
+      &masterSecret, &publicParameters, securityLevel, pairingGroupType);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  HessIdentityBasedSignaturePreparedPublicParameters prepared;
+  status = cryptid_ibs_hess_prepare(&prepared, publicParameters);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  PairingGroupElementAsBinary privateKey;
+  status = cryptid_ibs_hess_extractPrepared(
+      &privateKey, identity, strlen(identity), masterSecret, &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  HessIdentityBasedSignaturePreparedIdentity preparedIdentity,
+      otherPreparedIdentity;
+  status = cryptid_ibs_hess_prepareIdentity(&preparedIdentity, identity,
+                                            strlen(identity), &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  status = cryptid_ibs_hess_prepareIdentity(&otherPreparedIdentity,
+                                            "Darth Plagueis", 14, &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  for (int i = 0; i < 2; i++) {
+    // When
+    HessIdentityBasedSignatureSignatureAsBinary signature;
+    status = cryptid_ibs_hess_sign(&signature, message, strlen(message),
+                                   identity, strlen(identity), privateKey,
+                                   publicParameters);
+
+    ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+    // Then
+    status = cryptid_ibs_hess_verifyWithPreparedIdentity(
+        message, strlen(message), signature, &preparedIdentity, &prepared);
+
+    ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+    status = cryptid_ibs_hess_verifyWithPreparedIdentity(
+        "Darth Plagueis", 14, signature, &preparedIdentity, &prepared);
+
+    ASSERT_EQ(status, CRYPTID_VERIFICATION_FAILED_ERROR);
+
+    status = cryptid_ibs_hess_verifyWithPreparedIdentity(
+        message, strlen(message), signature, &otherPreparedIdentity,
+        &prepared);
+
+    ASSERT_EQ(status, CRYPTID_VERIFICATION_FAILED_ERROR);
+
+    hessIdentityBasedSignatureSignatureAsBinary_destroy(signature);
+  }
+
+  hessIdentityBasedSignaturePreparedIdentity_destroy(preparedIdentity);
+  hessIdentityBasedSignaturePreparedIdentity_destroy(otherPreparedIdentity);
+  hessIdentityBasedSignaturePreparedPublicParameters_destroy(prepared);
+  pairingGroupElementAsBinary_destroy(privateKey);
+  free(masterSecret.masterSecret);
+  hessIdentityBasedSignaturePublicParametersAsBinary_destroy(publicParameters);
+
+  PASS();
+}
+
+TEST prepared_signer_hess_ibs_signatures(
+    const PairingGroupType pairingGroupType, const SecurityLevel securityLevel,
+    const char *const message, const char *const identity) {
+  // Given
+  HessIdentityBasedSignaturePublicParametersAsBinary publicParameters;
+  HessIdentityBasedSignatureMasterSecretAsBinary masterSecret;
+
+  CryptidStatus status = cryptid_ibs_hess_setupForPairingGroup(
+      &masterSecret, &publicParameters, securityLevel, pairingGroupType);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  HessIdentityBasedSignaturePreparedPublicParameters prepared;
+  status = cryptid_ibs_hess_prepare(&prepared, publicParameters);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  PairingGroupElementAsBinary privateKey;
+  status = cryptid_ibs_hess_extractPrepared(
+      &privateKey, identity, strlen(identity), masterSecret, &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  HessIdentityBasedSignaturePreparedSigner preparedSigner;
+  status = cryptid_ibs_hess_prepareSigner(&preparedSigner, identity,
+                                          strlen(identity), privateKey,
+                                          &prepared);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  for (int i = 0; i < 2; i++) {
+    if (i == 1) {
+      status = cryptid_ibs_hess_prepareSignerTables(&preparedSigner, &prepared);
+
+      ASSERT_EQ(status, CRYPTID_SUCCESS);
+    }
+
+    // When
+    HessIdentityBasedSignatureSignatureAsBinary signature;
+    status = cryptid_ibs_hess_signWithPreparedSigner(
+        &signature, message, strlen(message), &preparedSigner, &prepared);
+
+    ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+    // Then
+    status =
+        cryptid_ibs_hess_verify(message, strlen(message), signature, identity,
+                                strlen(identity), publicParameters);
+
+    ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+    status = cryptid_ibs_hess_verify("Darth Plagueis", 14, signature, identity,
+                                     strlen(identity), publicParameters);
+
+    ASSERT_EQ(status, CRYPTID_VERIFICATION_FAILED_ERROR);
+
+    hessIdentityBasedSignatureSignatureAsBinary_destroy(signature);
+  }
+
+  hessIdentityBasedSignaturePreparedSigner_destroy(preparedSigner);
+  hessIdentityBasedSignaturePreparedPublicParameters_destroy(prepared);
+  pairingGroupElementAsBinary_destroy(privateKey);
+  free(masterSecret.masterSecret);
+  hessIdentityBasedSignaturePublicParametersAsBinary_destroy(publicParameters);
+
+  PASS();
+}
+
+TEST bls12381_hess_ibs_setup_unsupported_security_level(void) {
+  // Given
+  HessIdentityBasedSignaturePublicParametersAsBinary publicParameters;
+  HessIdentityBasedSignatureMasterSecretAsBinary masterSecret;
+
+  // When
+  CryptidStatus status = cryptid_ibs_hess_setupForPairingGroup(
+      &masterSecret, &publicParameters, HIGH, pairingGroup_BLS12_381);
+
+  // Then
+  ASSERT_EQ(status, CRYPTID_SECURITY_LEVEL_NOT_SUPPORTED_ERROR);
+
+  PASS();
+}
+
+TEST hess_ibs_private_key_of_other_group(const char *const message,
+                                         const char *const identity) {
+  // Given
+  HessIdentityBasedSignaturePublicParametersAsBinary publicParameters,
+      otherPublicParameters;
+  HessIdentityBasedSignatureMasterSecretAsBinary masterSecret,
+      otherMasterSecret;
+
+  CryptidStatus status = cryptid_ibs_hess_setupForPairingGroup(
+      &masterSecret, &publicParameters, LOWEST, pairingGroup_BLS12_381);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  status = cryptid_ibs_hess_setup(&otherMasterSecret, &otherPublicParameters,
+                                  LOWEST);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  PairingGroupElementAsBinary privateKey, otherPrivateKey;
+  status = cryptid_ibs_hess_extract(&privateKey, identity, strlen(identity),
+                                    masterSecret, publicParameters);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  status = cryptid_ibs_hess_extract(&otherPrivateKey, identity,
+                                    strlen(identity), otherMasterSecret,
+                                    otherPublicParameters);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  HessIdentityBasedSignatureSignatureAsBinary signature;
+  status =
+      cryptid_ibs_hess_sign(&signature, message, strlen(message), identity,
+                            strlen(identity), privateKey, publicParameters);
+
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+
+  // When
+  HessIdentityBasedSignatureSignatureAsBinary otherSignature;
+  status = cryptid_ibs_hess_sign(&otherSignature, message, strlen(message),
+                                 identity, strlen(identity), otherPrivateKey,
+                                 publicParameters);
+
+  // Then
+  ASSERT_EQ(status, CRYPTID_ILLEGAL_PRIVATE_KEY_ERROR);
+
+  status = cryptid_ibs_hess_verify(message, strlen(message), signature,
+                                   identity, strlen(identity),
+                                   otherPublicParameters);
+
+  ASSERT_EQ(status, CRYPTID_ILLEGAL_SIGNATURE_ERROR);
+
+  hessIdentityBasedSignatureSignatureAsBinary_destroy(signature);
+  pairingGroupElementAsBinary_destroy(privateKey);
+  pairingGroupElementAsBinary_destroy(otherPrivateKey);
+  free(masterSecret.masterSecret);
+  free(otherMasterSecret.masterSecret);
+  hessIdentityBasedSignaturePublicParametersAsBinary_destroy(publicParameters);
+  hessIdentityBasedSignaturePublicParametersAsBinary_destroy(
+      otherPublicParameters);
+
+  PASS();
+}
+
 static void generateRandomString(char **output, const size_t outputLength,
                                  const char *const alphabet,
                                  const size_t alphabetSize) {
@@ -178,8 +485,8 @@ SUITE(cryptid_hess_ibs_suite) {
           generateRandomString(&identity, identityLength + 1, defaultAlphabet,
                                strlen(defaultAlphabet));
 
-          RUN_TESTp(fresh_hess_ibs_setup_matching_identities, securityLevel,
-                    message, identity);
+          RUN_TESTp(fresh_hess_ibs_setup_matching_identities,
+                    pairingGroup_TYPE_1, securityLevel, message, identity);
 
           free(message);
           free(identity);
@@ -215,8 +522,9 @@ SUITE(cryptid_hess_ibs_suite) {
                                  defaultAlphabet, strlen(defaultAlphabet));
           } while (strcmp(signIdentity, verifyIdentity) == 0);
 
-          RUN_TESTp(fresh_hess_ibs_setup_different_identities, securityLevel,
-                    message, signIdentity, verifyIdentity);
+          RUN_TESTp(fresh_hess_ibs_setup_different_identities,
+                    pairingGroup_TYPE_1, securityLevel, message, signIdentity,
+                    verifyIdentity);
 
           free(message);
           free(signIdentity);
@@ -253,8 +561,8 @@ SUITE(cryptid_hess_ibs_suite) {
           generateRandomString(&identity, identityLength + 1, defaultAlphabet,
                                strlen(defaultAlphabet));
 
-          RUN_TESTp(fresh_hess_ibs_setup_wrong_signature, securityLevel,
-                    message1, message2, identity);
+          RUN_TESTp(fresh_hess_ibs_setup_wrong_signature, pairingGroup_TYPE_1,
+                    securityLevel, message1, message2, identity);
 
           free(message1);
           free(message2);
@@ -262,6 +570,77 @@ SUITE(cryptid_hess_ibs_suite) {
         }
       }
     }
+
+    {
+      PairingGroupType pairingGroupTypes[] = {
+          pairingGroup_TYPE_1, pairingGroup_TYPE_1, pairingGroup_BLS12_381,
+          pairingGroup_BLS12_381};
+      SecurityLevel securityLevels[] = {LOWEST, LOW, LOWEST, MEDIUM};
+
+      for (int i = 0; i < 4; i++) {
+        if (isLowestQuickCheck && securityLevels[i] != LOWEST) {
+          continue;
+        }
+
+        char *message = malloc(101);
+        char *otherMessage = malloc(101);
+        char *identity = malloc(101);
+        char *otherIdentity = malloc(101);
+
+        do {
+          generateRandomString(&message, 101, defaultAlphabet,
+                               strlen(defaultAlphabet));
+          generateRandomString(&otherMessage, 101, defaultAlphabet,
+                               strlen(defaultAlphabet));
+        } while (strcmp(message, otherMessage) == 0);
+        do {
+          generateRandomString(&identity, 101, defaultAlphabet,
+                               strlen(defaultAlphabet));
+          generateRandomString(&otherIdentity, 101, defaultAlphabet,
+                               strlen(defaultAlphabet));
+        } while (strcmp(identity, otherIdentity) == 0);
+
+        if (pairingGroupTypes[i] == pairingGroup_BLS12_381) {
+          RUN_TESTp(fresh_hess_ibs_setup_matching_identities,
+                    pairingGroupTypes[i], securityLevels[i], message,
+                    identity);
+          RUN_TESTp(fresh_hess_ibs_setup_different_identities,
+                    pairingGroupTypes[i], securityLevels[i], message,
+                    identity, otherIdentity);
+          RUN_TESTp(fresh_hess_ibs_setup_wrong_signature, pairingGroupTypes[i],
+                    securityLevels[i], message, otherMessage, identity);
+        }
+        RUN_TESTp(prepared_hess_ibs_matching_identities, pairingGroupTypes[i],
+                  securityLevels[i], message, identity);
+        RUN_TESTp(prepared_hess_ibs_invalid_public_parameters,
+                  pairingGroupTypes[i], securityLevels[i]);
+        RUN_TESTp(prepared_identity_hess_ibs_repeated_verifications,
+                  pairingGroupTypes[i], securityLevels[i], message, identity);
+        RUN_TESTp(prepared_signer_hess_ibs_signatures, pairingGroupTypes[i],
+                  securityLevels[i], message, identity);
+
+        free(message);
+        free(otherMessage);
+        free(identity);
+        free(otherIdentity);
+      }
+    }
+
+    {
+      char *message = malloc(101);
+      char *identity = malloc(101);
+
+      generateRandomString(&message, 101, defaultAlphabet,
+                           strlen(defaultAlphabet));
+      generateRandomString(&identity, 101, defaultAlphabet,
+                           strlen(defaultAlphabet));
+
+      RUN_TEST(bls12381_hess_ibs_setup_unsupported_security_level);
+      RUN_TESTp(hess_ibs_private_key_of_other_group, message, identity);
+
+      free(message);
+      free(identity);
+    }
   }
 }
 
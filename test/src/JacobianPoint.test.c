@@ -0,0 +1,201 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+
+#include "elliptic/AffinePoint.h"
+#include "elliptic/EllipticCurve.h"
+#include "elliptic/FieldAffinePoint.h"
+#include "elliptic/JacobianPoint.h"
+#include "field/MontgomeryContext.h"
+
+static void toScaledJacobian(JacobianPoint *result, const AffinePoint point,
+                             const long z,
+                             const MontgomeryContext *montgomeryContext) {
+  // \f$(x, y) \mapsto (x z^2, y z^3, z)\f$, which represents the same point.
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t limbs[3 * n];
+  FieldAffinePoint fieldPoint = fieldAffine_view(limbs, montgomeryContext);
+  fieldAffine_fromAffinePoint(&fieldPoint, point, montgomeryContext);
+  jacobian_fromFieldAffinePoint(result, &fieldPoint, montgomeryContext);
+
+  if (fieldPoint.isInfinity) {
+    return;
+  }
+
+  mpz_t zValue;
+  mpz_init_set_si(zValue, z);
+  FieldElement *scale = limbs + 2 * n;
+  fieldElement_fromMpz(scale, zValue, montgomeryContext);
+  mpz_clear(zValue);
+
+  fieldElement_copy(result->z, scale, montgomeryContext);
+  fieldElement_square(scale, scale, montgomeryContext);
+  fieldElement_mul(result->x, result->x, scale, montgomeryContext);
+  fieldElement_mul(scale, scale, result->z, montgomeryContext);
+  fieldElement_mul(result->y, result->y, scale, montgomeryContext);
+}
+
+static int isEqualToAffine(const JacobianPoint *point,
+                           const AffinePoint expected,
+                           const MontgomeryContext *montgomeryContext) {
+  mp_limb_t limbs[2 * montgomeryContext->limbCount];
+  FieldAffinePoint fieldPoint = fieldAffine_view(limbs, montgomeryContext);
+  if (jacobian_toFieldAffinePoint(&fieldPoint, point, montgomeryContext)) {
+    return 0;
+  }
+
+  AffinePoint result;
+  fieldAffine_toAffinePoint(&result, &fieldPoint, montgomeryContext);
+  int isEqual = affine_isEquals(result, expected);
+  affine_destroy(result);
+
+  return isEqual;
+}
+
+TEST arithmetic_should_agree_with_the_affine_one(const long a, const long b,
+                                                  const long p) {
+  // Given
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, a, b, p);
+
+  MontgomeryContext montgomeryContext;
+  montgomeryContext_init(&montgomeryContext, ec.fieldOrder);
+
+  const size_t n = montgomeryContext.limbCount;
+  mp_limb_t curveA[n];
+  fieldElement_fromMpz(curveA, ec.a, &montgomeryContext);
+
+  // Every point of the curve, including the point at infinity.
+  AffinePoint *points =
+      (AffinePoint *)malloc((p * p + 1) * sizeof(AffinePoint));
+  int pointCount = 0;
+  points[pointCount++] = affine_infinity();
+  for (long x = 0; x < p; ++x) {
+    for (long y = 0; y < p; ++y) {
+      affine_initLong(&points[pointCount], x, y);
+      if (affine_isOnCurve(points[pointCount], ec)) {
+        pointCount++;
+      } else {
+        affine_destroy(points[pointCount]);
+      }
+    }
+  }
+
+  for (int i = 0; i < pointCount; ++i) {
+    mp_limb_t limbs[14 * n];
+    JacobianPoint jacobianPoint = jacobian_view(limbs, &montgomeryContext);
+    toScaledJacobian(&jacobianPoint, points[i], i % (p - 2) + 2,
+                     &montgomeryContext);
+
+    // When
+    JacobianPoint doubled = jacobian_view(limbs + 3 * n, &montgomeryContext);
+    jacobian_double(&doubled, &jacobianPoint, curveA, &montgomeryContext);
+
+    // Then
+    AffinePoint expected;
+    ASSERT_EQ(affine_double(&expected, points[i], ec), CRYPTID_SUCCESS);
+    ASSERT(isEqualToAffine(&doubled, expected, &montgomeryContext));
+    affine_destroy(expected);
+
+    for (int j = 0; j < pointCount; ++j) {
+      FieldAffinePoint addend =
+          fieldAffine_view(limbs + 6 * n, &montgomeryContext);
+      fieldAffine_fromAffinePoint(&addend, points[j], &montgomeryContext);
+
+      // When
+      JacobianPoint sum = jacobian_view(limbs + 8 * n, &montgomeryContext);
+      jacobian_copy(&sum, &jacobianPoint, &montgomeryContext);
+      jacobian_addMixed(&sum, &sum, &addend, curveA, &montgomeryContext);
+
+      // Then
+      ASSERT_EQ(affine_add(&expected, points[i], points[j], ec),
+                CRYPTID_SUCCESS);
+      ASSERT(isEqualToAffine(&sum, expected, &montgomeryContext));
+
+      // When
+      JacobianPoint addend2 =
+          jacobian_view(limbs + 11 * n, &montgomeryContext);
+      toScaledJacobian(&addend2, points[j], j % (p - 2) + 2,
+                       &montgomeryContext);
+      jacobian_copy(&sum, &jacobianPoint, &montgomeryContext);
+      jacobian_add(&sum, &sum, &addend2, curveA, &montgomeryContext);
+
+      // Then
+      ASSERT(isEqualToAffine(&sum, expected, &montgomeryContext));
+      affine_destroy(expected);
+    }
+  }
+
+  for (int i = 0; i < pointCount; ++i) {
+    affine_destroy(points[i]);
+  }
+  free(points);
+  montgomeryContext_destroy(montgomeryContext);
+  ellipticCurve_destroy(ec);
+
+  PASS();
+}
+
+TEST batch_conversion_should_agree_with_the_single_one(void) {
+  // Given
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 131);
+
+  MontgomeryContext montgomeryContext;
+  montgomeryContext_init(&montgomeryContext, ec.fieldOrder);
+
+  AffinePoint points[4];
+  points[0] = affine_infinity();
+  affine_initLong(&points[1], 3, 40);
+  points[2] = affine_infinity();
+  affine_initLong(&points[3], 98, 58);
+
+  const size_t n = montgomeryContext.limbCount;
+  mp_limb_t limbs[4 * 5 * n];
+  JacobianPoint jacobianPoints[4];
+  FieldAffinePoint results[4];
+  for (int i = 0; i < 4; ++i) {
+    jacobianPoints[i] = jacobian_view(limbs + 5 * i * n, &montgomeryContext);
+    results[i] = fieldAffine_view(limbs + (5 * i + 3) * n, &montgomeryContext);
+    toScaledJacobian(&jacobianPoints[i], points[i], 3 * i + 2,
+                     &montgomeryContext);
+  }
+
+  // When
+  ASSERT_EQ(jacobian_toFieldAffinePoints(results, jacobianPoints, 4,
+                                         &montgomeryContext),
+            CRYPTID_SUCCESS);
+
+  // Then
+  for (int i = 0; i < 4; ++i) {
+    AffinePoint result;
+    fieldAffine_toAffinePoint(&result, &results[i], &montgomeryContext);
+    ASSERT(affine_isEquals(result, points[i]));
+    affine_destroy(result);
+    affine_destroy(points[i]);
+  }
+
+  montgomeryContext_destroy(montgomeryContext);
+  ellipticCurve_destroy(ec);
+
+  PASS();
+}
+
+SUITE(arithmetic_suite) {
+  RUN_TESTp(arithmetic_should_agree_with_the_affine_one, 0, 1, 11);
+  RUN_TESTp(arithmetic_should_agree_with_the_affine_one, 0, 1, 131);
+  RUN_TESTp(arithmetic_should_agree_with_the_affine_one, 2, 3, 97);
+  RUN_TEST(batch_conversion_should_agree_with_the_single_one);
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(arithmetic_suite);
+
+  GREATEST_MAIN_END();
+}
@@ -0,0 +1,163 @@
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+
+#include "field/MontgomeryContext.h"
+
+// \f$2^{512} - 569\f$, a prime spanning multiple limbs on every platform.
+static const char *const LARGE_PRIME =
+    "13407807929942597099574024998205846127479365820592393377723561443721764030"
+    "073546976801874298166903427690031858186486050853753882811946569946433649006"
+    "083527";
+
+#define LIMB_BITS (sizeof(mp_limb_t) * CHAR_BIT)
+
+// Reduces \f$ab\f$ and checks that the result is \f$abR^{-1} \mod p\f$ by
+// multiplying it back with \f$R\f$.
+static int isReductionCorrect(const mpz_t a, const mpz_t b,
+                              const MontgomeryContext *montgomeryContext) {
+  const size_t n = montgomeryContext->limbCount;
+  mp_limb_t t[2 * n], reduced[n];
+
+  mpz_t product, reducedView, result, expected;
+  mpz_inits(product, result, expected, NULL);
+
+  mpz_mul(product, a, b);
+  mpn_zero(t, 2 * n);
+  mpn_copyi(t, mpz_limbs_read(product), mpz_size(product));
+
+  montgomery_reduce(reduced, t, montgomeryContext);
+
+  mpz_roinit_n(reducedView, reduced, n);
+  mpz_mul(result, reducedView, montgomeryContext->r);
+  mpz_mod(result, result, montgomeryContext->modulus);
+  mpz_mod(expected, product, montgomeryContext->modulus);
+
+  const int isCorrect =
+      !mpz_cmp(result, expected) &&
+      mpz_cmp(reducedView, montgomeryContext->modulus) < 0;
+
+  mpz_clears(product, result, expected, NULL);
+
+  return isCorrect;
+}
+
+TEST constants_should_match_their_definitions(const char *const p) {
+  // Given
+  mpz_t modulus, r, expected;
+  mpz_init_set_str(modulus, p, 10);
+  mpz_inits(r, expected, NULL);
+
+  // When
+  MontgomeryContext montgomeryContext;
+  montgomeryContext_init(&montgomeryContext, modulus);
+
+  // Then
+  ASSERT_EQ(montgomeryContext.limbCount, mpz_size(modulus));
+  ASSERT_EQ((mp_limb_t)(mpz_getlimbn(modulus, 0) *
+                        montgomeryContext.modulusInverse),
+            (mp_limb_t)-1);
+
+  mpz_setbit(r, LIMB_BITS * montgomeryContext.limbCount);
+  mpz_mod(expected, r, modulus);
+  ASSERT_EQ(mpz_cmp(montgomeryContext.r, expected), 0);
+
+  mpz_powm_ui(expected, r, 2, modulus);
+  ASSERT_EQ(mpz_cmp(montgomeryContext.rSquared, expected), 0);
+
+  mpz_powm_ui(expected, r, 3, modulus);
+  ASSERT_EQ(mpz_cmp(montgomeryContext.rCubed, expected), 0);
+
+  montgomeryContext_destroy(montgomeryContext);
+  mpz_clears(modulus, r, expected, NULL);
+
+  PASS();
+}
+
+TEST reduction_should_agree_with_the_canonical_one(const long p) {
+  // Given
+  mpz_t modulus, a, b;
+  mpz_init_set_si(modulus, p);
+  mpz_inits(a, b, NULL);
+
+  MontgomeryContext montgomeryContext;
+  montgomeryContext_init(&montgomeryContext, modulus);
+
+  for (long n = 0; n < p; ++n) {
+    for (long m = 0; m < p; ++m) {
+      // When
+      mpz_set_si(a, n);
+      mpz_set_si(b, m);
+
+      // Then
+      ASSERT(isReductionCorrect(a, b, &montgomeryContext));
+    }
+  }
+
+  montgomeryContext_destroy(montgomeryContext);
+  mpz_clears(modulus, a, b, NULL);
+
+  PASS();
+}
+
+TEST multi_limb_reduction_should_agree_with_the_canonical_one(void) {
+  // Given
+  mpz_t modulus, a, b;
+  mpz_init_set_str(modulus, LARGE_PRIME, 10);
+  mpz_inits(a, b, NULL);
+
+  MontgomeryContext montgomeryContext;
+  montgomeryContext_init(&montgomeryContext, modulus);
+
+  // Pseudorandom operands from a simple quadratic recurrence.
+  mpz_set_ui(a, 2);
+  mpz_set_ui(b, 3);
+
+  for (int i = 0; i < 1000; ++i) {
+    // When
+    mpz_mul(a, a, a);
+    mpz_add_ui(a, a, 7);
+    mpz_mod(a, a, modulus);
+    mpz_mul(b, b, a);
+    mpz_add_ui(b, b, 11);
+    mpz_mod(b, b, modulus);
+
+    // Then
+    ASSERT(isReductionCorrect(a, b, &montgomeryContext));
+  }
+
+  // The largest input allowed, \f$(p - 1)^2 < pR\f$.
+  mpz_sub_ui(a, modulus, 1);
+  ASSERT(isReductionCorrect(a, a, &montgomeryContext));
+
+  montgomeryContext_destroy(montgomeryContext);
+  mpz_clears(modulus, a, b, NULL);
+
+  PASS();
+}
+
+SUITE(constants_suite) {
+  RUN_TESTp(constants_should_match_their_definitions, "7");
+  RUN_TESTp(constants_should_match_their_definitions, "131");
+  RUN_TESTp(constants_should_match_their_definitions, LARGE_PRIME);
+}
+
+SUITE(reduction_suite) {
+  RUN_TESTp(reduction_should_agree_with_the_canonical_one, 7);
+  RUN_TESTp(reduction_should_agree_with_the_canonical_one, 131);
+  RUN_TEST(multi_limb_reduction_should_agree_with_the_canonical_one);
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(constants_suite);
+  RUN_SUITE(reduction_suite);
+
+  GREATEST_MAIN_END();
+}
@@ -0,0 +1,769 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "greatest.h"
+
+#include "bls12-381/Bls12381.h"
+#include "bls12-381/Bls12381ContextCache.h"
+#include "elliptic/EllipticCurve.h"
+#include "elliptic/EllipticCurveContextCache.h"
+#include "pairing/PairingGroup.h"
+
+// Initializes the context of \f$y^2 = x^3 + 1\f$ over \f$F_{131}\f$, whose
+// order is \f$12 \cdot 11\f$, and the group on it.
+static void initType1Group(PairingGroup *group,
+                           EllipticCurveContext *curveContext) {
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 131);
+  mpz_t subgroupOrder;
+  mpz_init_set_ui(subgroupOrder, 11);
+
+  assert(ellipticCurveContext_init(curveContext, ec, subgroupOrder) ==
+         CRYPTID_SUCCESS);
+  pairingGroup_initType1(group, curveContext);
+
+  mpz_clear(subgroupOrder);
+  ellipticCurve_destroy(ec);
+}
+
+// \f$(98, 58)\f$ is a point of order 11.
+static void initType1Point(PairingGroupElement *point) {
+  AffinePoint affinePoint;
+  affine_initLong(&affinePoint, 98, 58);
+  pairingGroupElement_fromAffinePoint(point, affinePoint, pairingGroup_G1);
+  affine_destroy(affinePoint);
+}
+
+// Initializes the BLS12-381 group with a hashed point of \f$G_1\f$ and the
+// generator of \f$G_2\f$, read through the group.
+static void initBls12381Group(PairingGroup *group, Bls12381Context *context,
+                              PairingGroupElement *p, PairingGroupElement *q) {
+  assert(bls12381Context_init(context) == CRYPTID_SUCCESS);
+  pairingGroup_initBls12381(group, context);
+
+  assert(pairingGroup_hashToG1(p, "Pairing group", 13, hashFunction_SHA256,
+                               group) == CRYPTID_SUCCESS);
+
+  unsigned char g2Binary[BLS12381_G2_BINARY_LENGTH];
+  bls12381_g2ToBinary(g2Binary, &context->g2Generator, context);
+  assert(pairingGroup_fromBinary(q, pairingGroup_G2, g2Binary,
+                                 BLS12381_G2_BINARY_LENGTH,
+                                 group) == CRYPTID_SUCCESS);
+}
+
+// Checks \f$e([a]P, [b]Q) = e(P, Q)^{ab}\f$.
+static enum greatest_test_res checkBilinearity(const PairingGroupElement *p,
+                                               const PairingGroupElement *q,
+                                               const long a, const long b,
+                                               const PairingGroup *group) {
+  mpz_t aScalar, bScalar, product;
+  mpz_init_set_si(aScalar, a);
+  mpz_init_set_si(bScalar, b);
+  mpz_init(product);
+  mpz_mul(product, aScalar, bScalar);
+
+  PairingGroupElement aP, bQ, value, multipliedValue, expected;
+  ASSERT_EQ(pairingGroup_multiply(&aP, p, aScalar, group), CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_multiply(&bQ, q, bScalar, group), CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_pair(&value, p, q, group), CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_pair(&multipliedValue, &aP, &bQ, group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_pow(&expected, &value, product, group),
+            CRYPTID_SUCCESS);
+
+  ASSERT(pairingGroup_isEquals(&multipliedValue, &expected, group));
+
+  pairingGroupElement_destroy(aP);
+  pairingGroupElement_destroy(bQ);
+  pairingGroupElement_destroy(value);
+  pairingGroupElement_destroy(multipliedValue);
+  pairingGroupElement_destroy(expected);
+  mpz_clears(aScalar, bScalar, product, NULL);
+
+  PASS();
+}
+
+// Checks that the sums and the negation of multiples of a point agree with
+// multiplication for positive \f$a\f$ and \f$b\f$.
+static enum greatest_test_res
+checkPointArithmetic(const PairingGroupElement *p, const mpz_t a,
+                     const mpz_t b, const PairingGroup *group) {
+  mpz_t sum;
+  mpz_init(sum);
+  mpz_add(sum, a, b);
+
+  PairingGroupElement aP, bP, sumP, expectedSumP, negativeBP, differenceP;
+  ASSERT_EQ(pairingGroup_multiply(&aP, p, a, group), CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_multiply(&bP, p, b, group), CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_multiply(&expectedSumP, p, sum, group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_add(&sumP, &aP, &bP, group), CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_negate(&negativeBP, &bP, group), CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_add(&differenceP, &sumP, &negativeBP, group),
+            CRYPTID_SUCCESS);
+
+  const PairingGroupElement elements[] = {*p, *p};
+  const mpz_srcptr scalars[] = {a, b};
+  PairingGroupElement multiScalarSumP;
+  ASSERT_EQ(pairingGroup_multiScalarMultiply(&multiScalarSumP, elements,
+                                             scalars, 2, group),
+            CRYPTID_SUCCESS);
+
+  ASSERT(pairingGroup_isEquals(&sumP, &expectedSumP, group));
+  ASSERT(pairingGroup_isEquals(&differenceP, &aP, group));
+  ASSERT(pairingGroup_isEquals(&multiScalarSumP, &expectedSumP, group));
+
+  pairingGroupElement_destroy(aP);
+  pairingGroupElement_destroy(bP);
+  pairingGroupElement_destroy(sumP);
+  pairingGroupElement_destroy(expectedSumP);
+  pairingGroupElement_destroy(negativeBP);
+  pairingGroupElement_destroy(differenceP);
+  pairingGroupElement_destroy(multiScalarSumP);
+  mpz_clear(sum);
+
+  PASS();
+}
+
+// Checks the point arithmetic of both arguments, and that the products of
+// pairings agree with exponentiation for positive \f$a\f$ and \f$b\f$.
+static enum greatest_test_res checkArithmetic(const PairingGroupElement *p,
+                                              const PairingGroupElement *q,
+                                              const long a, const long b,
+                                              const PairingGroup *group) {
+  mpz_t aScalar, bScalar, sum;
+  mpz_init_set_si(aScalar, a);
+  mpz_init_set_si(bScalar, b);
+  mpz_init(sum);
+  mpz_add(sum, aScalar, bScalar);
+
+  CHECK_CALL(checkPointArithmetic(p, aScalar, bScalar, group));
+  CHECK_CALL(checkPointArithmetic(q, aScalar, bScalar, group));
+
+  PairingGroupElement aP, bQ, value, aValue, bValue, productValue,
+      expectedValue, pairProductValue;
+  ASSERT_EQ(pairingGroup_multiply(&aP, p, aScalar, group), CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_multiply(&bQ, q, bScalar, group), CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_pair(&value, p, q, group), CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_pow(&aValue, &value, aScalar, group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_pow(&bValue, &value, bScalar, group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_pow(&expectedValue, &value, sum, group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_mul(&productValue, &aValue, &bValue, group),
+            CRYPTID_SUCCESS);
+
+  const PairingGroupElement ps[] = {aP, *p};
+  const PairingGroupElement qs[] = {*q, bQ};
+  ASSERT_EQ(pairingGroup_pairProduct(&pairProductValue, ps, qs, 2, group),
+            CRYPTID_SUCCESS);
+
+  ASSERT(pairingGroup_isEquals(&productValue, &expectedValue, group));
+  ASSERT(pairingGroup_isEquals(&pairProductValue, &expectedValue, group));
+
+  PairingGroupElement invalid;
+  ASSERT_EQ(pairingGroup_add(&invalid, &aP, &value, group),
+            CRYPTID_ILLEGAL_SUBGROUP_ERROR);
+  ASSERT_EQ(pairingGroup_mul(&invalid, &aP, &value, group),
+            CRYPTID_ILLEGAL_SUBGROUP_ERROR);
+
+  pairingGroupElement_destroy(aP);
+  pairingGroupElement_destroy(bQ);
+  pairingGroupElement_destroy(value);
+  pairingGroupElement_destroy(aValue);
+  pairingGroupElement_destroy(bValue);
+  pairingGroupElement_destroy(productValue);
+  pairingGroupElement_destroy(expectedValue);
+  pairingGroupElement_destroy(pairProductValue);
+  mpz_clears(aScalar, bScalar, sum, NULL);
+
+  PASS();
+}
+
+TEST type1_pairing_should_be_bilinear(const long a, const long b) {
+  // Given
+  EllipticCurveContext curveContext;
+  PairingGroup group;
+  initType1Group(&group, &curveContext);
+  PairingGroupElement point;
+  initType1Point(&point);
+
+  // When, Then
+  CHECK_CALL(checkBilinearity(&point, &point, a, b, &group));
+
+  pairingGroupElement_destroy(point);
+  ellipticCurveContext_destroy(curveContext);
+
+  PASS();
+}
+
+TEST type1_prepared_elements_should_agree_with_plain_ones(const long s) {
+  // Given
+  EllipticCurveContext curveContext;
+  PairingGroup group;
+  initType1Group(&group, &curveContext);
+  PairingGroupElement point, preparedPoint;
+  initType1Point(&point);
+  initType1Point(&preparedPoint);
+  ASSERT_EQ(pairingGroup_prepareFixedBase(&preparedPoint, &group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_preparePairingArgument(&preparedPoint, &group),
+            CRYPTID_SUCCESS);
+
+  mpz_t scalar;
+  mpz_init_set_si(scalar, s);
+
+  // When
+  PairingGroupElement product, preparedProduct;
+  ASSERT_EQ(pairingGroup_multiply(&product, &point, scalar, &group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_multiply(&preparedProduct, &preparedPoint, scalar,
+                                  &group),
+            CRYPTID_SUCCESS);
+
+  PairingGroupElement value, preparedFirstValue, preparedSecondValue;
+  ASSERT_EQ(pairingGroup_pair(&value, &point, &product, &group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(
+      pairingGroup_pair(&preparedFirstValue, &preparedPoint, &product, &group),
+      CRYPTID_SUCCESS);
+  ASSERT_EQ(
+      pairingGroup_pair(&preparedSecondValue, &product, &preparedPoint, &group),
+      CRYPTID_SUCCESS);
+
+  PairingGroupElement baseValue, preparedValue, power, preparedPower;
+  ASSERT_EQ(pairingGroup_pair(&baseValue, &point, &point, &group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_pair(&preparedValue, &point, &point, &group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_prepareFixedBase(&preparedValue, &group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_pow(&power, &baseValue, scalar, &group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_pow(&preparedPower, &preparedValue, scalar, &group),
+            CRYPTID_SUCCESS);
+
+  // Then
+  ASSERT(pairingGroup_isEquals(&product, &preparedProduct, &group));
+  ASSERT(pairingGroup_isEquals(&value, &preparedFirstValue, &group));
+  ASSERT(pairingGroup_isEquals(&value, &preparedSecondValue, &group));
+  ASSERT(pairingGroup_isEquals(&power, &preparedPower, &group));
+  ASSERT(pairingGroup_isEquals(&value, &power, &group));
+
+  pairingGroupElement_destroy(point);
+  pairingGroupElement_destroy(preparedPoint);
+  pairingGroupElement_destroy(product);
+  pairingGroupElement_destroy(preparedProduct);
+  pairingGroupElement_destroy(value);
+  pairingGroupElement_destroy(preparedFirstValue);
+  pairingGroupElement_destroy(preparedSecondValue);
+  pairingGroupElement_destroy(baseValue);
+  pairingGroupElement_destroy(preparedValue);
+  pairingGroupElement_destroy(power);
+  pairingGroupElement_destroy(preparedPower);
+  mpz_clear(scalar);
+  ellipticCurveContext_destroy(curveContext);
+
+  PASS();
+}
+
+TEST type1_arithmetic_should_agree_with_multiplication(const long a,
+                                                       const long b) {
+  // Given
+  EllipticCurveContext curveContext;
+  PairingGroup group;
+  initType1Group(&group, &curveContext);
+  PairingGroupElement point;
+  initType1Point(&point);
+
+  // When, Then
+  CHECK_CALL(checkArithmetic(&point, &point, a, b, &group));
+
+  pairingGroupElement_destroy(point);
+  ellipticCurveContext_destroy(curveContext);
+
+  PASS();
+}
+
+TEST type1_random_elements_should_have_the_subgroup_order(void) {
+  // Given
+  EllipticCurveContext curveContext;
+  PairingGroup group;
+  initType1Group(&group, &curveContext);
+  mpz_t order;
+  mpz_init_set_ui(order, 11);
+
+  // When
+  PairingGroupElement element, multiple;
+  ASSERT_EQ(pairingGroup_random(&element, pairingGroup_G2, &group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_multiply(&multiple, &element, order, &group),
+            CRYPTID_SUCCESS);
+
+  // Then
+  ASSERT_EQ(element.subgroup, pairingGroup_G2);
+  ASSERT_FALSE(affine_isInfinity(element.affinePoint));
+  ASSERT(affine_isInfinity(multiple.affinePoint));
+
+  PairingGroupElement invalid;
+  ASSERT_EQ(pairingGroup_random(&invalid, pairingGroup_GT, &group),
+            CRYPTID_ILLEGAL_SUBGROUP_ERROR);
+
+  pairingGroupElement_destroy(element);
+  pairingGroupElement_destroy(multiple);
+  mpz_clear(order);
+  ellipticCurveContext_destroy(curveContext);
+
+  PASS();
+}
+
+TEST type1_serialization_should_round_trip(void) {
+  // Given
+  EllipticCurveContext curveContext;
+  PairingGroup group;
+  initType1Group(&group, &curveContext);
+  PairingGroupElement point, infinity;
+  initType1Point(&point);
+  mpz_t order;
+  mpz_init_set_ui(order, 11);
+  ASSERT_EQ(pairingGroup_multiply(&infinity, &point, order, &group),
+            CRYPTID_SUCCESS);
+
+  // When
+  unsigned char *binary;
+  int binaryLength;
+  pairingGroup_toBinary(&binary, &binaryLength, &point, &group);
+  unsigned char *infinityBinary;
+  int infinityBinaryLength;
+  pairingGroup_toBinary(&infinityBinary, &infinityBinaryLength, &infinity,
+                        &group);
+
+  // Then
+  ASSERT_EQ(binaryLength, 2);
+  ASSERT_EQ(binary[0], 98);
+  ASSERT_EQ(binary[1], 58);
+  ASSERT_EQ(infinityBinaryLength, 2);
+  ASSERT_EQ(infinityBinary[0], 0);
+  ASSERT_EQ(infinityBinary[1], 0);
+
+  PairingGroupElement readPoint, readInfinity;
+  ASSERT_EQ(pairingGroup_fromBinary(&readPoint, pairingGroup_G1, binary,
+                                    binaryLength, &group),
+            CRYPTID_SUCCESS);
+  ASSERT(pairingGroup_isEquals(&readPoint, &point, &group));
+  ASSERT_EQ(pairingGroup_fromBinary(&readInfinity, pairingGroup_G2,
+                                    infinityBinary, infinityBinaryLength,
+                                    &group),
+            CRYPTID_SUCCESS);
+  ASSERT(affine_isInfinity(readInfinity.affinePoint));
+
+  pairingGroupElement_destroy(point);
+  pairingGroupElement_destroy(infinity);
+  pairingGroupElement_destroy(readPoint);
+  pairingGroupElement_destroy(readInfinity);
+  free(binary);
+  free(infinityBinary);
+  mpz_clear(order);
+  ellipticCurveContext_destroy(curveContext);
+
+  PASS();
+}
+
+TEST type1_gt_serialization_should_round_trip(void) {
+  // Given
+  EllipticCurveContext curveContext;
+  PairingGroup group;
+  initType1Group(&group, &curveContext);
+  PairingGroupElement point, value;
+  initType1Point(&point);
+  ASSERT_EQ(pairingGroup_pair(&value, &point, &point, &group), CRYPTID_SUCCESS);
+
+  mpz_t exponent;
+  mpz_init(exponent);
+  for (unsigned long i = 0; i < 11; i++) {
+    mpz_set_ui(exponent, i);
+    PairingGroupElement power;
+    ASSERT_EQ(pairingGroup_pow(&power, &value, exponent, &group),
+              CRYPTID_SUCCESS);
+
+    // When
+    unsigned char *binary;
+    int binaryLength;
+    pairingGroup_toBinary(&binary, &binaryLength, &power, &group);
+
+    // Then
+    ASSERT_EQ(binaryLength, 2);
+    PairingGroupElement readPower;
+    ASSERT_EQ(pairingGroup_fromBinary(&readPower, pairingGroup_GT, binary,
+                                      binaryLength, &group),
+              CRYPTID_SUCCESS);
+    ASSERT(pairingGroup_isEquals(&readPower, &power, &group));
+
+    pairingGroupElement_destroy(power);
+    pairingGroupElement_destroy(readPower);
+    free(binary);
+  }
+
+  pairingGroupElement_destroy(point);
+  pairingGroupElement_destroy(value);
+  mpz_clear(exponent);
+  ellipticCurveContext_destroy(curveContext);
+
+  PASS();
+}
+
+TEST type1_deserialization_should_reject_invalid_encodings(void) {
+  // Given
+  EllipticCurveContext curveContext;
+  PairingGroup group;
+  initType1Group(&group, &curveContext);
+  const unsigned char notOnCurve[] = {98, 57};
+  const unsigned char outOfField[] = {229, 58};
+  const unsigned char valid[] = {98, 58};
+  // \f$-1\f$ has norm 1, but order 2.
+  const unsigned char minusOne[] = {0x00, 0x82};
+
+  // When, Then
+  PairingGroupElement element;
+  ASSERT_EQ(pairingGroup_fromBinary(&element, pairingGroup_G1, notOnCurve, 2,
+                                    &group),
+            CRYPTID_ILLEGAL_POINT_ENCODING_ERROR);
+  ASSERT_EQ(pairingGroup_fromBinary(&element, pairingGroup_G1, outOfField, 2,
+                                    &group),
+            CRYPTID_ILLEGAL_POINT_ENCODING_ERROR);
+  ASSERT_EQ(
+      pairingGroup_fromBinary(&element, pairingGroup_G1, valid, 1, &group),
+      CRYPTID_ILLEGAL_POINT_ENCODING_ERROR);
+  ASSERT_EQ(
+      pairingGroup_fromBinary(&element, pairingGroup_GT, valid, 2, &group),
+      CRYPTID_ILLEGAL_POINT_ENCODING_ERROR);
+  ASSERT_EQ(
+      pairingGroup_fromBinary(&element, pairingGroup_GT, minusOne, 2, &group),
+      CRYPTID_ILLEGAL_POINT_ENCODING_ERROR);
+
+  ellipticCurveContext_destroy(curveContext);
+
+  PASS();
+}
+
+TEST bls12381_pairing_should_be_bilinear(const long a, const long b) {
+  // Given
+  Bls12381Context context;
+  PairingGroup group;
+  PairingGroupElement p, q;
+  initBls12381Group(&group, &context, &p, &q);
+
+  // When, Then
+  CHECK_CALL(checkBilinearity(&p, &q, a, b, &group));
+
+  pairingGroupElement_destroy(p);
+  pairingGroupElement_destroy(q);
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST bls12381_serialization_should_round_trip(void) {
+  // Given
+  Bls12381Context context;
+  PairingGroup group;
+  PairingGroupElement p, q;
+  initBls12381Group(&group, &context, &p, &q);
+
+  // When
+  unsigned char *binary;
+  int binaryLength;
+  pairingGroup_toBinary(&binary, &binaryLength, &p, &group);
+
+  PairingGroupElement value;
+  ASSERT_EQ(pairingGroup_pair(&value, &p, &q, &group), CRYPTID_SUCCESS);
+  unsigned char *valueBinary;
+  int valueBinaryLength;
+  pairingGroup_toBinary(&valueBinary, &valueBinaryLength, &value, &group);
+
+  // Then
+  ASSERT_EQ(binaryLength, BLS12381_G1_BINARY_LENGTH);
+  PairingGroupElement readP;
+  ASSERT_EQ(pairingGroup_fromBinary(&readP, pairingGroup_G1, binary,
+                                    binaryLength, &group),
+            CRYPTID_SUCCESS);
+  ASSERT(pairingGroup_isEquals(&readP, &p, &group));
+  ASSERT_EQ(valueBinaryLength, BLS12381_GT_BINARY_LENGTH);
+  PairingGroupElement readValue;
+  ASSERT_EQ(pairingGroup_fromBinary(&readValue, pairingGroup_GT, valueBinary,
+                                    valueBinaryLength, &group),
+            CRYPTID_SUCCESS);
+  ASSERT(pairingGroup_isEquals(&readValue, &value, &group));
+
+  PairingGroupElement swappedValue;
+  ASSERT_EQ(pairingGroup_pair(&swappedValue, &q, &p, &group),
+            CRYPTID_ILLEGAL_SUBGROUP_ERROR);
+
+  pairingGroupElement_destroy(p);
+  pairingGroupElement_destroy(q);
+  pairingGroupElement_destroy(readP);
+  pairingGroupElement_destroy(value);
+  pairingGroupElement_destroy(readValue);
+  free(binary);
+  free(valueBinary);
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST bls12381_gt_deserialization_should_reject_invalid_encodings(void) {
+  // Given
+  Bls12381Context context;
+  PairingGroup group;
+  PairingGroupElement p, q, value;
+  initBls12381Group(&group, &context, &p, &q);
+  ASSERT_EQ(pairingGroup_pair(&value, &p, &q, &group), CRYPTID_SUCCESS);
+  unsigned char *binary;
+  int binaryLength;
+  pairingGroup_toBinary(&binary, &binaryLength, &value, &group);
+
+  unsigned char one[BLS12381_GT_BINARY_LENGTH] = {0};
+  one[2 * 48 - 1] = 1;
+  unsigned char notCyclotomic[BLS12381_GT_BINARY_LENGTH] = {0};
+  notCyclotomic[2 * 48 - 1] = 2;
+  unsigned char modified[BLS12381_GT_BINARY_LENGTH];
+  memcpy(modified, binary, BLS12381_GT_BINARY_LENGTH);
+  modified[BLS12381_GT_BINARY_LENGTH - 1] ^= 1;
+  unsigned char outOfField[BLS12381_GT_BINARY_LENGTH];
+  memcpy(outOfField, binary, BLS12381_GT_BINARY_LENGTH);
+  memset(outOfField, 0xff, 48);
+
+  // When, Then
+  PairingGroupElement element;
+  ASSERT_EQ(pairingGroup_fromBinary(&element, pairingGroup_GT, one,
+                                    BLS12381_GT_BINARY_LENGTH, &group),
+            CRYPTID_SUCCESS);
+  pairingGroupElement_destroy(element);
+  ASSERT_EQ(pairingGroup_fromBinary(&element, pairingGroup_GT, notCyclotomic,
+                                    BLS12381_GT_BINARY_LENGTH, &group),
+            CRYPTID_ILLEGAL_POINT_ENCODING_ERROR);
+  ASSERT_EQ(pairingGroup_fromBinary(&element, pairingGroup_GT, modified,
+                                    BLS12381_GT_BINARY_LENGTH, &group),
+            CRYPTID_ILLEGAL_POINT_ENCODING_ERROR);
+  ASSERT_EQ(pairingGroup_fromBinary(&element, pairingGroup_GT, outOfField,
+                                    BLS12381_GT_BINARY_LENGTH, &group),
+            CRYPTID_ILLEGAL_POINT_ENCODING_ERROR);
+  ASSERT_EQ(pairingGroup_fromBinary(&element, pairingGroup_GT, binary,
+                                    BLS12381_G1_BINARY_LENGTH, &group),
+            CRYPTID_ILLEGAL_POINT_ENCODING_ERROR);
+
+  pairingGroupElement_destroy(p);
+  pairingGroupElement_destroy(q);
+  pairingGroupElement_destroy(value);
+  free(binary);
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST bls12381_arithmetic_should_agree_with_multiplication(const long a,
+                                                          const long b) {
+  // Given
+  Bls12381Context context;
+  PairingGroup group;
+  PairingGroupElement p, q;
+  initBls12381Group(&group, &context, &p, &q);
+
+  // When, Then
+  CHECK_CALL(checkArithmetic(&p, &q, a, b, &group));
+
+  pairingGroupElement_destroy(p);
+  pairingGroupElement_destroy(q);
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST bls12381_random_elements_should_be_group_elements(
+    const PairingGroupSubgroup subgroup) {
+  // Given
+  Bls12381Context context;
+  PairingGroup group;
+  PairingGroupElement p, q;
+  initBls12381Group(&group, &context, &p, &q);
+
+  // When
+  PairingGroupElement element;
+  ASSERT_EQ(pairingGroup_random(&element, subgroup, &group), CRYPTID_SUCCESS);
+
+  // Then
+  ASSERT_EQ(element.subgroup, subgroup);
+  unsigned char *binary;
+  int binaryLength;
+  pairingGroup_toBinary(&binary, &binaryLength, &element, &group);
+  PairingGroupElement readElement;
+  ASSERT_EQ(pairingGroup_fromBinary(&readElement, subgroup, binary,
+                                    binaryLength, &group),
+            CRYPTID_SUCCESS);
+
+  PairingGroupElement value, one;
+  mpz_t zero;
+  mpz_init(zero);
+  ASSERT_EQ(pairingGroup_pair(&value,
+                              subgroup == pairingGroup_G1 ? &element : &p,
+                              subgroup == pairingGroup_G2 ? &element : &q,
+                              &group),
+            CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_pow(&one, &value, zero, &group), CRYPTID_SUCCESS);
+  ASSERT_FALSE(pairingGroup_isEquals(&value, &one, &group));
+
+  pairingGroupElement_destroy(p);
+  pairingGroupElement_destroy(q);
+  pairingGroupElement_destroy(element);
+  pairingGroupElement_destroy(readElement);
+  pairingGroupElement_destroy(value);
+  pairingGroupElement_destroy(one);
+  free(binary);
+  mpz_clear(zero);
+  bls12381Context_destroy(context);
+
+  PASS();
+}
+
+TEST bls12381_acquired_groups_should_share_the_context(void) {
+  // Given
+  PairingGroup group, otherGroup;
+
+  // When
+  ASSERT_EQ(pairingGroup_acquireBls12381(&group), CRYPTID_SUCCESS);
+  ASSERT_EQ(pairingGroup_acquireBls12381(&otherGroup), CRYPTID_SUCCESS);
+
+  // Then
+  ASSERT_EQ(group.type, pairingGroup_BLS12_381);
+  ASSERT_EQ(group.bls12381Context, otherGroup.bls12381Context);
+
+  EllipticCurve ellipticCurve;
+  mpz_t subgroupOrder;
+  mpz_init(subgroupOrder);
+  pairingGroup_describe(&ellipticCurve, subgroupOrder, &group);
+  ASSERT_EQ(mpz_cmp_ui(ellipticCurve.a, 0), 0);
+  ASSERT_EQ(mpz_cmp_ui(ellipticCurve.b, 4), 0);
+  ASSERT_EQ(
+      mpz_cmp(ellipticCurve.fieldOrder, group.bls12381Context->fieldOrder), 0);
+  ASSERT_EQ(mpz_cmp(subgroupOrder, group.bls12381Context->groupOrder), 0);
+
+  ellipticCurve_destroy(ellipticCurve);
+  mpz_clear(subgroupOrder);
+  pairingGroup_release(group);
+  pairingGroup_release(otherGroup);
+  bls12381ContextCache_flush();
+
+  PASS();
+}
+
+TEST acquire_should_check_the_description(const int type, const long b,
+                                          const long fieldOrder,
+                                          const long subgroupOrder,
+                                          const CryptidStatus expected) {
+  // Given
+  EllipticCurve ellipticCurve;
+  ellipticCurve_initLong(&ellipticCurve, 0, b, fieldOrder);
+  mpz_t order;
+  mpz_init_set_ui(order, subgroupOrder);
+
+  // When
+  PairingGroup group;
+  CryptidStatus status = pairingGroup_acquire(
+      &group, (PairingGroupType)type, ellipticCurve, order);
+
+  // Then
+  ASSERT_EQ(status, expected);
+
+  if (!status) {
+    ASSERT_EQ(group.type, (PairingGroupType)type);
+    pairingGroup_release(group);
+  }
+  ellipticCurve_destroy(ellipticCurve);
+  mpz_clear(order);
+  ellipticCurveContextCache_flush();
+  bls12381ContextCache_flush();
+
+  PASS();
+}
+
+TEST bls12381_acquire_should_accept_the_description(void) {
+  // Given
+  PairingGroup describedGroup;
+  ASSERT_EQ(pairingGroup_acquireBls12381(&describedGroup), CRYPTID_SUCCESS);
+
+  EllipticCurve ellipticCurve;
+  mpz_t subgroupOrder;
+  mpz_init(subgroupOrder);
+  pairingGroup_describe(&ellipticCurve, subgroupOrder, &describedGroup);
+
+  // When
+  PairingGroup group;
+  CryptidStatus status = pairingGroup_acquire(
+      &group, pairingGroup_BLS12_381, ellipticCurve, subgroupOrder);
+
+  // Then
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+  ASSERT_EQ(group.bls12381Context, describedGroup.bls12381Context);
+
+  ellipticCurve_destroy(ellipticCurve);
+  mpz_clear(subgroupOrder);
+  pairingGroup_release(group);
+  pairingGroup_release(describedGroup);
+  bls12381ContextCache_flush();
+
+  PASS();
+}
+
+SUITE(pairing_group_suite) {
+  RUN_TESTp(type1_pairing_should_be_bilinear, 2, 3);
+  RUN_TESTp(type1_pairing_should_be_bilinear, 5, 7);
+  for (long s = 0; s < 33; s++) {
+    RUN_TESTp(type1_prepared_elements_should_agree_with_plain_ones, s);
+  }
+  RUN_TESTp(type1_arithmetic_should_agree_with_multiplication, 2, 3);
+  RUN_TESTp(type1_arithmetic_should_agree_with_multiplication, 4, 4);
+  RUN_TEST(type1_random_elements_should_have_the_subgroup_order);
+  RUN_TEST(type1_serialization_should_round_trip);
+  RUN_TEST(type1_gt_serialization_should_round_trip);
+  RUN_TEST(type1_deserialization_should_reject_invalid_encodings);
+  RUN_TESTp(bls12381_pairing_should_be_bilinear, 2, 3);
+  RUN_TESTp(bls12381_pairing_should_be_bilinear, -5, 11);
+  RUN_TESTp(bls12381_arithmetic_should_agree_with_multiplication, 2, 3);
+  RUN_TESTp(bls12381_arithmetic_should_agree_with_multiplication, 4, 4);
+  RUN_TESTp(bls12381_random_elements_should_be_group_elements,
+            pairingGroup_G1);
+  RUN_TESTp(bls12381_random_elements_should_be_group_elements,
+            pairingGroup_G2);
+  RUN_TEST(bls12381_acquired_groups_should_share_the_context);
+  RUN_TEST(bls12381_serialization_should_round_trip);
+  RUN_TEST(bls12381_gt_deserialization_should_reject_invalid_encodings);
+  RUN_TESTp(acquire_should_check_the_description, pairingGroup_TYPE_1, 1, 131,
+            11, CRYPTID_SUCCESS);
+  // Not a prime.
+  RUN_TESTp(acquire_should_check_the_description, pairingGroup_TYPE_1, 1, 131,
+            12, CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR);
+  // A prime not dividing \f$p + 1\f$.
+  RUN_TESTp(acquire_should_check_the_description, pairingGroup_TYPE_1, 1, 131,
+            7, CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR);
+  // Not a supersingular curve of [RFC-5091].
+  RUN_TESTp(acquire_should_check_the_description, pairingGroup_TYPE_1, 2, 131,
+            11, CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR);
+  RUN_TESTp(acquire_should_check_the_description, pairingGroup_BLS12_381, 4,
+            131, 11, CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR);
+  RUN_TESTp(acquire_should_check_the_description, 7, 1, 131, 11,
+            CRYPTID_ILLEGAL_PUBLIC_PARAMETERS_ERROR);
+  RUN_TEST(bls12381_acquire_should_accept_the_description);
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(pairing_group_suite);
+
+  GREATEST_MAIN_END();
+}
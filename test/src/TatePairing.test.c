@@ -7,12 +7,12 @@
 #include "complex/Complex.h"
 #include "elliptic/AffinePoint.h"
 #include "elliptic/EllipticCurve.h"
+#include "elliptic/EllipticCurveContext.h"
 #include "elliptic/TatePairing.h"
 
 TEST GF_131_modified_tate_pairing_should_just_work(const long n,
                                                    const Complex expected) {
   // Given
-  int embeddingDegree = 2;
   mpz_t subgroupOrder, mul;
   mpz_init_set_ui(subgroupOrder, 11);
   mpz_init_set_ui(mul, n);
@@ -20,13 +20,17 @@ TEST GF_131_modified_tate_pairing_should_just_work(const long n,
   ellipticCurve_initLong(&ec, 0, 1, 131);
   AffinePoint a;
   affine_initLong(&a, 98, 58);
+
+  EllipticCurveContext context;
+  ASSERT_EQ(ellipticCurveContext_init(&context, ec, subgroupOrder),
+            CRYPTID_SUCCESS);
+
   AffinePoint b;
-  affine_wNAFMultiply(&b, a, mul, ec);
+  affine_wNAFMultiply(&b, a, mul, &context);
 
   // When
   Complex result;
-  CryptidStatus status =
-      tate_performPairing(&result, a, b, embeddingDegree, subgroupOrder, ec);
+  CryptidStatus status = tate_performPairing(&result, a, b, &context);
 
   // Then
   ASSERT_EQ(status, CRYPTID_SUCCESS);
@@ -35,6 +39,7 @@ TEST GF_131_modified_tate_pairing_should_just_work(const long n,
   affine_destroy(a);
   affine_destroy(b);
   mpz_clears(subgroupOrder, mul, NULL);
+  ellipticCurveContext_destroy(context);
   ellipticCurve_destroy(ec);
   complex_destroy(result);
 
@@ -43,7 +48,6 @@ TEST GF_131_modified_tate_pairing_should_just_work(const long n,
 
 TEST RFC_5091_tate_pairing_should_work(void) {
   // Given
-  int embeddingDegree = 2;
   mpz_t subgroupOrder, p, zero, ax, ay, bx, by, expecteda, expectedb;
   mpz_inits(subgroupOrder, p, ax, ay, bx, by, expecteda, expectedb, NULL);
 
@@ -74,10 +78,13 @@ TEST RFC_5091_tate_pairing_should_work(void) {
     mpz_clear(one);
   }
 
+  EllipticCurveContext context;
+  ASSERT_EQ(ellipticCurveContext_init(&context, ec, subgroupOrder),
+            CRYPTID_SUCCESS);
+
   // When
   Complex result;
-  CryptidStatus status =
-      tate_performPairing(&result, a, b, embeddingDegree, subgroupOrder, ec);
+  CryptidStatus status = tate_performPairing(&result, a, b, &context);
 
   // Then
   ASSERT_EQ(status, CRYPTID_SUCCESS);
@@ -86,6 +93,7 @@ TEST RFC_5091_tate_pairing_should_work(void) {
   affine_destroy(a);
   affine_destroy(b);
   complex_destroyMany(2, result, expected);
+  ellipticCurveContext_destroy(context);
   ellipticCurve_destroy(ec);
   mpz_clears(subgroupOrder, p, zero, ax, ay, bx, by, expecteda, expectedb,
              NULL);
@@ -93,6 +101,256 @@ TEST RFC_5091_tate_pairing_should_work(void) {
   PASS();
 }
 
+TEST tate_pairing_should_be_bilinear(const unsigned long a,
+                                      const unsigned long b) {
+  // Given
+  mpz_t subgroupOrder, scalar;
+  mpz_init_set_ui(subgroupOrder, 11);
+  mpz_init(scalar);
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 131);
+  EllipticCurveContext context;
+  ASSERT_EQ(ellipticCurveContext_init(&context, ec, subgroupOrder),
+            CRYPTID_SUCCESS);
+
+  AffinePoint p, aP, bP;
+  affine_initLong(&p, 98, 58);
+  mpz_set_ui(scalar, a);
+  ASSERT_EQ(affine_wNAFMultiply(&aP, p, scalar, &context), CRYPTID_SUCCESS);
+  mpz_set_ui(scalar, b);
+  ASSERT_EQ(affine_wNAFMultiply(&bP, p, scalar, &context), CRYPTID_SUCCESS);
+
+  // When
+  Complex result, base, expected;
+  ASSERT_EQ(tate_performPairing(&result, aP, bP, &context), CRYPTID_SUCCESS);
+  ASSERT_EQ(tate_performPairing(&base, p, p, &context), CRYPTID_SUCCESS);
+
+  // Then
+  // \f$e(aP, bP) = e(P, P)^{ab}\f$
+  mpz_set_ui(scalar, a * b);
+  complex_modPow(&expected, base, scalar, ec.fieldOrder);
+  ASSERT(complex_isEquals(result, expected));
+
+  affine_destroy(p);
+  affine_destroy(aP);
+  affine_destroy(bP);
+  complex_destroyMany(3, result, base, expected);
+  ellipticCurveContext_destroy(context);
+  ellipticCurve_destroy(ec);
+  mpz_clears(subgroupOrder, scalar, NULL);
+
+  PASS();
+}
+
+TEST prepared_pairing_should_agree_with_the_pairing(const long n,
+                                                    const long m) {
+  // Given
+  mpz_t subgroupOrder, scalar;
+  mpz_init_set_ui(subgroupOrder, 11);
+  mpz_init(scalar);
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 131);
+  EllipticCurveContext context;
+  ASSERT_EQ(ellipticCurveContext_init(&context, ec, subgroupOrder),
+            CRYPTID_SUCCESS);
+
+  AffinePoint generator, a, b;
+  affine_initLong(&generator, 98, 58);
+  mpz_set_si(scalar, n);
+  ASSERT_EQ(affine_wNAFMultiply(&a, generator, scalar, &context),
+            CRYPTID_SUCCESS);
+  mpz_set_si(scalar, m);
+  ASSERT_EQ(affine_wNAFMultiply(&b, generator, scalar, &context),
+            CRYPTID_SUCCESS);
+
+  PreparedPairingArgument prepared;
+  ASSERT_EQ(preparedPairingArgument_init(&prepared, a, &context),
+            CRYPTID_SUCCESS);
+
+  // When
+  Complex result;
+  CryptidStatus status =
+      tate_performPreparedPairing(&result, &prepared, b, &context);
+
+  // Then
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+  Complex expected;
+  ASSERT_EQ(tate_performPairing(&expected, a, b, &context), CRYPTID_SUCCESS);
+  ASSERT(complex_isEquals(result, expected));
+
+  preparedPairingArgument_destroy(prepared);
+  affine_destroy(generator);
+  affine_destroy(a);
+  affine_destroy(b);
+  complex_destroyMany(2, result, expected);
+  ellipticCurveContext_destroy(context);
+  ellipticCurve_destroy(ec);
+  mpz_clears(subgroupOrder, scalar, NULL);
+
+  PASS();
+}
+
+TEST RFC_5091_prepared_pairing_should_work(void) {
+  // Given
+  mpz_t subgroupOrder, p, zero, one, ax, ay, bx, by;
+  mpz_inits(subgroupOrder, p, ax, ay, bx, by, NULL);
+  mpz_init_set_ui(zero, 0);
+  mpz_init_set_ui(one, 1);
+
+  mpz_set_str(subgroupOrder, "fffffffffffffffffffffffffffbffff", 16);
+  mpz_set_str(p, "bffffffffffffffffffffffffffcffff3", 16);
+  mpz_set_str(ax, "489a03c58dcf7fcfc97e99ffef0bb4634", 16);
+  mpz_set_str(ay, "510c6972d795ec0c2b081b81de767f808", 16);
+  mpz_set_str(bx, "40e98b9382e0b1fa6747dcb1655f54f75", 16);
+  mpz_set_str(by, "b497a6a02e7611511d0db2ff133b32a3f", 16);
+  AffinePoint a, b;
+  affine_init(&a, ax, ay);
+  affine_init(&b, bx, by);
+
+  EllipticCurve ec;
+  ellipticCurve_init(&ec, zero, one, p);
+  EllipticCurveContext context;
+  ASSERT_EQ(ellipticCurveContext_init(&context, ec, subgroupOrder),
+            CRYPTID_SUCCESS);
+
+  PreparedPairingArgument prepared;
+  ASSERT_EQ(preparedPairingArgument_init(&prepared, b, &context),
+            CRYPTID_SUCCESS);
+
+  // When
+  Complex result;
+  CryptidStatus status =
+      tate_performPreparedPairing(&result, &prepared, a, &context);
+
+  // Then
+  // The pairing is symmetric, so preparing the second argument works as well.
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+  Complex expected;
+  ASSERT_EQ(tate_performPairing(&expected, a, b, &context), CRYPTID_SUCCESS);
+  ASSERT(complex_isEquals(result, expected));
+
+  preparedPairingArgument_destroy(prepared);
+  affine_destroy(a);
+  affine_destroy(b);
+  complex_destroyMany(2, result, expected);
+  ellipticCurveContext_destroy(context);
+  ellipticCurve_destroy(ec);
+  mpz_clears(subgroupOrder, p, zero, one, ax, ay, bx, by, NULL);
+
+  PASS();
+}
+
+TEST multi_pairing_should_be_the_product_of_the_pairings(const size_t count) {
+  // Given
+  mpz_t subgroupOrder, scalar, fieldOrder;
+  mpz_init_set_ui(subgroupOrder, 11);
+  mpz_init_set_ui(fieldOrder, 131);
+  mpz_init(scalar);
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 131);
+  EllipticCurveContext context;
+  ASSERT_EQ(ellipticCurveContext_init(&context, ec, subgroupOrder),
+            CRYPTID_SUCCESS);
+
+  AffinePoint generator;
+  affine_initLong(&generator, 98, 58);
+
+  // The multiples \f$(2i + 1)P\f$ and \f$(3i + 2)P\f$, the latter reaching
+  // the point at infinity for \f$i = 3\f$.
+  AffinePoint ps[count], bs[count];
+  for (size_t i = 0; i < count; ++i) {
+    mpz_set_ui(scalar, 2 * i + 1);
+    ASSERT_EQ(affine_wNAFMultiply(&ps[i], generator, scalar, &context),
+              CRYPTID_SUCCESS);
+    mpz_set_ui(scalar, 3 * i + 2);
+    ASSERT_EQ(affine_wNAFMultiply(&bs[i], generator, scalar, &context),
+              CRYPTID_SUCCESS);
+  }
+
+  // When
+  Complex result;
+  CryptidStatus status =
+      tate_performMultiPairing(&result, ps, bs, count, &context);
+
+  // Then
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+  Complex expected;
+  complex_initLong(&expected, 1, 0);
+  for (size_t i = 0; i < count; ++i) {
+    Complex pairing;
+    ASSERT_EQ(tate_performPairing(&pairing, ps[i], bs[i], &context),
+              CRYPTID_SUCCESS);
+    complex_modMulInto(&expected, &expected, &pairing, fieldOrder);
+    complex_destroy(pairing);
+  }
+  ASSERT(complex_isEquals(result, expected));
+
+  for (size_t i = 0; i < count; ++i) {
+    affine_destroy(ps[i]);
+    affine_destroy(bs[i]);
+  }
+  affine_destroy(generator);
+  complex_destroyMany(2, result, expected);
+  ellipticCurveContext_destroy(context);
+  ellipticCurve_destroy(ec);
+  mpz_clears(subgroupOrder, scalar, fieldOrder, NULL);
+
+  PASS();
+}
+
+TEST pairing_batch_should_agree_with_the_pairings(const size_t count) {
+  // Given
+  mpz_t subgroupOrder, scalar;
+  mpz_init_set_ui(subgroupOrder, 11);
+  mpz_init(scalar);
+  EllipticCurve ec;
+  ellipticCurve_initLong(&ec, 0, 1, 131);
+  EllipticCurveContext context;
+  ASSERT_EQ(ellipticCurveContext_init(&context, ec, subgroupOrder),
+            CRYPTID_SUCCESS);
+
+  AffinePoint generator;
+  affine_initLong(&generator, 98, 58);
+
+  // The multiples \f$(2i + 1)P\f$ and \f$(3i + 2)P\f$, reaching the point
+  // at infinity for \f$i = 5\f$ and \f$i = 3\f$.
+  AffinePoint ps[count], bs[count];
+  for (size_t i = 0; i < count; ++i) {
+    mpz_set_ui(scalar, 2 * i + 1);
+    ASSERT_EQ(affine_wNAFMultiply(&ps[i], generator, scalar, &context),
+              CRYPTID_SUCCESS);
+    mpz_set_ui(scalar, 3 * i + 2);
+    ASSERT_EQ(affine_wNAFMultiply(&bs[i], generator, scalar, &context),
+              CRYPTID_SUCCESS);
+  }
+
+  // When
+  Complex results[count];
+  CryptidStatus status =
+      tate_performPairingBatch(results, ps, bs, count, &context);
+
+  // Then
+  ASSERT_EQ(status, CRYPTID_SUCCESS);
+  for (size_t i = 0; i < count; ++i) {
+    Complex expected;
+    ASSERT_EQ(tate_performPairing(&expected, ps[i], bs[i], &context),
+              CRYPTID_SUCCESS);
+    ASSERT(complex_isEquals(results[i], expected));
+    complex_destroyMany(2, results[i], expected);
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    affine_destroy(ps[i]);
+    affine_destroy(bs[i]);
+  }
+  affine_destroy(generator);
+  ellipticCurveContext_destroy(context);
+  ellipticCurve_destroy(ec);
+  mpz_clears(subgroupOrder, scalar, NULL);
+
+  PASS();
+}
+
 SUITE(tate_pairing_suite) {
   {
     Complex expected[11];
@@ -118,6 +376,27 @@ SUITE(tate_pairing_suite) {
   }
 
   RUN_TEST(RFC_5091_tate_pairing_should_work);
+
+  for (unsigned long a = 1; a < 11; ++a) {
+    for (unsigned long b = 1; b < 11; ++b) {
+      RUN_TESTp(tate_pairing_should_be_bilinear, a, b);
+    }
+  }
+
+  for (long n = 1; n <= 11; ++n) {
+    RUN_TESTp(prepared_pairing_should_agree_with_the_pairing, n, 12 - n);
+    RUN_TESTp(prepared_pairing_should_agree_with_the_pairing, n, n);
+  }
+
+  RUN_TEST(RFC_5091_prepared_pairing_should_work);
+
+  for (size_t count = 1; count <= 5; ++count) {
+    RUN_TESTp(multi_pairing_should_be_the_product_of_the_pairings, count);
+  }
+
+  for (size_t count = 1; count <= 6; ++count) {
+    RUN_TESTp(pairing_batch_should_agree_with_the_pairings, count);
+  }
 }
 
 GREATEST_MAIN_DEFS();
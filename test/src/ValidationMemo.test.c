@@ -0,0 +1,138 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "greatest.h"
+
+#include "elliptic/EllipticCurve.h"
+#include "util/ValidationMemo.h"
+
+static void computeKeyOfLong(ValidationMemoKey *key, const char *const domain,
+                             const long value) {
+  mpz_t number;
+  mpz_init_set_si(number, value);
+
+  const mpz_srcptr values[] = {number};
+  validationMemo_computeKey(key, domain, values, 1);
+
+  mpz_clear(number);
+}
+
+static int isKeyEqual(const ValidationMemoKey *a, const ValidationMemoKey *b) {
+  return !memcmp(a->digest, b->digest, VALIDATION_MEMO_KEY_LENGTH);
+}
+
+TEST keys_should_depend_on_the_domain_and_the_values(void) {
+  // Given
+  ValidationMemoKey key, sameKey, otherDomainKey, otherValueKey, negativeKey;
+
+  // When
+  computeKeyOfLong(&key, "domain", 7919);
+  computeKeyOfLong(&sameKey, "domain", 7919);
+  computeKeyOfLong(&otherDomainKey, "other", 7919);
+  computeKeyOfLong(&otherValueKey, "domain", 7907);
+  computeKeyOfLong(&negativeKey, "domain", -7919);
+
+  // Then
+  ASSERT(isKeyEqual(&key, &sameKey));
+  ASSERT_FALSE(isKeyEqual(&key, &otherDomainKey));
+  ASSERT_FALSE(isKeyEqual(&key, &otherValueKey));
+  ASSERT_FALSE(isKeyEqual(&key, &negativeKey));
+
+  PASS();
+}
+
+TEST remembered_keys_should_be_known_until_flushed(void) {
+  // Given
+  validationMemo_flush();
+
+  ValidationMemoKey key, otherKey;
+  computeKeyOfLong(&key, "domain", 7919);
+  computeKeyOfLong(&otherKey, "domain", 7907);
+
+  // When
+  validationMemo_rememberValid(&key);
+
+  // Then
+  ASSERT(validationMemo_isKnownValid(&key));
+  ASSERT_FALSE(validationMemo_isKnownValid(&otherKey));
+
+  // When
+  validationMemo_flush();
+
+  // Then
+  ASSERT_FALSE(validationMemo_isKnownValid(&key));
+
+  PASS();
+}
+
+TEST oldest_key_should_be_evicted_when_full(void) {
+  // Given
+  validationMemo_flush();
+
+  ValidationMemoKey key;
+  for (long i = 0; i <= VALIDATION_MEMO_CAPACITY; i++) {
+    computeKeyOfLong(&key, "domain", i);
+    validationMemo_rememberValid(&key);
+  }
+
+  // When
+  ValidationMemoKey oldestKey, secondOldestKey;
+  computeKeyOfLong(&oldestKey, "domain", 0);
+  computeKeyOfLong(&secondOldestKey, "domain", 1);
+
+  // Then
+  ASSERT_FALSE(validationMemo_isKnownValid(&oldestKey));
+  ASSERT(validationMemo_isKnownValid(&secondOldestKey));
+  ASSERT(validationMemo_isKnownValid(&key));
+
+  validationMemo_flush();
+
+  PASS();
+}
+
+TEST curve_validation_should_only_remember_valid_curves(const long fieldOrder,
+                                                        const int isValid) {
+  // Given
+  validationMemo_flush();
+
+  EllipticCurve ellipticCurve;
+  ellipticCurve_initLong(&ellipticCurve, 0, 1, fieldOrder);
+
+  ValidationMemoKey key;
+  computeKeyOfLong(&key, "EllipticCurve.fieldOrder", fieldOrder);
+
+  // When
+  CryptidValidationResult result = ellipticCurve_isTypeOne(ellipticCurve);
+  CryptidValidationResult memoizedResult =
+      ellipticCurve_isTypeOne(ellipticCurve);
+
+  // Then
+  ASSERT_EQ(result, isValid);
+  ASSERT_EQ(memoizedResult, isValid);
+  ASSERT_EQ(validationMemo_isKnownValid(&key), isValid);
+
+  ellipticCurve_destroy(ellipticCurve);
+  validationMemo_flush();
+
+  PASS();
+}
+
+SUITE(validation_memo_suite) {
+  RUN_TEST(keys_should_depend_on_the_domain_and_the_values);
+  RUN_TEST(remembered_keys_should_be_known_until_flushed);
+  RUN_TEST(oldest_key_should_be_evicted_when_full);
+  RUN_TESTp(curve_validation_should_only_remember_valid_curves, 7919, 1);
+  RUN_TESTp(curve_validation_should_only_remember_valid_curves, 7917, 0);
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv) {
+  GREATEST_MAIN_BEGIN();
+
+  RUN_SUITE(validation_memo_suite);
+
+  GREATEST_MAIN_END();
+}